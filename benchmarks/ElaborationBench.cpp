@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include <benchmark/benchmark.h>
+
+#include "slang/ast/Compilation.h"
+#include "slang/syntax/SyntaxTree.h"
+
+using namespace slang;
+using namespace slang::ast;
+using namespace slang::syntax;
+
+// End-to-end elaboration of a checked-in synthetic design. The syntax tree
+// is parsed once up front so that this measures elaboration alone; parse
+// rate has its own benchmark.
+static void elaborateDesign(benchmark::State& state) {
+    auto result = SyntaxTree::fromFile("data/elab.sv");
+    if (!result) {
+        state.SkipWithError("failed to load data/elab.sv -- run from the build folder");
+        return;
+    }
+
+    auto tree = *result;
+    for (auto _ : state) {
+        Compilation compilation;
+        compilation.addSyntaxTree(tree);
+        auto& diags = compilation.getAllDiagnostics();
+        benchmark::DoNotOptimize(diags);
+    }
+}
+BENCHMARK(elaborateDesign)->Unit(benchmark::kMillisecond);
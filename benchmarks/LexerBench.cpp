@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "slang/diagnostics/Diagnostics.h"
+#include "slang/parsing/Lexer.h"
+#include "slang/text/SourceManager.h"
+#include "slang/util/BumpAllocator.h"
+
+using namespace slang;
+using namespace slang::parsing;
+
+// Builds a synthetic source file that exercises a representative mix of
+// token kinds: identifiers, keywords, operators, numeric literals in
+// several bases, strings, and both comment styles.
+static std::string makeLexerSource(int lines) {
+    std::string result;
+    result.reserve(size_t(lines) * 64);
+    for (int i = 0; i < lines; i++) {
+        switch (i % 5) {
+            case 0:
+                result += "logic [31:0] sig_" + std::to_string(i) + "; // trailing comment\n";
+                break;
+            case 1:
+                result += "assign sig_" + std::to_string(i) + " = (a + b) * c - 32'habcdef12;\n";
+                break;
+            case 2:
+                result += "parameter string P" + std::to_string(i) + " = \"hello world\";\n";
+                break;
+            case 3:
+                result += "always_ff @(posedge clk) q <= d ? 4'b1010 : 4'o17; /* block */\n";
+                break;
+            case 4:
+                result += "if (x !== y && z >>> 2 == 3.14159e-2) count++;\n";
+                break;
+        }
+    }
+    return result;
+}
+
+static void lexerThroughput(benchmark::State& state) {
+    auto text = makeLexerSource(int(state.range(0)));
+    SourceManager sourceManager;
+    auto buffer = sourceManager.assignText("bench.sv", text);
+
+    for (auto _ : state) {
+        BumpAllocator alloc;
+        Diagnostics diagnostics;
+        Lexer lexer(buffer, alloc, diagnostics);
+
+        Token token;
+        do {
+            token = lexer.lex();
+            benchmark::DoNotOptimize(token);
+        } while (token.kind != TokenKind::EndOfFile);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+}
+BENCHMARK(lexerThroughput)->Arg(1000)->Arg(10000);
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "slang/ast/Compilation.h"
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/ast/symbols/InstanceSymbols.h"
+#include "slang/syntax/SyntaxTree.h"
+
+using namespace slang;
+using namespace slang::ast;
+using namespace slang::syntax;
+
+// Builds a module with many members so that name lookup is measured against
+// a realistically populated scope rather than a toy one.
+static std::string makeLookupSource(int members) {
+    std::string result = "module top;\n";
+    for (int i = 0; i < members; i++)
+        result += "    int member_" + std::to_string(i) + ";\n";
+    result += "endmodule\n";
+    return result;
+}
+
+static void scopeFind(benchmark::State& state) {
+    Compilation compilation;
+    compilation.addSyntaxTree(SyntaxTree::fromText(makeLookupSource(int(state.range(0)))));
+
+    auto& body = compilation.getRoot().topInstances[0]->body;
+
+    std::vector<std::string> names;
+    for (int i = 0; i < state.range(0); i++)
+        names.push_back("member_" + std::to_string(i));
+
+    size_t index = 0;
+    for (auto _ : state) {
+        auto symbol = body.find(names[index]);
+        benchmark::DoNotOptimize(symbol);
+        if (++index == names.size())
+            index = 0;
+    }
+}
+BENCHMARK(scopeFind)->Arg(10)->Arg(1000);
+
+static void hierarchicalLookup(benchmark::State& state) {
+    Compilation compilation;
+    compilation.addSyntaxTree(SyntaxTree::fromText(R"(
+module leaf;
+    int x;
+endmodule
+
+module mid;
+    leaf l();
+endmodule
+
+module top;
+    mid m1();
+    mid m2();
+endmodule
+)"));
+
+    auto& root = compilation.getRoot();
+    for (auto _ : state) {
+        auto symbol = root.lookupName("top.m2.l.x");
+        benchmark::DoNotOptimize(symbol);
+    }
+}
+BENCHMARK(hierarchicalLookup);
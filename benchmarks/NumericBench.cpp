@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include <benchmark/benchmark.h>
+
+#include "slang/numeric/SVInt.h"
+
+using namespace slang;
+
+// Widths are chosen to hit the single-word fast path (32/64), a small
+// multi-word case (128), and a wide value where algorithmic costs dominate.
+static SVInt makeOperand(bitwidth_t width, uint64_t seed) {
+    SVInt value(width, seed, false);
+    for (bitwidth_t shift = 64; shift < width; shift *= 2)
+        value = value | value.shl(shift);
+    return value;
+}
+
+static void svintAdd(benchmark::State& state) {
+    auto width = bitwidth_t(state.range(0));
+    SVInt a = makeOperand(width, 0x0123456789abcdefULL);
+    SVInt b = makeOperand(width, 0xfedcba9876543210ULL);
+
+    for (auto _ : state) {
+        SVInt result = a + b;
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(svintAdd)->Arg(32)->Arg(64)->Arg(128)->Arg(1024);
+
+static void svintMul(benchmark::State& state) {
+    auto width = bitwidth_t(state.range(0));
+    SVInt a = makeOperand(width, 0x0123456789abcdefULL);
+    SVInt b = makeOperand(width, 0x00000000deadbeefULL);
+
+    for (auto _ : state) {
+        SVInt result = a * b;
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(svintMul)->Arg(32)->Arg(64)->Arg(128)->Arg(1024);
+
+static void svintDiv(benchmark::State& state) {
+    auto width = bitwidth_t(state.range(0));
+    SVInt a = makeOperand(width, 0xfedcba9876543210ULL);
+    SVInt b = makeOperand(width, 0x0000000012345678ULL);
+
+    for (auto _ : state) {
+        SVInt result = a / b;
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(svintDiv)->Arg(32)->Arg(64)->Arg(128)->Arg(1024);
+
+static void svintToString(benchmark::State& state) {
+    auto width = bitwidth_t(state.range(0));
+    SVInt a = makeOperand(width, 0x0123456789abcdefULL);
+
+    for (auto _ : state) {
+        auto result = a.toString(LiteralBase::Decimal, true);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(svintToString)->Arg(64)->Arg(1024);
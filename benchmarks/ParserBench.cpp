@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "slang/syntax/SyntaxTree.h"
+
+using namespace slang;
+using namespace slang::syntax;
+
+// Builds a synthetic module with a mix of declarations, procedural blocks,
+// and expressions so that parse rate reflects typical RTL rather than one
+// narrow grammar production.
+static std::string makeParserSource(int blocks) {
+    std::string result = "module bench(input logic clk, input logic rst, output logic done);\n";
+    for (int i = 0; i < blocks; i++) {
+        auto n = std::to_string(i);
+        result += "    logic [15:0] data_" + n + ";\n";
+        result += "    always_ff @(posedge clk or posedge rst) begin\n";
+        result += "        if (rst)\n";
+        result += "            data_" + n + " <= '0;\n";
+        result += "        else if (data_" + n + " < 16'd1000)\n";
+        result += "            data_" + n + " <= data_" + n + " + 16'd" + n + ";\n";
+        result += "    end\n";
+        result += "    function automatic logic [15:0] f_" + n + "(logic [15:0] x);\n";
+        result += "        return (x << 2) ^ (x >> 1) + 16'h" + std::to_string(i % 10) + ";\n";
+        result += "    endfunction\n";
+    }
+    result += "endmodule\n";
+    return result;
+}
+
+static void parseRate(benchmark::State& state) {
+    auto text = makeParserSource(int(state.range(0)));
+
+    for (auto _ : state) {
+        auto tree = SyntaxTree::fromText(text);
+        benchmark::DoNotOptimize(tree);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+}
+BENCHMARK(parseRate)->Arg(100)->Arg(1000);
@@ -0,0 +1,80 @@
+// Synthetic design for the end-to-end elaboration benchmark. It fans out a
+// parameterized hierarchy with generate loops so that elaboration has to
+// create many instances, resolve parameters, and evaluate constants.
+
+module alu #(parameter int WIDTH = 8) (
+    input  logic [WIDTH-1:0] a,
+    input  logic [WIDTH-1:0] b,
+    input  logic [1:0]       op,
+    output logic [WIDTH-1:0] y
+);
+    always_comb begin
+        case (op)
+            2'b00: y = a + b;
+            2'b01: y = a - b;
+            2'b10: y = a & b;
+            2'b11: y = a ^ b;
+        endcase
+    end
+endmodule
+
+module lane #(parameter int WIDTH = 8, parameter int DEPTH = 4) (
+    input  logic             clk,
+    input  logic [WIDTH-1:0] din,
+    output logic [WIDTH-1:0] dout
+);
+    logic [WIDTH-1:0] stage[DEPTH+1];
+    assign stage[0] = din;
+
+    for (genvar i = 0; i < DEPTH; i++) begin : stages
+        logic [WIDTH-1:0] result;
+        alu #(.WIDTH(WIDTH)) u_alu(
+            .a(stage[i]),
+            .b(WIDTH'(i + 1)),
+            .op(2'(i)),
+            .y(result)
+        );
+
+        always_ff @(posedge clk)
+            stage[i + 1] <= result;
+    end
+
+    assign dout = stage[DEPTH];
+endmodule
+
+module cluster #(parameter int LANES = 8) (
+    input  logic        clk,
+    input  logic [63:0] din,
+    output logic [63:0] dout
+);
+    for (genvar i = 0; i < LANES; i++) begin : lanes
+        localparam int W = 8 + (i % 3) * 8;
+        logic [W-1:0] lo;
+        lane #(.WIDTH(W), .DEPTH(4 + i % 4)) u_lane(
+            .clk(clk),
+            .din(din[W-1:0]),
+            .dout(lo)
+        );
+
+        assign dout[(i % 8) * 8 +: 8] = 8'(lo);
+    end
+endmodule
+
+module top(
+    input  logic        clk,
+    input  logic [63:0] din,
+    output logic [63:0] dout
+);
+    logic [63:0] link[9];
+    assign link[0] = din;
+
+    for (genvar i = 0; i < 8; i++) begin : clusters
+        cluster #(.LANES(8)) u_cluster(
+            .clk(clk),
+            .din(link[i]),
+            .dout(link[i + 1])
+        );
+    end
+
+    assign dout = link[8];
+endmodule
@@ -6,6 +6,7 @@
 #include "PyVisitors.h"
 #include "pyslang.h"
 
+#include "slang/ast/ASTQuery.h"
 #include "slang/ast/Compilation.h"
 #include "slang/ast/EvalContext.h"
 #include "slang/ast/SystemSubroutine.h"
@@ -62,7 +63,13 @@ void registerAST(py::module_& m) {
         .def_property("queueTarget", &EvalContext::getQueueTarget, &EvalContext::setQueueTarget);
 
     py::class_<EvalContext::Frame>(evalCtx, "Frame")
-        .def_readonly("temporaries", &EvalContext::Frame::temporaries)
+        .def_property_readonly("temporaries",
+                               [](const EvalContext::Frame& frame) {
+                                   std::map<const ValueSymbol*, ConstantValue> result;
+                                   for (auto [symbol, value] : frame.temporaries)
+                                       result.emplace(symbol, *value);
+                                   return result;
+                               })
         .def_readonly("subroutine", &EvalContext::Frame::subroutine)
         .def_readonly("callLocation", &EvalContext::Frame::callLocation)
         .def_readonly("lookupLocation", &EvalContext::Frame::lookupLocation);
@@ -482,4 +489,19 @@ void registerAST(py::module_& m) {
         .def_property_readonly("filter",
                                [](const BinSelectWithFilterExpr& self) { return &self.filter; })
         .def_readonly("matchesExpr", &BinSelectWithFilterExpr::matchesExpr);
+
+    py::class_<QueryPattern>(m, "QueryPattern")
+        .def(py::init<>())
+        .def_readwrite("kinds", &QueryPattern::kinds)
+        .def_readwrite("namePattern", &QueryPattern::namePattern)
+        .def_readwrite("typePredicate", &QueryPattern::typePredicate)
+        .def("matches", &QueryPattern::matches, "symbol"_a);
+
+    py::class_<ASTQueryEngine>(m, "ASTQueryEngine")
+        .def(py::init<>())
+        .def("addQuery", &ASTQueryEngine::addQuery, "pattern"_a, "callback"_a)
+        .def("run", &ASTQueryEngine::run, "root"_a)
+        .def("matchSymbol", &ASTQueryEngine::matchSymbol, "symbol"_a)
+        .def_static("findAll", &ASTQueryEngine::findAll, "root"_a, "pattern"_a,
+                    py::return_value_policy::reference);
 }
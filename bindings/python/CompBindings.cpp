@@ -7,6 +7,7 @@
 
 #include "slang/ast/Compilation.h"
 #include "slang/ast/ScriptSession.h"
+#include "slang/ast/SymbolSearchIndex.h"
 #include "slang/ast/SystemSubroutine.h"
 #include "slang/ast/symbols/AttributeSymbol.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
@@ -99,6 +100,14 @@ void registerCompilation(py::module_& m) {
         .def("getParseDiagnostics", &Compilation::getParseDiagnostics, byrefint)
         .def("getSemanticDiagnostics", &Compilation::getSemanticDiagnostics, byrefint)
         .def("getAllDiagnostics", &Compilation::getAllDiagnostics, byrefint)
+        .def("getDesignHash", [](Compilation& self) { return self.getDesignHash(); })
+        .def(
+            "resolveHierarchicalPaths",
+            [](Compilation& self, const std::vector<std::string>& paths) {
+                std::vector<std::string_view> views(paths.begin(), paths.end());
+                return self.resolveHierarchicalPaths(views);
+            },
+            byrefint, "paths"_a)
         .def("addDiagnostics", &Compilation::addDiagnostics, "diagnostics"_a)
         .def("getCompilationUnit", &Compilation::getCompilationUnit, byrefint, "syntax"_a)
         .def("getCompilationUnits", &Compilation::getCompilationUnits, byrefint)
@@ -155,6 +164,15 @@ void registerCompilation(py::module_& m) {
         .def("evalStatement", &ScriptSession::evalStatement, "expr"_a)
         .def("getDiagnostics", &ScriptSession::getDiagnostics);
 
+    py::class_<SymbolSearchIndex> searchIndex(m, "SymbolSearchIndex");
+    searchIndex.def(py::init<Compilation&>(), py::keep_alive<1, 2>(), "compilation"_a)
+        .def_property_readonly("size", &SymbolSearchIndex::size)
+        .def("lookup", &SymbolSearchIndex::lookup, "query"_a, "maxResults"_a = 100);
+
+    py::class_<SymbolSearchIndex::Result>(searchIndex, "Result")
+        .def_readonly("symbol", &SymbolSearchIndex::Result::symbol)
+        .def_readonly("score", &SymbolSearchIndex::Result::score);
+
     py::class_<CommandLine::ParseOptions>(m, "CommandLineOptions")
         .def(py::init<>())
         .def_readwrite("supportsComments", &CommandLine::ParseOptions::supportComments)
@@ -95,7 +95,7 @@ void registerNumeric(py::module_& m) {
         .def("__bool__", [](const logic_t& self) { return bool(self); })
         .def("__repr__", [](const logic_t& self) { return fmt::format("{}", self.toChar()); });
 
-    py::class_<SVInt>(m, "SVInt")
+    py::class_<SVInt>(m, "SVInt", py::buffer_protocol())
         .def(py::init<>())
         .def(py::init<logic_t>(), "bit"_a)
         .def(py::init<bitwidth_t, uint64_t, bool>(), "bits"_a, "value"_a, "isSigned"_a)
@@ -106,6 +106,14 @@ void registerNumeric(py::module_& m) {
         .def_property_readonly("isSigned", &SVInt::isSigned)
         .def_property_readonly("hasUnknown", &SVInt::hasUnknown)
         .def_property_readonly("bitWidth", &SVInt::getBitWidth)
+        // Zero-copy (numpy compatible) view of the raw 64-bit words backing
+        // the value. When hasUnknown is set, the second half of the words
+        // holds the unknown-bit flags for the first half.
+        .def_buffer([](SVInt& self) {
+            return py::buffer_info(self.getRawData(), sizeof(uint64_t),
+                                   py::format_descriptor<uint64_t>::format(), 1,
+                                   {size_t(self.getNumWords())}, {sizeof(uint64_t)}, true);
+        })
         .def_static("createFillX", &SVInt::createFillX, "bitWidth"_a, "isSigned"_a)
         .def_static("createFillZ", &SVInt::createFillZ, "bitWidth"_a, "isSigned"_a)
         .def_static("fromDigits", &SVInt::fromDigits, "bits"_a, "base"_a, "isSigned"_a,
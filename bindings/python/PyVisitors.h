@@ -7,7 +7,11 @@
 
 #include "pyslang.h"
 
+#include <bitset>
+#include <vector>
+
 #include "slang/ast/ASTVisitor.h"
+#include "slang/ast/Symbol.h"
 
 enum class VisitAction {
     Advance,
@@ -53,3 +57,94 @@ void pyASTVisit(const T& t, py::object f) {
     PyASTVisitor visitor{f};
     t.visit(visitor);
 }
+
+/// A set of symbol kinds used to filter batch visitation, stored as a bitset
+/// so membership checks don't cost anything during the walk.
+struct SymbolKindFilter {
+    std::bitset<SymbolKind_traits::values.size()> kinds;
+    bool matchAll = false;
+
+    explicit SymbolKindFilter(const std::vector<SymbolKind>& wanted) {
+        if (wanted.empty()) {
+            matchAll = true;
+            return;
+        }
+        for (auto kind : wanted)
+            kinds.set(static_cast<size_t>(kind));
+    }
+
+    bool matches(const Symbol& symbol) const {
+        return matchAll || kinds[static_cast<size_t>(symbol.kind)];
+    }
+};
+
+struct PySymbolCollector : public ASTVisitor<PySymbolCollector, false, false> {
+    static inline constexpr auto doc =
+        "Collect all symbols matching the given kinds in one call.\n\n"
+        "The entire walk runs in C++ and a single list of the matching symbols "
+        "is returned, instead of crossing the Python boundary once per node. "
+        "An empty kinds list collects every symbol.";
+
+    SymbolKindFilter filter;
+    std::vector<const Symbol*> results;
+
+    explicit PySymbolCollector(const std::vector<SymbolKind>& kinds) : filter(kinds) {}
+
+    template<typename T>
+    void handle(const T& t) {
+        if constexpr (std::is_base_of_v<Symbol, T>) {
+            if (filter.matches(t))
+                results.push_back(&t);
+        }
+        this->visitDefault(t);
+    }
+};
+
+template<typename T>
+std::vector<const Symbol*> pyASTCollect(const T& t, const std::vector<SymbolKind>& kinds) {
+    PySymbolCollector visitor{kinds};
+    t.visit(visitor);
+    return visitor.results;
+}
+
+struct PyMatchingVisitor : public ASTVisitor<PyMatchingVisitor, false, false> {
+    static inline constexpr auto doc =
+        "Visit a pyslang object with a callback f invoked only on symbols "
+        "matching the given kinds.\n\n"
+        "The walk itself runs in C++; f is called once per matching symbol. "
+        "The same pyslang.VisitAction return values as for visit() apply, "
+        "except that pyslang.VisitAction.Skip only takes effect on symbols "
+        "that matched. An empty kinds list matches every symbol.";
+
+    py::object f;
+    SymbolKindFilter filter;
+    bool interrupted = false;
+
+    PyMatchingVisitor(const std::vector<SymbolKind>& kinds, py::object f) :
+        f{std::move(f)}, filter(kinds) {}
+
+    template<typename T>
+    void handle(const T& t) {
+        if (interrupted)
+            return;
+
+        if constexpr (std::is_base_of_v<Symbol, T>) {
+            if (filter.matches(t)) {
+                py::object result = f(&t);
+                if (result.equal(py::cast(VisitAction::Interrupt))) {
+                    interrupted = true;
+                    return;
+                }
+                if (result.equal(py::cast(VisitAction::Skip)))
+                    return;
+            }
+        }
+        this->visitDefault(t);
+    }
+};
+
+template<typename T>
+void pyASTVisitMatching(const T& t, const std::vector<SymbolKind>& kinds, py::object f) {
+    PyMatchingVisitor visitor{kinds, std::move(f)};
+    t.visit(visitor);
+}
@@ -133,6 +133,10 @@ void registerSymbols(py::module_& m) {
         .def("isDeclaredBefore",
              py::overload_cast<LookupLocation>(&Symbol::isDeclaredBefore, py::const_), "location"_a)
         .def("visit", &pyASTVisit<Symbol>, "f"_a, PyASTVisitor::doc)
+        .def("collectSymbols", &pyASTCollect<Symbol>, "kinds"_a = std::vector<SymbolKind>{},
+             byrefint, PySymbolCollector::doc)
+        .def("visitMatching", &pyASTVisitMatching<Symbol>, "kinds"_a, "f"_a,
+             PyMatchingVisitor::doc)
         .def("__repr__", [](const Symbol& self) {
             return fmt::format("Symbol(SymbolKind.{}, \"{}\")", toString(self.kind), self.name);
         });
@@ -431,7 +435,8 @@ void registerSymbols(py::module_& m) {
         .def_property_readonly("portList", &InstanceBodySymbol::getPortList)
         .def_property_readonly("definition", &InstanceBodySymbol::getDefinition)
         .def("findPort", &InstanceBodySymbol::findPort, byrefint, "portName"_a)
-        .def("hasSameType", &InstanceBodySymbol::hasSameType, "other"_a);
+        .def("hasSameType", &InstanceBodySymbol::hasSameType, "other"_a)
+        .def("getStructuralHash", &InstanceBodySymbol::getStructuralHash);
 
     py::class_<InstanceArraySymbol, Symbol, Scope>(m, "InstanceArraySymbol")
         .def_readonly("elements", &InstanceArraySymbol::elements)
@@ -489,7 +494,7 @@ void registerSymbols(py::module_& m) {
 
     py::class_<GenerateBlockArraySymbol, Symbol, Scope>(m, "GenerateBlockArraySymbol")
         .def_readonly("constructIndex", &GenerateBlockArraySymbol::constructIndex)
-        .def_readonly("entries", &GenerateBlockArraySymbol::entries)
+        .def_property_readonly("entries", &GenerateBlockArraySymbol::getEntries)
         .def_readonly("valid", &GenerateBlockArraySymbol::valid)
         .def_property_readonly("externalName", &GenerateBlockArraySymbol::getExternalName);
 
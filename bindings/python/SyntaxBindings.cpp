@@ -19,6 +19,10 @@ namespace fs = std::filesystem;
 
 namespace {
 
+struct RawTokenBuffer {
+    std::vector<RawToken> tokens;
+};
+
 struct PySyntaxVisitor : public PyVisitorBase<PySyntaxVisitor, SyntaxVisitor> {
     using PyVisitorBase::PyVisitorBase;
 
@@ -270,6 +274,29 @@ void registerSyntax(py::module_& m) {
         .def_readwrite("maxErrors", &LexerOptions::maxErrors)
         .def_readwrite("languageVersion", &LexerOptions::languageVersion);
 
+    // Zero-copy (numpy compatible) view of raw lexed tokens as an (N, 3)
+    // array of uint32 (offset, length, kind) rows.
+    py::class_<RawTokenBuffer>(m, "RawTokenBuffer", py::buffer_protocol())
+        .def("__len__", [](const RawTokenBuffer& self) { return self.tokens.size(); })
+        .def_buffer([](RawTokenBuffer& self) {
+            return py::buffer_info(self.tokens.data(), sizeof(uint32_t),
+                                   py::format_descriptor<uint32_t>::format(), 2,
+                                   {self.tokens.size(), size_t(3)},
+                                   {sizeof(RawToken), sizeof(uint32_t)}, true);
+        });
+
+    m.def(
+        "lexRawTokens",
+        [](std::string_view source, const LexerOptions& options) {
+            SmallVector<RawToken> tokens;
+            Lexer::lexRaw(source, tokens, options);
+
+            RawTokenBuffer result;
+            result.tokens.assign(tokens.begin(), tokens.end());
+            return result;
+        },
+        "source"_a, "options"_a = LexerOptions{});
+
     py::class_<PreprocessorOptions>(m, "PreprocessorOptions")
         .def(py::init<>())
         .def_readwrite("maxIncludeDepth", &PreprocessorOptions::maxIncludeDepth)
@@ -210,8 +210,16 @@ void registerUtil(py::module_& m) {
         .def_readonly("code", &Diagnostic::code)
         .def_readonly("location", &Diagnostic::location)
         .def_readonly("symbol", &Diagnostic::symbol)
-        .def_readonly("args", &Diagnostic::args)
-        .def_readonly("ranges", &Diagnostic::ranges)
+        .def_property_readonly("args",
+                               [](const Diagnostic& self) {
+                                   return std::vector<Diagnostic::Arg>(self.args.begin(),
+                                                                       self.args.end());
+                               })
+        .def_property_readonly("ranges",
+                               [](const Diagnostic& self) {
+                                   return std::vector<SourceRange>(self.ranges.begin(),
+                                                                   self.ranges.end());
+                               })
         .def("isError", &Diagnostic::isError)
         .def(py::self == py::self)
         .def(py::self != py::self);
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fmt-populate"
+  "CMakeFiles/fmt-populate-complete"
+  "fmt-populate-prefix/src/fmt-populate-stamp/fmt-populate-build"
+  "fmt-populate-prefix/src/fmt-populate-stamp/fmt-populate-configure"
+  "fmt-populate-prefix/src/fmt-populate-stamp/fmt-populate-download"
+  "fmt-populate-prefix/src/fmt-populate-stamp/fmt-populate-install"
+  "fmt-populate-prefix/src/fmt-populate-stamp/fmt-populate-mkdir"
+  "fmt-populate-prefix/src/fmt-populate-stamp/fmt-populate-patch"
+  "fmt-populate-prefix/src/fmt-populate-stamp/fmt-populate-test"
+  "fmt-populate-prefix/src/fmt-populate-stamp/fmt-populate-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/fmt-populate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+//! @file ASTQuery.h
+//! @brief Declarative queries over the elaborated AST
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "slang/ast/Symbol.h"
+#include "slang/util/Hash.h"
+#include "slang/util/Util.h"
+
+namespace slang::ast {
+
+class Type;
+
+/// @brief A declarative description of the symbols an AST query matches.
+///
+/// All specified constraints must hold for a symbol to match; constraints
+/// that are left empty match everything.
+struct SLANG_EXPORT QueryPattern {
+    /// The symbol kinds to match. An empty list matches all kinds.
+    std::vector<SymbolKind> kinds;
+
+    /// A wildcard pattern applied to the symbol name, where '*' matches any
+    /// sequence of characters and '?' matches any single character.
+    /// An empty pattern places no constraint on the name.
+    std::string namePattern;
+
+    /// If provided, only symbols that have a declared type satisfying the
+    /// predicate will match.
+    std::function<bool(const Type&)> typePredicate;
+
+    /// Returns true if the given symbol satisfies this pattern.
+    bool matches(const Symbol& symbol) const;
+};
+
+/// @brief Runs a batch of declarative queries over the AST in one traversal.
+///
+/// Analysis tools frequently need to find several unrelated sets of symbols
+/// in the same design, and walking the whole AST once per query quickly
+/// dominates their runtime. This engine compiles registered patterns into
+/// per-kind buckets so that a single design walk can dispatch matches for
+/// all of them, with each visited symbol only consulting the queries that
+/// could possibly match it.
+class SLANG_EXPORT ASTQueryEngine {
+public:
+    using QueryCallback = std::function<void(const Symbol&)>;
+
+    /// Registers a query to run during subsequent traversals.
+    /// @returns an identifier for the query, assigned sequentially from zero.
+    size_t addQuery(QueryPattern pattern, QueryCallback callback);
+
+    /// Visits every symbol underneath (and including) @a root exactly once
+    /// and invokes the callback of each registered query the symbol matches.
+    /// Callbacks for a given symbol are invoked in query registration order.
+    void run(const Symbol& root) const;
+
+    /// Invokes the callbacks of all registered queries that match the given
+    /// symbol, without traversing its children.
+    void matchSymbol(const Symbol& symbol) const;
+
+    /// Convenience helper that runs a single pattern over @a root and
+    /// collects the matching symbols.
+    static std::vector<const Symbol*> findAll(const Symbol& root, QueryPattern pattern);
+
+private:
+    struct Query {
+        QueryPattern pattern;
+        QueryCallback callback;
+    };
+
+    std::vector<Query> queries;
+
+    // The compiled traversal plan: query indices bucketed by the symbol kinds
+    // they can match. Queries with no kind constraint go in a separate list
+    // since they must be consulted for every symbol.
+    flat_hash_map<SymbolKind, std::vector<size_t>> kindBuckets;
+    std::vector<size_t> unkindedQueries;
+};
+
+} // namespace slang::ast
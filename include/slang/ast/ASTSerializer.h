@@ -13,6 +13,7 @@ namespace slang {
 
 class ConstantValue;
 class JsonWriter;
+class ThreadPool;
 
 } // namespace slang
 
@@ -24,6 +25,7 @@ class Compilation;
 class Constraint;
 class Expression;
 class Pattern;
+class Scope;
 class Statement;
 class Symbol;
 class TimingControl;
@@ -45,6 +47,18 @@ public:
     /// Serializes a symbol to JSON.
     void serialize(const Symbol& symbol, bool inMembersArray = false);
 
+    /// @brief Serializes a symbol to JSON, spreading the work across a
+    /// thread pool.
+    ///
+    /// This behaves like serialize() except that if the symbol is a scope,
+    /// its direct members are partitioned across the given pool and
+    /// serialized concurrently, each into its own in-memory buffer; the
+    /// buffers are stitched into the output in order. The design must be
+    /// fully elaborated before calling this (for example by gathering its
+    /// diagnostics first) since the concurrent workers must not mutate the
+    /// compilation.
+    void serializeParallel(const Symbol& symbol, ThreadPool& pool);
+
     /// Serializes an expression to JSON.
     void serialize(const Expression& expr);
 
@@ -170,8 +184,16 @@ private:
     template<typename T>
     void visit(const T& symbol, bool inMembersArray = false);
 
+    void serializeMembersParallel(const Scope& scope);
+
     Compilation& compilation;
     JsonWriter& writer;
+
+    // Set only during serializeParallel(); the members of the symbol being
+    // serialized at the top level are farmed out to the pool.
+    const Symbol* parallelRoot = nullptr;
+    ThreadPool* parallelPool = nullptr;
+
     bool includeAddrs = true;
     bool includeSourceInfo = false;
 };
@@ -507,4 +507,141 @@ decltype(auto) RandSeqProductionSymbol::ProdBase::visit(TVisitor& visitor, Args&
 
 /// @endcond
 
+/// A compact set of SymbolKind values, stored as a bitmask.
+class SymbolKindBitSet {
+public:
+    /// Adds the given kind to the set.
+    void add(SymbolKind kind) { words[index(kind)] |= bit(kind); }
+
+    /// Returns true if the given kind is in the set.
+    bool has(SymbolKind kind) const { return (words[index(kind)] & bit(kind)) != 0; }
+
+    /// Adds all kinds in @a other to this set.
+    void unionWith(const SymbolKindBitSet& other) {
+        words[0] |= other.words[0];
+        words[1] |= other.words[1];
+    }
+
+    /// Returns true if this set and @a other have at least one kind in common.
+    bool intersects(const SymbolKindBitSet& other) const {
+        return ((words[0] & other.words[0]) | (words[1] & other.words[1])) != 0;
+    }
+
+private:
+    static size_t index(SymbolKind kind) { return size_t(kind) / 64; }
+    static uint64_t bit(SymbolKind kind) { return uint64_t(1) << (size_t(kind) % 64); }
+
+    static_assert(SymbolKind_traits::values.size() <= 128);
+    uint64_t words[2] = {0, 0};
+};
+
+/// @brief An index of which symbol kinds appear transitively within each scope
+/// of a hierarchy.
+///
+/// The index is built with one full traversal; afterwards @a visitMatching can
+/// run a visitor that only cares about a handful of symbol kinds while
+/// skipping every subtree that contains none of them, which is much cheaper
+/// than a full walk when the interesting kinds are sparse. This is intended
+/// for analysis passes that traverse a fully elaborated design many times;
+/// the index is a snapshot and does not reflect symbols created after it
+/// was built.
+class HierarchyKindIndex {
+public:
+    /// Builds the index over the hierarchy rooted at the given symbol.
+    explicit HierarchyKindIndex(const Symbol& root) { build(root); }
+
+    /// Invokes @a func on every symbol under @a root whose kind is one of
+    /// @a Kinds, skipping subtrees that contain none of them. The callable
+    /// is invoked with the concrete symbol type and may ignore kinds it
+    /// isn't callable with. Note that only symbols are visited; a visitor
+    /// interested in statements or expressions should list the kinds of the
+    /// symbols that own them and descend from its callback.
+    template<SymbolKind... Kinds, typename TFunc>
+    void visitMatching(const Symbol& root, TFunc&& func) const {
+        SymbolKindBitSet interest;
+        (interest.add(Kinds), ...);
+        visitImpl(root, interest, func);
+    }
+
+private:
+    struct AsScope {
+        template<typename T>
+        const Scope* visit(const T& symbol) {
+            if constexpr (std::is_base_of_v<Scope, T>) {
+                return static_cast<const Scope*>(&symbol);
+            }
+            else {
+                (void)symbol;
+                return nullptr;
+            }
+        }
+    };
+
+    static const Scope* scopeOf(const Symbol& symbol) {
+        AsScope visitor;
+        return symbol.visit(visitor);
+    }
+
+    template<typename TFunc>
+    struct SingleDispatch {
+        TFunc& func;
+        template<typename T>
+        void visit(const T& t) {
+            if constexpr (std::is_invocable_v<TFunc&, const T&>)
+                func(t);
+        }
+    };
+
+    SymbolKindBitSet build(const Symbol& symbol) {
+        SymbolKindBitSet mask;
+        mask.add(symbol.kind);
+
+        if (symbol.kind == SymbolKind::Instance)
+            mask.unionWith(build(symbol.as<InstanceSymbol>().body));
+        else if (symbol.kind == SymbolKind::CheckerInstance)
+            mask.unionWith(build(symbol.as<CheckerInstanceSymbol>().body));
+        else if (symbol.kind == SymbolKind::GenericClassDef) {
+            for (auto&& spec : symbol.as<GenericClassDefSymbol>().specializations())
+                mask.unionWith(build(spec));
+        }
+
+        if (auto scope = scopeOf(symbol)) {
+            for (auto member : scope->membersArray())
+                mask.unionWith(build(*member));
+            scopeMasks[scope] = mask;
+        }
+
+        return mask;
+    }
+
+    template<typename TFunc>
+    void visitImpl(const Symbol& symbol, const SymbolKindBitSet& interest, TFunc& func) const {
+        if (interest.has(symbol.kind)) {
+            SingleDispatch<TFunc> dispatch{func};
+            symbol.visit(dispatch);
+        }
+
+        if (symbol.kind == SymbolKind::Instance)
+            visitImpl(symbol.as<InstanceSymbol>().body, interest, func);
+        else if (symbol.kind == SymbolKind::CheckerInstance)
+            visitImpl(symbol.as<CheckerInstanceSymbol>().body, interest, func);
+        else if (symbol.kind == SymbolKind::GenericClassDef) {
+            for (auto&& spec : symbol.as<GenericClassDefSymbol>().specializations())
+                visitImpl(spec, interest, func);
+        }
+
+        if (auto scope = scopeOf(symbol)) {
+            if (auto it = scopeMasks.find(scope);
+                it != scopeMasks.end() && !it->second.intersects(interest)) {
+                return;
+            }
+
+            for (auto member : scope->membersArray())
+                visitImpl(*member, interest, func);
+        }
+    }
+
+    flat_hash_map<const Scope*, SymbolKindBitSet> scopeMasks;
+};
+
 } // namespace slang::ast
@@ -7,11 +7,14 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "slang/ast/OpaqueInstancePath.h"
 #include "slang/ast/Scope.h"
 #include "slang/diagnostics/Diagnostics.h"
+#include "slang/numeric/ConstantValue.h"
 #include "slang/numeric/Time.h"
 #include "slang/syntax/SyntaxFwd.h"
 #include "slang/syntax/SyntaxNode.h"
@@ -21,6 +24,10 @@
 #include "slang/util/LanguageVersion.h"
 #include "slang/util/SafeIndexedVector.h"
 
+namespace slang {
+class ThreadPool;
+}
+
 namespace slang::syntax {
 class SyntaxTree;
 }
@@ -29,11 +36,14 @@ namespace slang::ast {
 
 class AttributeSymbol;
 class ASTContext;
+enum class EvalFlags : uint8_t;
 class CompilationUnitSymbol;
 class ConfigBlockSymbol;
 class DefinitionSymbol;
+class EvalContext;
 class Expression;
 class GenericClassDefSymbol;
+class InstanceBodySymbol;
 class InterfacePortSymbol;
 class MethodPrototypeSymbol;
 class ModportSymbol;
@@ -44,11 +54,16 @@ class RootSymbol;
 class Statement;
 class SubroutineSymbol;
 class Symbol;
+class TimingControl;
 class SystemSubroutine;
 class ValueDriver;
 struct AssertionInstanceDetails;
+struct CaseMatchTable;
 struct ConfigRule;
+struct DiagnosticVisitor;
+struct LookupResult;
 struct ResolvedConfig;
+struct TypeBitLayout;
 
 using DriverIntervalMap = IntervalMap<uint64_t, const ValueDriver*>;
 using UnrollIntervalMap = IntervalMap<uint64_t, std::monostate>;
@@ -71,6 +86,27 @@ enum class SLANG_EXPORT MinTypMax {
     Max
 };
 
+/// Specifies how deeply the design should be elaborated when diagnostics
+/// are requested. Queries that only need part of the design (for example
+/// listing definitions or dumping the instance hierarchy) can select a
+/// shallower mode to skip the expensive full walk. Note that @a freeze
+/// always performs a full elaboration regardless of the selected mode,
+/// since the frozen-design contract requires it.
+enum class SLANG_EXPORT ElaborationMode {
+    /// Don't elaborate the design at all; only diagnostics from parsing
+    /// and definition creation are reported.
+    DefinitionsOnly,
+
+    /// Elaborate the shape of the instance hierarchy -- instances, generate
+    /// blocks, and parameter values -- without binding statement bodies or
+    /// expressions. Diagnostics are limited to whatever that shape walk
+    /// happens to bind (parameter evaluation, unknown modules, etc).
+    HierarchySkeleton,
+
+    /// Fully elaborate the design, binding every statement and expression.
+    Full
+};
+
 /// Defines flags that control compilation behavior.
 enum class SLANG_EXPORT CompilationFlags {
     /// No flags specified.
@@ -181,10 +217,20 @@ struct SLANG_EXPORT CompilationOptions {
     /// source text is hopelessly broken.
     uint32_t typoCorrectionLimit = 32;
 
+    /// A rough estimate of the number of design elements (modules, interfaces,
+    /// programs, packages) expected in the design, used to pre-size internal
+    /// name maps and type caches. Zero means no estimate is available and
+    /// default capacities are used.
+    uint32_t expectedDesignElements = 0;
+
     /// Specifies which set of min:typ:max expressions should
     /// be used during compilation.
     MinTypMax minTypMax = MinTypMax::Typ;
 
+    /// Specifies how deeply the design should be elaborated when
+    /// diagnostics are requested.
+    ElaborationMode elaborationMode = ElaborationMode::Full;
+
     /// The version of the SystemVerilog language to use.
     LanguageVersion languageVersion = LanguageVersion::Default;
 
@@ -258,6 +304,28 @@ struct SLANG_EXPORT HierarchyOverrideNode {
     std::vector<std::pair<BindDirectiveInfo, const syntax::SyntaxNode*>> binds;
 };
 
+/// A canonical, immutable record of one distinct parameterization of a
+/// definition: the value of each value parameter and the canonical type of
+/// each type parameter, in declaration order. Environments are interned on
+/// the compilation, so two instance bodies elaborated with identical
+/// parameter values share one environment object and can be compared by
+/// pointer; see Compilation::getParameterEnv.
+struct SLANG_EXPORT ParameterEnvironment {
+    /// The definition that was parameterized.
+    const DefinitionSymbol* definition = nullptr;
+
+    /// The values of the definition's value parameters, in declaration order.
+    std::span<const ConstantValue* const> paramValues;
+
+    /// The canonical types of the definition's type parameters, in
+    /// declaration order.
+    std::span<const Type* const> typeParams;
+
+    /// A precomputed hash of the definition and parameter values, usable as
+    /// a cache key for anything memoized per parameterization.
+    size_t hash = 0;
+};
+
 /// A centralized location for creating and caching symbols. This includes
 /// creating symbols from syntax nodes as well as fabricating them synthetically.
 /// Common symbols such as built in types are exposed here as well.
@@ -307,6 +375,19 @@ public:
     /// Indicates whether the design has been compiled and can no longer accept modifications.
     bool isFinalized() const { return finalized; }
 
+    /// @brief Fully elaborates the design and marks the compilation frozen.
+    ///
+    /// Every lazy member of the design -- types, initializers, generate blocks,
+    /// bind directives -- is forced to resolve eagerly, so that afterwards a
+    /// traversal never triggers resolution (and therefore never mutates the
+    /// compilation). A frozen compilation can be shared freely across reader
+    /// threads. Diagnostics are collected as a side effect, as with
+    /// @a getAllDiagnostics.
+    void freeze();
+
+    /// Indicates whether @a freeze has been called.
+    bool isFrozen() const { return frozen; }
+
     /// Gets the diagnostics produced during lexing, preprocessing, and syntax parsing.
     const Diagnostics& getParseDiagnostics();
 
@@ -319,6 +400,77 @@ public:
     /// Gets all of the diagnostics produced during compilation.
     const Diagnostics& getAllDiagnostics();
 
+    /// Coarse progress through elaboration, published through atomics so
+    /// that a watchdog or progress reporter on another thread can observe
+    /// liveness while a long-running analysis call is in flight.
+    /// Counters only ever increase; none of them is a precise accounting.
+    struct ElaborationProgress {
+        /// The broad region of work currently executing.
+        enum Phase : uint32_t {
+            NotStarted,
+            Packages,
+            CompilationUnits,
+            TopInstances,
+            UnreferencedInstances,
+            Finalizing,
+            UnusedSweep,
+            Complete
+        };
+
+        /// The currently executing phase.
+        std::atomic<uint32_t> phase = NotStarted;
+
+        /// The number of instances processed so far, counting instances
+        /// whose elaboration was shared with an identical body.
+        std::atomic<size_t> instancesProcessed = 0;
+
+        /// A recent snapshot of the compilation's live arena bytes,
+        /// refreshed as instances complete.
+        std::atomic<size_t> liveBytes = 0;
+
+        /// Gets a short human-readable name for the current phase.
+        std::string_view phaseName() const;
+    };
+
+    /// Gets the progress tracker for this compilation. Safe to read from
+    /// any thread at any time.
+    const ElaborationProgress& getProgress() const { return progress; }
+
+    /// @brief Computes a 128-bit hash of the elaborated design, suitable for
+    /// use as a build cache key.
+    ///
+    /// Each top instance's structural hash (see
+    /// InstanceBodySymbol::getStructuralHash) is folded together with its name
+    /// into two differently seeded 64-bit lanes, in declaration order so the
+    /// result is deterministic across runs. The compilation is frozen first
+    /// via @a freeze so that when @a pool is provided the per-top hashes can
+    /// be computed concurrently without any lazy resolution racing.
+    std::pair<uint64_t, uint64_t> getDesignHash(ThreadPool* pool = nullptr);
+
+    /// @brief Resolves a batch of hierarchical path strings against the design.
+    ///
+    /// Returns one symbol per input path, in order, with nullptr entries for
+    /// paths that don't resolve. Paths are rooted at the design root and each
+    /// component must name a direct member of the enclosing scope, optionally
+    /// followed by constant index selectors for instance and generate arrays
+    /// (e.g. "top.gen[2].u_core.acc"). Resolution of shared prefixes is cached
+    /// across the batch, so large batches cost roughly one member probe per
+    /// distinct scope rather than one full walk per string; sorting the batch
+    /// maximizes sharing but isn't required.
+    std::vector<const Symbol*> resolveHierarchicalPaths(
+        std::span<const std::string_view> paths);
+
+    /// @brief Finds procedural statements that can provably never execute
+    /// because a branch condition folds to a constant.
+    ///
+    /// Walks the given symbol's subtree (commonly an instance body or the
+    /// root) and evaluates each if statement's conditions; when they fold to
+    /// a constant, the branch that can never be taken is reported. Conditions
+    /// involving unknown bits, patterns, or anything not constant are left
+    /// alone. Each instance body folds its own parameter values, so the same
+    /// statement can be dead in one specialization and live in another.
+    std::vector<const Statement*> findConstantDeadStatements(const Symbol& symbol);
+
     /// @}
     /// @name Utility and convenience methods
     /// @{
@@ -419,7 +571,7 @@ public:
     const PackageSymbol* getPackage(std::string_view name) const;
 
     /// Gets the built-in 'std' package.
-    const PackageSymbol& getStdPackage() const { return *stdPkg; }
+    const PackageSymbol& getStdPackage() const;
 
     /// Gets a list of all packages in the design.
     std::vector<const PackageSymbol*> getPackages() const;
@@ -501,6 +653,42 @@ public:
     /// These are later checked for correctness.
     void noteInstanceWithDefBind(const Symbol& instance);
 
+    /// Notes that the given definition contains an upward hierarchical name reference.
+    /// Such definitions resolve names differently depending on where they are
+    /// instantiated, so they are excluded from instance body deduplication
+    /// during elaboration.
+    void noteUpwardNames(const DefinitionSymbol& def);
+
+    /// Returns true if @a noteUpwardNames has been called for the given definition.
+    bool hasUpwardNames(const DefinitionSymbol& def) const;
+
+    /// Notes that the given definition is the target of a hierarchical name
+    /// reference from outside one of its instances. Binding such a name can
+    /// register drivers and issue diagnostics inside the referenced body, so
+    /// instances of these definitions are excluded from instance body
+    /// deduplication during elaboration.
+    void noteHierarchicalReference(const DefinitionSymbol& def);
+
+    /// Returns true if @a noteHierarchicalReference has been called for the
+    /// given definition.
+    bool hasHierarchicalReferences(const DefinitionSymbol& def) const;
+
+    /// Gets the interned hierarchical path string previously cached for the given
+    /// symbol, or an empty optional if none has been computed yet.
+    std::optional<std::string_view> getCachedHierarchicalPath(const Symbol& symbol) const;
+
+    /// Interns the given hierarchical path string into the compilation's allocator
+    /// and caches it for the given symbol. Symbol parentage never changes once
+    /// created so cached paths remain valid for the compilation's lifetime.
+    void cacheHierarchicalPath(const Symbol& symbol, std::string_view path);
+
+    /// Gets a list of definitions that were instantiated more than once but whose
+    /// instances could not share one elaboration for diagnostic purposes, each
+    /// paired with a description of the construct that blocked sharing.
+    /// Only populated once a full elaboration has been performed.
+    std::vector<std::pair<const DefinitionSymbol*, std::string_view>> getElabSharingBlockers()
+        const;
+
     /// Notes the presence of a DPI export directive. These will be checked for correctness
     /// but are otherwise unused by SystemVerilog code.
     void noteDPIExportDirective(const syntax::DPIExportSyntax& syntax, const Scope& scope);
@@ -580,6 +768,245 @@ public:
     /// be elaborated and any relevant diagnostics to be issued.
     void forceElaborate(const Symbol& symbol);
 
+    /// Looks up a memoized result for a constant function call to the given
+    /// subroutine with the given argument values. Returns nullptr if no such
+    /// result has been recorded.
+    const ConstantValue* findMemoizedCall(const SubroutineSymbol& subroutine,
+                                          std::span<const ConstantValue> args) const;
+
+    /// Records the result of a side effect free constant function call so that
+    /// later calls to the same subroutine with the same argument values can
+    /// skip evaluation. The table is bounded in size; once it fills up it is
+    /// flushed before new results are recorded.
+    void memoizeCall(const SubroutineSymbol& subroutine, std::span<const ConstantValue> args,
+                     ConstantValue result);
+
+    /// The element-invariant result of resolving an interface port connection:
+    /// the connected symbol before any instance array slicing, the connected
+    /// modport (if any), and the unpacked dimensions of the connection's type.
+    using IfaceConnMemo =
+        std::tuple<const Symbol*, const ModportSymbol*, std::span<const ConstantRange>>;
+
+    /// Looks up a memoized interface port connection resolution recorded by a
+    /// sibling element of the same instance array. The key is the scope
+    /// containing the array (the same instance syntax elaborates once per
+    /// instance of the enclosing body, where the connection can resolve to a
+    /// different interface), the hierarchical instance syntax shared by all
+    /// of the array's elements, and the port's name. Returns nullptr if no
+    /// such result has been recorded.
+    const IfaceConnMemo* findMemoizedIfaceConn(const Scope& parent,
+                                               const syntax::SyntaxNode& instanceSyntax,
+                                               std::string_view portName) const;
+
+    /// Records the element-invariant portion of an interface port connection
+    /// resolution so that sibling elements of the same instance array can
+    /// reuse it instead of redoing the lookup and compatibility checks.
+    void memoizeIfaceConn(const Scope& parent, const syntax::SyntaxNode& instanceSyntax,
+                          std::string_view portName, IfaceConnMemo memo);
+
+    /// Looks up a memoized non-interface port connection expression recorded
+    /// by a sibling element of the same instance array. The key includes the
+    /// scope containing the array since the same syntax elaborates in every
+    /// instance of the enclosing body, where the connection's names can
+    /// resolve differently. Returns nullptr if no such expression has been
+    /// recorded.
+    const Expression* findMemoizedPortConn(const Scope& parent,
+                                           const syntax::SyntaxNode& instanceSyntax,
+                                           std::string_view portName) const;
+
+    /// Records a bound port connection expression that was determined to be
+    /// identical for every element of an instance array, so that sibling
+    /// elements can share it instead of rebinding the same syntax.
+    void memoizePortConn(const Scope& parent, const syntax::SyntaxNode& instanceSyntax,
+                         std::string_view portName, const Expression& expr);
+
+    /// Notes that a port connection expression was sliced up on a per-element
+    /// basis while binding a connection to an instance array, which makes the
+    /// resulting expression ineligible for sharing between sibling elements.
+    void notePortArraySlice() { portArraySliceCount++; }
+
+    /// Gets the number of per-element port connection slices performed so far;
+    /// comparing counts from before and after a bind reveals whether that bind
+    /// produced an element-dependent expression.
+    size_t getPortArraySliceCount() const { return portArraySliceCount; }
+
+    /// A view of everything a cached constant fold result depends on besides
+    /// the expression syntax itself: the values of the parameters and enum
+    /// members the expression references and the type at each of its nodes
+    /// (both in visitation order), plus the binding and evaluation flag bits.
+    /// Values are referenced by pointer; parameter and enum values are stable
+    /// for the lifetime of the compilation.
+    struct FoldCacheKeyView {
+        const syntax::SyntaxNode* syntax = nullptr;
+        std::span<const ConstantValue* const> values;
+        std::span<const Type* const> types;
+        uint64_t astFlags = 0;
+        uint64_t evalFlags = 0;
+    };
+
+    /// Looks up a cached constant fold result for the given key. All of the
+    /// key's components are compared in full, so a hash collision can never
+    /// substitute a wrong value. Returns nullptr if no result is recorded.
+    const ConstantValue* findCachedFold(const FoldCacheKeyView& key) const;
+
+    /// Records the result of constant folding an expression so that later
+    /// binds of the same syntax under an equivalent parameterization can
+    /// reuse the value without reevaluating. The value must be allocated by
+    /// this compilation.
+    void cacheFold(const FoldCacheKeyView& key, const ConstantValue& value);
+
+    /// Identifies a unique assertion instance expansion environment: the
+    /// declaration being expanded, the invocation syntax (null for bare name
+    /// references), the scope and lookup index of the use site, the enclosing
+    /// assertion expansion (if any), and the binding flags in effect.
+    using AssertionInstanceKey = std::tuple<const Symbol*, const syntax::SyntaxNode*, const Scope*,
+                                            uint32_t, const AssertionInstanceDetails*, uint64_t>;
+
+    /// Looks up a previously expanded assertion instance for the given
+    /// expansion environment. Returns nullptr if none has been recorded.
+    const Expression* findCachedAssertionInstance(const AssertionInstanceKey& key) const;
+
+    /// Records an expanded assertion instance so that later instantiations of
+    /// the same declaration in an equivalent environment can share the
+    /// expanded body instead of re-expanding it.
+    void cacheAssertionInstance(const AssertionInstanceKey& key, const Expression& expr);
+
+    /// Statistics about the expansion of a single sequence, property, or
+    /// let declaration.
+    struct AssertionExpansionStats {
+        /// The number of times the declaration has been expanded.
+        size_t count = 0;
+
+        /// The deepest level of nested assertion expansion at which an
+        /// expansion of this declaration occurred.
+        size_t maxDepth = 0;
+    };
+
+    /// Records an expansion of the given assertion declaration at the given
+    /// nesting depth.
+    void noteAssertionExpansion(const Symbol& symbol, size_t depth);
+
+    /// Gets per-declaration expansion statistics for sequences, properties,
+    /// and let declarations, useful for finding pathological properties in
+    /// assertion-heavy designs.
+    const flat_hash_map<const Symbol*, AssertionExpansionStats>& getAssertionExpansionStats()
+        const {
+        return assertionExpansionStats;
+    }
+
+    /// A cost estimate for elaborating one definition, recorded during full
+    /// elaboration. The estimate counts the symbols touched while visiting
+    /// the definition's bodies (not including nested instances, which are
+    /// attributed to their own definitions) along with the number of
+    /// instances of the definition encountered. When identical bodies share
+    /// one elaboration only the visited body contributes symbols.
+    struct ElaborationCostStats {
+        /// The number of symbols visited while elaborating bodies of the
+        /// definition.
+        size_t symbolsVisited = 0;
+
+        /// The number of instances of the definition that were encountered,
+        /// including ones whose bodies were shared rather than re-visited.
+        size_t instanceCount = 0;
+    };
+
+    /// Gets per-definition elaboration cost estimates, recorded during the
+    /// full elaboration performed by getAllDiagnostics. Useful for finding
+    /// the giant bodies that dominate elaboration time, and intended as the
+    /// scheduling input once elaboration units can run concurrently.
+    const flat_hash_map<const DefinitionSymbol*, ElaborationCostStats>& getElaborationCostStats()
+        const {
+        return elabCostStats;
+    }
+
+    /// Gets the canonical interned parameter environment for the given
+    /// instance body, creating one if this parameterization of the body's
+    /// definition hasn't been seen before. Resolves all of the body's
+    /// parameter values. Most callers should go through
+    /// InstanceBodySymbol::getParameterEnv, which caches the result.
+    const ParameterEnvironment& getParameterEnv(const InstanceBodySymbol& body);
+
+    /// Gets the bit-level layout of the given struct or union type, computing
+    /// and caching it on first use. The type must be canonical. Most callers
+    /// should use Type::getBitLayout instead.
+    const TypeBitLayout& getTypeBitLayout(const Type& type);
+
+    /// The compatibility relation being queried in the type compatibility
+    /// cache; see Type::isMatching, Type::isEquivalent, and
+    /// Type::isAssignmentCompatible.
+    enum class TypeCompatKind { Matching, Equivalent, AssignmentCompatible };
+
+    /// Looks up a previously recorded result of a type compatibility check.
+    /// Both types must be canonical. Returns std::nullopt if this pair and
+    /// relation has not been checked before.
+    std::optional<bool> findCachedTypeCompat(const Type& lhs, const Type& rhs,
+                                             TypeCompatKind kind) const;
+
+    /// Records the result of a type compatibility check so that later checks
+    /// of the same pair become a hash probe instead of a structural walk.
+    /// This is valid to cache because types are immutable once created.
+    void cacheTypeCompat(const Type& lhs, const Type& rhs, TypeCompatKind kind, bool result);
+
+    /// Looks up a previously bound timing control for the given syntax node,
+    /// binding position, and flag bits. Returns nullptr if none is cached.
+    TimingControl* findCachedTimingControl(const syntax::SyntaxNode& syntax, const Scope& scope,
+                                           SymbolIndex lookupIndex, uint64_t flagBits) const;
+
+    /// Records a bound timing control so that later binds of the same syntax
+    /// from the same position return the canonical node instead of rebinding.
+    void cacheTimingControl(const syntax::SyntaxNode& syntax, const Scope& scope,
+                            SymbolIndex lookupIndex, uint64_t flagBits, TimingControl& ctrl);
+
+    /// Returns true if an unqualified lookup of @a name starting from @a scope
+    /// has previously been proven to find nothing anywhere in the enclosing
+    /// scope chain. Only populated once the compilation is frozen, since name
+    /// maps can otherwise still grow.
+    bool isLookupMissCached(const Scope& scope, std::string_view name) const;
+
+    /// Records that an unqualified lookup of @a name starting from @a scope
+    /// finds nothing, so that repeated misses become a single hash probe
+    /// instead of a walk of the whole scope chain.
+    void cacheLookupMiss(const Scope& scope, std::string_view name);
+
+    /// Aggregated memory attribution statistics for a compilation and its
+    /// syntax trees, as reported by @a getMemoryStats. All values are in bytes.
+    struct MemoryStats {
+        size_t tokens = 0;      ///< Token data, including macro expansions.
+        size_t trivia = 0;      ///< Trivia attached to tokens.
+        size_t syntaxNodes = 0; ///< Syntax nodes and other parse-time data.
+        size_t symbols = 0;     ///< Symbols and their name tables.
+        size_t types = 0;       ///< Types.
+        size_t constants = 0;   ///< Constant values.
+        size_t other = 0;       ///< Everything not otherwise attributed.
+        size_t liveBytes = 0;   ///< Total segment memory currently held.
+    };
+
+    /// Computes memory attribution statistics aggregated over this
+    /// compilation's allocators and those of all added syntax trees.
+    /// The per-category numbers are approximate; allocations are attributed
+    /// at a few coarse choke points rather than exactly per object.
+    MemoryStats getMemoryStats() const;
+
+    /// Entry counts and hit counts for the compilation's memoization caches,
+    /// as reported by @a getCacheStats.
+    struct CacheStats {
+        /// Statistics for one cache.
+        struct Entry {
+            size_t entries = 0; ///< Number of entries currently in the cache.
+            size_t hits = 0;    ///< Number of successful lookups so far.
+        };
+        Entry memoizedCalls;   ///< Constant function call memoization.
+        Entry ifaceConns;      ///< Interface port connection memoization.
+        Entry portConns;       ///< Value port connection memoization.
+        Entry typeCompat;      ///< Type compatibility check results.
+        Entry timingControls;  ///< Bound timing controls.
+        Entry lookupMisses;    ///< Negative unqualified lookup results.
+    };
+
+    /// Gets entry and hit counts for the compilation's memoization caches,
+    /// for telemetry and performance investigation.
+    CacheStats getCacheStats() const;
+
     /// Gets the default time scale to use when none is specified in the source code.
     std::optional<TimeScale> getDefaultTimeScale() const { return options.defaultTimeScale; }
 
@@ -612,6 +1039,13 @@ public:
     /// Gets an integral vector type with the given size and flags.
     const Type& getType(bitwidth_t width, bitmask<IntegralFlags> flags);
 
+    /// Gets a packed array type with the given element type, range, and
+    /// overall bit width. Structurally identical packed arrays are interned
+    /// to a single shared instance, so the results can be compared by
+    /// pointer; interned types carry no originating syntax.
+    const Type& getPackedArrayType(const Type& elementType, ConstantRange range,
+                                   bitwidth_t fullWidth);
+
     /// Gets a scalar (single bit) type with the given flags.
     const Type& getScalarType(bitmask<IntegralFlags> flags);
 
@@ -697,6 +1131,19 @@ public:
     /// Allocates a scope's wildcard import data object.
     Scope::WildcardImportData* allocWildcardImportData();
 
+    /// Allocates a case statement match table.
+    CaseMatchTable* allocCaseMatchTable(CaseMatchTable&& table);
+
+    /// Acquires an evaluation context for transient constant folding,
+    /// recycled from a pool so that repeated folds during binding don't
+    /// rebuild the evaluation machinery each time. The context must be
+    /// returned via releaseEvalContext when evaluation is finished.
+    EvalContext& acquireEvalContext(const ASTContext& astCtx, bitmask<EvalFlags> flags);
+
+    /// Resets an evaluation context obtained from acquireEvalContext and
+    /// returns it to the recycle pool.
+    void releaseEvalContext(EvalContext& ctx);
+
     /// Gets the driver map allocator.
     DriverIntervalMap::allocator_type& getDriverMapAllocator() { return driverMapAllocator; }
 
@@ -716,6 +1163,7 @@ public:
 private:
     friend class Lookup;
     friend class Scope;
+    friend struct DiagnosticVisitor;
 
     // Collected information about a resolved bind directive.
     struct ResolvedBind {
@@ -727,6 +1175,7 @@ private:
 
     // These functions are called by Scopes to create and track various members.
     Scope::DeferredMemberData& getOrAddDeferredData(Scope::DeferredMemberIndex& index);
+    Scope::DeferredMemberData popDeferredData(Scope::DeferredMemberIndex index);
 
     bool doTypoCorrection() const { return typoCorrections < options.typoCorrectionLimit; }
     void didTypoCorrection() { typoCorrections++; }
@@ -767,6 +1216,9 @@ private:
     DriverIntervalMap::allocator_type driverMapAllocator;
     UnrollIntervalMap::allocator_type unrollIntervalMapAllocator;
 
+    // A pool of recycled evaluation contexts for transient constant folding.
+    std::vector<std::unique_ptr<EvalContext>> evalCtxPool;
+
     // A table to look up scalar types based on combinations of the three flags: signed, fourstate,
     // reg. Two of the entries are not valid and will be nullptr (!fourstate & reg).
     Type* scalarTypeTable[8]{nullptr};
@@ -801,9 +1253,20 @@ private:
     flat_hash_map<std::tuple<std::string_view, const Scope*>, std::pair<std::vector<Symbol*>, bool>>
         definitionMap;
 
+    // The set of non-root scopes that directly contain at least one definition.
+    // Lookups for names shadowed by nested modules walk the scope chain probing
+    // the definition map at each level; this set lets scopes with no local
+    // definitions (the overwhelmingly common case) be skipped with a pointer
+    // hash instead of a full name / scope key probe.
+    flat_hash_set<const Scope*> scopesWithLocalDefs;
+
     // A cache of vector types, keyed on various properties such as bit width.
     flat_hash_map<uint32_t, const Type*> vectorTypeCache;
 
+    // A cache of packed array types, interning structurally identical packed
+    // arrays to a single shared instance.
+    flat_hash_map<std::tuple<const Type*, int32_t, int32_t>, const Type*> packedArrayCache;
+
     // Map from syntax kinds to the built-in types.
     flat_hash_map<syntax::SyntaxKind, const Type*> knownTypes;
 
@@ -814,16 +1277,127 @@ private:
     // which is why they can't share the definitions name table.
     flat_hash_map<std::string_view, const PackageSymbol*> packageMap;
 
-    // The name map for system subroutines.
+    // The name map for locally registered system subroutines. Builtin
+    // subroutines live in the shared Builtins instance and are consulted
+    // first on lookup, so this map is empty unless a user adds their own.
     flat_hash_map<std::string_view, std::shared_ptr<SystemSubroutine>> subroutineMap;
 
-    // The name map for system methods.
+    // The name map for locally registered system methods; see subroutineMap.
     flat_hash_map<std::tuple<std::string_view, SymbolKind>, std::shared_ptr<SystemSubroutine>>
         methodMap;
 
     // Map from pointers (to symbols, statements, expressions) to their associated attributes.
     flat_hash_map<const void*, std::span<const AttributeSymbol* const>> attributeMap;
 
+    // Memoized results of side effect free constant function calls, keyed by
+    // the subroutine and the argument values passed at the call site.
+    using MemoizedCallKey = std::pair<const SubroutineSymbol*, std::vector<ConstantValue>>;
+    struct MemoizedCallHasher {
+        using is_transparent = void;
+        size_t operator()(const MemoizedCallKey& key) const {
+            return hashKey(key.first, key.second);
+        }
+        size_t operator()(
+            const std::pair<const SubroutineSymbol*, std::span<const ConstantValue>>& key) const {
+            return hashKey(key.first, key.second);
+        }
+        static size_t hashKey(const SubroutineSymbol* sub, std::span<const ConstantValue> args);
+    };
+    struct MemoizedCallComparer {
+        using is_transparent = void;
+        template<typename TLeft, typename TRight>
+        bool operator()(const TLeft& lhs, const TRight& rhs) const {
+            return lhs.first == rhs.first && std::ranges::equal(lhs.second, rhs.second);
+        }
+    };
+    flat_hash_map<MemoizedCallKey, ConstantValue, MemoizedCallHasher, MemoizedCallComparer>
+        memoizedCalls;
+
+    // Memoized interface port connection resolutions, keyed by the scope
+    // containing the instance array, the instance syntax (shared by all
+    // elements of the array), and the port name.
+    flat_hash_map<std::tuple<const Scope*, const syntax::SyntaxNode*, std::string_view>,
+                  IfaceConnMemo>
+        memoizedIfaceConns;
+
+    // Memoized non-interface port connection expressions shared between
+    // elements of an instance array, keyed the same way, along with a count
+    // of per-element slicing operations used to detect expressions that
+    // cannot be shared.
+    flat_hash_map<std::tuple<const Scope*, const syntax::SyntaxNode*, std::string_view>,
+                  const Expression*>
+        memoizedPortConns;
+    size_t portArraySliceCount = 0;
+
+    // Cached constant fold results, keyed by the expression syntax and the
+    // values and types its result depends on; see FoldCacheKeyView. The
+    // owning key stores the same components as the view, and both hasher and
+    // comparer are transparent so that lookups don't allocate.
+    struct FoldCacheKey {
+        const syntax::SyntaxNode* syntax = nullptr;
+        std::vector<const ConstantValue*> values;
+        std::vector<const Type*> types;
+        uint64_t astFlags = 0;
+        uint64_t evalFlags = 0;
+    };
+    struct FoldCacheHasher {
+        using is_transparent = void;
+        template<typename TKey>
+        size_t operator()(const TKey& key) const {
+            size_t seed = 0;
+            hash_combine(seed, key.syntax, key.astFlags, key.evalFlags);
+            for (auto type : key.types)
+                hash_combine(seed, type);
+            for (auto value : key.values)
+                hash_combine(seed, *value);
+            return seed;
+        }
+    };
+    struct FoldCacheComparer {
+        using is_transparent = void;
+        template<typename TLeft, typename TRight>
+        bool operator()(const TLeft& lhs, const TRight& rhs) const {
+            return lhs.syntax == rhs.syntax && lhs.astFlags == rhs.astFlags &&
+                   lhs.evalFlags == rhs.evalFlags && std::ranges::equal(lhs.types, rhs.types) &&
+                   std::ranges::equal(lhs.values, rhs.values,
+                                      [](const ConstantValue* l, const ConstantValue* r) {
+                                          return *l == *r;
+                                      });
+        }
+    };
+    flat_hash_map<FoldCacheKey, const ConstantValue*, FoldCacheHasher, FoldCacheComparer> foldCache;
+
+    // Cached assertion instance expansions, shared across repeated
+    // instantiations of the same declaration in the same environment.
+    flat_hash_map<AssertionInstanceKey, const Expression*> assertionInstanceCache;
+
+    // Per-declaration assertion expansion statistics.
+    flat_hash_map<const Symbol*, AssertionExpansionStats> assertionExpansionStats;
+
+    // Cached bit layouts for canonical struct and union types; the layouts
+    // and their field tables are allocated from this compilation's arena.
+    flat_hash_map<const Type*, const TypeBitLayout*> typeLayoutCache;
+
+    // Memoized results of type compatibility checks between canonical types,
+    // keyed by the pair and the relation being checked.
+    flat_hash_map<std::tuple<const Type*, const Type*, int>, bool> typeCompatCache;
+    flat_hash_map<std::tuple<const syntax::SyntaxNode*, const Scope*, uint32_t, uint64_t>,
+                  TimingControl*>
+        timingControlCache;
+
+    // Names proven absent from a scope's entire enclosing chain, recorded
+    // only after the compilation freezes.
+    flat_hash_set<std::tuple<const Scope*, std::string_view>> lookupMissCache;
+
+    // Hit counters for the memoization caches, reported by getCacheStats.
+    // Mutable because the lookups happen through const query methods.
+    mutable size_t memoizedCallHits = 0;
+    mutable size_t ifaceConnHits = 0;
+    mutable size_t portConnHits = 0;
+    mutable size_t typeCompatHits = 0;
+    mutable size_t timingControlHits = 0;
+    mutable size_t lookupMissHits = 0;
+
     struct SyntaxMetadata {
         const syntax::SyntaxTree* tree = nullptr;
         const NetType* defaultNetType = nullptr;
@@ -839,7 +1413,14 @@ private:
 
     // A map from diag code + location to the diagnostics that have occurred at that location.
     // This is used to collapse duplicate diagnostics across instantiations into a single report.
-    using DiagMap = flat_hash_map<std::tuple<DiagCode, SourceLocation>, std::vector<Diagnostic>>;
+    // Copies that match the first completed diagnostic for a key get folded down at issue time
+    // to just the instance body they came from instead of storing the whole diagnostic again;
+    // see addDiag for details.
+    struct DiagnosticGroup {
+        std::vector<Diagnostic> diags;
+        std::vector<const InstanceBodySymbol*> foldedBodies;
+    };
+    using DiagMap = flat_hash_map<std::tuple<DiagCode, SourceLocation>, DiagnosticGroup>;
     DiagMap diagMap;
 
     // A list of libraries that control the order in which we search for cell bindings.
@@ -854,11 +1435,22 @@ private:
         std::tuple<const syntax::SyntaxNode*, const syntax::ScopedNameSyntax*, SymbolIndex, bool>>
         outOfBlockDecls;
 
+    // A cache of scoped name lookups performed after the compilation has been
+    // frozen, keyed by the initial scope and the textual name path. A frozen
+    // hierarchy can never change, so entries never need to be invalidated;
+    // the mutex keeps probes safe for concurrent reader threads.
+    mutable flat_hash_map<std::tuple<const Scope*, std::string, uint64_t, uint32_t>,
+                          std::unique_ptr<LookupResult>>
+        hierLookupCache;
+    mutable std::mutex hierLookupMutex;
+
     std::unique_ptr<RootSymbol> root;
     const SourceManager* sourceManager = nullptr;
+    ElaborationProgress progress;
     size_t numErrors = 0; // total number of errors inserted into the diagMap
     bool finalized = false;
     bool finalizing = false; // to prevent reentrant calls to getRoot()
+    bool frozen = false;
     bool anyElemsWithTimescales = false;
     uint32_t typoCorrections = 0;
     int nextEnumSystemId = 1;
@@ -869,6 +1461,7 @@ private:
     TypedBumpAllocator<AssertionInstanceDetails> assertionDetailsAllocator;
     TypedBumpAllocator<ConfigBlockSymbol> configBlockAllocator;
     TypedBumpAllocator<Scope::WildcardImportData> wildcardImportAllocator;
+    TypedBumpAllocator<CaseMatchTable> caseMatchAllocator;
 
     // This is storage for a temporary diagnostic that is being constructed.
     // Typically this is done in-place within the diagMap, but for diagnostics
@@ -940,13 +1533,40 @@ private:
     // This is pretty rare and only used for checking of type params.
     flat_hash_map<const DefinitionSymbol*, std::vector<const Symbol*>> instancesWithDefBinds;
 
+    // A set of definitions known to contain upward hierarchical name references.
+    flat_hash_set<const DefinitionSymbol*> defsWithUpwardNames;
+    flat_hash_set<const DefinitionSymbol*> defsWithHierRefs;
+
+    // A map from fully elaborated instance bodies to the number of additional
+    // identical bodies whose elaboration they stood in for. Used to keep
+    // diagnostic coalescing counts accurate when bodies are deduplicated.
+    flat_hash_map<const InstanceBodySymbol*, size_t> sharedElaborations;
+
+    // A map from definitions whose instances could not share one elaboration
+    // to a description of the construct that blocked sharing.
+    flat_hash_map<const DefinitionSymbol*, std::string_view> elabSharingBlockers;
+
+    // Per-definition elaboration cost estimates recorded during the full
+    // diagnostic visitation.
+    flat_hash_map<const DefinitionSymbol*, ElaborationCostStats> elabCostStats;
+
+    // Interned parameter environments, bucketed by definition and value hash;
+    // the bucket lists resolve hash collisions by full value comparison.
+    flat_hash_map<std::tuple<const DefinitionSymbol*, size_t>,
+                  std::vector<const ParameterEnvironment*>>
+        paramEnvBuckets;
+
+    // A cache of interned hierarchical path strings, so that building paths
+    // for many symbols doesn't recompute shared parent prefixes each time.
+    flat_hash_map<const Symbol*, std::string_view> hierPathCache;
+
     // The name map for extern module/interface/program/primitive declarations.
     // The key is a combination of definition name + the scope in which it was declared.
     flat_hash_map<std::tuple<std::string_view, const Scope*>, const syntax::SyntaxNode*>
         externDefMap;
 
-    // The built-in std package.
-    const PackageSymbol* stdPkg = nullptr;
+    // The built-in std package, created lazily on first use.
+    mutable const PackageSymbol* stdPkg = nullptr;
 
     // The default library.
     std::unique_ptr<SourceLibrary> defaultLibMem;
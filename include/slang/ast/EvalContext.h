@@ -7,11 +7,12 @@
 //------------------------------------------------------------------------------
 #pragma once
 
-#include <map>
+#include <deque>
 
 #include "slang/ast/ASTContext.h"
 #include "slang/numeric/ConstantValue.h"
 #include "slang/text/SourceLocation.h"
+#include "slang/util/Hash.h"
 #include "slang/util/ScopeGuard.h"
 
 namespace slang::ast {
@@ -35,9 +36,13 @@ public:
 
     /// Represents a single frame in the call stack.
     struct Frame {
-        /// A set of temporary values materialized within the stack frame.
-        /// Uses a map so that the values don't move around in memory.
-        std::map<const ValueSymbol*, ConstantValue> temporaries;
+        /// A map of temporary values materialized within the stack frame.
+        /// The values themselves live in @a storage so that they don't
+        /// move around in memory as more locals are created.
+        flat_hash_map<const ValueSymbol*, ConstantValue*> temporaries;
+
+        /// Backing storage for the values in @a temporaries.
+        std::deque<ConstantValue> storage;
 
         /// The function that is being executed in this frame, if any.
         const SubroutineSymbol* subroutine = nullptr;
@@ -66,8 +71,8 @@ public:
     /// Returns nullptr if the symbol cannot be found.
     ConstantValue* findLocal(const ValueSymbol* symbol);
 
-    /// Removes a previously created local. Pointers to the local's
-    /// storage will be invalidated.
+    /// Removes a previously created local. The local's backing storage
+    /// is not reclaimed until the frame is popped.
     void deleteLocal(const ValueSymbol* symbol);
 
     /// Push a new frame onto the call stack.
@@ -161,6 +166,10 @@ public:
     /// Gets the set of diagnostics that have been produced during constant evaluation.
     Diagnostics getAllDiagnostics() const;
 
+    /// Gets the number of diagnostics (errors and warnings) that have been
+    /// produced so far and not yet reported to the AST context.
+    size_t getDiagCount() const { return diags.size() + warnings.size(); }
+
     /// Records a diagnostic under the current evaluation context.
     Diagnostic& addDiag(DiagCode code, SourceLocation location);
 
@@ -178,11 +187,14 @@ public:
 
 private:
     void reportDiags(Diagnostics& diagSet);
+    Frame makeFrame();
 
     uint32_t steps = 0;
+    mutable uint32_t cachedStepLimit = 0;
     const Symbol* disableTarget = nullptr;
     const ConstantValue* queueTarget = nullptr;
     SmallVector<Frame> stack;
+    SmallVector<Frame> spareFrames;
     SmallVector<LValue*> lvalStack;
     Diagnostics diags;
     Diagnostics warnings;
@@ -67,6 +67,10 @@ public:
     /// Stores the given value into the storage pointed to by the lvalue.
     void store(const ConstantValue& value);
 
+    /// Stores the given value into the storage pointed to by the lvalue.
+    /// Whole-value stores take ownership of @a value instead of copying it.
+    void store(ConstantValue&& value);
+
     /// Extends the lvalue by adding a bit slice.
     void addBitSlice(ConstantRange range);
 
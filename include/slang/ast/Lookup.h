@@ -11,6 +11,7 @@
 #include "slang/diagnostics/Diagnostics.h"
 #include "slang/syntax/SyntaxFwd.h"
 #include "slang/text/SourceLocation.h"
+#include "slang/util/Hash.h"
 #include "slang/util/Util.h"
 
 namespace slang::ast {
@@ -156,6 +157,22 @@ private:
     uint32_t index = 0;
 };
 
+/// @brief A lookup name that carries a precomputed hash of its text.
+///
+/// Unqualified lookup probes the name map of each scope up the parent chain;
+/// hashing the name once up front lets every one of those probes reuse the
+/// same hash value instead of rehashing the string bytes at each level.
+struct SLANG_EXPORT HashedName {
+    /// The text of the name.
+    std::string_view text;
+
+    /// The precomputed hash of the name's text.
+    uint64_t hash;
+
+    /// Constructs a new HashedName by hashing the given text.
+    HashedName(std::string_view text) : text(text), hash(slang::hash<std::string_view>()(text)) {}
+};
+
 /// A structure that contains the results of a name lookup operation.
 struct SLANG_EXPORT LookupResult {
     /// The symbol that was found by the lookup, or nullptr if no symbol was found.
@@ -329,7 +346,8 @@ public:
 private:
     Lookup() = default;
 
-    static void unqualifiedImpl(const Scope& scope, std::string_view name, LookupLocation location,
+    static void unqualifiedImpl(const Scope& scope, const HashedName& name,
+                                LookupLocation location,
                                 std::optional<SourceRange> sourceRange, bitmask<LookupFlags> flags,
                                 SymbolIndex outOfBlockIndex, LookupResult& result,
                                 const Scope& originalScope);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <ranges>
+#include <span>
 
 #include "slang/ast/Lookup.h"
 #include "slang/ast/SemanticFacts.h"
@@ -33,7 +34,27 @@ class InstanceBodySymbol;
 class NetType;
 class WildcardImportSymbol;
 
-using SymbolMap = flat_hash_map<std::string_view, const Symbol*>;
+/// Hashes keys for a SymbolMap. Supports heterogeneous probing with a
+/// HashedName so that the precomputed hash is reused instead of rehashing
+/// the name's text.
+struct SymbolMapHasher {
+    using is_transparent = void;
+    using is_avalanching = void;
+    uint64_t operator()(std::string_view name) const {
+        return slang::hash<std::string_view>()(name);
+    }
+    uint64_t operator()(const HashedName& name) const { return name.hash; }
+};
+
+/// Compares keys for a SymbolMap, including against HashedName probes.
+struct SymbolMapEqual {
+    using is_transparent = void;
+    bool operator()(std::string_view lhs, std::string_view rhs) const { return lhs == rhs; }
+    bool operator()(const HashedName& lhs, std::string_view rhs) const { return lhs.text == rhs; }
+    bool operator()(std::string_view lhs, const HashedName& rhs) const { return lhs == rhs.text; }
+};
+
+using SymbolMap = flat_hash_map<std::string_view, const Symbol*, SymbolMapHasher, SymbolMapEqual>;
 using PointerMap = flat_hash_map<uintptr_t, uintptr_t>;
 
 /// Base class for symbols that represent a name scope; that is, they contain children and can
@@ -49,6 +70,11 @@ public:
     /// Creates and adds one or more member symbols to the scope from the given syntax node.
     void addMembers(const syntax::SyntaxNode& syntax);
 
+    /// Hints that approximately @a count additional members are about to be
+    /// added, allowing the name map to be sized up front in one allocation
+    /// instead of rehashing as members are inserted individually.
+    void reserveMembers(size_t count) const;
+
     const Symbol& asSymbol() const { return *thisSym; }
 
     /// Gets the compilation that contains this scope.
@@ -209,6 +235,16 @@ public:
         return {firstMember, nullptr};
     }
 
+    /// @brief Gets the members of the scope as a contiguous array of symbol pointers.
+    ///
+    /// The array is built on the compilation's allocator the first time it's
+    /// requested and cached; inserting more members into the scope invalidates
+    /// it so that it gets rebuilt on the next request. Scanning the array is
+    /// much friendlier to caches than chasing the intrusive member list, so
+    /// prefer this in passes that run after elaboration is complete. Unlike
+    /// members(), insertions made while iterating will not be observed.
+    std::span<const Symbol* const> membersArray() const;
+
     /// @brief Gets a pointer to the first member in the scope.
     ///
     /// @note This does not force elaboration of the scope.
@@ -242,6 +278,30 @@ public:
         /// This is mutated as the scope is elaborated.
         SymbolMap importedSymbols;
 
+        /// The result of probing the full wildcard import chain for a name,
+        /// recorded so that later lookups of the same name don't search
+        /// every imported package again.
+        struct ImportProbe {
+            /// The symbol found, or nullptr if no package provides the name.
+            const Symbol* imported = nullptr;
+
+            /// The import directive that provided the symbol, if any.
+            const WildcardImportSymbol* import = nullptr;
+
+            /// The number of wildcard imports registered when this entry was
+            /// recorded; entries become stale when more imports appear.
+            uint32_t importCount = 0;
+
+            /// True if a probed import had an unresolvable package, which
+            /// suppresses undeclared-identifier diagnostics.
+            bool suppressUndeclared = false;
+        };
+
+        /// Cached full-chain probe results by name, both positive and
+        /// negative. Only valid for lookups whose location can see the
+        /// entire import chain.
+        flat_hash_map<std::string_view, ImportProbe, SymbolMapHasher, SymbolMapEqual> probeCache;
+
         /// True if we have called forceElaborate on this scope to
         /// ensure that we've seen all imported names.
         bool hasForceElaborated = false;
@@ -333,7 +393,9 @@ private:
     const Symbol* thisSym;
 
     // The map of names to members that can be looked up within this scope.
-    SymbolMap* nameMap;
+    // Scopes that have never had a named member inserted all point at one
+    // shared empty map; the first insertion swaps in a real one.
+    mutable SymbolMap* nameMap;
 
     // A linked list of member symbols in the scope. These are mutable because a
     // scope might have only deferred members, and realization of deferred members
@@ -342,6 +404,10 @@ private:
     mutable const Symbol* firstMember = nullptr;
     mutable const Symbol* lastMember = nullptr;
 
+    // A cached contiguous array of the scope's members, built on demand by
+    // membersArray() and reset whenever the member list changes.
+    mutable std::span<const Symbol* const> cachedMemberArray;
+
     // If this scope has any deferred member symbols they'll be temporarily
     // stored in a sideband list in the compilation object until we expand them.
     mutable DeferredMemberIndex deferredMemberIndex{0};
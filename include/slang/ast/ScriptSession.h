@@ -37,6 +37,19 @@ public:
     /// and returns the result as a constant value.
     ConstantValue eval(std::string_view text);
 
+    /// @brief Evaluates a batch of expression snippets in one call.
+    ///
+    /// All snippets are parsed and bound up front against the current
+    /// session state and then evaluated independently, each with a fresh
+    /// evaluation context seeded with the session's local variables;
+    /// side effects on session state are not preserved. When @a pool is
+    /// provided the evaluations run concurrently across its threads.
+    ///
+    /// Only expression snippets are supported here; any snippet that is
+    /// not an expression yields an empty value in the result list.
+    std::vector<ConstantValue> evalBatch(std::span<const std::string_view> texts,
+                                         ThreadPool* pool = nullptr);
+
     /// Tries to evaluate the given expression tree and returns the
     /// result as a constant value.
     ConstantValue evalExpression(const syntax::ExpressionSyntax& expr);
@@ -52,6 +65,7 @@ private:
     std::vector<std::shared_ptr<syntax::SyntaxTree>> syntaxTrees;
     ASTContext astCtx;
     EvalContext evalContext;
+    Diagnostics batchDiags;
 };
 
 } // namespace slang::ast
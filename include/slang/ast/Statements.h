@@ -520,6 +520,62 @@ public:
     }
 };
 
+/// @brief A lazily built table that accelerates constant evaluation of case
+/// statements whose item expressions are all context-independent constants.
+///
+/// Exact arms dispatch through a single hash probe; wildcard arms are reduced
+/// to precomputed care-mask / care-value pairs checked in declaration order.
+struct CaseMatchTable {
+    /// An arm containing wildcard bits, reduced to the set of bits that must
+    /// match and the values they must have.
+    struct WildcardArm {
+        /// A mask of the bits the arm actually cares about.
+        SVInt careMask;
+
+        /// The required values of the cared-about bits.
+        SVInt careValue;
+
+        /// The ordinal of the arm across the whole statement.
+        uint32_t order;
+
+        /// The index of the item group the arm belongs to.
+        uint32_t group;
+    };
+
+    /// Hashes keys consistently with ExactKeyEqual: the bit width, unknown
+    /// flag, and raw words all participate.
+    struct ExactKeyHasher {
+        size_t operator()(const SVInt& key) const {
+            size_t seed = 0;
+            hash_combine(seed, key.getBitWidth(), key.hasUnknown(), key.hash());
+            return seed;
+        }
+    };
+
+    /// Compares keys by exact 4-state equality, i.e. case-equality (===)
+    /// semantics. SVInt's own operator== is a 4-state comparison yielding
+    /// X in the presence of unknown bits, which is unusable for a hash
+    /// table, and bare exactlyEqual would extend mismatched widths in a
+    /// way the hasher can't see; requiring identical widths keeps the two
+    /// consistent.
+    struct ExactKeyEqual {
+        bool operator()(const SVInt& lhs, const SVInt& rhs) const {
+            return lhs.getBitWidth() == rhs.getBitWidth() &&
+                   lhs.hasUnknown() == rhs.hasUnknown() && exactlyEqual(lhs, rhs);
+        }
+    };
+
+    /// Arms that must match the selector exactly, mapped to the ordinal of
+    /// the arm across the whole statement and the index of its item group.
+    flat_hash_map<SVInt, std::pair<uint32_t, uint32_t>, ExactKeyHasher, ExactKeyEqual> exact;
+
+    /// Wildcard arms, in declaration order.
+    std::vector<WildcardArm> wildcards;
+
+    /// The common bit width of all of the arms.
+    bitwidth_t bitWidth = 0;
+};
+
 /// Represents a case statement.
 class SLANG_EXPORT CaseStatement : public Statement {
 public:
@@ -579,6 +635,19 @@ public:
         if (defaultCase)
             defaultCase->visit(visitor);
     }
+
+    /// Pre-builds the lazily-constructed constant dispatch table used during
+    /// evaluation, if one hasn't been attempted yet. Useful before evaluating
+    /// the statement from several threads at once, since the table would
+    /// otherwise be built and cached on first use.
+    void warmMatchTable(EvalContext& context) const;
+
+private:
+    // A table for dispatching constant arms without scanning all of them,
+    // built on the first evaluation that can make use of it. Remains null
+    // if any arm turns out to depend on the evaluation context.
+    mutable const CaseMatchTable* matchTable = nullptr;
+    mutable bool matchTableTried = false;
 };
 
 /// Represents a pattern case statement.
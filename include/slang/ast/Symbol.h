@@ -137,6 +137,17 @@ public:
     /// The type of symbol.
     SymbolKind kind;
 
+private:
+    // The members hottest during traversal -- the kind above, the ordering
+    // index (packed into the kind's padding), and the intrusive scope links
+    // -- are laid out together at the front of the object so that full
+    // design walks touch as few cache lines per symbol as possible. Colder
+    // data like the source location and originating syntax sits behind them.
+    mutable SymbolIndex indexInScope{0};
+    mutable const Scope* parentScope = nullptr;
+    mutable const Symbol* nextInScope = nullptr;
+
+public:
     /// The name of the symbol; if the symbol does not have a name,
     /// this will be an empty string.
     std::string_view name;
@@ -289,17 +300,16 @@ private:
 
     const Scope* scopeOrNull() const;
 
-    // When a symbol is first added to a scope a pointer to it will be stored here.
-    // Along with that pointer, a linked list of members in the scope will be created
-    // by using the nextInScope pointer, and the index within the scope (used to quickly
-    // determine ordering during lookups) will be set here.
-    mutable const Scope* parentScope = nullptr;
-    mutable const Symbol* nextInScope = nullptr;
-    mutable SymbolIndex indexInScope{0};
-
+    // When a symbol is first added to a scope a pointer to it will be stored
+    // in parentScope above. Along with that pointer, a linked list of members
+    // in the scope will be created by using the nextInScope pointer, and the
+    // index within the scope (used to quickly determine ordering during
+    // lookups) will be set in indexInScope.
     const syntax::SyntaxNode* originatingSyntax = nullptr;
 };
 
+static_assert(sizeof(Symbol) == 56);
+
 inline SymbolIndex operator+(SymbolIndex si, uint32_t offset) {
     return SymbolIndex(uint32_t(si) + offset);
 }
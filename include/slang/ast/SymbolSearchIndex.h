@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+//! @file SymbolSearchIndex.h
+//! @brief Ranked substring search over all symbol names in a design
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "slang/util/Hash.h"
+#include "slang/util/Util.h"
+
+namespace slang::ast {
+
+class Compilation;
+class Symbol;
+
+/// @brief A search index over all symbol names in an elaborated design.
+///
+/// The index assigns every named symbol a dense id and maps each trigram
+/// of its (case-folded) name to the ids containing it, so that substring
+/// queries only ever examine the symbols whose names share all of the
+/// query's trigrams rather than scanning the whole design. It is intended
+/// for interactive tooling such as editor completion, where queries must
+/// return ranked results in a few milliseconds even for large designs.
+///
+/// The index is a snapshot: it holds plain pointers into the compilation
+/// it was built from and must not outlive it, and symbols added to the
+/// design afterwards are not visible to queries.
+class SLANG_EXPORT SymbolSearchIndex {
+public:
+    /// A single ranked query result.
+    struct Result {
+        /// The matched symbol.
+        const Symbol* symbol = nullptr;
+
+        /// The match score; higher is better. Exact name matches score
+        /// above prefix matches, which score above interior substrings.
+        int score = 0;
+    };
+
+    /// Builds an index over all named symbols in the design rooted
+    /// at the given compilation. Forces full elaboration.
+    explicit SymbolSearchIndex(Compilation& compilation);
+
+    /// Gets the number of symbols in the index.
+    size_t size() const { return symbols.size(); }
+
+    /// @brief Performs a ranked, case-insensitive substring search.
+    ///
+    /// Returns up to @a maxResults symbols whose names contain @a query,
+    /// ordered from best to worst match.
+    std::vector<Result> lookup(std::string_view query, size_t maxResults = 100) const;
+
+private:
+    // Dense id -> symbol and its case-folded name.
+    std::vector<const Symbol*> symbols;
+    std::vector<std::string> foldedNames;
+
+    // Trigram of a folded name -> sorted ids of symbols containing it.
+    flat_hash_map<uint32_t, std::vector<uint32_t>> trigrams;
+};
+
+} // namespace slang::ast
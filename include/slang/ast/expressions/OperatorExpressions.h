@@ -111,6 +111,8 @@ public:
     }
 
 private:
+    ConstantValue evalWithLhs(EvalContext& context, ConstantValue&& cvl) const;
+
     static void analyzeOpTypes(const Type& clt, const Type& crt, const Type& originalLt,
                                const Type& originalRt, const Expression& lhs, const Expression& rhs,
                                const ASTContext& context, SourceRange opRange, DiagCode code,
@@ -137,7 +137,6 @@ public:
 /// Represents an array of generate blocks, as generated by a loop generate construct.
 class SLANG_EXPORT GenerateBlockArraySymbol : public Symbol, public Scope {
 public:
-    std::span<const GenerateBlockSymbol* const> entries;
     uint32_t constructIndex;
     bool valid = false;
 
@@ -146,6 +145,14 @@ public:
         Symbol(SymbolKind::GenerateBlockArray, name, loc), Scope(compilation, this),
         constructIndex(constructIndex) {}
 
+    /// Gets the generate blocks that make up this array, one per loop iteration.
+    /// The loop itself is evaluated eagerly but the iteration scopes are only
+    /// materialized when the array is first elaborated.
+    std::span<const GenerateBlockSymbol* const> getEntries() const {
+        ensureElaborated();
+        return entries;
+    }
+
     std::string getExternalName() const;
 
     void serializeTo(ASTSerializer& serializer) const;
@@ -157,6 +164,17 @@ public:
                                                 uint32_t constructIndex);
 
     static bool isKind(SymbolKind kind) { return kind == SymbolKind::GenerateBlockArray; }
+
+private:
+    friend class Scope;
+
+    void elaborateEntries(function_ref<void(const Symbol&)> insertCB) const;
+
+    mutable std::span<const GenerateBlockSymbol* const> entries;
+
+    // The evaluated genvar value for each loop iteration, used to build the
+    // iteration scopes on demand.
+    std::span<const ConstantValue* const> indexValues;
 };
 
 } // namespace slang::ast
@@ -59,7 +59,7 @@ public:
     /// Searches for a symbol by name, in the context of importing from the package.
     /// This is similar to a call to find() but also includes symbols that have been
     /// exported from the package.
-    const Symbol* findForImport(std::string_view name) const;
+    const Symbol* findForImport(const HashedName& name) const;
 
     void serializeTo(ASTSerializer&) const {}
 
@@ -33,6 +33,7 @@ class PrimitiveSymbol;
 class TimingControl;
 struct BindDirectiveInfo;
 struct ConfigRule;
+struct ParameterEnvironment;
 struct ResolvedConfig;
 struct HierarchyOverrideNode;
 enum class DriveStrength : int;
@@ -182,8 +183,23 @@ public:
 
     const DefinitionSymbol& getDefinition() const { return definition; }
 
+    /// Gets the canonical interned parameter environment for this body; see
+    /// Compilation::getParameterEnv. Two bodies of the same definition with
+    /// identical parameter values share one environment object, so the
+    /// results can be compared by pointer. Resolves the body's parameter
+    /// values on first use; the result is cached.
+    const ParameterEnvironment& getParameterEnv() const;
+
     bool hasSameType(const InstanceBodySymbol& other) const;
 
+    /// Computes a hash of the semantic content of this instance body: its
+    /// definition, parameter values, port and member types, and statements.
+    /// Hashes of child instance bodies are folded in by value, merkle-style,
+    /// so two bodies with equal hashes have structurally equivalent subtrees
+    /// and a design diff can skip descending into them. The body must be
+    /// fully elaborated; the result is cached.
+    uint64_t getStructuralHash() const;
+
     static InstanceBodySymbol& fromDefinition(
         Compilation& compilation, const DefinitionSymbol& definition, SourceLocation instanceLoc,
         bitmask<InstanceFlags> flags, const HierarchyOverrideNode* hierarchyOverrideNode,
@@ -207,6 +223,8 @@ private:
     const DefinitionSymbol& definition;
     mutable std::span<const Symbol* const> portList;
     std::span<const ParameterSymbolBase* const> parameters;
+    mutable std::optional<uint64_t> structuralHash;
+    mutable const ParameterEnvironment* paramEnv = nullptr;
 };
 
 class SLANG_EXPORT InstanceArraySymbol : public Symbol, public Scope {
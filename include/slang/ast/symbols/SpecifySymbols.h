@@ -21,8 +21,37 @@ class SLANG_EXPORT SpecifyBlockSymbol : public Symbol, public Scope {
 public:
     enum class SpecifyTerminalDir { Input, Output, Both };
 
+    /// A compact record of one timing path declaration, with all of its
+    /// resolved pieces gathered in one place. Gate-level libraries can carry
+    /// enormous numbers of paths per cell, and consumers like timing
+    /// exporters iterate every arc in bulk; this form lets them do that over
+    /// a contiguous array instead of chasing per-symbol lazy state.
+    struct TimingArc {
+        /// The symbol for the path declaration this arc came from.
+        const TimingPathSymbol* path = nullptr;
+
+        /// The source (input) terminal expressions of the path.
+        std::span<const Expression* const> inputs;
+
+        /// The destination (output) terminal expressions of the path.
+        std::span<const Expression* const> outputs;
+
+        /// The delay value expressions assigned to the path.
+        std::span<const Expression* const> delays;
+
+        /// The state-dependent condition of the path, if any.
+        const Expression* condition = nullptr;
+
+        /// The edge source expression of the path, if any.
+        const Expression* edgeSource = nullptr;
+    };
+
     SpecifyBlockSymbol(Compilation& compilation, SourceLocation loc);
 
+    /// Returns all timing paths declared in this block, in declaration order,
+    /// resolved in a single pass and packed into contiguous storage.
+    std::span<const TimingArc> getTimingArcs() const;
+
     static SpecifyBlockSymbol& fromSyntax(const Scope& scope,
                                           const syntax::SpecifyBlockSyntax& syntax,
                                           SmallVector<const Symbol*>& implicitSymbols);
@@ -34,6 +63,10 @@ public:
     void serializeTo(ASTSerializer&) const {}
 
     static bool isKind(SymbolKind kind) { return kind == SymbolKind::SpecifyBlock; }
+
+private:
+    mutable bool arcsResolved = false;
+    mutable std::span<const TimingArc> timingArcs;
 };
 
 using TimingPathMap =
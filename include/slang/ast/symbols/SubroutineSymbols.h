@@ -119,6 +119,18 @@ public:
     /// Returns true if the subroutine has output, inout, or non-const ref arguments.
     bool hasOutputArgs() const;
 
+    /// Returns true if the subroutine meets the structural requirements for being
+    /// invoked in a constant expression: a non-void, non-virtual function with only
+    /// input arguments that is not declared inside a generate block. The verdict
+    /// is cached so that repeated constant calls don't redo the analysis.
+    bool isConstEvalCompatible() const;
+
+    /// If the function body is trivially a single return statement, returns the
+    /// returned expression so that constant calls can evaluate it directly instead
+    /// of executing the body statement by statement. Returns nullptr for anything
+    /// more complicated. The verdict is cached after the first query.
+    const Expression* getInlinedReturnExpr() const;
+
     const Statement& getBody() const;
     const Type& getReturnType() const { return declaredReturnType.getType(); }
 
@@ -183,6 +195,8 @@ private:
     mutable const SubroutineSymbol* overrides = nullptr;
     mutable const MethodPrototypeSymbol* prototype = nullptr;
     mutable std::optional<bool> cachedHasOutputArgs;
+    mutable std::optional<bool> cachedConstEvalOk;
+    mutable std::optional<const Expression*> cachedInlineExpr;
     mutable bool isConstructing = false;
 };
 
@@ -69,6 +69,11 @@ public:
 
     void addDriver(DriverBitRange bounds, const ValueDriver& driver) const;
 
+    /// Adds the given driver to this symbol for each of the given bit ranges.
+    /// This is equivalent to calling @a addDriver once per range but does the
+    /// per-symbol setup and overlap configuration only once for the batch.
+    void addDrivers(std::span<const DriverBitRange> boundsList, const ValueDriver& driver) const;
+
     std::ranges::subrange<DriverIntervalMap::const_iterator> drivers() const {
         return {driverMap.begin(), driverMap.end()};
     }
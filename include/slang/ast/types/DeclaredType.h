@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <atomic>
+
 #include "slang/syntax/SyntaxFwd.h"
 #include "slang/syntax/SyntaxNode.h"
 
@@ -109,7 +111,7 @@ public:
 
     /// Manually sets the resolved type, overriding anything that may have been
     /// resolved previously.
-    void setType(const Type& newType) { type = &newType; }
+    void setType(const Type& newType) { type.store(&newType, std::memory_order_release); }
 
     /// Sets the source syntax for the type, which will later be used when
     /// resolution is requested.
@@ -144,7 +146,9 @@ public:
 
     /// Manually sets the resolved initializer expression, overriding anything
     /// that may have been resolved previously.
-    void setInitializer(const Expression& expr) { initializer = &expr; }
+    void setInitializer(const Expression& expr) {
+        initializer.store(&expr, std::memory_order_release);
+    }
 
     /// Sets the syntax for the initializer expression, which will be later used
     /// when resolution is requested.
@@ -216,14 +220,19 @@ private:
 
     const Symbol& parent;
 
-    mutable const Type* type = nullptr;
+    // The resolved type and initializer are published with release stores
+    // (and read back with acquire loads) so that a fully elaborated design
+    // can be traversed concurrently by read-only threads. Resolution itself
+    // still mutates the compilation and so must not run concurrently; the
+    // atomics only make observing an already-published result safe.
+    mutable std::atomic<const Type*> type{nullptr};
     union {
         const syntax::DataTypeSyntax* typeSyntax = nullptr;
         const DeclaredType* link;
     } typeOrLink;
     const syntax::SyntaxList<syntax::VariableDimensionSyntax>* dimensions = nullptr;
 
-    mutable const Expression* initializer = nullptr;
+    mutable std::atomic<const Expression*> initializer{nullptr};
     const syntax::ExpressionSyntax* initializerSyntax = nullptr;
     SourceLocation initializerLocation;
 
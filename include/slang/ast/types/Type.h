@@ -15,9 +15,40 @@
 namespace slang::ast {
 
 class Compilation;
+class FieldSymbol;
 struct LookupResult;
 enum class RandMode;
 
+/// @brief Describes the bit-level layout of a struct or union type.
+///
+/// The layout is computed once per canonical type and cached by the
+/// compilation, so tools that repeatedly map fields to bit ranges (emitters,
+/// bitstream packing, coverage) can index a flat table instead of re-walking
+/// the member list. Offsets are relative to bit zero of the whole type: for
+/// packed types they count from the LSB, and for unpacked types they are in
+/// "selectable" bits, matching FieldSymbol::bitOffset.
+struct SLANG_EXPORT TypeBitLayout {
+    /// Describes one field of the type.
+    struct FieldInfo {
+        /// The field symbol itself.
+        const FieldSymbol* field = nullptr;
+
+        /// The bit offset of the field within the type.
+        uint64_t offset = 0;
+
+        /// The width of the field in bits.
+        uint64_t width = 0;
+    };
+
+    /// The total width of the type in bits; the bit width for packed types
+    /// and the selectable width for unpacked types.
+    uint64_t totalWidth = 0;
+
+    /// The fields of the type in declaration order, indexable
+    /// by FieldSymbol::fieldIndex.
+    std::span<const FieldInfo> fields;
+};
+
 /// Specifies possible traits for integral types.
 enum class SLANG_EXPORT IntegralFlags : uint8_t {
     /// The type is unsigned. This is the default.
@@ -70,6 +101,13 @@ public:
     /// types are given the size of 1 for selection purposes.
     uint64_t getSelectableWidth() const;
 
+    /// @brief Gets the cached bit-level layout of this type if it is a
+    /// struct or union type (packed or unpacked), otherwise returns nullptr.
+    ///
+    /// Array layouts aren't tabulated since they are uniform; use
+    /// getArrayElementType / getFixedRange to compute element strides.
+    const TypeBitLayout* getBitLayout() const;
+
     /// Indicates whether the type can represent negative numeric values. For non-numeric types,
     /// this always returns false.
     bool isSigned() const;
@@ -17,6 +17,7 @@ class FormatBuffer;
 namespace slang::ast {
 
 class ClassType;
+class Compilation;
 class CovergroupType;
 
 /// A collection of type printing options.
@@ -119,6 +120,15 @@ private:
     TypePrinter printer;
     flat_hash_set<const Type*> seenTypes;
     flat_hash_set<const Type*> typesToDisambiguate;
+
+    // Memoized renderings of types that have already been formatted. The key
+    // combines the type pointer with the per-call option bits (types are at
+    // least pointer aligned so the low bits are free). The cache is tied to a
+    // single compilation and flushed when types from a different compilation
+    // show up, since formatter instances are shared between engines and can
+    // outlive the arenas that back the types they've seen.
+    flat_hash_map<uintptr_t, std::string> formatCache;
+    const Compilation* cachedCompilation = nullptr;
 };
 
 } // namespace slang::ast
@@ -251,6 +251,27 @@ private:
     // A global mapping from diagnostic to the message it should display.
     flat_hash_map<DiagCode, std::string> messageTable;
 
+    // A format string pre-split into literal text and argument slots, so that
+    // repeated issuances of the same diagnostic skip format string parsing.
+    // Only sequential "{}" replacement fields are compiled; format strings
+    // with explicit specs or positional indices keep @a simple false and fall
+    // back to fmt::vformat.
+    struct CompiledFormat {
+        struct Piece {
+            std::string literal; // text preceding the argument slot
+            bool hasArg = false; // true if an argument slot follows the text
+        };
+        std::vector<Piece> pieces;
+        size_t argSlots = 0;
+        bool simple = false;
+    };
+
+    const CompiledFormat& getCompiledFormat(DiagCode code) const;
+
+    // Lazily compiled format strings by code, invalidated when the
+    // corresponding message is overridden.
+    mutable flat_hash_map<DiagCode, CompiledFormat> formatCache;
+
     // A set of buffers for which we have reported an include stack,
     // so that we don't do it more than once.
     flat_hash_set<BufferID> reportedIncludeStack;
@@ -259,6 +280,12 @@ private:
     // These correspond to `pragma diagnostic entries in the source code.
     flat_hash_map<DiagCode, flat_hash_map<BufferID, std::vector<DiagnosticMapping>>> diagMappings;
 
+    // An approximate-membership filter over the codes present in diagMappings.
+    // Most issued diagnostics have no in-source mapping for their code, so a
+    // single bit test lets them skip the map probe (and the macro expansion
+    // walk needed to compute the file location for it).
+    uint64_t mappedCodesFilter = 0;
+
     // A list of path patterns in which to suppress warnings.
     std::vector<std::filesystem::path> ignoreWarnPatterns;
     std::vector<std::filesystem::path> ignoreMacroWarnPatterns;
@@ -116,8 +116,12 @@ public:
 
     // Diagnostic-specific arguments that can be used to better report messages.
     using Arg = std::variant<std::string, int64_t, uint64_t, char, ConstantValue, CustomArgType>;
-    std::vector<Arg> args;
-    std::vector<SourceRange> ranges;
+
+    // The vast majority of diagnostics carry at most two arguments and
+    // highlight ranges, so store that many inline to avoid heap traffic
+    // when issuing them.
+    SmallVector<Arg, 2> args;
+    SmallVector<SourceRange, 2> ranges;
     std::vector<Diagnostic> notes;
     std::optional<size_t> coalesceCount;
 
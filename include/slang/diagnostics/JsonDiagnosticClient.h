@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+//! @file JsonDiagnosticClient.h
+//! @brief Diagnostic client that streams one JSON record per diagnostic
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <iosfwd>
+
+#include "slang/diagnostics/DiagnosticClient.h"
+
+namespace slang {
+
+/// @brief A diagnostic client that writes one newline-delimited JSON object
+/// per diagnostic directly to an output stream as each one is issued.
+///
+/// Each record carries the location, severity, message, and warning option
+/// name; nothing is buffered and the stream is flushed after every record,
+/// so a consumer sees the first diagnostic at issuance rather than at the
+/// end of compilation. The expensive fields -- the source line excerpt and
+/// the macro expansion backtrace -- are omitted by default and can be
+/// enabled per client for consumers that want them.
+class SLANG_EXPORT JsonDiagnosticClient : public DiagnosticClient {
+public:
+    explicit JsonDiagnosticClient(std::ostream& os) : os(os) {}
+
+    /// Sets whether the source line containing each diagnostic is included
+    /// in its record. Off by default; reading the line back from the source
+    /// buffer is the most expensive part of rendering a diagnostic.
+    void showSourceLine(bool show) { includeSourceLine = show; }
+
+    /// Sets whether the macro expansion backtrace (one location record per
+    /// expansion level) is included. Off by default.
+    void showMacroExpansion(bool show) { includeExpansion = show; }
+
+    void report(const ReportedDiagnostic& diagnostic) override;
+
+private:
+    std::ostream& os;
+    bool includeSourceLine = false;
+    bool includeExpansion = false;
+};
+
+} // namespace slang
@@ -0,0 +1,38 @@
+//------------------------------------------------------------------------------
+//! @file StreamingDiagnosticClient.h
+//! @brief Diagnostic client that streams one line per diagnostic
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <iosfwd>
+
+#include "slang/diagnostics/DiagnosticClient.h"
+
+namespace slang {
+
+/// @brief A diagnostic client that writes a single plain formatted line per
+/// diagnostic directly to an output stream as each one is issued.
+///
+/// Unlike TextDiagnosticClient this renders no source excerpts, caret lines,
+/// include stacks, or macro expansion backtraces, and it buffers nothing:
+/// each diagnostic is emitted immediately in the form
+///
+///     file:line:col: severity: message [-Woption]
+///
+/// which is intended for machine consumers (CI log scrapers and the like)
+/// where rendering millions of decorated diagnostics would dominate the
+/// report phase.
+class SLANG_EXPORT StreamingDiagnosticClient : public DiagnosticClient {
+public:
+    explicit StreamingDiagnosticClient(std::ostream& os) : os(os) {}
+
+    void report(const ReportedDiagnostic& diagnostic) override;
+
+private:
+    std::ostream& os;
+};
+
+} // namespace slang
@@ -13,6 +13,7 @@
 #include "slang/text/SourceManager.h"
 #include "slang/util/Bag.h"
 #include "slang/util/CommandLine.h"
+#include "slang/util/Function.h"
 #include "slang/util/LanguageVersion.h"
 #include "slang/util/OS.h"
 #include "slang/util/Util.h"
@@ -99,10 +100,23 @@ public:
         /// If true, library files will inherit macro definitions from primary source files.
         std::optional<bool> librariesInheritMacros;
 
+        /// If true, library files are pre-scanned for the declarations they provide
+        /// and are only fully parsed when one of those declarations is referenced.
+        std::optional<bool> lazyLibraries;
+
         /// If true, the preprocessor will support legacy protected envelope directives,
         /// for compatibility with old Verilog tools.
         std::optional<bool> enableLegacyProtect;
 
+        /// If true, the lexer will canonicalize whitespace trivia on tokens
+        /// instead of recording the original text, which saves time and
+        /// memory during batch compiles.
+        std::optional<bool> compactWhitespaceTrivia;
+
+        /// If true, fully expanded macro usages will be cached and replayed
+        /// for later textually identical usages of the same macro.
+        std::optional<bool> enableMacroCache;
+
         /// A set of preprocessor directives to be ignored.
         std::vector<std::string> ignoreDirectives;
 
@@ -116,9 +130,18 @@ public:
         /// The maximum number of lexer errors that can be encountered before giving up.
         std::optional<uint32_t> maxLexerErrors;
 
+        /// The maximum number of tokens to skip during parser error recovery in a
+        /// single member before scanning ahead to the next member boundary.
+        std::optional<uint32_t> errorRecoveryLimit;
+
         /// The number of threads to use for parsing.
         std::optional<uint32_t> numThreads;
 
+        /// If true, pin each worker thread to a distinct CPU. On multi-socket
+        /// machines this keeps the memory a worker allocates local to the
+        /// NUMA node that will use it.
+        std::optional<bool> threadAffinity;
+
         /// @}
         /// @name Compilation
         /// @{
@@ -154,10 +177,19 @@ public:
         /// of (min:typ:max) expressions is valid for this compilation.
         std::optional<std::string> minTypMax;
 
+        /// A string indicating a member of @a ElaborationMode to indicate
+        /// how deeply the design should be elaborated.
+        std::optional<std::string> elabMode;
+
         /// A string that indicates the default time scale to use for
         /// any design elements that don't specify one explicitly.
         std::optional<std::string> timeScale;
 
+        /// A string indicating the expected scale of the design ("small" or
+        /// "large"), used to pre-size compilation data structures. If not set,
+        /// an estimate is derived from the number of loaded source files.
+        std::optional<std::string> designSizeHint;
+
         /// A collection of flags that control compilation.
         std::map<ast::CompilationFlags, std::optional<bool>> compilationFlags;
 
@@ -166,6 +198,30 @@ public:
         /// based on which modules are unreferenced elsewhere.
         std::vector<std::string> topModules;
 
+        /// If set to true, each entry in @a topModules is elaborated and diagnosed
+        /// in its own isolated compilation instead of all tops sharing one design.
+        /// The per-top compilations share the parsed syntax trees and can run
+        /// concurrently.
+        std::optional<bool> compilePerTop;
+
+        /// If set, the path of a file recording per-top elaboration times.
+        /// When per-top compilations run concurrently, times from a previous
+        /// run are used to start the most expensive tops first, and the file
+        /// is rewritten with the times measured by this run.
+        std::optional<std::string> elabProfile;
+
+        /// If set, partitions the top modules of the design into this many
+        /// disjoint shards so that separate processes (e.g. on a compile farm)
+        /// can each elaborate one subset. The partition is computed
+        /// deterministically from the sorted list of top module names, so
+        /// every process arrives at the same assignment independently.
+        /// Requires @a shardIndex.
+        std::optional<uint32_t> shardCount;
+
+        /// The zero-based index of the shard of top modules that this process
+        /// should elaborate when @a shardCount is set.
+        std::optional<uint32_t> shardIndex;
+
         /// A list of parameters to override, of the form &lt;name>=&lt;value> -- note that
         /// for now at least this only applies to parameters in top-level modules.
         std::vector<std::string> paramOverrides;
@@ -206,12 +262,49 @@ public:
         /// include hierarchy paths in printed diagnostics.
         std::optional<std::string> diagHierarchy;
 
+        /// The overall diagnostic output format; either "text" for the
+        /// default decorated human-readable output or "oneline" to stream
+        /// a single undecorated line per diagnostic as it is issued.
+        std::optional<std::string> diagFormat;
+
         /// The maximum number of errors to print before giving up.
         std::optional<uint32_t> errorLimit;
 
         /// A list of warning options that will be passed to the DiagnosticEngine.
         std::vector<std::string> warningOptions;
 
+        /// If set to true, a report of memory usage by category is printed
+        /// after compilation finishes.
+        std::optional<bool> memReport;
+
+        /// If set to true, elaboration progress (current phase, instances
+        /// processed, live memory) is periodically reported to stderr
+        /// while analysis runs.
+        std::optional<bool> showProgress;
+
+        /// If set to true, a report of sequence / property / let expansion
+        /// counts and depths is printed after compilation finishes.
+        std::optional<bool> assertionReport;
+
+        /// If set to true, a report of per-definition elaboration cost
+        /// estimates is printed after compilation finishes.
+        std::optional<bool> elabCostReport;
+
+        /// If set, a soft limit in megabytes on the memory retained by parsed
+        /// syntax trees. When the parsed trees exceed the limit they are
+        /// compacted in place, largest first, to shed parse-time allocation
+        /// slack before elaboration begins.
+        std::optional<uint64_t> memoryLimit;
+
+        /// If set, a compact binary summary of the compile (diagnostics,
+        /// file dependencies, top-level modules) is written to this path.
+        std::optional<std::string> resultFile;
+
+        /// If set, a structured JSON telemetry report (phase timings, memory
+        /// usage, cache statistics, diagnostic counts) is written to this
+        /// path after compilation finishes.
+        std::optional<std::string> telemetryFile;
+
         /// @}
         /// @name File lists
         /// @{
@@ -220,6 +313,14 @@ public:
         /// compilation unit, meaning all of their text will be merged together.
         std::optional<bool> singleUnit;
 
+        /// If set to true, source files will be memory mapped instead of
+        /// copied into allocated buffers when loaded.
+        std::optional<bool> enableMemoryMapping;
+
+        /// A list of source package files (previously written via the
+        /// --precompile flow) from which to load library files.
+        std::vector<std::string> loadPackages;
+
         /// A set of extensions that will be used to exclude files.
         flat_hash_set<std::string> excludeExts;
 
@@ -303,6 +404,22 @@ public:
     /// Creates a compilation object from all of the current loaded state of the driver.
     [[nodiscard]] std::unique_ptr<ast::Compilation> createCompilation();
 
+    /// @brief Runs a parameter sweep, invoking @a callback once per sweep point.
+    ///
+    /// Each sweep point is a list of `<name>=<value>` parameter overrides that
+    /// replaces any -G overrides from the command line for that point. All
+    /// points share the already-parsed syntax trees, so the design is parsed
+    /// exactly once for the whole sweep; each point then gets its own fresh
+    /// compilation built from those trees. Elaboration is lazy, so a callback
+    /// that queries only the values it cares about forces only the cone of
+    /// instances those values depend on rather than the full design.
+    ///
+    /// Symbols and types are arena-allocated per compilation and cannot be
+    /// shared across sweep points; the compilation passed to the callback is
+    /// destroyed before the next point begins.
+    void runParameterSweep(std::span<const std::vector<std::string>> sweepPoints,
+                           function_ref<void(size_t index, ast::Compilation& compilation)> callback);
+
     /// Reports all parsing diagnostics found in all of the @a syntaxTrees
     /// @returns true on success and false if errors were encountered.
     [[nodiscard]] bool reportParseDiags();
@@ -313,17 +430,61 @@ public:
     /// @returns true if compilation succeeded and false if errors were encountered.
     [[nodiscard]] bool reportCompilation(ast::Compilation& compilation, bool quiet);
 
+    /// @brief Elaborates and reports each requested top module in its own
+    /// isolated compilation.
+    ///
+    /// All compilations share the already-parsed syntax trees, so shared
+    /// libraries and packages are parsed only once for the whole batch.
+    /// Elaboration runs concurrently on a thread pool sized by the --threads
+    /// option; diagnostics are then reported serially in the order the tops
+    /// were specified, with counts reset in between, so the output matches
+    /// running each top in a separate process.
+    ///
+    /// If @a quiet is set to true, non-essential output will be suppressed.
+    /// @returns true if all of the compilations succeeded
+    [[nodiscard]] bool reportPerTopCompilations(bool quiet);
+
+    /// @brief Writes a compact binary summary of the compile to the given file.
+    ///
+    /// The summary contains all diagnostics, the list of files the compile
+    /// depended on, and the names of the top-level modules, laid out as
+    /// fixed-size records pointing into a string table so that build tooling
+    /// can map the file directly instead of reparsing textual output.
+    /// See the implementation for the exact layout; the format is not
+    /// guaranteed to be stable across slang versions.
+    ///
+    /// @returns true on success and false if the file could not be written
+    bool writeResultFile(ast::Compilation& compilation, const std::filesystem::path& path);
+
+    /// @brief Writes a structured JSON telemetry report to the given file.
+    ///
+    /// The report is a single JSON object covering wall-clock phase timings,
+    /// memory usage by category, memoization cache entry and hit counts, and
+    /// diagnostic counts, so that fleet-wide collectors can ingest per-run
+    /// performance data directly instead of scraping logs. Forwarding the
+    /// values to a metrics backend is left to external tooling.
+    ///
+    /// @returns true on success and false if the file could not be written
+    bool writeTelemetry(ast::Compilation& compilation, const std::filesystem::path& path);
+
 private:
+    std::unique_ptr<ast::Compilation> createCompilation(Bag&& optionBag);
     bool parseUnitListing(std::string_view text);
     void addLibraryFiles(std::string_view pattern);
     void addParseOptions(Bag& bag) const;
     void addCompilationOptions(Bag& bag) const;
     bool reportLoadErrors();
+    void enforceMemoryLimit();
+    bool selectShardTops();
     void printError(const std::string& message);
     void printWarning(const std::string& message);
 
     bool anyFailedLoads = false;
     flat_hash_set<std::filesystem::path> activeCommandFiles;
+
+    // Wall-clock phase durations recorded for telemetry reporting.
+    double parseSeconds = 0.0;
+    double elabSeconds = 0.0;
 };
 
 } // namespace slang::driver
@@ -17,6 +17,7 @@
 
 #include "slang/syntax/SyntaxFwd.h"
 #include "slang/text/Glob.h"
+#include "slang/text/SourceLocation.h"
 #include "slang/util/Hash.h"
 #include "slang/util/Util.h"
 
@@ -40,6 +41,9 @@ struct SLANG_EXPORT SourceOptions {
     /// The number of threads to use for loading and parsing.
     std::optional<uint32_t> numThreads;
 
+    /// If true, pin each parsing worker thread to a distinct CPU.
+    bool threadAffinity = false;
+
     /// If set to true, all source files will be treated as part of a single
     /// compilation unit, meaning all of their text will be merged together.
     bool singleUnit;
@@ -49,6 +53,15 @@ struct SLANG_EXPORT SourceOptions {
 
     /// If true, library files will inherit macro definitions from primary source files.
     bool librariesInheritMacros;
+
+    /// If true, library files are pre-scanned for the names of the declarations
+    /// they provide and are only fully parsed when one of those declarations is
+    /// actually referenced from the rest of the design.
+    bool lazyLibraries;
+
+    /// If true, source files will be memory mapped instead of copied
+    /// into allocated buffers when loaded.
+    bool enableMemoryMapping;
 };
 
 /// @brief Handles loading and parsing of groups of source files
@@ -124,12 +137,37 @@ public:
                          const std::vector<std::string>& includePaths,
                          std::vector<std::string> defines, const std::string& libraryName);
 
+    /// @brief Writes all files that have been added to the loader into a single
+    /// binary source package file at the given path.
+    ///
+    /// A source package bundles the contents of many library files into one
+    /// file (along with their paths and library associations) so that later
+    /// runs can load them via @a loadPackage with a single read instead of
+    /// globbing, stat'ing, and opening each file individually. The format is
+    /// not guaranteed to be stable across slang versions.
+    ///
+    /// @returns true on success and false if errors were encountered;
+    /// any errors are reported via @a getErrors.
+    bool writePackage(const std::filesystem::path& path);
+
+    /// @brief Loads a source package previously written by @a writePackage.
+    ///
+    /// All files in the package are treated as library files; their modules
+    /// are not automatically instantiated.
+    ///
+    /// @returns true on success and false if errors were encountered;
+    /// any errors are reported via @a getErrors.
+    bool loadPackage(const std::filesystem::path& path);
+
     /// Returns a list of all library map syntax trees that have been loaded and parsed.
     const SyntaxTreeList& getLibraryMaps() const { return libraryMapTrees; }
 
     /// Returns true if there is at least one source file to load,
     /// and false if none have been added to the loader.
-    bool hasFiles() const { return !fileEntries.empty(); }
+    bool hasFiles() const { return !fileEntries.empty() || !packageBuffers.empty(); }
+
+    /// Returns the number of source files that have been added to the loader.
+    size_t getFileCount() const { return fileEntries.size(); }
 
     /// Loads all of the sources that have been added to the loader,
     /// but does not parse them. Returns the loaded buffers.
@@ -223,8 +261,11 @@ private:
     flat_hash_set<std::string_view> uniqueExtensions;
     std::vector<std::string> errors;
     SyntaxTreeList libraryMapTrees;
+    std::vector<SourceBuffer> packageBuffers;
 
     static constexpr int MinFilesForThreading = 4;
+    static constexpr size_t MinFilesForReadAhead = 64;
+    static constexpr size_t MaxReadAheadThreads = 64;
 };
 
 } // namespace slang::driver
@@ -476,9 +476,27 @@ public:
     SVInt operator~() const;
     logic_t operator!() const { return !reductionOr(); }
 
-    SVInt operator+(const SVInt& rhs) const;
-    SVInt operator-(const SVInt& rhs) const;
-    SVInt operator*(const SVInt& rhs) const;
+    SLANG_NO_SANITIZE("unsigned-integer-overflow")
+    SVInt operator+(const SVInt& rhs) const {
+        if (isSingleWord() && rhs.isSingleWord() && bitWidth == rhs.bitWidth)
+            return SVInt(bitWidth, val + rhs.val, signFlag);
+        return addSlowCase(rhs);
+    }
+
+    SLANG_NO_SANITIZE("unsigned-integer-overflow")
+    SVInt operator-(const SVInt& rhs) const {
+        if (isSingleWord() && rhs.isSingleWord() && bitWidth == rhs.bitWidth)
+            return SVInt(bitWidth, val - rhs.val, signFlag);
+        return subSlowCase(rhs);
+    }
+
+    SLANG_NO_SANITIZE("unsigned-integer-overflow")
+    SVInt operator*(const SVInt& rhs) const {
+        if (isSingleWord() && rhs.isSingleWord() && bitWidth == rhs.bitWidth)
+            return SVInt(bitWidth, val * rhs.val, signFlag);
+        return mulSlowCase(rhs);
+    }
+
     SVInt operator/(const SVInt& rhs) const;
     SVInt operator%(const SVInt& rhs) const;
     SVInt operator&(const SVInt& rhs) const;
@@ -495,7 +513,13 @@ public:
 
     logic_t operator!=(const SVInt& rhs) const { return !((*this) == rhs); }
 
-    logic_t operator<(const SVInt& rhs) const;
+    logic_t operator<(const SVInt& rhs) const {
+        if (isSingleWord() && rhs.isSingleWord() && bitWidth == rhs.bitWidth &&
+            !(signFlag && rhs.signFlag)) {
+            return logic_t(val < rhs.val);
+        }
+        return lessThanSlowCase(rhs);
+    }
     logic_t operator<=(const SVInt& rhs) const { return (*this < rhs) || (*this == rhs); }
     logic_t operator>(const SVInt& rhs) const { return !(*this <= rhs); }
     logic_t operator>=(const SVInt& rhs) const { return !(*this < rhs); }
@@ -589,6 +613,13 @@ private:
     bitwidth_t countLeadingZerosSlowCase() const;
     bitwidth_t countLeadingOnesSlowCase() const;
 
+    // Slow cases for arithmetic and relational operators; the fast paths
+    // for single word values are inline in the operators themselves.
+    SVInt addSlowCase(const SVInt& rhs) const;
+    SVInt subSlowCase(const SVInt& rhs) const;
+    SVInt mulSlowCase(const SVInt& rhs) const;
+    logic_t lessThanSlowCase(const SVInt& rhs) const;
+
     // Get the number of bits that are useful in the top word
     void getTopWordMask(bitwidth_t& bitsInMsw, uint64_t& mask) const;
 
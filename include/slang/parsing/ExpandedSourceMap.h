@@ -0,0 +1,59 @@
+//------------------------------------------------------------------------------
+//! @file ExpandedSourceMap.h
+//! @brief Zero-copy reconstruction of preprocessed source with provenance
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <vector>
+
+#include "slang/text/SourceLocation.h"
+#include "slang/util/Util.h"
+
+namespace slang::parsing {
+
+class Preprocessor;
+
+/// One contiguous piece of the preprocessed (include- and macro-expanded)
+/// view of a compilation unit. The text is a view directly into an existing
+/// source buffer -- nothing is copied -- and the provenance fields give the
+/// original location of its first character, so concatenating the segments
+/// in order reproduces the expanded text while each expanded range remains
+/// mappable back to where it came from.
+struct SLANG_EXPORT ExpandedSourceSegment {
+    /// The text of the segment, viewing the original source buffer.
+    std::string_view text;
+
+    /// The buffer the text originally came from. Invalid in the rare case
+    /// where provenance could not be determined (synthesized trivia with no
+    /// recorded location), in which case @a offset is meaningless.
+    BufferID buffer;
+
+    /// The offset of the text within its original buffer.
+    size_t offset = 0;
+
+    /// The offset of the text within the reconstructed expanded view.
+    size_t expandedOffset = 0;
+
+    /// True if the text was produced by macro expansion; its provenance
+    /// then points at the macro definition site.
+    bool fromMacro = false;
+};
+
+/// @brief Runs the given preprocessor to completion and returns the
+/// include- and macro-expanded view of its input as an ordered list of
+/// contiguous segments.
+///
+/// The caller pushes sources into the preprocessor first; this drains its
+/// token stream. Directives, disabled `ifdef regions, and skipped text are
+/// excluded, matching preprocessed text output, while whitespace and
+/// comments are retained. Adjacent pieces that continue one another in the
+/// same original buffer are coalesced, so an include file with no macro
+/// usage typically contributes a single segment. No text is copied and no
+/// re-lexing is needed; segments stay valid as long as the source manager's
+/// buffers and the preprocessor's allocator do.
+SLANG_EXPORT std::vector<ExpandedSourceSegment> buildExpandedSourceMap(Preprocessor& preprocessor);
+
+} // namespace slang::parsing
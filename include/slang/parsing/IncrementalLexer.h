@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+//! @file IncrementalLexer.h
+//! @brief Incremental re-lexing of edited source buffers
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "slang/parsing/Lexer.h"
+#include "slang/util/Util.h"
+
+namespace slang::parsing {
+
+/// @brief Supports incremental re-lexing of edited source buffers.
+///
+/// The lexer itself is one-shot; this class keeps the token boundary offsets
+/// from the last lex of a buffer and, when the text is edited, re-lexes only
+/// from the nearest safe restart point before the edit until the first token
+/// that re-synchronizes with the old stream (shifted by the edit's length
+/// delta). For a single keystroke in a large file that's typically a handful
+/// of tokens instead of the whole buffer.
+///
+/// Raw lexing carries no state between tokens -- constructs that span text,
+/// such as block comments and string literals, are single tokens -- so any
+/// token start is a valid restart point. The restart logic still backs up a
+/// couple of tokens and then to a token that begins a fresh line, which keeps
+/// it clear of tokens the edit may have extended and of line-oriented
+/// directive text.
+class SLANG_EXPORT IncrementalLexer {
+public:
+    explicit IncrementalLexer(LexerOptions options = {}) : options(options) {}
+
+    /// Describes a single contiguous text edit: @a oldLength characters at
+    /// @a offset were replaced by @a newLength characters of new text.
+    struct Edit {
+        size_t offset;
+        size_t oldLength;
+        size_t newLength;
+    };
+
+    /// Lexes @a text from scratch and records its token boundaries. The text
+    /// must include the null terminator as its final character, matching the
+    /// guarantee made by SourceManager buffers.
+    void prime(std::string_view text);
+
+    /// @brief Re-lexes after an edit, reusing as much of the previous token
+    /// stream as possible.
+    ///
+    /// @param text the complete post-edit buffer text, including the final
+    ///             null terminator
+    /// @param edit the edit that transformed the previous text into @a text
+    /// @returns the number of tokens that actually had to be re-lexed
+    size_t update(std::string_view text, Edit edit);
+
+    /// @return the start offsets of each token in the buffer, in ascending
+    /// order. Offsets are of the token's own text; any leading trivia
+    /// (whitespace, comments) precedes the recorded offset.
+    std::span<const size_t> boundaries() const { return bounds; }
+
+private:
+    LexerOptions options;
+    std::vector<size_t> bounds;
+};
+
+} // namespace slang::parsing
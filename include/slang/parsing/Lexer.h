@@ -35,11 +35,37 @@ struct SLANG_EXPORT LexerOptions {
     /// If true, the preprocessor will support legacy protected envelope directives,
     /// for compatibility with old Verilog tools.
     bool enableLegacyProtect = false;
+
+    /// If true, whitespace trivia is recorded as a canonical single space
+    /// instead of the original source text, which lets the common case of a
+    /// token preceded only by whitespace share static storage instead of
+    /// bump allocating a trivia array per token. The presence, kind, and
+    /// ordering of all trivia is unchanged (so everything that keys off
+    /// trivia to detect token adjacency still works); only the whitespace
+    /// text itself is lost. The original text can always be recovered from
+    /// the source buffer between adjacent token locations. Output that
+    /// reproduces source text from trivia (such as SyntaxPrinter, or macro
+    /// stringification) will see the canonicalized spacing.
+    bool compactWhitespaceTrivia = false;
 };
 
 /// Possible encodings for encrypted text used in a pragma protect region.
 enum class SLANG_EXPORT ProtectEncoding { UUEncode, Base64, QuotedPrintable, Raw };
 
+/// A minimal token record produced by Lexer::lexRaw: just the token kind and
+/// its offset and length within the source text. All fields are 32 bits so a
+/// list of records can be consumed as a flat (N, 3) array of uint32 values.
+struct SLANG_EXPORT RawToken {
+    /// The byte offset of the token's text within the source.
+    uint32_t offset = 0;
+
+    /// The length in bytes of the token's text.
+    uint32_t length = 0;
+
+    /// The kind of the token, as a TokenKind value.
+    uint32_t kind = 0;
+};
+
 /// The Lexer is responsible for taking source text and chopping it up into tokens.
 /// Tokens carry along leading "trivia", which is things like whitespace and comments,
 /// so that we can programmatically piece back together what the original file looked like.
@@ -51,6 +77,14 @@ public:
     Lexer(SourceBuffer buffer, BumpAllocator& alloc, Diagnostics& diagnostics,
           LexerOptions options = LexerOptions{});
 
+    /// Constructs a lexer that starts lexing partway into the given buffer,
+    /// at @a startOffset. Reported source locations remain relative to the
+    /// start of the buffer, which lets incremental reparsing resume lexing
+    /// mid-file with correct locations. The offset must be at a token
+    /// boundary from a previous lex of the same text.
+    Lexer(SourceBuffer buffer, BumpAllocator& alloc, Diagnostics& diagnostics, size_t startOffset,
+          LexerOptions options = LexerOptions{});
+
     // Not copyable
     Lexer(const Lexer&) = delete;
     Lexer& operator=(const Lexer&) = delete;
@@ -88,6 +122,19 @@ public:
                             const SourceManager& sourceManager, Token sourceToken, size_t offset,
                             KeywordVersion keywordVersion, SmallVectorBase<Token>& results);
 
+    /// @brief Lexes the entire source text into a flat list of raw tokens.
+    ///
+    /// Each result records only the token kind and its offset and length
+    /// within @a source; trivia, token infos, and diagnostics are discarded
+    /// and the internal arena is recycled as lexing proceeds, so memory use
+    /// stays flat regardless of input size. No preprocessing is performed --
+    /// directives and macro usages appear as their raw tokens. The error
+    /// limit from @a options is ignored so that malformed files still yield
+    /// spans for everything that can be lexed. This is intended for tooling
+    /// like code-search indexers that only need kinds and source spans.
+    static void lexRaw(std::string_view source, SmallVectorBase<RawToken>& results,
+                       LexerOptions options = {});
+
 private:
     Lexer(BufferID bufferId, std::string_view source, const char* startPtr, BumpAllocator& alloc,
           Diagnostics& diagnostics, LexerOptions options);
@@ -160,6 +207,10 @@ private:
     // the number of errors that have occurred while lexing the current buffer
     uint32_t errorCount = 0;
 
+    // true if the source buffer was validated as UTF-8 when it was loaded,
+    // allowing non-ASCII runs to be skipped without re-validating them
+    bool knownValidUtf8 = false;
+
     // temporary storage for building arrays of trivia
     SmallVector<Trivia, 32> triviaBuffer;
 
@@ -45,6 +45,12 @@ public:
     static const flat_hash_map<std::string_view, TokenKind>* getKeywordTable(
         KeywordVersion version);
 
+    /// Classifies the given text as a keyword under the given keyword version,
+    /// or returns TokenKind::Unknown if it isn't one. This uses a perfect hash
+    /// built at compile time and is much cheaper than probing the tables
+    /// returned by getKeywordTable.
+    static TokenKind getKeywordKind(std::string_view text, KeywordVersion version);
+
     static syntax::SyntaxKind getDirectiveKind(std::string_view directive,
                                                bool enableLegacyProtect);
     static std::string_view getDirectiveText(syntax::SyntaxKind kind);
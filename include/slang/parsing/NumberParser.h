@@ -175,6 +175,8 @@ private:
     void startVector(Token baseToken, Token sizeToken);
     int append(Token token, bool isFirst);
     Token finishValue(Token firstToken, bool singleToken, bool isNegated);
+    bool tryScanFast(std::string_view chars);
+    void replayFastDigits();
     void addDigit(logic_t digit, int maxValue);
     Diagnostic& addDiag(DiagCode code, SourceLocation location);
     IntResult reportMissingDigits(Token sizeToken, Token baseToken, Token first);
@@ -188,6 +190,15 @@ private:
     bool hasUnknown = false;
     bool valid = false;
     SVInt decimalValue;
+
+    // State for the two-state fast path: literals without unknown bits whose
+    // value fits in 64 bits are accumulated directly into an integer instead
+    // of going through the digit vector and the general SVInt build.
+    bool fastOk = false;
+    uint32_t fastShift = 0;
+    bitwidth_t fastSigBits = 0;
+    uint64_t fastValue = 0;
+    std::string_view fastChars;
     Diagnostics& diagnostics;
     BumpAllocator& alloc;
     SmallVector<logic_t> digits;
@@ -132,6 +132,15 @@ struct SLANG_EXPORT ParserOptions {
 
     /// The version of the SystemVerilog language to use.
     LanguageVersion languageVersion = LanguageVersion::Default;
+
+    /// The maximum number of tokens to skip during error recovery while
+    /// parsing a single member before giving up and scanning ahead to the
+    /// next likely member boundary instead. Badly broken files can otherwise
+    /// spend a long time re-attempting member parses that fail one token at
+    /// a time; bounding the budget bounds worst-case parse time at the cost
+    /// of skipping more text (and therefore reporting fewer diagnostics).
+    /// Zero (the default) means no limit.
+    uint32_t errorRecoveryLimit = 0;
 };
 
 /// Implements a full syntax parser for SystemVerilog.
@@ -391,6 +400,8 @@ private:
     std::span<TMember*> parseMemberList(TokenKind endKind, Token& endToken,
                                         syntax::SyntaxKind parentKind, TParseFunc&& parseFunc);
 
+    void skipToMemberBoundary(TokenKind endKind);
+
     template<typename IsItemFunc, typename ParseItemFunc>
     bool parseCaseItems(TokenKind caseKind, SmallVectorBase<syntax::CaseItemSyntax*>& itemBuffer,
                         IsItemFunc&& isItem, ParseItemFunc&& parseItem);
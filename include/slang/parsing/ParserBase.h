@@ -44,6 +44,10 @@ protected:
     Token getLastConsumed() const;
     bool haveDiagAtCurrentLoc();
 
+    /// Returns the total number of tokens skipped during error recovery
+    /// so far; used to enforce recovery budgets.
+    size_t getRecoverySkipCount() const { return recoverySkipCount; }
+
     const std::pair<Token, Token>& getLastPoppedDelims() const { return lastPoppedDelims; }
 
     Preprocessor& getPP() { return window.tokenSource; }
@@ -239,6 +243,7 @@ private:
     SmallVector<Token> skippedTokens;
     SmallVector<Token> openDelims;
     std::pair<Token, Token> lastPoppedDelims;
+    size_t recoverySkipCount = 0;
 };
 
 } // namespace slang::parsing
@@ -51,6 +51,14 @@ struct SLANG_EXPORT ParserMetadata {
     /// Otherwise an empty token.
     Token eofToken;
 
+    /// The number of module/interface/program declarations parsed. Used to
+    /// pre-size definition tables during elaboration.
+    size_t definitionCount = 0;
+
+    /// The number of package declarations parsed. Used to pre-size the
+    /// package table during elaboration.
+    size_t packageCount = 0;
+
     /// Indicates whether the parse tree has any defparam directives.
     bool hasDefparams = false;
 
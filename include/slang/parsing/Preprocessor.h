@@ -32,6 +32,8 @@ struct PragmaExpressionSyntax;
 
 namespace slang::parsing {
 
+class MacroSnapshot;
+
 /// Contains various options that can control preprocessing behavior.
 struct SLANG_EXPORT PreprocessorOptions {
     /// The maximum depth of the include stack; further attempts to include
@@ -57,6 +59,13 @@ struct SLANG_EXPORT PreprocessorOptions {
 
     /// A set of preprocessor directives to be ignored.
     flat_hash_set<std::string_view> ignoreDirectives;
+
+    /// If true, fully expanded top-level macro usages are cached and replayed
+    /// for later textually identical usages of the same macro. This can
+    /// greatly speed up heavily macro-based code, but diagnostics arising
+    /// from replayed expansions will point at the first such usage, so it
+    /// defaults to off.
+    bool enableMacroCache = false;
 };
 
 /// Preprocessor - Interface between lexer and parser
@@ -77,6 +86,12 @@ public:
     void pushSource(std::string_view source, std::string_view name = "source");
     void pushSource(SourceBuffer buffer);
 
+    /// Pushes a source buffer that will be lexed starting at @a startOffset
+    /// rather than from the beginning; reported locations remain relative to
+    /// the start of the buffer. Used by incremental reparsing to resume at
+    /// a known token boundary mid-file.
+    void pushSource(SourceBuffer buffer, size_t startOffset);
+
     /// Predefines the given macro definition. The given definition string is lexed
     /// as if it were source text immediately following a `define directive.
     /// If any diagnostics are printed for the created text, they will be marked
@@ -91,6 +106,19 @@ public:
     /// Undefines all currently defined macros.
     void undefineAll();
 
+    /// Captures the complete set of currently defined macros as a snapshot
+    /// that can later be restored into this or another preprocessor with
+    /// restoreMacros(). The snapshot references definition syntax owned by
+    /// this preprocessor's allocator, which must stay alive for as long as
+    /// the snapshot (or any preprocessor it's restored into) is in use.
+    MacroSnapshot snapshotMacros() const;
+
+    /// Replaces the set of currently defined macros with the contents of
+    /// the given snapshot. The environment is restored with one bulk table
+    /// copy, without re-lexing or re-parsing any definition text. Restoring
+    /// a default-constructed snapshot is equivalent to undefineAll().
+    void restoreMacros(const MacroSnapshot& snapshot);
+
     /// Checks whether the given macro is defined. This does not check built-in
     /// directives except for the intrinsic macros (__LINE__, etc).
     bool isDefined(std::string_view name);
@@ -147,6 +175,10 @@ public:
     /// Gets all macros that have been defined thus far in the preprocessor.
     std::vector<const syntax::DefineDirectiveSyntax*> getDefinedMacros() const;
 
+    /// Gets the IDs of all source buffers consumed by the preprocessor so far,
+    /// including any files pulled in via `include directives.
+    std::span<const BufferID> getConsumedBuffers() const { return consumedBuffers; }
+
 private:
     Preprocessor(const Preprocessor& other);
     Preprocessor& operator=(const Preprocessor& other) = delete;
@@ -156,6 +188,10 @@ private:
     Token nextRaw();
     void popSource();
 
+    // include guard detection and skipping
+    void updateIncludeGuardState(Token token);
+    bool shouldSkipIncludeFile(const SourceBuffer& buffer) const;
+
     // directive handling methods
     Token handleDirectives(Token token);
     Trivia handleIncludeDirective(Token directive);
@@ -384,12 +420,33 @@ private:
     // stack of active lexers; each `include pushes a new lexer
     SmallVector<std::unique_ptr<Lexer>, 2> lexerStack;
 
+    // all source buffers pushed onto the lexer stack, in the order seen
+    std::vector<BufferID> consumedBuffers;
+
     // keep track of nested processor branches (ifdef, ifndef, else, elsif, endif)
     SmallVector<BranchEntry, 2> branchStack;
 
     // map from macro name to macro definition
     flat_hash_map<std::string_view, MacroDef> macros;
 
+    // A cache of fully expanded top-level macro usages, keyed by definition
+    // and the raw text of their actual arguments. Entries are invalidated
+    // wholesale whenever the set of defined macros changes, since a cached
+    // expansion may embed expansions of nested macros.
+    struct MacroCacheEntry {
+        std::span<const Token> tokens;
+        std::string_view argsText;
+        uint64_t argsHash;
+        uint64_t generation;
+    };
+    flat_hash_map<const syntax::DefineDirectiveSyntax*, std::vector<MacroCacheEntry>> macroCache;
+    uint64_t macroGeneration = 0;
+
+    // True if the current top-level macro expansion expanded an intrinsic
+    // like __LINE__, whose result depends on the usage site and therefore
+    // must not be cached.
+    bool expandedIntrinsic = false;
+
     // list of expanded macro tokens to drain before continuing with active lexer
     SmallVector<Token> expandedTokens;
     Token* currentMacroToken = nullptr;
@@ -415,6 +472,24 @@ private:
     // have been marked `pragma once so that we avoid trying to include them more than once.
     flat_hash_set<const char*> includeOnceHeaders;
 
+    // State for automatically detecting include-guarded files (the classic
+    // multiple-include optimization). Each pushed source tracks whether its
+    // entire contents are wrapped in `ifndef GUARD ... `endif; tokens are fed
+    // through this little state machine as they're lexed.
+    enum class GuardPhase { AtStart, CondName, InGuard, AfterGuard, Disqualified };
+    struct IncludeGuardState {
+        const char* contentPtr = nullptr;
+        std::string_view guardMacro;
+        uint32_t depth = 0;
+        GuardPhase phase = GuardPhase::AtStart;
+    };
+    SmallVector<IncludeGuardState, 2> guardStateStack;
+
+    // Files (keyed the same way as includeOnceHeaders) found to be fully
+    // wrapped in an include guard, along with the guard macro name. Including
+    // such a file again is skipped outright while the guard macro is defined.
+    flat_hash_map<const char*, std::string_view> guardedHeaders;
+
     /// Various state set by preprocessor directives.
     std::vector<KeywordVersion> keywordVersionStack;
     std::optional<TimeScale> activeTimeScale;
@@ -432,6 +507,7 @@ private:
     // Parser for numeric literals in pragma expressions.
     NumberParser numberParser;
     friend class NumberParser;
+    friend class MacroSnapshot;
 
     // Called by NumberParser to handle an error condition.
     void handleExponentSplit(Token token, size_t offset);
@@ -443,4 +519,15 @@ private:
         pragmaProtectHandlers;
 };
 
+/// A snapshot of a preprocessor's macro environment, as captured by
+/// Preprocessor::snapshotMacros(). Snapshots share their contents, so
+/// copying one and restoring it into many preprocessor instances is cheap.
+/// A default-constructed snapshot represents the empty environment.
+class SLANG_EXPORT MacroSnapshot {
+private:
+    friend class Preprocessor;
+    struct Impl;
+    std::shared_ptr<const Impl> impl;
+};
+
 } // namespace slang::parsing
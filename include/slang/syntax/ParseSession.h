@@ -0,0 +1,64 @@
+//------------------------------------------------------------------------------
+//! @file ParseSession.h
+//! @brief Reusable parsing context that pools allocator memory across parses
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "slang/text/SourceManager.h"
+#include "slang/util/Bag.h"
+#include "slang/util/BumpAllocator.h"
+
+namespace slang::syntax {
+
+class SyntaxTree;
+
+/// @brief A reusable context for parsing many inputs in sequence.
+///
+/// Each call to SyntaxTree::fromText pays a fixed setup cost -- fresh
+/// allocator segments from the system allocator chief among it -- that is
+/// negligible for whole files but dominates when parsing thousands of small
+/// snippets per second. A ParseSession amortizes that cost by pooling the
+/// underlying allocator memory: trees handed back via recycle() donate
+/// their segments, rewound rather than freed, to subsequent parses.
+///
+/// The session owns the source manager that holds the text of everything it
+/// parses, so trees produced by a session must not outlive it. Sessions are
+/// not thread-safe; use one per thread.
+class SLANG_EXPORT ParseSession {
+public:
+    /// Constructs a new session. @a options is an optional bag of lexer,
+    /// preprocessor, and parser options applied to every parse.
+    explicit ParseSession(const Bag& options = {});
+    ~ParseSession();
+
+    ParseSession(const ParseSession&) = delete;
+    ParseSession& operator=(const ParseSession&) = delete;
+
+    /// Gets the source manager that owns the text of all parsed inputs.
+    SourceManager& getSourceManager() { return sourceManager; }
+
+    /// Parses the given text exactly as SyntaxTree::fromText would, drawing
+    /// memory from the session's allocator pool when any is available.
+    /// @a name is an optional name to give to the parsed source region.
+    std::shared_ptr<SyntaxTree> parse(std::string_view text, std::string_view name = "source"sv);
+
+    /// Returns a tree's allocator memory to the session's pool for reuse by
+    /// later parses. The caller must hold the only reference to the tree;
+    /// all of its nodes and tokens become invalid. Trees that share memory
+    /// with a predecessor (rewrites, reparses) or that came from a different
+    /// session are simply destroyed.
+    void recycle(std::shared_ptr<SyntaxTree>&& tree);
+
+private:
+    SourceManager sourceManager;
+    Bag options;
+    std::vector<BumpAllocator> pool;
+};
+
+} // namespace slang::syntax
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <ranges>
 #include <string>
 #include <variant>
 
@@ -86,6 +87,35 @@ struct SLANG_EXPORT TokenOrSyntax : public ConstTokenOrSyntax {
     }
 };
 
+namespace detail {
+
+/// Describes where one child of a fixed-shape syntax node is stored
+/// within the node object.
+struct ChildEntry {
+    /// The kind of storage used for the child.
+    enum Kind : uint32_t {
+        TokenChild, ///< A Token stored by value.
+        NodeChild,  ///< A (possibly null) pointer to a syntax node.
+        ListChild   ///< A list node stored by value.
+    };
+
+    uint32_t offset; ///< Byte offset of the child within the node object.
+    Kind kind;       ///< The kind of storage used for the child.
+};
+
+/// A per-kind table describing the children of a fixed-shape syntax node.
+struct ChildTable {
+    const ChildEntry* entries; ///< The child descriptors, or nullptr if none.
+    uint32_t count;            ///< The number of children.
+};
+
+/// Child descriptor tables for every syntax kind, indexed by the numeric
+/// value of the kind. Generated in AllSyntax.cpp; the list kinds and
+/// Unknown have no fixed shape and get empty tables.
+extern const ChildTable childTables[];
+
+} // namespace detail
+
 /// Base class for all syntax nodes.
 class SLANG_EXPORT SyntaxNode {
 public:
@@ -137,6 +167,50 @@ public:
     /// Gets the number of (direct) children underneath this node in the tree.
     size_t getChildCount() const; // Note: implemented in AllSyntax.cpp
 
+    /// An iterator over the children (tokens and nodes) of a syntax node.
+    template<typename U>
+    class child_iterator_base : public iterator_facade<child_iterator_base<U>> {
+    public:
+        using ParentNode = std::conditional_t<std::is_same_v<U, ConstTokenOrSyntax>,
+                                              const SyntaxNode, SyntaxNode>;
+
+        child_iterator_base() : node(nullptr), index(0) {}
+        child_iterator_base(ParentNode& node, size_t index) : node(&node), index(index) {}
+
+        U dereference() const { return node->getChild(index); }
+
+        bool equals(const child_iterator_base& other) const {
+            return node == other.node && index == other.index;
+        }
+
+        ptrdiff_t distance_to(const child_iterator_base& other) const {
+            return ptrdiff_t(other.index) - ptrdiff_t(index);
+        }
+
+        void advance(ptrdiff_t n) { index = size_t(ptrdiff_t(index) + n); }
+
+    private:
+        ParentNode* node;
+        size_t index;
+    };
+
+    using child_iterator = child_iterator_base<TokenOrSyntax>;
+    using const_child_iterator = child_iterator_base<ConstTokenOrSyntax>;
+
+    /// @return a range over all of the node's children, each one a token or a
+    /// (possibly null) child node. Each child is fetched exactly once, which
+    /// is cheaper than probing childNode and childToken separately.
+    std::ranges::subrange<child_iterator> children() {
+        return {child_iterator(*this, 0), child_iterator(*this, getChildCount())};
+    }
+
+    /// @return a range over all of the node's children, each one a token or a
+    /// (possibly null) child node. Each child is fetched exactly once, which
+    /// is cheaper than probing childNode and childToken separately.
+    std::ranges::subrange<const_child_iterator> children() const {
+        return {const_child_iterator(*this, 0), const_child_iterator(*this, getChildCount())};
+    }
+
     /// Returns true if this syntax node is "equivalent" to the other provided
     /// syntax node. Equivalence here is determined by the entire subtrees having
     /// the same kinds of syntax nodes in the same order and all leaf tokens
@@ -10,6 +10,7 @@
 #include <string>
 
 #include "slang/parsing/Token.h"
+#include "slang/text/SegmentedBuffer.h"
 
 namespace slang {
 class SourceManager;
@@ -18,6 +19,7 @@ class SourceManager;
 namespace slang::syntax {
 
 class SyntaxNode;
+class SyntaxTokenStore;
 class SyntaxTree;
 
 /// Provides support for printing tokens, trivia, or whole syntax trees
@@ -47,6 +49,14 @@ public:
     /// @return a reference to this object, to allow chaining additional method calls.
     SyntaxPrinter& print(const SyntaxTree& tree);
 
+    /// @brief Print the provided token @a store to the internal buffer.
+    ///
+    /// The store is already a flat sequence with all trivia, directives, and
+    /// skipped text included, so this is a single linear pass over its arrays;
+    /// the various include* settings do not apply (only newline squashing).
+    /// @return a reference to this object, to allow chaining additional method calls.
+    SyntaxPrinter& print(const SyntaxTokenStore& store);
+
     /// Sets whether to include trivia when printing syntax.
     /// @return a reference to this object, to allow chaining additional method calls.
     SyntaxPrinter& setIncludeTrivia(bool include) {
@@ -97,7 +107,23 @@ public:
     }
 
     /// @return a copy of the internal text buffer.
-    std::string str() const { return buffer; }
+    std::string str() const { return buffer.str(); }
+
+    /// @return the number of characters currently held in the internal buffer.
+    size_t size() const { return buffer.size(); }
+
+    /// Returns everything currently buffered and resets the buffer to empty.
+    /// This lets callers stream very large outputs in bounded chunks instead
+    /// of materializing the whole text at once.
+    std::string extract() {
+        std::string result = buffer.str();
+        buffer.clear();
+        return result;
+    }
+
+    /// Writes the contents of the internal text buffer to the given stream
+    /// without first concatenating it into a single string.
+    void writeTo(std::ostream& os) const { buffer.writeTo(os); }
 
     /// A helper method that assists in printing an entire syntax tree back to source
     /// text. A SyntaxPrinter with useful defaults is constructed, the tree is printed,
@@ -105,7 +131,7 @@ public:
     static std::string printFile(const SyntaxTree& tree);
 
 private:
-    std::string buffer;
+    SegmentedBuffer buffer;
     const SourceManager* sourceManager = nullptr;
     bool includeTrivia = true;
     bool includeMissing = false;
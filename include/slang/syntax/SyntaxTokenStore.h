@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+//! @file SyntaxTokenStore.h
+//! @brief Columnar storage of the tokens in a syntax tree
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <vector>
+
+#include "slang/parsing/Token.h"
+
+namespace slang::syntax {
+
+class SyntaxNode;
+class SyntaxTree;
+
+/// @brief A structure-of-arrays snapshot of every token in a syntax tree.
+///
+/// Tokens in a parse tree are scattered across the nodes that own them, so
+/// passes that touch every token (printing, rewriting, lexical scans) chase
+/// pointers through the whole tree. This class flattens one traversal into
+/// parallel arrays -- kind, location, and raw text span per token -- that such
+/// passes can iterate linearly instead.
+///
+/// Directive and skipped-syntax trivia are flattened into token entries as
+/// well, and plain trivia text is recorded alongside each token, so
+/// concatenating the trivia and token text in order reproduces exactly what
+/// @a SyntaxPrinter emits with all content included. The store is a snapshot;
+/// it is not updated if the tree it was built from is rewritten.
+class SLANG_EXPORT SyntaxTokenStore {
+public:
+    /// The kind of each token, in source order.
+    std::vector<parsing::TokenKind> kinds;
+
+    /// The location of each token; parallel with @a kinds.
+    std::vector<SourceLocation> locations;
+
+    /// The raw text of each token; parallel with @a kinds.
+    std::vector<std::string_view> texts;
+
+    /// The raw text of plain trivia pieces, in source order. The trivia
+    /// belonging to token `i` occupies the range
+    /// [triviaOffsets[i], triviaOffsets[i + 1]).
+    std::vector<std::string_view> triviaTexts;
+
+    /// Offsets into @a triviaTexts delimiting each token's leading trivia;
+    /// always contains one more entry than there are tokens.
+    std::vector<uint32_t> triviaOffsets;
+
+    /// Returns the number of tokens in the store.
+    size_t size() const { return kinds.size(); }
+
+    /// Builds a token store by traversing the given node.
+    static SyntaxTokenStore build(const SyntaxNode& node);
+
+    /// Builds a token store by traversing the given tree,
+    /// including its end-of-file token.
+    static SyntaxTokenStore build(const SyntaxTree& tree);
+
+private:
+    void addNode(const SyntaxNode& node);
+    void addToken(parsing::Token token);
+    void addTrivia(parsing::Trivia trivia);
+};
+
+} // namespace slang::syntax
@@ -29,6 +29,7 @@ struct ParserMetadata;
 namespace slang::syntax {
 
 class SyntaxNode;
+class SyntaxTokenStore;
 struct DefineDirectiveSyntax;
 
 /// The SyntaxTree is the easiest way to interface with the lexer / preprocessor /
@@ -149,6 +150,26 @@ public:
                                                    const Bag& options = {},
                                                    MacroList inheritedMacros = {});
 
+    /// @brief Reparses a changed source file, reusing syntax from a previous parse.
+    ///
+    /// @a buffer holds the complete new text of the file and @a editOffset is the
+    /// offset of the first character that differs from the text @a oldTree was
+    /// parsed from. Top-level members of the old compilation unit that end before
+    /// the edit are reused by reference; parsing restarts at the first affected
+    /// member and continues through the end of the file. Token locations are
+    /// immutable, so members at or after the edit are always reparsed rather than
+    /// shifted. Falls back to a full parse when reuse isn't possible: when the
+    /// old tree isn't a plain single-buffer compilation unit, or when there are
+    /// preprocessor directives ahead of the edit (which could change how the
+    /// rest of the file lexes).
+    ///
+    /// Reused members are re-parented into the new tree, which keeps the old
+    /// tree alive but makes it invalid to traverse; only the returned tree
+    /// should be used afterwards.
+    static std::shared_ptr<SyntaxTree> reparse(const std::shared_ptr<SyntaxTree>& oldTree,
+                                               const SourceBuffer& buffer, size_t editOffset,
+                                               const Bag& options = {});
+
     /// Creates a syntax tree from a library map file.
     /// @a path is the path to the source file on disk.
     /// @a sourceManager is the manager that owns all of the loaded source code.
@@ -210,6 +231,45 @@ public:
     /// Gets the list of macros that were defined at the end of the loaded source file.
     MacroList getDefinedMacros() const { return macros; }
 
+    /// Gets the list of source buffers that were consumed while building this
+    /// tree, including files pulled in via `include directives.
+    std::span<const BufferID> getConsumedBuffers() const { return consumedBuffers; }
+
+    /// Indicates whether this tree is an unmodified product of the parser over
+    /// a single top-level source buffer, meaning its tokens and trivia render
+    /// back to exactly that buffer's original text. Trees produced by
+    /// rewriting, reparsing, or direct construction report false.
+    bool isVerbatimSource() const { return verbatimSource; }
+
+    /// @brief Creates a compacted copy of this tree.
+    ///
+    /// All live nodes and tokens are cloned in a single depth-first pass into
+    /// one fresh allocator, so the result is laid out contiguously in traversal
+    /// order and holds no references to this tree's memory. Trees produced by
+    /// repeated rewrites benefit the most: each rewrite keeps its parent tree
+    /// alive and scatters the surviving nodes across the parents' allocators,
+    /// whereas visitors walking a compacted tree touch memory sequentially.
+    std::shared_ptr<SyntaxTree> compact() const;
+
+    /// @brief Gets (and caches) a columnar snapshot of all tokens in the tree.
+    ///
+    /// The store is built lazily on first access by one traversal of the tree
+    /// and then reused, so passes that scan every token repeatedly (printing,
+    /// lexical analysis) can iterate the flat arrays instead of re-walking the
+    /// node structure. The snapshot is not invalidated by rewrites; rewritten
+    /// trees are new SyntaxTree objects with their own stores.
+    const SyntaxTokenStore& getTokenStore() const;
+
+    /// @brief Computes (and caches) a hash over the contents of all source buffers
+    /// consumed while building this tree, including files pulled in via `include,
+    /// plus the preprocessor options that affect parsing.
+    ///
+    /// Trees built from identical content with identical options hash identically,
+    /// making the result usable as a key for caching parse results, e.g. to detect
+    /// unchanged files across runs on the same machine. The hash is not stable
+    /// across machine architectures or slang versions.
+    uint64_t getContentHash() const;
+
     /// This is a shared default source manager for cases where the user doesn't
     /// care about managing the lifetime of loaded source. Note that all of
     /// the source loaded by this thing will live in memory for the lifetime of
@@ -217,9 +277,12 @@ public:
     static SourceManager& getDefaultSourceManager();
 
 private:
+    friend class ParseSession;
+
     SyntaxTree(SyntaxNode* root, const SourceLibrary* library, SourceManager& sourceManager,
                BumpAllocator&& alloc, Diagnostics&& diagnostics, parsing::ParserMetadata&& metadata,
-               std::vector<const DefineDirectiveSyntax*>&& macros, Bag options);
+               std::vector<const DefineDirectiveSyntax*>&& macros,
+               std::vector<BufferID>&& consumedBuffers, Bag options);
 
     static std::shared_ptr<SyntaxTree> create(SourceManager& sourceManager,
                                               std::span<const SourceBuffer> source,
@@ -234,6 +297,14 @@ private:
     Bag options_;
     std::unique_ptr<parsing::ParserMetadata> metadata;
     std::vector<const DefineDirectiveSyntax*> macros;
+    std::vector<BufferID> consumedBuffers;
+    mutable std::unique_ptr<SyntaxTokenStore> tokenStore;
+    mutable std::optional<uint64_t> contentHash;
+    bool verbatimSource = false;
+
+    // Trees that share nodes with a predecessor (rewrites, reparses) retain
+    // it here so the shared memory outlives them.
+    std::shared_ptr<SyntaxTree> parentTree;
 };
 
 } // namespace slang::syntax
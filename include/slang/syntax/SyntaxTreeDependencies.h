@@ -0,0 +1,103 @@
+//------------------------------------------------------------------------------
+//! @file SyntaxTreeDependencies.h
+//! @brief Tracks name-level dependencies between syntax trees
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "slang/util/Hash.h"
+#include "slang/util/Util.h"
+
+namespace slang::syntax {
+
+class SyntaxTree;
+
+/// @brief Tracks which syntax trees reference names declared by other trees.
+///
+/// This is intended to support incremental workflows, such as a lint server
+/// that re-checks a design as individual files are edited. Each tree's
+/// parser metadata already records the global names it references (module
+/// instantiations, package imports, class and package scoped names, and
+/// interface ports); this class pairs those with the names each tree
+/// declares at its root scope and answers the question "if this tree
+/// changes, which other trees could elaborate differently?"
+///
+/// A typical usage pattern looks like:
+///
+/// @code{.cpp}
+/// SyntaxTreeDependencyGraph graph;
+/// for (auto& tree : driver.syntaxTrees)
+///     graph.add(tree);
+///
+/// // ...a file is edited and reparsed into newTree...
+/// auto affected = graph.replace(*oldTree, newTree);
+///
+/// Compilation compilation(options);
+/// for (auto& tree : graph.getTrees())
+///     compilation.addSyntaxTree(tree);
+/// for (auto& tree : affected)
+///     { ...issue diagnostics for just those units... }
+/// @endcode
+///
+/// Note that elaborated symbols cannot be reused across compilations;
+/// the savings come from reparsing only the edited file and from limiting
+/// which parts of the design are forced to elaborate, since @a Compilation
+/// elaborates lazily on demand.
+///
+/// The analysis is name-based and conservative: defparams and bind
+/// directives can affect arbitrary parts of the design, so any tree
+/// containing them (and every tree, if the edited one contains them)
+/// is always considered affected. One caveat: interface ports declared
+/// with a plain type name (e.g. `bus b`) are indistinguishable from data
+/// ports at parse time and are not tracked as references; the modport
+/// form (`bus.master b`) is.
+class SLANG_EXPORT SyntaxTreeDependencyGraph {
+public:
+    /// Adds a tree to the graph.
+    void add(std::shared_ptr<SyntaxTree> tree);
+
+    /// Gets the list of trees currently in the graph.
+    std::span<const std::shared_ptr<SyntaxTree>> getTrees() const { return trees; }
+
+    /// @brief Replaces @a oldTree with @a newTree in the graph.
+    ///
+    /// @returns the set of trees whose elaboration could be affected by the
+    /// replacement, including @a newTree itself. Trees that merely reference
+    /// names declared by an affected tree are themselves affected, transitively.
+    /// If @a oldTree is not in the graph, @a newTree is added and returned as
+    /// the only affected tree.
+    std::vector<std::shared_ptr<SyntaxTree>> replace(const SyntaxTree& oldTree,
+                                                     std::shared_ptr<SyntaxTree> newTree);
+
+    /// @brief Gets the set of trees that depend on names declared by @a tree.
+    ///
+    /// The result is transitive but does not include @a tree itself
+    /// (unless it participates in a reference cycle).
+    std::vector<std::shared_ptr<SyntaxTree>> getDependents(const SyntaxTree& tree) const;
+
+private:
+    struct Entry {
+        std::shared_ptr<SyntaxTree> tree;
+        flat_hash_set<std::string_view> declares;
+        flat_hash_set<std::string_view> references;
+        bool hasSideEffects = false;
+    };
+
+    static Entry makeEntry(std::shared_ptr<SyntaxTree> tree);
+    std::vector<std::shared_ptr<SyntaxTree>> collectAffected(
+        flat_hash_set<std::string_view>&& dirtyNames, bool dirtyHasSideEffects,
+        const SyntaxTree* skip) const;
+
+    // These are kept in sync; trees exists only so that getTrees can
+    // hand out a span without copying.
+    std::vector<std::shared_ptr<SyntaxTree>> trees;
+    std::vector<Entry> entries;
+};
+
+} // namespace slang::syntax
@@ -37,14 +37,13 @@ public:
     /// Will visit all child nodes by default.
     template<typename T>
     void visitDefault(T&& node) {
-        for (uint32_t i = 0; i < node.getChildCount(); i++) {
-            auto child = node.childNode(i);
-            if (child)
-                child->visit(*DERIVED);
-            else {
-                auto token = node.childToken(i);
-                if (token)
-                    DERIVED->visitToken(token);
+        for (auto child : node.children()) {
+            if (child.isNode()) {
+                if (auto childNode = child.node())
+                    childNode->visit(*DERIVED);
+            }
+            else if (auto token = child.token()) {
+                DERIVED->visitToken(token);
             }
         }
     }
@@ -110,9 +109,12 @@ public:
     /// @return if no changes are requested, returns the original syntax tree.
     /// Otherwise, the changes are applied and the newly rewritten syntax tree is returned.
     ///
-    /// @note lifetimes of new and old trees are independent from each other. If you
-    /// shallow clone something from old tree into new one, you have to make sure that
-    /// shared_ptr to original doesn't go out of scope too early.
+    /// @note unchanged subtrees are shared by pointer between the old and new
+    /// trees rather than cloned; only the path from the root to each edit is
+    /// recreated, so the cost of a transform is proportional to the size of the
+    /// edits rather than the size of the file. The new tree holds a reference
+    /// to the original tree to keep the shared nodes alive; use
+    /// SyntaxTree::compact to sever that link after a long chain of rewrites.
     std::shared_ptr<SyntaxTree> transform(const std::shared_ptr<SyntaxTree>& tree,
                                           const SourceLibrary* library = nullptr) {
         sourceManager = &tree->sourceManager();
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string_view>
 
 namespace slang {
 
@@ -198,4 +199,10 @@ constexpr const char* utf8Decode(const char* b, uint32_t* c, int* e, int& comput
     return next;
 }
 
+/// Checks whether the given text is entirely valid UTF-8; i.e. every byte
+/// is either ASCII or part of a correctly formed multi-byte sequence that
+/// decodes to a legal code point. Runs of ASCII (the common case) are
+/// scanned a word at a time rather than byte by byte.
+bool isValidUtf8(std::string_view text);
+
 } // namespace slang
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <cstring>
 #include <fmt/color.h>
 #include <string_view>
 
@@ -43,6 +44,11 @@ public:
     void clear() { buf.clear(); }
     void resize(size_t newSize) { buf.resize(newSize); }
 
+    void removePrefix(size_t count) {
+        std::memmove(buf.data(), buf.data() + count, buf.size() - count);
+        buf.resize(buf.size() - count);
+    }
+
     void setColorsEnabled(bool enabled) { showColors = enabled; }
 
     std::string str() const { return fmt::to_string(buf); }
@@ -7,13 +7,15 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <iosfwd>
 #include <memory>
+#include <string>
 
 #include "slang/util/Util.h"
 
 namespace slang {
 
-class FormatBuffer;
+class SegmentedBuffer;
 
 /// A very lightweight JSON writer.
 ///
@@ -29,14 +31,35 @@ public:
     /// level of structure in the JSON.
     void setIndentSize(int size) { indentSize = size; }
 
+    /// Gets the number of spaces used to indent each new level of structure.
+    int getIndentSize() const { return indentSize; }
+
+    /// @return true if pretty printing is enabled.
+    bool isPrettyPrint() const { return pretty; }
+
     /// Set whether pretty printing is enabled (off by default).
     /// When pretty printing is on, newlines, additional whitespace,
     /// and indentation are added to make the output more human friendly.
     void setPrettyPrint(bool enabled) { pretty = enabled; }
 
+    /// @brief Configures the writer to stream its output to @a os in chunks.
+    ///
+    /// Whenever the internal buffer grows beyond roughly @a chunkSize bytes
+    /// the stable prefix is written to the stream and dropped from memory,
+    /// so the full serialized text never has to fit in memory at once.
+    /// Call @a finishStream once all writes are done to flush the remainder.
+    /// While streaming, @a view only returns the still-buffered tail.
+    void streamTo(std::ostream& os, size_t chunkSize = 1 << 20);
+
+    /// Flushes all remaining buffered output (with any dangling trailing
+    /// comma removed, as with @a view) to the stream configured by
+    /// @a streamTo, then flushes the stream itself.
+    void finishStream();
+
     /// @return a view of the emitted JSON text so far.
-    /// @note the returned view is not guaranteed to remain valid once
-    /// additional writes are performed.
+    /// @note this collapses the internal segmented buffer into a single
+    /// contiguous string, and the returned view is not guaranteed to
+    /// remain valid once additional writes are performed.
     std::string_view view() const;
 
     /// Begins a new JSON object. It's expected that you will write zero or
@@ -74,15 +97,36 @@ public:
     /// Writes an array or property boolean value ("true" or "false").
     void writeValue(bool value);
 
+    /// @brief Writes preformatted JSON text directly into the output as an
+    /// array or property value.
+    ///
+    /// The text must be a complete, valid JSON value. This is intended for
+    /// stitching together output produced by several writers; when pretty
+    /// printing, the other writer's indentation should have been seeded
+    /// with this writer's current indent via @a setCurrentIndent.
+    void writeDirect(std::string_view rawJson);
+
+    /// Gets the current indentation amount, in characters.
+    int getCurrentIndent() const { return currentIndent; }
+
+    /// Sets the current indentation amount, in characters. This is useful
+    /// for making a standalone writer produce output that nests correctly
+    /// when stitched into another writer via @a writeDirect.
+    void setCurrentIndent(int amount) { currentIndent = amount; }
+
     /// Writes a newline character into the buffer.
     void writeNewLine();
 
 private:
     void endValue();
+    void maybeFlush();
     size_t findLastComma() const;
     void writeQuoted(std::string_view str);
 
-    std::unique_ptr<FormatBuffer> buffer;
+    std::unique_ptr<SegmentedBuffer> buffer;
+    mutable std::string viewScratch;
+    std::ostream* stream = nullptr;
+    size_t streamChunkSize = 0;
 
     int currentIndent = 0;
     int indentSize = 2;
@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+//! @file SegmentedBuffer.h
+//! @brief A growable character buffer made of fixed-capacity segments
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <fmt/format.h>
+#include <iosfwd>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "slang/util/Util.h"
+
+namespace slang {
+
+/// @brief A character output buffer that grows by adding segments instead of
+/// reallocating.
+///
+/// Unlike a contiguous buffer, appending never moves previously written
+/// characters; once a segment fills up a new one is started, with segment
+/// sizes growing geometrically up to a fixed cap. This keeps append O(1)
+/// amortized with no large copies, which matters when serializing very large
+/// outputs (e.g. multi-GB JSON dumps). The tradeoff is that the contents are
+/// not contiguous in memory; output is performed by writing each segment in
+/// turn via @a writeTo / @a extractTo, or by collapsing into a single string
+/// with @a str.
+class SLANG_EXPORT SegmentedBuffer {
+public:
+    using value_type = char;
+
+    /// Appends the given string to the end of the buffer.
+    void append(std::string_view str);
+
+    /// Appends a single character to the end of the buffer.
+    void push_back(char c) {
+        if (segments.empty() || segments.back().size() == segments.back().capacity())
+            addSegment();
+        segments.back().push_back(c);
+        totalSize++;
+    }
+
+    /// Appends a formatted string to the end of the buffer.
+    template<typename... Args>
+    void format(fmt::format_string<Args...> fmt, Args&&... args) {
+        fmt::format_to(std::back_inserter(*this), fmt, std::forward<Args>(args)...);
+    }
+
+    /// @return the number of characters in the buffer.
+    size_t size() const { return totalSize; }
+
+    /// @return true if the buffer is empty.
+    bool empty() const { return totalSize == 0; }
+
+    /// @return the last character in the buffer, which must not be empty.
+    char back() const { return segments.back().back(); }
+
+    /// Removes all characters from the buffer.
+    void clear();
+
+    /// Shrinks the buffer to the given size, which must not be
+    /// larger than the current size.
+    void resize(size_t newSize);
+
+    /// @brief Visits characters from the back of the buffer moving toward
+    /// the front.
+    ///
+    /// @a func is invoked with each character in turn and visitation stops
+    /// the first time it returns false.
+    /// @return the number of characters for which @a func returned true.
+    template<typename TFunc>
+    size_t scanBack(TFunc&& func) const {
+        size_t visited = 0;
+        for (auto segIt = segments.rbegin(); segIt != segments.rend(); segIt++) {
+            for (auto it = segIt->rbegin(); it != segIt->rend(); it++) {
+                if (!func(*it))
+                    return visited;
+                visited++;
+            }
+        }
+        return visited;
+    }
+
+    /// Writes the entire contents of the buffer to the given stream,
+    /// one segment at a time, without concatenating them first.
+    void writeTo(std::ostream& os) const;
+
+    /// Writes the first @a count characters of the buffer to the given
+    /// stream and removes them from the buffer.
+    void extractTo(std::ostream& os, size_t count);
+
+    /// @return a copy of the buffer contents collapsed into a single string.
+    std::string str() const;
+
+private:
+    void addSegment();
+
+    static constexpr size_t InitialSegmentSize = 1 << 12;
+    static constexpr size_t MaxSegmentSize = 1 << 20;
+
+    // Each segment is reserved up front and never grows past its capacity,
+    // so appends never reallocate previously written data.
+    std::vector<std::string> segments;
+    size_t totalSize = 0;
+    size_t nextSegmentSize = InitialSegmentSize;
+};
+
+} // namespace slang
@@ -215,6 +215,12 @@ struct SLANG_EXPORT SourceBuffer {
     /// The ID assigned to the buffer.
     BufferID id;
 
+    /// True if the buffer contents were checked when the file was loaded
+    /// and found to be entirely valid UTF-8, which lets downstream
+    /// consumers skip per-character validation. False means the contents
+    /// either weren't checked or contain invalid sequences.
+    bool isValidUtf8 = false;
+
     explicit operator bool() const { return id.valid(); }
 };
 
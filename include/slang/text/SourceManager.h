@@ -12,14 +12,17 @@
 #include <filesystem>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <shared_mutex>
 #include <span>
 #include <variant>
 #include <vector>
 
+#include "slang/text/CharInfo.h"
 #include "slang/text/SourceLocation.h"
 #include "slang/util/Hash.h"
+#include "slang/util/OS.h"
 #include "slang/util/SmallVector.h"
 #include "slang/util/Util.h"
 
@@ -27,10 +30,6 @@ namespace slang {
 
 enum class DiagnosticSeverity;
 
-template<typename T>
-concept IsLock = std::is_same_v<T, std::shared_lock<std::shared_mutex>> ||
-                 std::is_same_v<T, std::unique_lock<std::shared_mutex>>;
-
 /// SourceManager - Handles loading and tracking source files.
 ///
 /// The source manager abstracts away the differences between
@@ -64,6 +63,16 @@ public:
     /// Gets the source line number for a given source location.
     size_t getLineNumber(SourceLocation location) const;
 
+    /// @brief Gets source line numbers for a whole group of source locations at once.
+    ///
+    /// This is equivalent to calling @a getLineNumber for each location in turn,
+    /// but when the locations are sorted by buffer and offset (as diagnostics
+    /// typically are) the whole group is resolved in a single forward pass over
+    /// each buffer's line index instead of doing an independent binary search
+    /// per location. Unsorted locations are still resolved correctly.
+    void getLineNumbers(std::span<const SourceLocation> locations,
+                        std::span<size_t> results) const;
+
     /// Gets the source file name for a given source location.
     std::string_view getFileName(SourceLocation location) const;
 
@@ -172,6 +181,12 @@ public:
     /// disabled to always use the simple filename.
     void setDisableProximatePaths(bool set) { disableProximatePaths = set; }
 
+    /// Sets whether source files should be memory mapped instead of copied
+    /// into allocated buffers when read. This is off by default. Files that
+    /// can't be mapped (stdin, non-regular files, files without room for a
+    /// null terminator in their final page) fall back to being copied.
+    void setEnableMemoryMapping(bool set) { enableMemoryMapping = set; }
+
     /// Adds a line directive at the given location.
     void addLineDirective(SourceLocation location, size_t lineNum, std::string_view name,
                           uint8_t level);
@@ -233,15 +248,32 @@ private:
     // Stores actual file contents and metadata; only one per loaded file
     struct FileData {
         const std::string name;                       // name of the file
-        const SmallVector<char> mem;                  // file contents
-        std::vector<size_t> lineOffsets;              // cache of compute line offsets
+        const SmallVector<char> mem;                  // owned file contents; empty when mapped
+        const std::unique_ptr<MappedFile> mapped;     // memory-mapped file contents, if used
+        const bool validUtf8;                         // whether contents are valid UTF-8
+        mutable std::vector<size_t> lineOffsets;      // line offset index; built lazily
+        mutable std::once_flag lineOffsetsFlag;       // guards building of lineOffsets
         const std::filesystem::path* const directory; // directory in which the file exists
         const std::filesystem::path fullPath;         // full path to the file
 
         FileData(const std::filesystem::path* directory, std::string name, SmallVector<char>&& data,
-                 std::filesystem::path fullPath) :
-            name(std::move(name)), mem(std::move(data)), directory(directory),
+                 std::unique_ptr<MappedFile> mapped, std::filesystem::path fullPath) :
+            name(std::move(name)), mem(std::move(data)), mapped(std::move(mapped)),
+            validUtf8(isValidUtf8(contents())), directory(directory),
             fullPath(std::move(fullPath)) {}
+
+        // A view of the file contents, including the null terminator.
+        std::string_view contents() const {
+            return mapped ? mapped->data() : std::string_view(mem.data(), mem.size());
+        }
+
+        // Returns the offset of the start of each line in the file. The index
+        // is built once on first use and is immutable afterward, so callers
+        // can read it without holding any lock.
+        const std::vector<size_t>& getLineOffsets() const {
+            std::call_once(lineOffsetsFlag, [this] { computeLineOffsets(contents(), lineOffsets); });
+            return lineOffsets;
+        }
     };
 
     // Stores a pointer to file data along with information about where we included it.
@@ -286,15 +318,26 @@ private:
             originalLoc(originalLoc), expansionRange(expansionRange), macroName(macroName) {}
     };
 
-    // This mutex protects pretty much everything in this class.
+    using BufferEntry = std::variant<FileInfo, ExpansionInfo>;
+
+    // This mutex protects the file lookup cache, the diagnostic directive map,
+    // and mutation of existing buffer entries (line directives). The buffer
+    // entry table itself can be read without it; see below.
     mutable std::shared_mutex mutex;
 
     // This mutex is specifically for protecting the system and user
     // include directory lists.
     mutable std::shared_mutex includeDirMutex;
 
-    // index from BufferID to buffer metadata
-    std::vector<std::variant<FileInfo, ExpansionInfo>> bufferEntries;
+    // Index from BufferID to buffer metadata. Entries are only ever appended
+    // and are immutable once published (except for line directives, which are
+    // guarded by the mutex above), so they are stored in chunks of geometrically
+    // increasing size whose addresses never change. Chunk N holds 2^N entries.
+    // Paired with the atomic entry count this lets location queries walk the
+    // table without taking any lock.
+    static constexpr size_t MaxBufferChunks = 31;
+    std::unique_ptr<BufferEntry[]> bufferChunks[MaxBufferChunks];
+    std::atomic<size_t> bufferEntryCount = 0;
 
     // cache for file lookups; this holds on to the actual file data
     flat_hash_map<std::string, std::pair<std::unique_ptr<FileData>, std::error_code>> lookupCache;
@@ -303,6 +346,23 @@ private:
     std::vector<std::filesystem::path> systemDirectories;
     std::vector<std::filesystem::path> userDirectories;
 
+    // This mutex protects the include resolution caches below.
+    mutable std::mutex listingMutex;
+
+    // Cached listings of include directory contents, keyed by directory path.
+    // Filenames are stored ASCII-lowercased so membership tests work on both
+    // case sensitive and case insensitive filesystems; a nullopt value means
+    // the directory couldn't be listed and candidates must be probed directly.
+    // Listings are read once and never refreshed, matching the lookup cache's
+    // treatment of failed opens.
+    flat_hash_map<std::string, std::optional<flat_hash_set<std::string>>> dirListings;
+
+    // Header names that were probed against every system / user include
+    // directory without being found, along with the directory count at the
+    // time so the entry goes stale if more directories are added.
+    flat_hash_map<std::string, size_t> systemHeaderMisses;
+    flat_hash_map<std::string, size_t> userHeaderMisses;
+
     // uniquified backing memory for directories
     std::set<std::filesystem::path> directories;
 
@@ -311,43 +371,43 @@ private:
 
     std::atomic<uint32_t> unnamedBufferCount = 0;
     bool disableProximatePaths = false;
+    bool enableMemoryMapping = false;
+
+    // Returns the entry for the given buffer, or nullptr if the buffer is
+    // invalid or out of range. Safe to call without holding any lock.
+    const BufferEntry* lookupEntry(BufferID buffer) const;
 
-    template<IsLock TLock>
-    FileInfo* getFileInfo(BufferID buffer, TLock& lock);
+    // Appends a new buffer entry to the table and returns its index. The
+    // lock parameter enforces that the caller holds the mutex exclusively.
+    size_t appendBufferEntry(BufferEntry&& entry, std::unique_lock<std::shared_mutex>& lock);
 
-    template<IsLock TLock>
-    const FileInfo* getFileInfo(BufferID buffer, TLock& lock) const;
+    FileInfo* getFileInfo(BufferID buffer);
+    const FileInfo* getFileInfo(BufferID buffer) const;
 
     SourceBuffer createBufferEntry(FileData* fd, SourceLocation includedFrom,
                                    const SourceLibrary* library, uint64_t sortKey,
                                    std::unique_lock<std::shared_mutex>& lock);
 
+    // Returns true if the given directory might contain an entry with the
+    // given ASCII-lowercased name, consulting (and populating) the cached
+    // directory listing. Returns true when the listing is unavailable.
+    bool directoryMightContain(const std::filesystem::path& dir, const std::string& name);
+
     BufferOrError openCached(const std::filesystem::path& fullPath, SourceLocation includedFrom,
                              const SourceLibrary* library, uint64_t sortKey = UINT64_MAX);
     SourceBuffer cacheBuffer(std::filesystem::path&& path, std::string&& pathStr,
                              SourceLocation includedFrom, const SourceLibrary* library,
-                             uint64_t sortKey, SmallVector<char>&& buffer);
-
-    template<IsLock TLock>
-    size_t getRawLineNumber(SourceLocation location, TLock& lock) const;
-
-    template<IsLock TLock>
-    bool isMacroLocImpl(SourceLocation location, TLock& lock) const;
-
-    template<IsLock TLock>
-    bool isMacroArgLocImpl(SourceLocation location, TLock& lock) const;
-
-    template<IsLock TLock>
-    SourceLocation getFullyExpandedLocImpl(SourceLocation location, TLock& lock) const;
-
-    template<IsLock TLock>
-    SourceLocation getOriginalLocImpl(SourceLocation location, TLock& lock) const;
+                             uint64_t sortKey, SmallVector<char>&& buffer,
+                             std::unique_ptr<MappedFile> mapped = nullptr);
 
-    template<IsLock TLock>
-    SourceRange getExpansionRangeImpl(SourceLocation location, TLock& lock) const;
+    size_t getRawLineNumber(SourceLocation location) const;
+    bool isMacroLocImpl(SourceLocation location) const;
+    bool isMacroArgLocImpl(SourceLocation location) const;
+    SourceLocation getFullyExpandedLocImpl(SourceLocation location) const;
+    SourceLocation getOriginalLocImpl(SourceLocation location) const;
+    SourceRange getExpansionRangeImpl(SourceLocation location) const;
 
-    static void computeLineOffsets(const SmallVector<char>& buffer,
-                                   std::vector<size_t>& offsets) noexcept;
+    static void computeLineOffsets(std::string_view buffer, std::vector<size_t>& offsets) noexcept;
 };
 
 } // namespace slang
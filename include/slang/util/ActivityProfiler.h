@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+//! @file ActivityProfiler.h
+//! @brief Sampling profiler keyed by compiler activity
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <iosfwd>
+#include <memory>
+#include <string_view>
+
+#include "slang/util/Util.h"
+
+namespace slang {
+
+/// Support for low-overhead sampling profiles keyed by what the compiler is
+/// doing rather than by native call stack, so results name design elements
+/// instead of function addresses and don't require a debug build.
+///
+/// Hot code paths annotate themselves with cheap RAII markers (see
+/// ActivityScope) that maintain a per-thread activity stack. Once profiling
+/// is started, a background thread samples every thread's stack at a fixed
+/// interval and accumulates the observations as folded stack counts, which
+/// @a write emits in the collapsed format understood by flamegraph tools.
+class SLANG_EXPORT ActivityProfiler {
+public:
+    /// Indicates whether profiling has been enabled or not.
+    static bool isEnabled() { return sampler != nullptr; }
+
+    /// Starts the background sampling thread, taking one sample of each
+    /// thread's activity stack every @a intervalUs microseconds.
+    static void start(uint32_t intervalUs = 1000);
+
+    /// Stops sampling and writes the accumulated samples to the given stream
+    /// in collapsed stack format -- one "outer;inner;leaf count" line per
+    /// observed stack -- suitable for flamegraph.pl or speedscope.
+    static void write(std::ostream& os);
+
+    /// Pushes a frame onto the calling thread's activity stack.
+    /// Most callers should use ActivityScope instead.
+    static void push(std::string_view name, std::string_view detail);
+
+    /// Pops the frame most recently pushed by the calling thread.
+    static void pop();
+
+private:
+    ActivityProfiler() = delete;
+
+    struct Sampler;
+    static std::unique_ptr<Sampler> sampler;
+};
+
+/// A helper class that pushes a frame onto the current thread's activity
+/// stack for the duration of a scope. If the profiler is not running the
+/// overhead is a single branch.
+class SLANG_EXPORT ActivityScope {
+public:
+    ActivityScope(std::string_view name, std::string_view detail) {
+        if (ActivityProfiler::isEnabled()) {
+            ActivityProfiler::push(name, detail);
+            active = true;
+        }
+    }
+
+    ~ActivityScope() {
+        if (active)
+            ActivityProfiler::pop();
+    }
+
+private:
+    bool active = false;
+};
+
+} // namespace slang
@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cstring>
 #include <new>
 #include <span>
@@ -15,6 +17,10 @@
 
 namespace slang {
 
+/// Categories to which bump-allocated memory can be attributed for profiling
+/// purposes. See BumpAllocator::CategoryScope.
+enum class AllocCategory : uint8_t { Other, Tokens, Trivia, SyntaxNodes, Symbols, Types, Constants };
+
 /// BumpAllocator - Fast O(1) allocator.
 ///
 /// Allocates items sequentially in memory, with underlying memory allocated in
@@ -42,6 +48,7 @@ public:
 
     /// Allocate @a size bytes of memory with the given @a alignment.
     byte* allocate(size_t size, size_t alignment) {
+        categoryBytes[size_t(category)] += size;
         byte* base = alignPtr(head->current, alignment);
         byte* next = base + size;
         if (next > endPtr)
@@ -69,11 +76,120 @@ public:
     /// The other allocator will be in a moved-from state after the call.
     void steal(BumpAllocator&& other);
 
+    /// A marker for the state of the allocator at a particular point in time,
+    /// as returned by snapshot().
+    struct Snapshot {
+        void* head = nullptr;
+        void* headPrev = nullptr;
+        byte* current = nullptr;
+        byte* endPtr = nullptr;
+    };
+
+    /// Captures the current state of the allocator so that it can later be
+    /// rewound with rollbackTo(), releasing everything allocated in between.
+    /// This is useful for speculative work that is frequently abandoned.
+    Snapshot snapshot() const { return Snapshot{head, head->prev, head->current, endPtr}; }
+
+    /// Rewinds the allocator to a previously captured snapshot, freeing all
+    /// memory allocated since then. Snapshots must be rolled back in reverse
+    /// order of capture, and memory handed out after the snapshot was taken
+    /// must not be referenced again. Don't use this with TypedBumpAllocator;
+    /// the rewound items would need their destructors run.
+    void rollbackTo(Snapshot snap);
+
+    /// Releases all allocations while retaining the largest underlying memory
+    /// segment, rewound for reuse. Callers that repeatedly build and discard
+    /// short-lived content (e.g. pooled parse arenas) avoid going back to the
+    /// system allocator for pages on every cycle. All memory previously handed
+    /// out becomes invalid; as with rollbackTo, don't use this with
+    /// TypedBumpAllocator.
+    void reset();
+
+    /// Returns the number of bytes of segment memory currently held by this
+    /// allocator.
+    size_t liveBytes() const { return currentBytes; }
+
+    /// Returns the largest value liveBytes() has reached over the lifetime of
+    /// this allocator.
+    size_t peakBytes() const { return maxBytes; }
+
+    /// Returns the total number of bytes of segment memory allocated by all
+    /// BumpAllocator instances since the start of the process. This is used
+    /// for profiling; the counter only ever increases, so the difference of
+    /// two readings gives the bytes allocated between them.
+    static size_t totalBytesAllocated() { return totalBytes.load(std::memory_order_relaxed); }
+
+    /// Statistics for the process-wide pool of retained memory segments
+    /// shared by all BumpAllocator instances. Standard-sized segments are
+    /// returned to the pool instead of the system when an allocator is
+    /// destroyed, so successive compilations in one process reuse warm
+    /// pages rather than re-faulting fresh ones.
+    struct PoolStats {
+        /// The number of segments currently held in the pool.
+        size_t segmentsHeld = 0;
+
+        /// The total bytes of segment memory currently held in the pool.
+        size_t bytesHeld = 0;
+
+        /// The number of segment requests served from the pool.
+        size_t hits = 0;
+
+        /// The number of segment requests that went to the system allocator.
+        size_t misses = 0;
+    };
+
+    /// Returns statistics for the process-wide segment pool.
+    static PoolStats getPoolStats();
+
+    /// Releases all memory held by the process-wide segment pool back to
+    /// the system. Useful during idle periods in long-running processes.
+    static void trimPool();
+
+    /// Sets the maximum number of bytes the process-wide segment pool may
+    /// retain, freeing pooled segments beyond the new limit immediately.
+    /// Pass zero to disable pooling entirely. The default is 64 MB.
+    static void setPoolCapacity(size_t bytes);
+
+    /// The number of distinct AllocCategory values.
+    static constexpr size_t NumCategories = 7;
+
+    /// Sets the category to which this allocator's allocations are attributed
+    /// when no CategoryScope is active.
+    void setDefaultCategory(AllocCategory cat) { category = cat; }
+
+    /// Returns the number of bytes that have been requested from this
+    /// allocator attributed to the given category. This counts allocation
+    /// traffic rather than live memory: padding for alignment is excluded and
+    /// bytes released again via rollbackTo() remain counted.
+    size_t bytesForCategory(AllocCategory cat) const { return categoryBytes[size_t(cat)]; }
+
+    /// RAII helper that attributes all allocations made from the given
+    /// allocator during its lifetime to the given category. The counters are
+    /// plain per-allocator integers, so the bookkeeping is cheap enough to
+    /// leave enabled unconditionally; allocators are not meant to be shared
+    /// across threads so no synchronization is involved.
+    class CategoryScope {
+    public:
+        CategoryScope(BumpAllocator& alloc, AllocCategory cat) :
+            alloc(alloc), prev(alloc.category) {
+            alloc.category = cat;
+        }
+        ~CategoryScope() { alloc.category = prev; }
+
+        CategoryScope(const CategoryScope&) = delete;
+        CategoryScope& operator=(const CategoryScope&) = delete;
+
+    private:
+        BumpAllocator& alloc;
+        AllocCategory prev;
+    };
+
 protected:
     // Allocations are tracked as a linked list of segments.
     struct Segment {
         Segment* prev;
         byte* current;
+        size_t size;
     };
 
     Segment* head;
@@ -84,12 +200,24 @@ protected:
     // Slow path handling of allocation.
     byte* allocateSlow(size_t size, size_t alignment);
 
+    // Returns a segment to the process-wide pool, or to the system if it
+    // isn't poolable or the pool is full.
+    static void freeSegment(Segment* seg);
+
     static byte* alignPtr(byte* ptr, size_t alignment) {
         return reinterpret_cast<byte*>((reinterpret_cast<uintptr_t>(ptr) + alignment - 1) &
                                        ~(alignment - 1));
     }
 
-    static Segment* allocSegment(Segment* prev, size_t size);
+    Segment* allocSegment(Segment* prev, size_t size);
+
+private:
+    size_t currentBytes = 0;
+    size_t maxBytes = 0;
+    std::array<size_t, NumCategories> categoryBytes = {};
+    AllocCategory category = AllocCategory::Other;
+
+    static std::atomic<size_t> totalBytes;
 };
 
 /// A strongly-typed version of the BumpAllocator, which has the additional
@@ -407,7 +407,7 @@ private:
     std::string findNearestMatch(std::string_view arg) const;
 
     std::shared_ptr<Option> positional;
-    std::map<std::string, std::shared_ptr<Option>> optionMap;
+    std::map<std::string, std::shared_ptr<Option>, std::less<>> optionMap;
     std::vector<std::shared_ptr<Option>> orderedOptions;
 
     // A map of commands to be ignored.
@@ -7,6 +7,9 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "slang/util/PointerIntPair.h"
 #include "slang/util/PoolAllocator.h"
 #include "slang/util/SmallVector.h"
@@ -1498,4 +1501,116 @@ void IntervalMap<TKey, TValue>::overlap_iterator::unionWith(const TValue& value,
     }
 }
 
+/// @brief A read-optimized immutable snapshot of an IntervalMap.
+///
+/// All intervals and values are packed into flat sorted arrays, using a
+/// fraction of the memory of the B+ tree form and answering overlap queries
+/// with a binary search plus a scan pruned by a running maximum of right
+/// endpoints. Build one once a map has reached its final contents; the
+/// source map (and the pool pages backing it) can be discarded afterward.
+template<typename TKey, typename TValue>
+class FrozenIntervalMap {
+public:
+    /// Default constructor; creates an empty map.
+    FrozenIntervalMap() = default;
+
+    /// Constructs a frozen snapshot of the given map's current contents.
+    explicit FrozenIntervalMap(const IntervalMap<TKey, TValue>& map) {
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            auto b = it.bounds();
+            lefts.push_back(b.first);
+            rights.push_back(b.second);
+            values.push_back(*it);
+        }
+
+        // A running maximum of right endpoints, used to prune the left end
+        // of overlap scans; map iteration order keeps @a lefts sorted.
+        maxRights = rights;
+        for (size_t i = 1; i < maxRights.size(); i++)
+            maxRights[i] = std::max(maxRights[i - 1], maxRights[i]);
+    }
+
+    /// Indicates whether the map is empty.
+    bool empty() const { return lefts.empty(); }
+
+    /// Gets the number of intervals in the map.
+    size_t size() const { return lefts.size(); }
+
+    /// A forward iterator over intervals that overlap a search key.
+    class overlap_iterator {
+    public:
+        overlap_iterator() = default;
+
+        /// @return true if the iterator points at a valid overlapping entry.
+        bool valid() const { return map && index < endIndex; }
+
+        /// Gets the bounds of the interval pointed to by the iterator.
+        std::pair<TKey, TKey> bounds() const {
+            SLANG_ASSERT(valid());
+            return {map->lefts[index], map->rights[index]};
+        }
+
+        const TValue& operator*() const {
+            SLANG_ASSERT(valid());
+            return map->values[index];
+        }
+
+        overlap_iterator& operator++() {
+            SLANG_ASSERT(valid());
+            index++;
+            skipNonOverlapping();
+            return *this;
+        }
+
+        overlap_iterator operator++(int) {
+            overlap_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+    private:
+        friend class FrozenIntervalMap;
+
+        overlap_iterator(const FrozenIntervalMap& map, TKey left, size_t index, size_t endIndex) :
+            map(&map), searchLeft(left), index(index), endIndex(endIndex) {
+            skipNonOverlapping();
+        }
+
+        void skipNonOverlapping() {
+            while (index < endIndex && map->rights[index] < searchLeft)
+                index++;
+        }
+
+        const FrozenIntervalMap* map = nullptr;
+        TKey searchLeft{};
+        size_t index = 0;
+        size_t endIndex = 0;
+    };
+
+    /// @brief Finds all intervals in the map that overlap the given interval.
+    ///
+    /// The query is O(log n + m) where n is the number of intervals in the
+    /// map and m is the number of entries scanned.
+    overlap_iterator find(TKey left, TKey right) const {
+        SLANG_ASSERT(left <= right);
+        size_t start = size_t(std::ranges::lower_bound(maxRights, left) - maxRights.begin());
+        size_t end = size_t(std::ranges::upper_bound(lefts, right) - lefts.begin());
+        return overlap_iterator(*this, left, start, end);
+    }
+
+    /// @brief Finds all intervals in the map that overlap the given interval.
+    ///
+    /// The query is O(log n + m) where n is the number of intervals in the
+    /// map and m is the number of entries scanned.
+    overlap_iterator find(const std::pair<TKey, TKey>& key) const {
+        return find(key.first, key.second);
+    }
+
+private:
+    std::vector<TKey> lefts;
+    std::vector<TKey> rights;
+    std::vector<TKey> maxRights;
+    std::vector<TValue> values;
+};
+
 } // namespace slang
@@ -9,6 +9,7 @@
 
 #include <filesystem>
 #include <fmt/color.h>
+#include <memory>
 
 #include "slang/util/ScopeGuard.h"
 #include "slang/util/SmallVector.h"
@@ -16,6 +17,28 @@
 
 namespace slang {
 
+/// A read-only, memory-mapped view of a file on disk.
+/// The underlying mapping is released when this object is destroyed.
+class SLANG_EXPORT MappedFile {
+public:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    /// A view of the mapped file contents, including a null terminator
+    /// directly past the end of the file's data.
+    std::string_view data() const { return view; }
+
+private:
+    friend class OS;
+    MappedFile() = default;
+
+    std::string_view view;
+#if defined(_WIN32)
+    void* mappingHandle = nullptr;
+#endif
+};
+
 /// A collection of various OS-specific utility functions.
 class SLANG_EXPORT OS {
 public:
@@ -37,11 +60,25 @@ public:
     static void setStdoutColorsEnabled(bool enabled) { showColorsStdout = enabled; }
     static void setStderrColorsEnabled(bool enabled) { showColorsStderr = enabled; }
 
+    /// Pins the calling thread to the given logical CPU so that the scheduler
+    /// won't migrate it across cores (or NUMA nodes) and memory it first-touches
+    /// stays local to it.
+    /// @return true if successful and false if pinning isn't supported on
+    ///         this platform or the request was rejected.
+    static bool pinThreadToCpu(unsigned cpuIndex);
+
     /// Reads a file from @a path into memory. If successful, the bytes are placed
     /// into @a buffer -- otherwise, returns false.
     /// Note that the buffer will be null-terminated.
     static std::error_code readFile(const std::filesystem::path& path, SmallVector<char>& buffer);
 
+    /// Maps the file at @a path into memory as a read-only view, avoiding a copy
+    /// of its contents. Returns nullptr if the file cannot be mapped -- for example
+    /// if it's stdin or a non-regular file, or if its size doesn't leave room in the
+    /// final page for the null terminator that callers rely on -- in which case the
+    /// caller should fall back to @a readFile.
+    static std::unique_ptr<MappedFile> mapFile(const std::filesystem::path& path);
+
     /// Writes the given contents to the specified file.
     static void writeFile(const std::filesystem::path& path, std::string_view contents);
 
@@ -13,6 +13,10 @@
 #include <span>
 #include <utility>
 
+#ifdef SLANG_SMALLVECTOR_TELEMETRY
+#    include <source_location>
+#endif
+
 #include "slang/util/BumpAllocator.h"
 
 namespace slang {
@@ -22,6 +26,14 @@ namespace detail {
 [[noreturn]] SLANG_EXPORT void throwOutOfRange();
 [[noreturn]] SLANG_EXPORT void throwLengthError();
 
+#ifdef SLANG_SMALLVECTOR_TELEMETRY
+/// Records statistics for one SmallVector lifetime. Stats are aggregated
+/// per construction site and dumped to stderr at program exit, to support
+/// tuning of inline capacities.
+SLANG_EXPORT void recordSmallVectorStats(const char* file, uint32_t line, size_t inlineCap,
+                                         size_t finalLen, size_t finalCap, bool spilled);
+#endif
+
 } // namespace detail
 
 /// @brief Base class for a fast growable array
@@ -461,7 +473,16 @@ protected:
     // This way we don't need a virtual destructor, or vtable at all.
     SmallVectorBase() noexcept = default;
     explicit SmallVectorBase(size_type capacity) noexcept : cap(capacity) {}
-    ~SmallVectorBase() { cleanup(); }
+    ~SmallVectorBase() {
+#ifdef SLANG_SMALLVECTOR_TELEMETRY
+        // Skip vectors whose storage was stolen by a move, and sites that
+        // weren't attributed by an instrumented constructor.
+        if (telemetryFile && data_)
+            detail::recordSmallVectorStats(telemetryFile, telemetryLine, inlineCap, len, cap,
+                                           !isSmall());
+#endif
+        cleanup();
+    }
 
     SmallVectorBase& operator=(const SmallVectorBase& rhs);
     SmallVectorBase& operator=(SmallVectorBase&& rhs);
@@ -474,6 +495,12 @@ private:
     size_type len = 0;
     size_type cap = 0;
 
+#ifdef SLANG_SMALLVECTOR_TELEMETRY
+    const char* telemetryFile = nullptr;
+    uint32_t telemetryLine = 0;
+    uint32_t inlineCap = 0;
+#endif
+
 #ifdef _MSC_VER
 #    pragma warning(push)
 #    pragma warning(disable : 4324) // structure was padded due to alignment specifier
@@ -585,8 +612,19 @@ public:
     using size_type = typename Base::size_type;
     using pointer = typename Base::pointer;
 
+#ifdef SLANG_SMALLVECTOR_TELEMETRY
+    /// Default constructs the SmallVector. When telemetry is enabled the
+    /// construction site is captured so that spill counts and size stats
+    /// can be attributed to the declaring line of code.
+    SmallVector(std::source_location loc = std::source_location::current()) noexcept : Base(N) {
+        this->telemetryFile = loc.file_name();
+        this->telemetryLine = uint32_t(loc.line());
+        this->inlineCap = uint32_t(N);
+    }
+#else
     /// Default constructs the SmallVector.
     SmallVector() noexcept : Base(N) {}
+#endif
 
     /// Constructs the SmallVector with the given capacity. If that capacity is less than
     /// the preallocated stack size `N` it will be ignored. Otherwise it will perform a heap
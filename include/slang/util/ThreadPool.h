@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <deque>
 #include <functional>
@@ -17,11 +18,18 @@
 #include <type_traits>
 #include <vector>
 
+#include "slang/util/OS.h"
 #include "slang/util/Util.h"
 
 namespace slang {
 
-/// A lightweight thread pool for running concurrent jobs.
+/// @brief A lightweight thread pool for running concurrent jobs.
+///
+/// Each worker thread owns its own task queue; tasks pushed from within a
+/// pool thread land on that thread's queue and run in LIFO order for cache
+/// locality, while idle workers steal the oldest task from a busy peer.
+/// Submission and dispatch therefore don't contend on a shared lock in the
+/// common case, which matters when many fine-grained tasks are in flight.
 class ThreadPool {
 public:
     /// @brief Constructs a new ThreadPool.
@@ -29,21 +37,29 @@ public:
     /// @param threadCount The number of threads to create in the pool. If zero (the default)
     ///                    the number of threads will be set to the number of concurrent threads
     ///                    supported by the system.
-    explicit ThreadPool(unsigned threadCount = 0) {
+    /// @param pinWorkers If true, each worker thread is pinned to a distinct logical
+    ///                   CPU. On multi-socket machines this keeps a worker (and the
+    ///                   memory it first-touches) on one NUMA node, and combined with
+    ///                   the per-worker queues it keeps a task subtree's data local
+    ///                   to the node that produced it.
+    explicit ThreadPool(unsigned threadCount = 0, bool pinWorkers = false) :
+        pinWorkers(pinWorkers) {
         if (threadCount == 0) {
             threadCount = std::thread::hardware_concurrency();
             if (threadCount == 0)
                 threadCount = 1;
         }
 
+        for (unsigned i = 0; i < threadCount; i++)
+            workers.emplace_back(std::make_unique<Worker>());
+
         {
             std::unique_lock lock(mutex);
-            waiting = false;
             running = true;
         }
 
         for (unsigned i = 0; i < threadCount; i++)
-            threads.emplace_back(&ThreadPool::worker, this);
+            threads.emplace_back(&ThreadPool::workerLoop, this, size_t(i));
     }
 
     /// Destroys the thread pool, blocking until all threads have exited.
@@ -69,11 +85,24 @@ public:
     /// calling @a waitForAll and waiting for all tasks in the pool to complete.
     template<typename TFunc, typename... TArgs>
     void pushTask(TFunc&& task, TArgs&&... args) {
+        // Tasks pushed from a pool thread stay on that thread's queue;
+        // external submitters distribute round-robin across the workers.
+        Worker& target = currentPool == this
+                             ? *workers[currentIndex]
+                             : *workers[nextWorker.fetch_add(1, std::memory_order_relaxed) %
+                                        workers.size()];
+
+        totalTasks.fetch_add(1);
         {
-            std::unique_lock lock(mutex);
-            tasks.emplace_back(std::bind(std::forward<TFunc>(task), std::forward<TArgs>(args)...));
+            std::unique_lock lock(target.mutex);
+            target.tasks.emplace_back(std::bind(std::forward<TFunc>(task),
+                                                std::forward<TArgs>(args)...));
+            queuedTasks.fetch_add(1);
         }
 
+        // Synchronize with the sleep path in workerLoop so that the notify
+        // can't slip in between a worker's final empty check and its wait.
+        { std::unique_lock lock(mutex); }
         taskAvailable.notify_one();
     }
 
@@ -141,7 +170,7 @@ public:
     void waitForAll() {
         std::unique_lock lock(mutex);
         waiting = true;
-        taskDone.wait(lock, [this] { return !currentTasks && tasks.empty(); });
+        taskDone.wait(lock, [this] { return totalTasks == 0; });
         waiting = false;
     }
 
@@ -152,41 +181,91 @@ public:
     bool waitForAll(const std::chrono::duration<R, P>& duration) {
         std::unique_lock lock(mutex);
         waiting = true;
-        const bool status = taskDone.wait_for(lock, duration,
-                                              [this] { return !currentTasks && tasks.empty(); });
+        const bool status = taskDone.wait_for(lock, duration, [this] { return totalTasks == 0; });
         waiting = false;
         return status;
     }
 
 private:
-    void worker() {
+    struct Worker {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void workerLoop(size_t index) {
+        currentPool = this;
+        currentIndex = index;
+
+        if (pinWorkers) {
+            // Pinning is best effort; if the OS rejects it the worker just
+            // runs wherever the scheduler puts it.
+            unsigned numCpus = std::max(1u, std::thread::hardware_concurrency());
+            OS::pinThreadToCpu(unsigned(index) % numCpus);
+        }
+
         while (true) {
+            std::function<void()> task;
+            while (popTask(index, task)) {
+                task();
+
+                // Both counters and the waiting flag are sequentially
+                // consistent, so either we observe the waiter's flag here
+                // or the waiter observes the count hitting zero and
+                // doesn't block in the first place.
+                if (totalTasks.fetch_sub(1) == 1 && waiting) {
+                    std::unique_lock lock(mutex);
+                    taskDone.notify_all();
+                }
+            }
+
             std::unique_lock lock(mutex);
-            taskAvailable.wait(lock, [this] { return !tasks.empty() || !running; });
+            taskAvailable.wait(lock, [this] { return queuedTasks > 0 || !running; });
             if (!running)
                 break;
+        }
+    }
 
-            auto task = std::move(tasks.front());
-            tasks.pop_front();
-            ++currentTasks;
-            lock.unlock();
-            task();
-            lock.lock();
-            --currentTasks;
+    bool popTask(size_t index, std::function<void()>& task) {
+        // Prefer our own queue, newest first; fall back to stealing the
+        // oldest task from the next busy worker.
+        auto& self = *workers[index];
+        {
+            std::unique_lock lock(self.mutex);
+            if (!self.tasks.empty()) {
+                task = std::move(self.tasks.back());
+                self.tasks.pop_back();
+                queuedTasks.fetch_sub(1);
+                return true;
+            }
+        }
 
-            if (waiting && !currentTasks && tasks.empty())
-                taskDone.notify_all();
+        for (size_t i = 1; i < workers.size(); i++) {
+            auto& victim = *workers[(index + i) % workers.size()];
+            std::unique_lock lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queuedTasks.fetch_sub(1);
+                return true;
+            }
         }
+        return false;
     }
 
     std::mutex mutex;
-    std::deque<std::function<void()>> tasks;
     std::condition_variable taskAvailable;
     std::condition_variable taskDone;
+    std::vector<std::unique_ptr<Worker>> workers;
     std::vector<std::thread> threads;
-    size_t currentTasks = 0;
-    bool running;
-    bool waiting;
+    std::atomic<size_t> totalTasks = 0;
+    std::atomic<size_t> queuedTasks = 0;
+    std::atomic<size_t> nextWorker = 0;
+    std::atomic<bool> waiting = false;
+    bool running = false;
+    bool pinWorkers = false;
+
+    static inline thread_local ThreadPool* currentPool = nullptr;
+    static inline thread_local size_t currentIndex = 0;
 };
 
 } // namespace slang
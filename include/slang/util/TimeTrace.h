@@ -19,6 +19,13 @@ namespace slang {
 /// Support for performance profiling via hierarchical time tracing.
 /// Record events with @a beginTrace and @a endTrace and then dump the
 /// results to file with @a write for viewing with the Chrome Profiler.
+///
+/// In addition to wall-clock time, each recorded section includes the
+/// BumpAllocator bytes allocated while it ran and, on Linux, per-thread
+/// hardware counters (instructions retired and cache misses read via
+/// perf_event) plus the process peak RSS at the end of the section.
+/// These appear in the "args" of each trace event; on platforms or
+/// environments where a counter is unavailable it is reported as zero.
 class SLANG_EXPORT TimeTrace {
 public:
     /// Indicates whether tracing has been enabled or not.
@@ -424,6 +424,7 @@ namespace slang::syntax {
 //------------------------------------------------------------------------------
 #include "slang/syntax/AllSyntax.h"
 
+#include <cstddef>
 #include <type_traits>
 
 // This file contains all parse tree syntax node generated definitions.
@@ -431,23 +432,73 @@ namespace slang::syntax {
 
 namespace slang::syntax {
 
-size_t SyntaxNode::getChildCount() const {
-    switch (kind) {
-        case SyntaxKind::Unknown: return 0;
-        case SyntaxKind::SyntaxList:
-        case SyntaxKind::TokenList:
-        case SyntaxKind::SeparatedList:
-            return ((const SyntaxListBase*)this)->getChildCount();
+namespace detail {
+
+// offsetof on these types is conditionally-supported because they are not
+// standard-layout, but every supported compiler computes it correctly for
+// single-inheritance non-virtual hierarchies like the syntax nodes.
+#if defined(__GNUC__)
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
 """
     )
 
+    # Emit one child descriptor table per final type, then the kind-indexed
+    # master table used for branch-free child access.
+    for name in sorted(set(kindmap.values())):
+        v = alltypes[name]
+        if not v.combinedMembers:
+            continue
+
+        cppf.write("static constexpr ChildEntry {}_children[] = {{\n".format(name))
+        for m in v.combinedMembers:
+            if m[0] == "Token":
+                childKind = "TokenChild"
+            elif m[1] in v.pointerMembers:
+                childKind = "ListChild"
+            else:
+                childKind = "NodeChild"
+            cppf.write(
+                "    {{offsetof({}, {}), ChildEntry::{}}},\n".format(
+                    name, m[1], childKind
+                )
+            )
+        cppf.write("};\n\n")
+
+    cppf.write("const ChildTable childTables[] = {\n")
+    cppf.write("    {nullptr, 0}, // Unknown\n")
+    cppf.write("    {nullptr, 0}, // SyntaxList\n")
+    cppf.write("    {nullptr, 0}, // TokenList\n")
+    cppf.write("    {nullptr, 0}, // SeparatedList\n")
     for k, v in sorted(kindmap.items()):
         count = len(alltypes[v].combinedMembers)
-        cppf.write("        case SyntaxKind::{}: return {};\n".format(k, count))
+        if count:
+            cppf.write(
+                "    {{{}_children, {}}}, // {}\n".format(v, count, k)
+            )
+        else:
+            cppf.write("    {{nullptr, 0}}, // {}\n".format(k))
+    cppf.write("};\n\n")
+
+    cppf.write(
+        """#if defined(__GNUC__)
+#    pragma GCC diagnostic pop
+#endif
+
+} // namespace detail
 
-    cppf.write("    }\n")
-    cppf.write("    SLANG_UNREACHABLE;\n")
-    cppf.write("}\n\n")
+size_t SyntaxNode::getChildCount() const {
+    if (kind > SyntaxKind::SeparatedList)
+        return detail::childTables[size_t(kind)].count;
+    if (kind == SyntaxKind::Unknown)
+        return 0;
+    return ((const SyntaxListBase*)this)->getChildCount();
+}
+
+"""
+    )
 
     # Build a reverse mapping from class types to their syntax kinds.
     reverseKindmap = {}
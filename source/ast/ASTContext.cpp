@@ -7,15 +7,19 @@
 //------------------------------------------------------------------------------
 #include "slang/ast/ASTContext.h"
 
+#include "slang/ast/ASTVisitor.h"
 #include "slang/ast/Compilation.h"
 #include "slang/ast/EvalContext.h"
+#include "slang/ast/expressions/CallExpression.h"
 #include "slang/ast/expressions/MiscExpressions.h"
 #include "slang/ast/expressions/OperatorExpressions.h"
+#include "slang/ast/symbols/ParameterSymbols.h"
 #include "slang/ast/symbols/AttributeSymbol.h"
 #include "slang/ast/symbols/BlockSymbols.h"
 #include "slang/ast/symbols/InstanceSymbols.h"
 #include "slang/ast/symbols/SubroutineSymbols.h"
 #include "slang/ast/symbols/VariableSymbols.h"
+#include "slang/ast/types/AllTypes.h"
 #include "slang/ast/types/Type.h"
 #include "slang/diagnostics/DeclarationsDiags.h"
 #include "slang/diagnostics/ExpressionsDiags.h"
@@ -279,15 +283,154 @@ bool ASTContext::requireTimingAllowed(SourceRange range) const {
     return true;
 }
 
+namespace {
+
+// System functions whose constant result is a pure function of their
+// argument values and types. Anything not listed here -- $sformatf
+// (which can reference the calling scope via %m and %l), $typename,
+// the plusargs functions, etc. -- may depend on where it's evaluated
+// and must never be fold-cached across bind sites.
+bool isPureConstantSystemCall(std::string_view name) {
+    static const flat_hash_set<std::string_view> pureFuncs = {
+        "$clog2",  "$bits",     "$signed",     "$unsigned",
+        "$ln",     "$log10",    "$exp",        "$sqrt",
+        "$pow",    "$floor",    "$ceil",       "$sin",
+        "$cos",    "$tan",      "$asin",       "$acos",
+        "$atan",   "$atan2",    "$hypot",      "$sinh",
+        "$cosh",   "$tanh",     "$asinh",      "$acosh",
+        "$atanh",  "$rtoi",     "$itor",       "$realtobits",
+        "$bitstoreal", "$shortrealtobits", "$bitstoshortreal",
+        "$countbits", "$countones", "$onehot", "$onehot0",
+        "$isunknown", "$size",  "$left",       "$right",
+        "$low",    "$high",     "$increment",  "$dimensions",
+        "$unpacked_dimensions"};
+    return pureFuncs.contains(name);
+}
+
+// Collects everything a bound expression's constant value can depend on
+// besides its syntax: the values of referenced parameters and enum members
+// and the type at each node (which captures parameter-dependent widths,
+// e.g. from casts), in visitation order. Expression kinds outside the
+// whitelist, and system calls without a pure/constant guarantee, mark the
+// expression as uncacheable, which falls back to normal evaluation.
+struct FoldKeyVisitor {
+    SmallVector<const ConstantValue*> values;
+    SmallVector<const Type*> types;
+    bool cacheable = true;
+
+    template<typename T>
+    void visit(const T& expr) {
+        if (!cacheable)
+            return;
+
+        if constexpr (std::is_base_of_v<Expression, T>) {
+            switch (expr.kind) {
+                case ExpressionKind::IntegerLiteral:
+                case ExpressionKind::RealLiteral:
+                case ExpressionKind::TimeLiteral:
+                case ExpressionKind::UnbasedUnsizedIntegerLiteral:
+                case ExpressionKind::NullLiteral:
+                case ExpressionKind::UnboundedLiteral:
+                case ExpressionKind::StringLiteral:
+                case ExpressionKind::UnaryOp:
+                case ExpressionKind::BinaryOp:
+                case ExpressionKind::ConditionalOp:
+                case ExpressionKind::Inside:
+                case ExpressionKind::Concatenation:
+                case ExpressionKind::Replication:
+                case ExpressionKind::ElementSelect:
+                case ExpressionKind::RangeSelect:
+                case ExpressionKind::MemberAccess:
+                case ExpressionKind::Conversion:
+                case ExpressionKind::MinTypMax:
+                case ExpressionKind::ValueRange:
+                case ExpressionKind::SimpleAssignmentPattern:
+                case ExpressionKind::StructuredAssignmentPattern:
+                case ExpressionKind::ReplicatedAssignmentPattern:
+                    break;
+                case ExpressionKind::NamedValue: {
+                    auto& sym = expr.template as<NamedValueExpression>().symbol;
+                    if (sym.kind == SymbolKind::Parameter)
+                        values.push_back(&sym.template as<ParameterSymbol>().getValue());
+                    else if (sym.kind == SymbolKind::EnumValue)
+                        values.push_back(&sym.template as<EnumValueSymbol>().getValue());
+                    else {
+                        cacheable = false;
+                        return;
+                    }
+                    break;
+                }
+                case ExpressionKind::Call: {
+                    auto& call = expr.template as<CallExpression>();
+                    if (!call.isSystemCall() ||
+                        !isPureConstantSystemCall(call.getSubroutineName())) {
+                        cacheable = false;
+                        return;
+                    }
+                    break;
+                }
+                default:
+                    cacheable = false;
+                    return;
+            }
+
+            types.push_back(expr.type.get());
+            if constexpr (HasVisitExprs<T, FoldKeyVisitor>)
+                expr.visitExprs(*this);
+        }
+    }
+};
+
+// Shared implementation for eval() and tryEval(). Repeated binds of the same
+// syntax node (one per instance body or generate iteration) refold identical
+// expressions; when the expression's value is a pure function of its
+// referenced parameter and enum values, the fold cache on the compilation
+// lets later binds reuse the first result. Only diagnostic-free successful
+// folds are shared, so anything that needs to replay diagnostics at each
+// use site still evaluates normally.
+ConstantValue evalWithFoldCache(const ASTContext& context, const Expression& expr,
+                                bitmask<EvalFlags> extraFlags, bool reportDiags) {
+    auto& comp = context.getCompilation();
+    FoldKeyVisitor visitor;
+    std::optional<Compilation::FoldCacheKeyView> key;
+    if (expr.syntax && !expr.constant) {
+        expr.visit(visitor);
+        if (visitor.cacheable) {
+            key = Compilation::FoldCacheKeyView{expr.syntax,
+                                                {visitor.values.data(), visitor.values.size()},
+                                                {visitor.types.data(), visitor.types.size()},
+                                                uint64_t(context.flags.bits()),
+                                                uint64_t(extraFlags.bits())};
+            if (auto cached = comp.findCachedFold(*key)) {
+                expr.constant = cached;
+                return *cached;
+            }
+        }
+    }
+
+    // Folding happens constantly during binding, so recycle eval contexts
+    // through the compilation instead of rebuilding one per expression.
+    auto& ctx = comp.acquireEvalContext(context, extraFlags);
+    auto ctxGuard = ScopeGuard([&] { comp.releaseEvalContext(ctx); });
+
+    ConstantValue result = expr.eval(ctx);
+
+    if (key && ctx.getDiagCount() == 0 && expr.constant && *expr.constant)
+        comp.cacheFold(*key, *expr.constant);
+
+    if (reportDiags)
+        ctx.reportAllDiags();
+    return result;
+}
+
+} // namespace
+
 ConstantValue ASTContext::eval(const Expression& expr, bitmask<EvalFlags> extraFlags) const {
     extraFlags |= EvalFlags::CacheResults;
     if (flags.has(ASTFlags::SpecifyBlock | ASTFlags::SpecparamInitializer))
         extraFlags |= EvalFlags::SpecparamsAllowed;
 
-    EvalContext ctx(*this, extraFlags);
-    ConstantValue result = expr.eval(ctx);
-    ctx.reportAllDiags();
-    return result;
+    return evalWithFoldCache(*this, expr, extraFlags, /* reportDiags */ true);
 }
 
 ConstantValue ASTContext::tryEval(const Expression& expr) const {
@@ -295,8 +438,7 @@ ConstantValue ASTContext::tryEval(const Expression& expr) const {
     if (flags.has(ASTFlags::SpecifyBlock | ASTFlags::SpecparamInitializer))
         extraFlags |= EvalFlags::SpecparamsAllowed;
 
-    EvalContext ctx(*this, extraFlags);
-    return expr.eval(ctx);
+    return evalWithFoldCache(*this, expr, extraFlags, /* reportDiags */ false);
 }
 
 std::optional<bitwidth_t> ASTContext::requireValidBitWidth(const SVInt& value,
@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+// ASTQuery.cpp
+// Declarative queries over the elaborated AST
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/ast/ASTQuery.h"
+
+#include "slang/ast/ASTVisitor.h"
+
+namespace slang::ast {
+
+static bool nameMatches(std::string_view str, std::string_view pattern) {
+    while (!pattern.empty()) {
+        if (pattern[0] == '*') {
+            pattern.remove_prefix(1);
+            if (pattern.empty())
+                return true;
+
+            for (size_t i = 0; i <= str.size(); i++) {
+                if (nameMatches(str.substr(i), pattern))
+                    return true;
+            }
+            return false;
+        }
+
+        if (str.empty() || (pattern[0] != '?' && pattern[0] != str[0]))
+            return false;
+
+        str.remove_prefix(1);
+        pattern.remove_prefix(1);
+    }
+    return str.empty();
+}
+
+bool QueryPattern::matches(const Symbol& symbol) const {
+    if (!kinds.empty() && std::ranges::find(kinds, symbol.kind) == kinds.end())
+        return false;
+
+    if (!namePattern.empty() && !nameMatches(symbol.name, namePattern))
+        return false;
+
+    if (typePredicate) {
+        auto declaredType = symbol.getDeclaredType();
+        if (!declaredType || !typePredicate(declaredType->getType()))
+            return false;
+    }
+
+    return true;
+}
+
+size_t ASTQueryEngine::addQuery(QueryPattern pattern, QueryCallback callback) {
+    size_t index = queries.size();
+    if (pattern.kinds.empty()) {
+        unkindedQueries.push_back(index);
+    }
+    else {
+        for (auto kind : pattern.kinds) {
+            auto& bucket = kindBuckets[kind];
+            if (bucket.empty() || bucket.back() != index)
+                bucket.push_back(index);
+        }
+    }
+
+    queries.emplace_back(Query{std::move(pattern), std::move(callback)});
+    return index;
+}
+
+namespace {
+
+struct QueryVisitor : public ASTVisitor<QueryVisitor, false, false> {
+    const ASTQueryEngine& engine;
+
+    explicit QueryVisitor(const ASTQueryEngine& engine) : engine(engine) {}
+
+    template<std::derived_from<Symbol> T>
+    void handle(const T& symbol) {
+        engine.matchSymbol(symbol);
+        visitDefault(symbol);
+    }
+};
+
+} // namespace
+
+void ASTQueryEngine::run(const Symbol& root) const {
+    if (queries.empty())
+        return;
+
+    QueryVisitor visitor(*this);
+    root.visit(visitor);
+}
+
+void ASTQueryEngine::matchSymbol(const Symbol& symbol) const {
+    auto invoke = [&](size_t index) {
+        auto& query = queries[index];
+        if (query.pattern.matches(symbol))
+            query.callback(symbol);
+    };
+
+    const std::vector<size_t>* bucket = nullptr;
+    if (auto it = kindBuckets.find(symbol.kind); it != kindBuckets.end())
+        bucket = &it->second;
+
+    // Both lists are in registration order; merge them so that callbacks
+    // fire in that same order regardless of which list a query landed in.
+    size_t bi = 0, ui = 0;
+    size_t numBucketed = bucket ? bucket->size() : 0;
+    while (bi < numBucketed || ui < unkindedQueries.size()) {
+        if (ui == unkindedQueries.size() ||
+            (bi < numBucketed && (*bucket)[bi] < unkindedQueries[ui])) {
+            invoke((*bucket)[bi++]);
+        }
+        else {
+            invoke(unkindedQueries[ui++]);
+        }
+    }
+}
+
+std::vector<const Symbol*> ASTQueryEngine::findAll(const Symbol& root, QueryPattern pattern) {
+    std::vector<const Symbol*> results;
+
+    ASTQueryEngine engine;
+    engine.addQuery(std::move(pattern),
+                    [&results](const Symbol& symbol) { results.push_back(&symbol); });
+    engine.run(root);
+    return results;
+}
+
+} // namespace slang::ast
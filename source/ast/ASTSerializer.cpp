@@ -15,6 +15,7 @@
 #include "slang/text/FormatBuffer.h"
 #include "slang/text/Json.h"
 #include "slang/text/SourceManager.h"
+#include "slang/util/ThreadPool.h"
 
 namespace slang::ast {
 
@@ -26,6 +27,45 @@ void ASTSerializer::serialize(const Symbol& symbol, bool inMembersArray) {
     symbol.visit(*this, inMembersArray);
 }
 
+void ASTSerializer::serializeParallel(const Symbol& symbol, ThreadPool& pool) {
+    parallelRoot = &symbol;
+    parallelPool = &pool;
+    serialize(symbol);
+    parallelRoot = nullptr;
+    parallelPool = nullptr;
+}
+
+void ASTSerializer::serializeMembersParallel(const Scope& scope) {
+    auto members = scope.membersArray();
+    std::vector<std::string> chunks(members.size());
+
+    // Each member gets serialized into its own writer, seeded with the
+    // main writer's settings and current indentation so the chunks splice
+    // together seamlessly.
+    const int indent = writer.getCurrentIndent();
+    parallelPool->pushLoop(size_t(0), members.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++) {
+            JsonWriter chunkWriter;
+            chunkWriter.setPrettyPrint(writer.isPrettyPrint());
+            chunkWriter.setIndentSize(writer.getIndentSize());
+            chunkWriter.setCurrentIndent(indent);
+
+            ASTSerializer chunkSerializer(compilation, chunkWriter);
+            chunkSerializer.includeAddrs = includeAddrs;
+            chunkSerializer.includeSourceInfo = includeSourceInfo;
+            chunkSerializer.serialize(*members[i], /* inMembersArray */ true);
+            chunks[i] = chunkWriter.view();
+        }
+    });
+    parallelPool->waitForAll();
+
+    for (auto& chunk : chunks) {
+        // Some members (like built-in class methods) serialize to nothing.
+        if (!chunk.empty())
+            writer.writeDirect(chunk);
+    }
+}
+
 void ASTSerializer::serialize(const Expression& expr) {
     expr.visit(*this);
 }
@@ -293,8 +333,13 @@ void ASTSerializer::visit(const T& elem, bool inMembersArray) {
         if constexpr (std::is_base_of_v<Scope, T>) {
             if (!elem.empty()) {
                 startArray("members");
-                for (auto& member : elem.members())
-                    serialize(member, /* inMembersArray */ true);
+                if (parallelPool && static_cast<const Symbol*>(&elem) == parallelRoot) {
+                    serializeMembersParallel(elem);
+                }
+                else {
+                    for (auto& member : elem.members())
+                        serialize(member, /* inMembersArray */ true);
+                }
                 endArray();
             }
         }
@@ -341,11 +341,17 @@ static SVInt slicePacked(PackIterator& iter, const PackIterator iterEnd, uint64_
         return SVInt(bitwidth_t(width), 0, false); // filling with zero bits on the right
     }
 
-    ConstantValue cp = **iter;
-    if (cp.isString())
-        cp = cp.convertToInt();
+    // Slice integer leaves in place instead of copying the whole leaf first;
+    // a large packed value unpacked into many small fields would otherwise
+    // copy all of its words once per field. Strings still convert on the fly.
+    const ConstantValue* cp = *iter;
+    ConstantValue converted;
+    if (cp->isString()) {
+        converted = cp->convertToInt();
+        cp = &converted;
+    }
 
-    auto& ci = cp.integer();
+    auto& ci = cp->integer();
     SLANG_ASSERT(bit < ci.getBitWidth());
     uint64_t msb = ci.getBitWidth() - bit - 1;
     uint64_t lsb = std::min<uint64_t>(bit + width, ci.getBitWidth());
@@ -358,8 +364,11 @@ static SVInt slicePacked(PackIterator& iter, const PackIterator iterEnd, uint64_
         bit = 0;
     }
 
-    if (lsb == 0 && msb == ci.getBitWidth() - 1)
-        return std::move(ci);
+    if (lsb == 0 && msb == ci.getBitWidth() - 1) {
+        if (cp == &converted)
+            return std::move(converted.integer());
+        return ci;
+    }
 
     return ci.slice(static_cast<int32_t>(msb), static_cast<int32_t>(lsb));
 }
@@ -829,7 +838,7 @@ static bool unpackConcatenation(const StreamingConcatenationExpression& lhs, Pac
                         auto newValue = Bitstream::resizeToRange(std::move(oldValue),
                                                                  {0, with.right},
                                                                  elemType->getDefaultValue(), true);
-                        lvalue.store(newValue);
+                        lvalue.store(std::move(newValue));
                     }
                 }
 
@@ -839,7 +848,7 @@ static bool unpackConcatenation(const StreamingConcatenationExpression& lhs, Pac
                     lvalue.addArraySlice(with, elemType->getDefaultValue());
             }
 
-            lvalue.store(rvalue);
+            lvalue.store(std::move(rvalue));
         }
     }
 
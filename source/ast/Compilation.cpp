@@ -9,9 +9,12 @@
 
 #include "ElabVisitors.h"
 #include "builtins/Builtins.h"
+#include <charconv>
 #include <fmt/core.h>
 #include <mutex>
 
+#include "slang/ast/EvalContext.h"
+#include "slang/ast/Lookup.h"
 #include "slang/ast/ScriptSession.h"
 #include "slang/ast/SystemSubroutine.h"
 #include "slang/ast/types/TypePrinter.h"
@@ -22,15 +25,20 @@
 #include "slang/parsing/Parser.h"
 #include "slang/parsing/Preprocessor.h"
 #include "slang/syntax/SyntaxTree.h"
+#include "slang/syntax/SyntaxVisitor.h"
 #include "slang/text/CharInfo.h"
 #include "slang/text/SourceManager.h"
+#include "slang/util/ThreadPool.h"
 #include "slang/util/TimeTrace.h"
 
 using namespace slang::parsing;
 
 namespace slang::ast::builtins {
 
-Builtins Builtins::Instance;
+Builtins& Builtins::getInstance() {
+    static Builtins instance;
+    return instance;
+}
 
 void registerGateTypes(Compilation&);
 const PackageSymbol& createStdPackage(Compilation&);
@@ -43,8 +51,14 @@ Compilation::Compilation(const Bag& options, const SourceLibrary* defaultLib) :
     options(options.getOrDefault<CompilationOptions>()), driverMapAllocator(*this),
     unrollIntervalMapAllocator(*this), tempDiag({}, {}), defaultLibPtr(defaultLib) {
 
+    // Most of what gets allocated directly from the compilation is symbols;
+    // type and constant allocations are attributed separately.
+    setDefaultCategory(AllocCategory::Symbols);
+    symbolMapAllocator.setDefaultCategory(AllocCategory::Symbols);
+    constantAllocator.setDefaultCategory(AllocCategory::Constants);
+
     // Construct all built-in types.
-    auto& bi = slang::ast::builtins::Builtins::Instance;
+    auto& bi = slang::ast::builtins::Builtins::getInstance();
     bitType = &bi.bitType;
     logicType = &bi.logicType;
     intType = &bi.intType;
@@ -137,16 +151,12 @@ Compilation::Compilation(const Bag& options, const SourceLibrary* defaultLib) :
 
     root = std::make_unique<RootSymbol>(*this);
 
-    // Copy in all built-in system tasks, functions, and methods.
-    subroutineMap = bi.subroutineMap;
-    methodMap = bi.methodMap;
-
-    // Register the built-in std package.
-    stdPkg = &builtins::createStdPackage(*this);
-    packageMap.emplace(stdPkg->name, stdPkg);
-
-    // Register the built-in gate types.
-    builtins::registerGateTypes(*this);
+    // Note: built-in system tasks, functions, and methods are not copied
+    // in here; lookups consult the shared Builtins maps directly so that
+    // short-lived compilations don't pay to duplicate them. Similarly the
+    // built-in std package and gate types are not created here;
+    // they get constructed lazily on first use so that short-lived
+    // compilations that never reference them don't pay for building them.
 
     // Register the default library.
     if (defaultLibPtr) {
@@ -175,6 +185,16 @@ Compilation::Compilation(const Bag& options, const SourceLibrary* defaultLib) :
     nextEnumSystemId = 1;
     nextStructSystemId = 1;
     nextUnionSystemId = 1;
+
+    // If the creator provided a hint about the expected scale of the design,
+    // pre-size the major name maps and type caches so that large designs
+    // don't spend elaboration time repeatedly rehashing them.
+    if (uint32_t hint = this->options.expectedDesignElements) {
+        definitionMap.reserve(hint);
+        packageMap.reserve(std::max(hint / 8, 16u));
+        vectorTypeCache.reserve(std::min(hint, 1024u));
+        packedArrayCache.reserve(std::min(hint * 2, 4096u));
+    }
 }
 
 Compilation::~Compilation() = default;
@@ -215,7 +235,16 @@ void Compilation::addSyntaxTree(std::shared_ptr<SyntaxTree> tree) {
     root->addMember(*unit);
     compilationUnits.push_back(unit);
 
-    for (auto& [n, meta] : tree->getMetadata().nodeMap) {
+    // The parser counted the declarations in this tree, so grow the lookup
+    // tables once up front instead of rehashing as each one is inserted.
+    auto& treeMeta = tree->getMetadata();
+    if (treeMeta.definitionCount)
+        definitionMap.reserve(definitionMap.size() + treeMeta.definitionCount);
+    if (treeMeta.packageCount)
+        packageMap.reserve(packageMap.size() + treeMeta.packageCount);
+    syntaxMetadata.reserve(syntaxMetadata.size() + treeMeta.nodeMap.size());
+
+    for (auto& [n, meta] : treeMeta.nodeMap) {
         SyntaxMetadata result;
         result.tree = tree.get();
         result.defaultNetType = &getNetType(meta.defaultNetType);
@@ -236,11 +265,14 @@ void Compilation::addSyntaxTree(std::shared_ptr<SyntaxTree> tree) {
         syntaxMetadata[n] = result;
     }
 
-    for (auto& name : tree->getMetadata().globalInstances)
+    globalInstantiations.reserve(globalInstantiations.size() + treeMeta.globalInstances.size());
+    for (auto& name : treeMeta.globalInstances)
         globalInstantiations.emplace(name);
 
     if (node.kind == SyntaxKind::CompilationUnit) {
-        for (auto member : node.as<CompilationUnitSyntax>().members)
+        auto members = node.as<CompilationUnitSyntax>().members;
+        unit->reserveMembers(members.size());
+        for (auto member : members)
             unit->addMembers(*member);
     }
     else if (node.kind == SyntaxKind::LibraryMap) {
@@ -596,10 +628,15 @@ Compilation::DefinitionLookupResult Compilation::tryGetDefinition(std::string_vi
     if (it->second.second) {
         auto searchScope = &scope;
         do {
-            auto scopeIt = definitionMap.find({lookupName, searchScope});
-            if (scopeIt != definitionMap.end()) {
-                it = scopeIt;
-                break;
+            // Most scopes along the path contain no definitions at all, so
+            // check the membership set first to skip hashing the full
+            // name / scope key against the definition map for them.
+            if (scopesWithLocalDefs.contains(searchScope)) {
+                auto scopeIt = definitionMap.find({lookupName, searchScope});
+                if (scopeIt != definitionMap.end()) {
+                    it = scopeIt;
+                    break;
+                }
             }
 
             searchScope = searchScope->asSymbol().getParentScope();
@@ -929,16 +966,33 @@ void Compilation::insertDefinition(Symbol& symbol, const Scope& scope) {
     else {
         // Record the fact that we have nested modules with this name.
         definitionMap[std::tuple(symbol.name, root.get())].second = true;
+        scopesWithLocalDefs.insert(targetScope);
     }
 }
 
 const PackageSymbol* Compilation::getPackage(std::string_view lookupName) const {
     auto it = packageMap.find(lookupName);
-    if (it == packageMap.end())
+    if (it == packageMap.end()) {
+        // The built-in std package is created on demand the first time
+        // someone asks for it.
+        if (lookupName == "std"sv)
+            return &getStdPackage();
         return nullptr;
+    }
     return it->second;
 }
 
+const PackageSymbol& Compilation::getStdPackage() const {
+    if (!stdPkg) {
+        // const_cast is fine; the std package is logically part of every
+        // compilation and we're just constructing it lazily.
+        auto self = const_cast<Compilation*>(this);
+        self->stdPkg = &builtins::createStdPackage(*self);
+        self->packageMap.emplace(stdPkg->name, stdPkg);
+    }
+    return *stdPkg;
+}
+
 const PackageSymbol& Compilation::createPackage(const Scope& scope,
                                                 const ModuleDeclarationSyntax& syntax) {
     auto& metadata = syntaxMetadata[&syntax];
@@ -1006,6 +1060,11 @@ const PrimitiveSymbol& Compilation::createPrimitive(Scope& scope,
 }
 
 const PrimitiveSymbol* Compilation::getGateType(std::string_view lookupName) const {
+    // The built-in gates are registered on the first lookup; designs that
+    // don't instantiate any gate primitives never create them at all.
+    if (gateMap.empty())
+        builtins::registerGateTypes(*const_cast<Compilation*>(this));
+
     if (auto it = gateMap.find(lookupName); it != gateMap.end())
         return it->second;
     return nullptr;
@@ -1026,6 +1085,13 @@ void Compilation::addSystemMethod(SymbolKind typeKind,
 }
 
 const SystemSubroutine* Compilation::getSystemSubroutine(std::string_view name) const {
+    // Builtins are shared immutably across compilations rather than copied
+    // into each one. They take precedence over locally registered entries,
+    // which matches the old behavior of copying them in up front.
+    auto& bi = builtins::Builtins::getInstance();
+    if (auto it = bi.subroutineMap.find(name); it != bi.subroutineMap.end())
+        return it->second.get();
+
     auto it = subroutineMap.find(name);
     if (it == subroutineMap.end())
         return nullptr;
@@ -1034,6 +1100,10 @@ const SystemSubroutine* Compilation::getSystemSubroutine(std::string_view name)
 
 const SystemSubroutine* Compilation::getSystemMethod(SymbolKind typeKind,
                                                      std::string_view name) const {
+    auto& bi = builtins::Builtins::getInstance();
+    if (auto it = bi.methodMap.find(std::make_tuple(name, typeKind)); it != bi.methodMap.end())
+        return it->second.get();
+
     auto it = methodMap.find(std::make_tuple(name, typeKind));
     if (it == methodMap.end())
         return nullptr;
@@ -1095,6 +1165,47 @@ void Compilation::noteInstanceWithDefBind(const Symbol& instance) {
     instancesWithDefBinds[&def].push_back(&instance);
 }
 
+void Compilation::noteUpwardNames(const DefinitionSymbol& def) {
+    defsWithUpwardNames.emplace(&def);
+}
+
+bool Compilation::hasUpwardNames(const DefinitionSymbol& def) const {
+    return defsWithUpwardNames.contains(&def);
+}
+
+void Compilation::noteHierarchicalReference(const DefinitionSymbol& def) {
+    defsWithHierRefs.emplace(&def);
+}
+
+bool Compilation::hasHierarchicalReferences(const DefinitionSymbol& def) const {
+    return defsWithHierRefs.contains(&def);
+}
+
+std::optional<std::string_view> Compilation::getCachedHierarchicalPath(const Symbol& symbol) const {
+    if (auto it = hierPathCache.find(&symbol); it != hierPathCache.end())
+        return it->second;
+    return std::nullopt;
+}
+
+void Compilation::cacheHierarchicalPath(const Symbol& symbol, std::string_view path) {
+    auto copied = copyFrom(std::span<const char>(path.data(), path.size()));
+    hierPathCache[&symbol] = std::string_view(copied.data(), copied.size());
+}
+
+std::vector<std::pair<const DefinitionSymbol*, std::string_view>> Compilation::
+    getElabSharingBlockers() const {
+    std::vector<std::pair<const DefinitionSymbol*, std::string_view>> results;
+    for (auto [def, reason] : elabSharingBlockers) {
+        // Definitions with a single instance have nothing to share anyway,
+        // so don't clutter the report with them.
+        if (def->getInstanceCount() > 1)
+            results.emplace_back(def, reason);
+    }
+
+    std::ranges::sort(results, [](auto& a, auto& b) { return a.first->name < b.first->name; });
+    return results;
+}
+
 void Compilation::noteDPIExportDirective(const DPIExportSyntax& syntax, const Scope& scope) {
     dpiExports.emplace_back(&syntax, &scope);
 }
@@ -1306,17 +1417,150 @@ CompilationUnitSymbol& Compilation::createScriptScope() {
     return *unit;
 }
 
+namespace {
+
+// Walks just enough of the design to materialize the instance tree:
+// visiting a scope's members forces creation of child instances, generate
+// blocks, and parameter values, but with statement and expression
+// visitation disabled nothing inside those members gets bound.
+struct HierarchySkeletonVisitor : public ASTVisitor<HierarchySkeletonVisitor, false, false> {};
+
+} // namespace
+
 void Compilation::elaborate() {
+    // Query-scoped elaboration: callers that only need the definition set
+    // or the shape of the instance hierarchy can stop the walk before any
+    // statement or expression binding happens.
+    if (options.elaborationMode == ElaborationMode::DefinitionsOnly) {
+        progress.phase = ElaborationProgress::Complete;
+        return;
+    }
+
+    if (options.elaborationMode == ElaborationMode::HierarchySkeleton) {
+        HierarchySkeletonVisitor skeletonVisitor;
+        getRoot().visit(skeletonVisitor);
+        progress.phase = ElaborationProgress::Complete;
+        return;
+    }
+
     // Touch every symbol, scope, statement, and expression tree so that
     // we can be sure we have all the diagnostics.
     uint32_t errorLimit = options.errorLimit == 0 ? UINT32_MAX : options.errorLimit;
     DiagnosticVisitor elabVisitor(*this, numErrors, errorLimit);
-    getRoot().visit(elabVisitor);
 
-    if (elabVisitor.finishedEarly())
-        return;
+    // The walk over the design is structured as one unit of work per
+    // top-level instance subtree, with the shared parts of the design
+    // (packages, compilation units, and other root scope members) visited
+    // up front since instance subtrees can depend on all of them.
+    //
+    // Note that the units are currently elaborated serially: visitation
+    // builds the AST lazily, and every binding allocates from the
+    // compilation's shared bump allocator (`alloc`) and mutates shared
+    // symbol maps and caches (diagMap, attributeMap, the scope name maps,
+    // and the various note* lists). Until that state supports concurrent
+    // mutation the units can't safely be handed to separate threads --
+    // this applies equally to the diagnostic visitation below, which is
+    // the dominant cost of getAllDiagnostics on large designs. Keeping
+    // the units explicit here means the scheduling can improve as that
+    // state gets sharded.
+    auto& root = getRoot();
+
+    // Packages otherwise elaborate lazily on first import, which folds their
+    // work into whichever importer happens to be visited first. Visit them
+    // eagerly in dependency order instead -- a package's own imports first --
+    // so each one is fully checked as its own unit before anything depends on
+    // it. Only top-level imports are considered for ordering; imports nested
+    // deeper still resolve lazily and correctly, they just don't reorder the
+    // walk. Cyclic imports are broken wherever the cycle is first entered.
+    {
+        progress.phase = ElaborationProgress::Packages;
+
+        flat_hash_set<const PackageSymbol*> visitedPackages;
+        auto visitPackage = [&](auto&& self, const PackageSymbol& pkg) -> void {
+            if (!visitedPackages.insert(&pkg).second)
+                return;
+
+            for (auto& member : pkg.members()) {
+                std::string_view depName;
+                if (member.kind == SymbolKind::WildcardImport)
+                    depName = member.as<WildcardImportSymbol>().packageName;
+                else if (member.kind == SymbolKind::ExplicitImport)
+                    depName = member.as<ExplicitImportSymbol>().packageName;
+                else
+                    continue;
+
+                if (auto it = packageMap.find(depName); it != packageMap.end())
+                    self(self, *it->second);
+            }
+
+            pkg.visit(elabVisitor);
+        };
+
+        for (auto unit : compilationUnits) {
+            for (auto& member : unit->members()) {
+                if (member.kind == SymbolKind::Package)
+                    visitPackage(visitPackage, member.as<PackageSymbol>());
+            }
+        }
+    }
+
+    // The packages just visited are skipped when their compilation unit is
+    // visited here; see DiagnosticVisitor::handle(PackageSymbol).
+    progress.phase = ElaborationProgress::CompilationUnits;
+    for (auto& member : root.members()) {
+        if (member.kind != SymbolKind::Instance)
+            member.visit(elabVisitor);
+    }
 
-    elabVisitor.finalize();
+    progress.phase = ElaborationProgress::TopInstances;
+    for (auto inst : root.topInstances) {
+        if (elabVisitor.finishedEarly())
+            break;
+        inst->visit(elabVisitor);
+        elabVisitor.drainSuspendedSubtrees();
+    }
+
+    // Unreferenced definitions were instantiated in invalid form by getRoot
+    // so that their contents still get checked; those instances live in the
+    // root scope but aren't tops, and each forms its own unit of work here.
+    // This ordering matters for lint-only runs, where typically every
+    // definition is unreferenced and all of the checking happens in this
+    // loop; symbols are still only resolved when a unit is actually visited,
+    // so bailing out early (error limit) leaves the rest untouched.
+    progress.phase = ElaborationProgress::UnreferencedInstances;
+    for (auto& member : root.members()) {
+        if (elabVisitor.finishedEarly())
+            break;
+
+        if (member.kind == SymbolKind::Instance &&
+            member.as<InstanceSymbol>().body.flags.has(InstanceFlags::Uninstantiated)) {
+            member.visit(elabVisitor);
+            elabVisitor.drainSuspendedSubtrees();
+        }
+    }
+
+    // Hierarchical names that reach into an instance can be bound after its
+    // body was skipped as a duplicate; any definitions flagged that way need
+    // their skipped bodies elaborated for real before the walk is done.
+    elabVisitor.visitDeferredSharedBodies();
+
+    if (!elabVisitor.finishedEarly()) {
+        progress.phase = ElaborationProgress::Finalizing;
+        elabVisitor.finalize();
+        elabVisitor.visitDeferredSharedBodies();
+    }
+
+    // Remember which bodies stood in for identical duplicates so that
+    // diagnostic coalescing can account for the skipped instances, and
+    // which constructs prevented sharing for reporting purposes.
+    sharedElaborations = std::move(elabVisitor.sharedElabCounts);
+    elabSharingBlockers = std::move(elabVisitor.sharingBlockers);
+    elabCostStats = std::move(elabVisitor.costStats);
+
+    if (elabVisitor.finishedEarly()) {
+        progress.phase = ElaborationProgress::Complete;
+        return;
+    }
 
     // Note for the following checks here: anything that depends on a list
     // stored in the compilation object should think carefully about taking
@@ -1428,6 +1672,7 @@ void Compilation::elaborate() {
         }
     }
 
+    progress.phase = ElaborationProgress::UnusedSweep;
     if (!hasFlag(CompilationFlags::SuppressUnused)) {
         // Report on unused definitions.
         for (auto def : unreferencedDefs) {
@@ -1449,9 +1694,32 @@ void Compilation::elaborate() {
             }
         }
 
-        PostElabVisitor postElabVisitor(*this);
+        PostElabVisitor postElabVisitor(*this, elabVisitor.visitedBodies);
         getRoot().visit(postElabVisitor);
     }
+
+    progress.phase = ElaborationProgress::Complete;
+}
+
+std::string_view Compilation::ElaborationProgress::phaseName() const {
+    switch (phase.load(std::memory_order_relaxed)) {
+        case Packages:
+            return "packages"sv;
+        case CompilationUnits:
+            return "compilation units"sv;
+        case TopInstances:
+            return "instances"sv;
+        case UnreferencedInstances:
+            return "unreferenced modules"sv;
+        case Finalizing:
+            return "finalizing"sv;
+        case UnusedSweep:
+            return "unused checks"sv;
+        case Complete:
+            return "complete"sv;
+        default:
+            return "not started"sv;
+    }
 }
 
 const Diagnostics& Compilation::getParseDiagnostics() {
@@ -1475,7 +1743,9 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
     elaborate();
 
     Diagnostics results;
-    for (auto& [key, diagList] : diagMap) {
+    for (auto& [key, group] : diagMap) {
+        auto& diagList = group.diags;
+
         // If the location is NoLocation, just issue each diagnostic.
         if (std::get<1>(key) == SourceLocation::NoLocation) {
             for (auto& diag : diagList)
@@ -1521,10 +1791,17 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
             if (!symbol)
                 continue;
 
-            auto parent = symbol->as<InstanceBodySymbol>().parentInstance;
+            auto& diagBody = symbol->as<InstanceBodySymbol>();
+            auto parent = diagBody.parentInstance;
             SLANG_ASSERT(parent);
 
+            // A body whose elaboration stood in for identical duplicates
+            // counts once for each instance it represents.
             count++;
+            if (auto sharedIt = sharedElaborations.find(&diagBody);
+                sharedIt != sharedElaborations.end()) {
+                count += sharedIt->second;
+            }
             if (auto scope = parent->getParentScope()) {
                 auto& sym = scope->asSymbol();
                 if (sym.kind != SymbolKind::Root && sym.kind != SymbolKind::CompilationUnit) {
@@ -1534,6 +1811,31 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
             }
         }
 
+        // Copies folded at issue time match the first stored diagnostic by
+        // construction, so fold their instance contributions back in here.
+        if (!differingArgs) {
+            for (auto body : group.foldedBodies) {
+                count++;
+                if (auto sharedIt = sharedElaborations.find(body);
+                    sharedIt != sharedElaborations.end()) {
+                    count += sharedIt->second;
+                }
+
+                if (!found) {
+                    auto parent = body->parentInstance;
+                    SLANG_ASSERT(parent);
+                    if (auto scope = parent->getParentScope()) {
+                        auto& sym = scope->asSymbol();
+                        if (sym.kind != SymbolKind::Root &&
+                            sym.kind != SymbolKind::CompilationUnit) {
+                            found = &diagList.front();
+                            inst = parent;
+                        }
+                    }
+                }
+            }
+        }
+
         if (!differingArgs && found &&
             inst->as<InstanceSymbol>().getDefinition().getInstanceCount() > count) {
             // The diagnostic is present only in some instances, so include the coalescing
@@ -1552,8 +1854,20 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
 
             {
                 Diagnostic d = *it;
-                if (differingArgs)
-                    d.coalesceCount = 1;
+                if (differingArgs) {
+                    // Folded copies always match this first diagnostic, so
+                    // they roll up into its instance count even though the
+                    // rest of the group gets reported individually.
+                    size_t c = 1;
+                    for (auto body : group.foldedBodies) {
+                        c++;
+                        if (auto sharedIt = sharedElaborations.find(body);
+                            sharedIt != sharedElaborations.end()) {
+                            c += sharedIt->second;
+                        }
+                    }
+                    d.coalesceCount = c;
+                }
                 results.emplace_back(std::move(d));
             }
 
@@ -1579,20 +1893,248 @@ const Diagnostics& Compilation::getAllDiagnostics() {
     if (cachedAllDiagnostics)
         return *cachedAllDiagnostics;
 
+    auto& parseDiags = getParseDiagnostics();
+    auto& semanticDiags = getSemanticDiagnostics();
+
     cachedAllDiagnostics.emplace();
-    cachedAllDiagnostics->append_range(getParseDiagnostics());
-    cachedAllDiagnostics->append_range(getSemanticDiagnostics());
+    cachedAllDiagnostics->append_range(parseDiags);
+    cachedAllDiagnostics->append_range(semanticDiags);
 
-    if (sourceManager)
+    // Both input lists are already sorted, so the combined list only needs
+    // another sorting pass when they actually have to be interleaved.
+    if (sourceManager && !parseDiags.empty() && !semanticDiags.empty())
         cachedAllDiagnostics->sort(*sourceManager);
     return *cachedAllDiagnostics;
 }
 
+void Compilation::freeze() {
+    if (frozen)
+        return;
+
+    // The frozen contract promises that nothing is left to lazily resolve,
+    // which a query-scoped elaboration mode cannot provide: the lookup
+    // caches gated on the frozen flag assume name maps no longer grow.
+    // Force a full pass here, discarding any diagnostics cached by an
+    // earlier shallow elaboration so that it actually runs.
+    if (options.elaborationMode != ElaborationMode::Full) {
+        options.elaborationMode = ElaborationMode::Full;
+        cachedSemanticDiagnostics.reset();
+        cachedAllDiagnostics.reset();
+    }
+
+    // Gathering the full set of diagnostics visits every instance in the
+    // design and forces all remaining lazy resolution, so nothing is left
+    // to resolve (and therefore to allocate) during later traversals.
+    // Elaboration itself still runs serially since it mutates the shared
+    // bump allocator and symbol caches; the payoff is that the frozen
+    // design can then be handed to any number of reader threads.
+    getAllDiagnostics();
+    frozen = true;
+}
+
+std::pair<uint64_t, uint64_t> Compilation::getDesignHash(ThreadPool* pool) {
+    // Freezing forces all remaining lazy resolution, after which each top's
+    // merkle hash only reads and caches into its own subtree, so the tops
+    // can be hashed concurrently.
+    freeze();
+
+    auto tops = getRoot().topInstances;
+    if (pool) {
+        pool->pushLoop(size_t(0), tops.size(), [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++)
+                tops[i]->body.getStructuralHash();
+        });
+        pool->waitForAll();
+    }
+
+    // Fold the (now cached) hashes together in declaration order so the
+    // result is deterministic. Two differently seeded lanes widen the key to
+    // 128 bits; the underlying per-body hashes are still 64-bit, which is
+    // plenty for cache keying.
+    size_t lo = 0;
+    size_t hi = 0x9e3779b97f4a7c15ull;
+    for (auto inst : tops) {
+        uint64_t bodyHash = inst->body.getStructuralHash();
+        hash_combine(lo, inst->name, bodyHash);
+        hash_combine(hi, bodyHash, inst->name);
+    }
+    return {lo, hi};
+}
+
+// Gets the scope to search when resolving a hierarchical path component
+// underneath the given symbol, or nullptr if the symbol can't have children.
+static const Scope* getPathChildScope(const Symbol* symbol) {
+    if (!symbol)
+        return nullptr;
+    if (symbol->kind == SymbolKind::Instance)
+        return &symbol->as<InstanceSymbol>().body;
+    return symbol->isScope() ? &symbol->as<Scope>() : nullptr;
+}
+
+// Resolves one dotted path component -- a member name plus any constant
+// "[index]" selectors -- as a direct member of the given scope.
+static const Symbol* resolvePathComponent(const Scope& scope, std::string_view component) {
+    size_t bracket = component.find('[');
+    const Symbol* symbol = scope.find(component.substr(0, bracket));
+
+    while (symbol && bracket != std::string_view::npos) {
+        size_t close = component.find(']', bracket);
+        if (close == std::string_view::npos)
+            return nullptr;
+
+        int32_t index;
+        auto first = component.data() + bracket + 1;
+        auto last = component.data() + close;
+        if (auto fc = std::from_chars(first, last, index); fc.ec != std::errc() || fc.ptr != last)
+            return nullptr;
+
+        if (symbol->kind == SymbolKind::InstanceArray) {
+            auto& array = symbol->as<InstanceArraySymbol>();
+            if (array.elements.empty() || !array.range.containsPoint(index))
+                return nullptr;
+            symbol = array.elements[size_t(array.range.translateIndex(index))];
+        }
+        else if (symbol->kind == SymbolKind::GenerateBlockArray) {
+            auto& array = symbol->as<GenerateBlockArraySymbol>();
+            if (!array.valid)
+                return nullptr;
+
+            symbol = nullptr;
+            for (auto entry : array.getEntries()) {
+                if (entry->arrayIndex && *entry->arrayIndex == index) {
+                    symbol = entry;
+                    break;
+                }
+            }
+        }
+        else {
+            return nullptr;
+        }
+
+        bracket = component.find('[', close);
+    }
+    return symbol;
+}
+
+std::vector<const Symbol*> Compilation::resolveHierarchicalPaths(
+    std::span<const std::string_view> paths) {
+
+    auto& root = getRoot();
+    std::vector<const Symbol*> results(paths.size());
+
+    // Every resolved prefix (including failed ones) is recorded here, so each
+    // distinct scope in the batch is walked into exactly once.
+    flat_hash_map<std::string_view, const Symbol*> cache;
+
+    for (size_t i = 0; i < paths.size(); i++) {
+        auto path = paths[i];
+        if (path.empty())
+            continue;
+
+        if (auto it = cache.find(path); it != cache.end()) {
+            results[i] = it->second;
+            continue;
+        }
+
+        // Resume from the longest already-resolved prefix.
+        const Scope* scope = &root;
+        size_t pos = 0;
+        for (size_t prefixEnd = path.rfind('.');
+             prefixEnd != std::string_view::npos && prefixEnd != 0;
+             prefixEnd = path.rfind('.', prefixEnd - 1)) {
+
+            if (auto it = cache.find(path.substr(0, prefixEnd)); it != cache.end()) {
+                scope = getPathChildScope(it->second);
+                pos = prefixEnd + 1;
+                break;
+            }
+        }
+
+        // Walk the remaining components, caching each new prefix as we go.
+        // A failed component poisons all longer prefixes with nullptr.
+        const Symbol* symbol = nullptr;
+        while (true) {
+            size_t dot = path.find('.', pos);
+            auto component = path.substr(pos, dot == std::string_view::npos ? std::string_view::npos
+                                                                            : dot - pos);
+            symbol = scope ? resolvePathComponent(*scope, component) : nullptr;
+
+            size_t prefixLen = dot == std::string_view::npos ? path.size() : dot;
+            cache.emplace(path.substr(0, prefixLen), symbol);
+
+            if (dot == std::string_view::npos)
+                break;
+
+            scope = getPathChildScope(symbol);
+            pos = dot + 1;
+        }
+        results[i] = symbol;
+    }
+    return results;
+}
+
+std::vector<const Statement*> Compilation::findConstantDeadStatements(const Symbol& symbol) {
+    std::vector<const Statement*> dead;
+    ASTContext astCtx(getRoot(), LookupLocation::max);
+
+    auto visitor = makeVisitor([&](auto& v, const ConditionalStatement& stmt) {
+        // Descend first; a branch that is itself dead can still contain
+        // nested constant conditions worth reporting separately.
+        v.visitDefault(stmt);
+
+        // All conditions must be definitely true for ifTrue to run; one
+        // definitely false condition kills it. Unknown bits, patterns, and
+        // non-constant expressions prove nothing.
+        bool allTrue = true;
+        for (auto& cond : stmt.conditions) {
+            if (cond.pattern)
+                return;
+
+            EvalContext evalCtx(astCtx);
+            ConstantValue cv = cond.expr->eval(evalCtx);
+            if (!cv)
+                return;
+
+            if (cv.isFalse()) {
+                dead.push_back(&stmt.ifTrue);
+                return;
+            }
+            if (!cv.isTrue())
+                allTrue = false;
+        }
+
+        if (allTrue && stmt.ifFalse)
+            dead.push_back(stmt.ifFalse);
+    });
+    symbol.visit(visitor);
+    return dead;
+}
+
 void Compilation::addDiagnostics(const Diagnostics& diagnostics) {
     for (auto& diag : diagnostics)
         addDiag(diag);
 }
 
+// Walks from a diagnostic's symbol up to the instance body containing it, for
+// the purposes of folding duplicate diagnostics down to just that pointer.
+// Diagnostics from inside checker bodies pick up expansion notes during
+// reporting and so aren't foldable; they return null here and take the full
+// storage path.
+static const InstanceBodySymbol* getFoldableBody(const Diagnostic& diag) {
+    auto symbol = diag.symbol;
+    while (symbol && symbol->kind != SymbolKind::InstanceBody) {
+        if (symbol->kind == SymbolKind::CheckerInstanceBody)
+            return nullptr;
+
+        auto scope = symbol->getParentScope();
+        symbol = scope ? &scope->asSymbol() : nullptr;
+    }
+
+    if (!symbol)
+        return nullptr;
+    return &symbol->as<InstanceBodySymbol>();
+}
+
 Diagnostic& Compilation::addDiag(Diagnostic diag) {
     auto isSuppressed = [](const Symbol* symbol) {
         while (symbol) {
@@ -1613,22 +2155,34 @@ Diagnostic& Compilation::addDiag(Diagnostic diag) {
         return tempDiag;
     }
 
-    // Coalesce diagnostics that are at the same source location and have the same code.
-    if (auto it = diagMap.find({diag.code, diag.location}); it != diagMap.end()) {
-        auto& diagList = it->second;
-        diagList.emplace_back(std::move(diag));
-        return diagList.back();
-    }
-
-    if (diag.isError())
+    // Coalesce diagnostics that are at the same source location and have the
+    // same code. A single try_emplace covers both the hit and the miss case
+    // so the key is only hashed once per added diagnostic.
+    auto [it, inserted] = diagMap.try_emplace({diag.code, diag.location});
+    if (inserted && diag.isError())
         numErrors++;
 
-    auto key = std::make_tuple(diag.code, diag.location);
-    std::vector<Diagnostic> newEntry;
-    newEntry.emplace_back(std::move(diag));
+    auto& group = it->second;
+    auto& diagList = group.diags;
 
-    auto [it, inserted] = diagMap.emplace(key, std::move(newEntry));
-    return it->second.back();
+    // The reference we return is still being built by the caller (arguments
+    // and notes get appended after we return), so the newest entry for a key
+    // can never be examined right away; the arrival of the next diagnostic
+    // for the same key is what marks the previous one complete. At that
+    // point, a copy that matches the first diagnostic of the group collapses
+    // to just its instance body pointer -- in heavily replicated hierarchies
+    // the duplicate copies otherwise dominate diagnostic memory. Report-time
+    // coalescing adds the folded bodies back into its instance counts.
+    if (diagList.size() > 1 && diag.location != SourceLocation::NoLocation) {
+        if (auto body = getFoldableBody(diagList.back());
+            body && diagList.back() == diagList.front()) {
+            group.foldedBodies.push_back(body);
+            diagList.pop_back();
+        }
+    }
+
+    diagList.emplace_back(std::move(diag));
+    return diagList.back();
 }
 
 AssertionInstanceDetails* Compilation::allocAssertionDetails() {
@@ -1643,6 +2197,10 @@ Scope::WildcardImportData* Compilation::allocWildcardImportData() {
     return wildcardImportAllocator.emplace();
 }
 
+CaseMatchTable* Compilation::allocCaseMatchTable(CaseMatchTable&& table) {
+    return caseMatchAllocator.emplace(std::move(table));
+}
+
 const ImplicitTypeSyntax& Compilation::createEmptyTypeSyntax(SourceLocation loc) {
     return *emplace<ImplicitTypeSyntax>(Token(), nullptr,
                                         Token(*this, TokenKind::Placeholder, {}, {}, loc));
@@ -1655,6 +2213,249 @@ void Compilation::forceElaborate(const Symbol& symbol) {
     symbol.visit(visitor);
 }
 
+size_t Compilation::MemoizedCallHasher::hashKey(const SubroutineSymbol* sub,
+                                                std::span<const ConstantValue> args) {
+    size_t seed = slang::hash<const SubroutineSymbol*>()(sub);
+    for (auto& arg : args)
+        hash_combine(seed, arg);
+    return seed;
+}
+
+const ConstantValue* Compilation::findMemoizedCall(const SubroutineSymbol& subroutine,
+                                                   std::span<const ConstantValue> args) const {
+    auto it = memoizedCalls.find(std::pair{&subroutine, args});
+    if (it == memoizedCalls.end())
+        return nullptr;
+
+    memoizedCallHits++;
+    return &it->second;
+}
+
+void Compilation::memoizeCall(const SubroutineSymbol& subroutine,
+                              std::span<const ConstantValue> args, ConstantValue result) {
+    // Keep memory usage predictable: rather than tracking recency just flush
+    // the whole table once it gets too big. Workloads that benefit from
+    // memoization tend to hit a small set of hot functions over and over,
+    // so the table quickly repopulates with the entries that matter.
+    static constexpr size_t MaxMemoizedCalls = 1 << 16;
+    if (memoizedCalls.size() >= MaxMemoizedCalls)
+        memoizedCalls.clear();
+
+    memoizedCalls.emplace(
+        MemoizedCallKey{&subroutine, std::vector<ConstantValue>(args.begin(), args.end())},
+        std::move(result));
+}
+
+const Compilation::IfaceConnMemo* Compilation::findMemoizedIfaceConn(
+    const Scope& parent, const syntax::SyntaxNode& instanceSyntax,
+    std::string_view portName) const {
+    auto it = memoizedIfaceConns.find(std::tuple{&parent, &instanceSyntax, portName});
+    if (it == memoizedIfaceConns.end())
+        return nullptr;
+
+    ifaceConnHits++;
+    return &it->second;
+}
+
+void Compilation::memoizeIfaceConn(const Scope& parent, const syntax::SyntaxNode& instanceSyntax,
+                                   std::string_view portName, IfaceConnMemo memo) {
+    memoizedIfaceConns.emplace(std::tuple{&parent, &instanceSyntax, portName}, memo);
+}
+
+const Expression* Compilation::findMemoizedPortConn(const Scope& parent,
+                                                    const syntax::SyntaxNode& instanceSyntax,
+                                                    std::string_view portName) const {
+    auto it = memoizedPortConns.find(std::tuple{&parent, &instanceSyntax, portName});
+    if (it == memoizedPortConns.end())
+        return nullptr;
+
+    portConnHits++;
+    return it->second;
+}
+
+void Compilation::memoizePortConn(const Scope& parent, const syntax::SyntaxNode& instanceSyntax,
+                                  std::string_view portName, const Expression& expr) {
+    memoizedPortConns.emplace(std::tuple{&parent, &instanceSyntax, portName}, &expr);
+}
+
+const ConstantValue* Compilation::findCachedFold(const FoldCacheKeyView& key) const {
+    auto it = foldCache.find(key);
+    if (it == foldCache.end())
+        return nullptr;
+    return it->second;
+}
+
+void Compilation::cacheFold(const FoldCacheKeyView& key, const ConstantValue& value) {
+    foldCache.emplace(FoldCacheKey{key.syntax,
+                                   std::vector(key.values.begin(), key.values.end()),
+                                   std::vector(key.types.begin(), key.types.end()), key.astFlags,
+                                   key.evalFlags},
+                      &value);
+}
+
+const Expression* Compilation::findCachedAssertionInstance(const AssertionInstanceKey& key) const {
+    auto it = assertionInstanceCache.find(key);
+    if (it == assertionInstanceCache.end())
+        return nullptr;
+    return it->second;
+}
+
+void Compilation::cacheAssertionInstance(const AssertionInstanceKey& key, const Expression& expr) {
+    assertionInstanceCache.emplace(key, &expr);
+}
+
+void Compilation::noteAssertionExpansion(const Symbol& symbol, size_t depth) {
+    auto& stats = assertionExpansionStats[&symbol];
+    stats.count++;
+    stats.maxDepth = std::max(stats.maxDepth, depth);
+}
+
+const ParameterEnvironment& Compilation::getParameterEnv(const InstanceBodySymbol& body) {
+    auto& def = body.getDefinition();
+
+    SmallVector<const ConstantValue*> values;
+    SmallVector<const Type*> types;
+    size_t hash = 0;
+    hash_combine(hash, &def);
+
+    for (auto param : body.getParameters()) {
+        auto& sym = param->symbol;
+        if (sym.kind == SymbolKind::Parameter) {
+            auto& cv = sym.as<ParameterSymbol>().getValue();
+            values.push_back(&cv);
+            hash_combine(hash, cv.toString());
+        }
+        else {
+            auto& type = sym.as<TypeParameterSymbol>().targetType.getType().getCanonicalType();
+            types.push_back(&type);
+            hash_combine(hash, &type);
+        }
+    }
+
+    // Buckets resolve hash collisions by comparing the actual values; a
+    // distinct parameterization is only ever created once.
+    auto& bucket = paramEnvBuckets[{&def, hash}];
+    for (auto env : bucket) {
+        if (env->paramValues.size() != values.size() || env->typeParams.size() != types.size())
+            continue;
+
+        bool same = std::equal(types.begin(), types.end(), env->typeParams.begin());
+        for (size_t i = 0; same && i < values.size(); i++)
+            same = *values[i] == *env->paramValues[i];
+
+        if (same)
+            return *env;
+    }
+
+    auto env = emplace<ParameterEnvironment>();
+    env->definition = &def;
+    env->paramValues = values.copy(*this);
+    env->typeParams = types.copy(*this);
+    env->hash = hash;
+    bucket.push_back(env);
+    return *env;
+}
+
+const TypeBitLayout& Compilation::getTypeBitLayout(const Type& type) {
+    SLANG_ASSERT(&type == &type.getCanonicalType());
+    if (auto it = typeLayoutCache.find(&type); it != typeLayoutCache.end())
+        return *it->second;
+
+    const bool packed = type.isIntegral();
+    SmallVector<TypeBitLayout::FieldInfo> fields;
+    for (auto& field : type.as<Scope>().membersOfType<FieldSymbol>()) {
+        auto& fieldType = field.getType();
+        fields.push_back({&field, field.bitOffset,
+                          packed ? fieldType.getBitWidth() : fieldType.getSelectableWidth()});
+    }
+
+    auto layout = emplace<TypeBitLayout>();
+    layout->totalWidth = packed ? type.getBitWidth() : type.getSelectableWidth();
+    layout->fields = fields.copy(*this);
+
+    typeLayoutCache.emplace(&type, layout);
+    return *layout;
+}
+
+std::optional<bool> Compilation::findCachedTypeCompat(const Type& lhs, const Type& rhs,
+                                                      TypeCompatKind kind) const {
+    auto it = typeCompatCache.find(std::tuple{&lhs, &rhs, int(kind)});
+    if (it == typeCompatCache.end())
+        return std::nullopt;
+
+    typeCompatHits++;
+    return it->second;
+}
+
+void Compilation::cacheTypeCompat(const Type& lhs, const Type& rhs, TypeCompatKind kind,
+                                  bool result) {
+    typeCompatCache.emplace(std::tuple{&lhs, &rhs, int(kind)}, result);
+}
+
+TimingControl* Compilation::findCachedTimingControl(const syntax::SyntaxNode& syntax,
+                                                    const Scope& scope, SymbolIndex lookupIndex,
+                                                    uint64_t flagBits) const {
+    auto it = timingControlCache.find(
+        std::tuple{&syntax, &scope, uint32_t(lookupIndex), flagBits});
+    if (it == timingControlCache.end())
+        return nullptr;
+
+    timingControlHits++;
+    return it->second;
+}
+
+void Compilation::cacheTimingControl(const syntax::SyntaxNode& syntax, const Scope& scope,
+                                     SymbolIndex lookupIndex, uint64_t flagBits,
+                                     TimingControl& ctrl) {
+    timingControlCache.emplace(std::tuple{&syntax, &scope, uint32_t(lookupIndex), flagBits},
+                               &ctrl);
+}
+
+bool Compilation::isLookupMissCached(const Scope& scope, std::string_view name) const {
+    if (!lookupMissCache.contains(std::tuple{&scope, name}))
+        return false;
+
+    lookupMissHits++;
+    return true;
+}
+
+void Compilation::cacheLookupMiss(const Scope& scope, std::string_view name) {
+    lookupMissCache.emplace(std::tuple{&scope, name});
+}
+
+Compilation::MemoryStats Compilation::getMemoryStats() const {
+    MemoryStats stats;
+    auto accumulate = [&](const BumpAllocator& alloc) {
+        stats.tokens += alloc.bytesForCategory(AllocCategory::Tokens);
+        stats.trivia += alloc.bytesForCategory(AllocCategory::Trivia);
+        stats.syntaxNodes += alloc.bytesForCategory(AllocCategory::SyntaxNodes);
+        stats.symbols += alloc.bytesForCategory(AllocCategory::Symbols);
+        stats.types += alloc.bytesForCategory(AllocCategory::Types);
+        stats.constants += alloc.bytesForCategory(AllocCategory::Constants);
+        stats.other += alloc.bytesForCategory(AllocCategory::Other);
+        stats.liveBytes += alloc.liveBytes();
+    };
+
+    accumulate(*this);
+    accumulate(symbolMapAllocator);
+    accumulate(constantAllocator);
+    for (auto& tree : syntaxTrees)
+        accumulate(tree->allocator());
+
+    return stats;
+}
+
+Compilation::CacheStats Compilation::getCacheStats() const {
+    CacheStats stats;
+    stats.memoizedCalls = {memoizedCalls.size(), memoizedCallHits};
+    stats.ifaceConns = {memoizedIfaceConns.size(), ifaceConnHits};
+    stats.portConns = {memoizedPortConns.size(), portConnHits};
+    stats.typeCompat = {typeCompatCache.size(), typeCompatHits};
+    stats.timingControls = {timingControlCache.size(), timingControlHits};
+    stats.lookupMisses = {lookupMissCache.size(), lookupMissHits};
+    return stats;
+}
+
 const Type& Compilation::getType(SyntaxKind typeKind) const {
     auto it = knownTypes.find(typeKind);
     return it == knownTypes.end() ? *errorType : *it->second;
@@ -1662,27 +2463,38 @@ const Type& Compilation::getType(SyntaxKind typeKind) const {
 
 const Type& Compilation::getType(const DataTypeSyntax& node, const ASTContext& context,
                                  const Type* typedefTarget) {
+    CategoryScope scope(*this, AllocCategory::Types);
     return Type::fromSyntax(*this, node, context, typedefTarget);
 }
 
 const Type& Compilation::getType(const Type& elementType,
                                  const SyntaxList<VariableDimensionSyntax>& dimensions,
                                  const ASTContext& context) {
+    CategoryScope scope(*this, AllocCategory::Types);
     return Type::fromSyntax(*this, elementType, dimensions, context);
 }
 
 const Type& Compilation::getType(bitwidth_t width, bitmask<IntegralFlags> flags) {
     SLANG_ASSERT(width > 0 && width <= SVInt::MAX_BITS);
+    CategoryScope scope(*this, AllocCategory::Types);
     uint32_t key = width;
     key |= uint32_t(flags.bits()) << SVInt::BITWIDTH_BITS;
     auto it = vectorTypeCache.find(key);
     if (it != vectorTypeCache.end())
         return *it->second;
 
-    auto type = emplace<PackedArrayType>(getScalarType(flags), ConstantRange{int32_t(width - 1), 0},
-                                         width);
-    vectorTypeCache.emplace_hint(it, key, type);
-    return *type;
+    auto& type = getPackedArrayType(getScalarType(flags), {int32_t(width - 1), 0}, width);
+    vectorTypeCache.emplace_hint(it, key, &type);
+    return type;
+}
+
+const Type& Compilation::getPackedArrayType(const Type& elementType, ConstantRange range,
+                                            bitwidth_t fullWidth) {
+    auto key = std::make_tuple(&elementType, range.left, range.right);
+    auto [it, inserted] = packedArrayCache.emplace(key, nullptr);
+    if (inserted)
+        it->second = emplace<PackedArrayType>(elementType, range, fullWidth);
+    return *it->second;
 }
 
 const Type& Compilation::getScalarType(bitmask<IntegralFlags> flags) {
@@ -1719,6 +2531,28 @@ Scope::DeferredMemberData& Compilation::getOrAddDeferredData(Scope::DeferredMemb
     return deferredData[index];
 }
 
+Scope::DeferredMemberData Compilation::popDeferredData(Scope::DeferredMemberIndex index) {
+    auto data = std::move(deferredData[index]);
+    deferredData.remove(index);
+    return data;
+}
+
+EvalContext& Compilation::acquireEvalContext(const ASTContext& astCtx, bitmask<EvalFlags> flags) {
+    if (evalCtxPool.empty())
+        return *new EvalContext(astCtx, flags);
+
+    auto ctx = std::move(evalCtxPool.back());
+    evalCtxPool.pop_back();
+    ctx->astCtx = astCtx;
+    ctx->flags = flags;
+    return *ctx.release();
+}
+
+void Compilation::releaseEvalContext(EvalContext& ctx) {
+    ctx.reset();
+    evalCtxPool.emplace_back(&ctx);
+}
+
 void Compilation::parseParamOverrides(
     flat_hash_map<std::string_view, const ConstantValue*>& results) {
     if (options.paramOverrides.empty())
@@ -2138,9 +2972,164 @@ void Compilation::checkBindTargetParams(const syntax::BindDirectiveSyntax& synta
     }
 }
 
+namespace {
+
+// Determines which module/interface/program definitions can possibly contain
+// a defparam or bind directive, either directly or through something they
+// instantiate. Instances of any other definition have nothing to contribute
+// to defparam resolution and don't need to be elaborated during the
+// iteration passes at all.
+class DefParamRelevanceScanner : public syntax::SyntaxVisitor<DefParamRelevanceScanner> {
+public:
+    void handle(const syntax::ModuleDeclarationSyntax& syntax) {
+        size_t index = defs.size();
+        defs.push_back({&syntax, {}, false});
+        byName[syntax.header->name.valueText()].push_back(index);
+
+        auto saved = current;
+        current = index;
+        visitDefault(syntax);
+        current = saved;
+    }
+
+    void handle(const syntax::UdpDeclarationSyntax& syntax) {
+        // Primitives can't contain defparams, but we need to know their names
+        // so that instantiating one doesn't defeat the analysis below.
+        knownLeafNames.emplace(syntax.name.valueText());
+    }
+
+    void handle(const syntax::HierarchyInstantiationSyntax& syntax) {
+        if (current != SIZE_MAX && syntax.type.kind == parsing::TokenKind::Identifier)
+            defs[current].instantiates.push_back(syntax.type.valueText());
+        visitDefault(syntax);
+    }
+
+    void handle(const syntax::InterfacePortHeaderSyntax& syntax) {
+        // An interface connected through a port elaborates within the
+        // instance, so it counts as an instantiation edge here.
+        auto name = syntax.nameOrKeyword.valueText();
+        if (current != SIZE_MAX && !name.empty() && name != "interface")
+            defs[current].instantiates.push_back(name);
+    }
+
+    void handle(const syntax::DefParamSyntax&) {
+        if (current != SIZE_MAX)
+            defs[current].relevant = true;
+    }
+
+    void handle(const syntax::ConfigDeclarationSyntax&) {
+        // Config use-cell rules can swap an instantiation's definition out
+        // from under the name the scanner records, invalidating the edges
+        // the relevance propagation is built on -- a remapped subtree could
+        // contain defparams this scan never sees. Give up on pruning
+        // entirely whenever a config is present.
+        unsafe = true;
+    }
+
+    void handle(const syntax::BindDirectiveSyntax& syntax) {
+        // The scope containing the bind must be visited for the bind to be
+        // discovered at all.
+        if (current != SIZE_MAX)
+            defs[current].relevant = true;
+
+        // The bound instantiation is injected into the target definition, so
+        // the target inherits an edge to whatever the bind instantiates. Only
+        // simple definition name targets can be tracked here; give up on
+        // anything fancier.
+        if (syntax.targetInstances || syntax.target->kind != syntax::SyntaxKind::IdentifierName ||
+            syntax.instantiation->kind != syntax::SyntaxKind::HierarchyInstantiation) {
+            unsafe = true;
+            return;
+        }
+
+        bindEdges.push_back(
+            {syntax.target->as<syntax::IdentifierNameSyntax>().identifier.valueText(),
+             syntax.instantiation->as<syntax::HierarchyInstantiationSyntax>().type.valueText()});
+    }
+
+    /// Returns the set of definition syntax nodes whose instances can be
+    /// skipped entirely, or an empty set if the analysis had to give up.
+    flat_hash_set<const syntax::SyntaxNode*> getPrunable() {
+        flat_hash_set<const syntax::SyntaxNode*> result;
+        if (unsafe)
+            return result;
+
+        for (auto& [target, bound] : bindEdges) {
+            auto it = byName.find(target);
+            if (it == byName.end()) {
+                // The bind targets a definition we never saw; be conservative.
+                return result;
+            }
+            for (auto index : it->second)
+                defs[index].instantiates.push_back(bound);
+        }
+
+        // Propagate relevance through the instantiation edges to a fixpoint.
+        // Names we know nothing about could be lazily loaded library modules,
+        // so they are assumed to be relevant.
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (auto& def : defs) {
+                if (def.relevant)
+                    continue;
+
+                for (auto name : def.instantiates) {
+                    bool relevant;
+                    if (auto it = byName.find(name); it != byName.end()) {
+                        relevant = false;
+                        for (auto index : it->second)
+                            relevant |= defs[index].relevant;
+                    }
+                    else {
+                        relevant = !knownLeafNames.contains(name);
+                    }
+
+                    if (relevant) {
+                        def.relevant = true;
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (auto& def : defs) {
+            if (!def.relevant)
+                result.emplace(def.syntax);
+        }
+        return result;
+    }
+
+private:
+    struct DefInfo {
+        const syntax::ModuleDeclarationSyntax* syntax;
+        std::vector<std::string_view> instantiates;
+        bool relevant;
+    };
+
+    std::vector<DefInfo> defs;
+    flat_hash_map<std::string_view, std::vector<size_t>> byName;
+    flat_hash_set<std::string_view> knownLeafNames;
+    std::vector<std::pair<std::string_view, std::string_view>> bindEdges;
+    size_t current = SIZE_MAX;
+    bool unsafe = false;
+};
+
+} // namespace
+
 void Compilation::resolveDefParamsAndBinds() {
     TimeTraceScope timeScope("resolveDefParamsAndBinds"sv, ""sv);
 
+    // Each iteration below clones the compilation and re-elaborates it, which
+    // is the dominant cost on large designs. Scan the syntax up front to find
+    // the definitions that can't possibly contribute defparams or binds; the
+    // visitors skip those subtrees on every pass.
+    DefParamRelevanceScanner scanner;
+    for (auto& tree : syntaxTrees)
+        tree->root().visit(scanner);
+    auto prunableDefs = scanner.getPrunable();
+
     struct OverrideEntry {
         OpaqueInstancePath path;
         const SyntaxNode* targetSyntax = nullptr;
@@ -2305,7 +3294,7 @@ void Compilation::resolveDefParamsAndBinds() {
         Compilation initialClone({}, defaultLibPtr);
         cloneInto(initialClone);
 
-        DefParamVisitor initialVisitor(options.maxInstanceDepth, generateLevel);
+        DefParamVisitor initialVisitor(options.maxInstanceDepth, generateLevel, prunableDefs);
         initialClone.getRoot(/* skipDefParamsAndBinds */ true).visit(initialVisitor);
         saveState(initialVisitor, initialClone);
         if (checkProblem(initialVisitor))
@@ -2323,11 +3312,11 @@ void Compilation::resolveDefParamsAndBinds() {
         // reevaluating defparams until they all settle to a stable value or until we
         // give up due to the potential of cyclical references.
         bool allSame = true;
-        for (uint32_t i = 0; i < options.maxDefParamSteps; i++) {
+        for (uint32_t i = 0; !overrides.empty() && i < options.maxDefParamSteps; i++) {
             Compilation c({}, defaultLibPtr);
             cloneInto(c);
 
-            DefParamVisitor v(options.maxInstanceDepth, generateLevel);
+            DefParamVisitor v(options.maxInstanceDepth, generateLevel, prunableDefs);
             c.getRoot(/* skipDefParamsAndBinds */ true).visit(v);
             if (checkProblem(v))
                 return;
@@ -35,6 +35,9 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
             return false;
 
         if constexpr (std::is_base_of_v<Symbol, T>) {
+            if (currentCost)
+                ++*currentCost;
+
             auto declaredType = symbol.getDeclaredType();
             if (declaredType) {
                 declaredType->getType();
@@ -62,6 +65,17 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
         return true;
     }
 
+    void handle(const PackageSymbol& symbol) {
+        if (finishedEarly())
+            return;
+
+        // Packages get visited eagerly in dependency order by the pre-pass
+        // in Compilation::elaborate; don't redo the work when their
+        // compilation unit is visited afterwards.
+        if (visitedPackages.emplace(&symbol).second)
+            handleDefault(symbol);
+    }
+
     void handle(const ExplicitImportSymbol& symbol) {
         if (!handleDefault(symbol))
             return;
@@ -298,6 +312,15 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
         if (finishedEarly())
             return;
 
+        // See the note on maxNativeVisitDepth: past this depth the subtree
+        // is suspended and later resumed from the top of the stack instead
+        // of recursing deeper.
+        if (visitInstances &&
+            activeInstanceBodies.size() - suspendBaseDepth >= maxNativeVisitDepth) {
+            suspendedSubtrees.push_back({&symbol, activeInstanceBodies});
+            return;
+        }
+
         TimeTraceScope timeScope("AST Instance", [&] {
             std::string buffer;
             symbol.getHierarchicalPath(buffer);
@@ -336,8 +359,105 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
             return;
         }
 
-        if (visitInstances)
-            visit(symbol.body);
+        if (visitInstances) {
+            // Record a per-definition cost estimate as we go: the symbols
+            // touched while visiting a body (nested instances are attributed
+            // to their own definitions) and the number of instances seen.
+            // This is what lets the giant bodies in a design be identified,
+            // and is the input for largest-first scheduling of elaboration
+            // units once they can run concurrently.
+            auto& cost = costStats[&symbol.getDefinition()];
+            cost.instanceCount++;
+
+            auto visitBody = [&] {
+                auto prevCost = std::exchange(currentCost, &cost.symbolsVisited);
+                visit(symbol.body);
+                currentCost = prevCost;
+            };
+
+            // If we've already fully elaborated an identical body for this
+            // definition (same parameter values, no hierarchy-dependent
+            // behavior) then visiting this one would only rediscover the
+            // same diagnostics, so skip it. The body symbols themselves are
+            // still created per-instance; only the full traversal is shared.
+            if (auto blocker = getSharingBlocker(symbol); !blocker.empty()) {
+                sharingBlockers.emplace(&symbol.getDefinition(), blocker);
+                visitedBodies.insert(&symbol.body);
+                visitBody();
+            }
+            else {
+                auto& list = elaboratedBodies[&symbol.getDefinition()];
+                for (auto other : list) {
+                    if (other->hasSameType(symbol.body)) {
+                        sharedElabCounts[other]++;
+
+                        // Record the skip so it can be undone later; a
+                        // hierarchical name reaching into this body may only
+                        // get bound after this point, and then the body must
+                        // be fully elaborated after all. See
+                        // visitDeferredSharedBodies.
+                        skippedInstances[&symbol.getDefinition()].push_back({&symbol, other});
+                        noteInstanceProcessed();
+                        return;
+                    }
+                }
+
+                visitedBodies.insert(&symbol.body);
+                visitBody();
+
+                // Only record the body once it has been completely visited;
+                // bailing out early (recursion or error limits) must not
+                // mark it as a valid elaboration to share.
+                if (!finishedEarly())
+                    list.push_back(&symbol.body);
+            }
+
+            noteInstanceProcessed();
+        }
+    }
+
+    // Publishes one instance's worth of progress for observers on other
+    // threads; see Compilation::ElaborationProgress.
+    void noteInstanceProcessed() {
+        auto& progress = compilation.progress;
+        progress.instancesProcessed.fetch_add(1, std::memory_order_relaxed);
+        progress.liveBytes.store(compilation.liveBytes(), std::memory_order_relaxed);
+    }
+
+    // Diagnostics for an instance's body are guaranteed to be identical to
+    // those of any other body with the same definition and parameter values
+    // unless some construct specializes the body per instance; in that case
+    // one full elaboration can stand in for all of them. Returns a description
+    // of the first construct found that blocks such sharing, or an empty view
+    // if sharing is allowed.
+    std::string_view getSharingBlocker(const InstanceSymbol& symbol) {
+        auto& body = symbol.body;
+        auto& def = body.getDefinition();
+        if (def.definitionKind == DefinitionKind::Interface)
+            return "interface definition"sv;
+        if (!def.bindDirectives.empty())
+            return "bind directive"sv;
+
+        // Overrides, configs, and upward hierarchical names can all make
+        // otherwise identical parameterizations elaborate differently.
+        if (body.hierarchyOverrideNode)
+            return "defparam or hierarchy override"sv;
+        if (body.flags != InstanceFlags::None)
+            return "uninstantiated or bound context"sv;
+        if (symbol.resolvedConfig)
+            return "configuration rule"sv;
+        if (compilation.hasUpwardNames(def))
+            return "upward hierarchical name"sv;
+        if (compilation.hasHierarchicalReferences(def))
+            return "hierarchical reference into the body"sv;
+
+        // Interface ports specialize the body based on what's connected.
+        for (auto port : body.getPortList()) {
+            if (port->kind == SymbolKind::InterfacePort)
+                return "interface port"sv;
+        }
+
+        return ""sv;
     }
 
     void handle(const SubroutineSymbol& symbol) {
@@ -454,12 +574,103 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
         }
     }
 
+    // A hierarchical name that reaches into an instance may only get bound
+    // after the dedup decision for that instance's body has already been
+    // made; binding the skipped body is what registers its internal drivers
+    // and issues the diagnostics that interact with such names. Revisit any
+    // skipped bodies whose definition has since been flagged as a
+    // hierarchical reference target, repeating in case those visits bind
+    // yet more names into other skipped definitions.
+    void visitDeferredSharedBodies() {
+        bool didSomething;
+        do {
+            didSomething = false;
+
+            // Gather the work up front; visiting a body below can record
+            // new skips, which would otherwise invalidate this iteration.
+            SmallVector<std::tuple<const DefinitionSymbol*, const InstanceSymbol*,
+                                   const InstanceBodySymbol*>>
+                work;
+            for (auto& [def, list] : skippedInstances) {
+                if (list.empty() || !compilation.hasHierarchicalReferences(*def))
+                    continue;
+
+                sharingBlockers.emplace(def, "hierarchical reference into the body"sv);
+                for (auto [inst, rep] : list)
+                    work.push_back({def, inst, rep});
+                list.clear();
+            }
+
+            for (auto [def, inst, rep] : work) {
+                if (finishedEarly())
+                    return;
+
+                if (auto countIt = sharedElabCounts.find(rep);
+                    countIt != sharedElabCounts.end() && --countIt->second == 0) {
+                    sharedElabCounts.erase(countIt);
+                }
+
+                auto& cost = costStats[def];
+                auto prevCost = std::exchange(currentCost, &cost.symbolsVisited);
+                visitedBodies.insert(&inst->body);
+                visit(inst->body);
+                currentCost = prevCost;
+                drainSuspendedSubtrees();
+                didSomething = true;
+            }
+        } while (didSomething && !finishedEarly());
+    }
+
+    // Resumes visitation of any instance subtrees that were suspended to
+    // bound native stack depth. Must be called with the visitation stack
+    // empty, i.e. between visits of root-level members.
+    void drainSuspendedSubtrees() {
+        while (!suspendedSubtrees.empty() && !finishedEarly()) {
+            auto item = std::move(suspendedSubtrees.back());
+            suspendedSubtrees.pop_back();
+
+            suspendBaseDepth = item.ancestors.size();
+            activeInstanceBodies = std::move(item.ancestors);
+            item.instance->visit(*this);
+        }
+
+        activeInstanceBodies.clear();
+        suspendBaseDepth = 0;
+    }
+
+    // Visiting an instance body consumes a nontrivial amount of native stack
+    // per hierarchy level, so a very deep (but legal) hierarchy could blow
+    // the thread's stack well before reaching maxInstanceDepth. Instead of
+    // recursing without bound, subtrees at this depth are suspended and
+    // resumed from the top of the stack, carrying their active ancestor set
+    // along so that recursion detection and the depth limit behave exactly
+    // as they would on a single native stack.
+    static constexpr size_t maxNativeVisitDepth = 64;
+
+    struct SuspendedSubtree {
+        const InstanceSymbol* instance;
+        flat_hash_set<const InstanceBodySymbol*> ancestors;
+    };
+
     Compilation& compilation;
     const size_t& numErrors;
     uint32_t errorLimit;
     bool visitInstances = true;
     bool hierarchyProblem = false;
+    size_t suspendBaseDepth = 0;
+    std::vector<SuspendedSubtree> suspendedSubtrees;
     flat_hash_set<const InstanceBodySymbol*> activeInstanceBodies;
+    flat_hash_map<const DefinitionSymbol*, std::vector<const InstanceBodySymbol*>>
+        elaboratedBodies;
+    flat_hash_map<const InstanceBodySymbol*, size_t> sharedElabCounts;
+    flat_hash_map<const DefinitionSymbol*,
+                  std::vector<std::pair<const InstanceSymbol*, const InstanceBodySymbol*>>>
+        skippedInstances;
+    flat_hash_map<const DefinitionSymbol*, std::string_view> sharingBlockers;
+    flat_hash_map<const DefinitionSymbol*, Compilation::ElaborationCostStats> costStats;
+    size_t* currentCost = nullptr;
+    flat_hash_set<const InstanceBodySymbol*> visitedBodies;
+    flat_hash_set<const PackageSymbol*> visitedPackages;
     flat_hash_set<const DefinitionSymbol*> usedIfacePorts;
     SmallVector<const GenericClassDefSymbol*> genericClasses;
     SmallVector<const SubroutineSymbol*> dpiImports;
@@ -484,8 +695,10 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
 // with the compilation by Scope::addMembers and then get processed after we finish
 // visiting the tree.
 struct DefParamVisitor : public ASTVisitor<DefParamVisitor, false, false> {
-    DefParamVisitor(size_t maxInstanceDepth, size_t generateLevel) :
-        maxInstanceDepth(maxInstanceDepth), generateLevel(generateLevel) {}
+    DefParamVisitor(size_t maxInstanceDepth, size_t generateLevel,
+                    const flat_hash_set<const syntax::SyntaxNode*>& prunableDefs) :
+        prunableDefs(prunableDefs), maxInstanceDepth(maxInstanceDepth),
+        generateLevel(generateLevel) {}
 
     void handle(const RootSymbol& symbol) { visitDefault(symbol); }
     void handle(const CompilationUnitSymbol& symbol) { visitDefault(symbol); }
@@ -499,6 +712,13 @@ struct DefParamVisitor : public ASTVisitor<DefParamVisitor, false, false> {
         if (symbol.body.flags.has(InstanceFlags::Uninstantiated) || hierarchyProblem)
             return;
 
+        // Instances whose definitions can't contain or instantiate any
+        // defparams or bind directives have nothing to contribute here, so
+        // skip elaborating them entirely. The same subtrees are skipped on
+        // every iteration so the found/seen bookkeeping stays consistent.
+        if (prunableDefs.contains(symbol.getDefinition().getSyntax()))
+            return;
+
         // If we hit max depth we have a problem -- setting the hierarchyProblem
         // member will cause other functions to early out so that we complete
         // this visitation as quickly as possible.
@@ -563,6 +783,7 @@ struct DefParamVisitor : public ASTVisitor<DefParamVisitor, false, false> {
 
     SmallVector<const DefParamSymbol*> found;
     flat_hash_set<const DefinitionSymbol*> activeInstances;
+    const flat_hash_set<const syntax::SyntaxNode*>& prunableDefs;
     size_t instanceDepth = 0;
     size_t maxInstanceDepth = 0;
     size_t generateLevel = 0;
@@ -575,7 +796,19 @@ struct DefParamVisitor : public ASTVisitor<DefParamVisitor, false, false> {
 // This visitor runs post-elaboration and can be used to find and report on
 // things like unused code elements.
 struct PostElabVisitor : public ASTVisitor<PostElabVisitor, false, false> {
-    explicit PostElabVisitor(Compilation& compilation) : compilation(compilation) {}
+    PostElabVisitor(Compilation& compilation,
+                    const flat_hash_set<const InstanceBodySymbol*>& visitedBodies) :
+        compilation(compilation), visitedBodies(visitedBodies) {}
+
+    void handle(const InstanceSymbol& symbol) {
+        // Bodies that diagnostic visitation skipped as identical to an
+        // already-elaborated one were never resolved; sweeping them here
+        // would force a full elaboration only to rediscover warnings that
+        // coalesce away with the ones already reported. Sweep each design
+        // subtree exactly once, mirroring the elaboration itself.
+        if (visitedBodies.contains(&symbol.body))
+            visit(symbol.body);
+    }
 
     void handle(const NetSymbol& symbol) {
         if (symbol.isImplicit) {
@@ -782,6 +1015,7 @@ private:
     }
 
     Compilation& compilation;
+    const flat_hash_set<const InstanceBodySymbol*>& visitedBodies;
 };
 
 } // namespace slang::ast
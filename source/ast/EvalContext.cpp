@@ -21,7 +21,12 @@ void EvalContext::reset() {
     steps = 0;
     disableTarget = nullptr;
     queueTarget = nullptr;
-    stack.clear();
+
+    // Recycle any live frames instead of discarding them so that their
+    // allocations carry over to the next evaluation using this context.
+    while (!stack.empty())
+        popFrame();
+
     lvalStack.clear();
     diags.clear();
     warnings.clear();
@@ -31,7 +36,12 @@ void EvalContext::reset() {
 
 ConstantValue* EvalContext::createLocal(const ValueSymbol* symbol, ConstantValue value) {
     SLANG_ASSERT(!stack.empty());
-    ConstantValue& result = stack.back().temporaries[symbol];
+    auto& frame = stack.back();
+    auto [it, inserted] = frame.temporaries.try_emplace(symbol, nullptr);
+    if (inserted)
+        it->second = &frame.storage.emplace_back();
+
+    ConstantValue& result = *it->second;
     if (!value) {
         result = symbol->getType().getDefaultValue();
     }
@@ -53,7 +63,7 @@ ConstantValue* EvalContext::findLocal(const ValueSymbol* symbol) {
     auto it = frame.temporaries.find(symbol);
     if (it == frame.temporaries.end())
         return nullptr;
-    return &it->second;
+    return it->second;
 }
 
 void EvalContext::deleteLocal(const ValueSymbol* symbol) {
@@ -71,7 +81,7 @@ bool EvalContext::pushFrame(const SubroutineSymbol& subroutine, SourceLocation c
         return false;
     }
 
-    Frame frame;
+    Frame frame = makeFrame();
     frame.subroutine = &subroutine;
     frame.callLocation = callLocation;
     frame.lookupLocation = lookupLocation;
@@ -80,13 +90,32 @@ bool EvalContext::pushFrame(const SubroutineSymbol& subroutine, SourceLocation c
 }
 
 void EvalContext::pushEmptyFrame() {
-    stack.emplace_back(Frame{});
+    stack.emplace_back(makeFrame());
 }
 
 void EvalContext::popFrame() {
+    // Save the popped frame for reuse by a later push; its map and
+    // storage keep their allocations across the clear, which saves a
+    // round trip to the heap for every function call.
+    auto& frame = stack.back();
+    frame.temporaries.clear();
+    frame.storage.clear();
+    frame.subroutine = nullptr;
+    frame.callLocation = {};
+    frame.lookupLocation = {};
+    spareFrames.emplace_back(std::move(frame));
     stack.pop_back();
 }
 
+EvalContext::Frame EvalContext::makeFrame() {
+    if (spareFrames.empty())
+        return Frame();
+
+    Frame frame = std::move(spareFrames.back());
+    spareFrames.pop_back();
+    return frame;
+}
+
 void EvalContext::pushLValue(LValue& lval) {
     lvalStack.push_back(&lval);
 }
@@ -103,7 +132,14 @@ LValue* EvalContext::getTopLValue() const {
 }
 
 bool EvalContext::step(SourceLocation loc) {
-    if (++steps < getCompilation().getOptions().maxConstexprSteps)
+    // The step limit doesn't change for a given compilation; cache it so that
+    // the hot path here doesn't chase pointers through the AST context for
+    // every statement executed. A configured limit of zero always fails below
+    // so it doesn't matter that it's indistinguishable from the unset state.
+    if (cachedStepLimit == 0)
+        cachedStepLimit = getCompilation().getOptions().maxConstexprSteps;
+
+    if (++steps < cachedStepLimit)
         return true;
 
     addDiag(diag::ConstEvalExceededMaxSteps, loc);
@@ -115,8 +151,15 @@ std::string EvalContext::dumpStack() const {
     int index = 0;
     for (const Frame& frame : stack) {
         buffer.format("{}: {}\n", index++, frame.subroutine ? frame.subroutine->name : "<global>");
-        for (auto& [symbol, value] : frame.temporaries)
-            buffer.format("    {} = {}\n", symbol->name, value.toString());
+
+        // Sort locals by name so that the dump is deterministic.
+        SmallVector<std::pair<const ValueSymbol*, const ConstantValue*>> locals;
+        for (auto [symbol, value] : frame.temporaries)
+            locals.push_back({symbol, value});
+        std::ranges::sort(locals, {}, [](auto& entry) { return entry.first->name; });
+
+        for (auto [symbol, value] : locals)
+            buffer.format("    {} = {}\n", symbol->name, value->toString());
     }
     return buffer.str();
 }
@@ -174,7 +217,7 @@ static void reportFrame(Diagnostic& diag, const EvalContext::Frame& frame) {
         auto it = frame.temporaries.find(arg);
         SLANG_ASSERT(it != frame.temporaries.end());
 
-        buffer.append(it->second.toString());
+        buffer.append(it->second->toString());
         if (arg != frame.subroutine->getArguments().last(1)[0])
             buffer.append(", ");
     }
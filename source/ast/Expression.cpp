@@ -16,6 +16,7 @@
 #include "slang/diagnostics/LookupDiags.h"
 #include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxVisitor.h"
+#include "slang/util/ActivityProfiler.h"
 
 namespace {
 
@@ -763,6 +764,7 @@ const Expression& Expression::unwrapImplicitConversions() const {
 Expression& Expression::create(Compilation& compilation, const ExpressionSyntax& syntax,
                                const ASTContext& ctx, bitmask<ASTFlags> extraFlags,
                                const Type* assignmentTarget) {
+    ActivityScope activityScope("bind", toString(syntax.kind));
     ASTContext context = ctx.resetFlags(extraFlags);
     Expression* result;
     switch (syntax.kind) {
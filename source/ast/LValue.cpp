@@ -51,61 +51,70 @@ ConstantValue LValue::load() const {
     }
 
     // Otherwise, we have an lvalue path. Walk the path and apply each element.
+    // The walk is done by pointer so that selecting an element out of a large
+    // array doesn't copy the whole array; a value is only materialized when a
+    // path element computes something that isn't already in storage.
     auto& path = std::get<Path>(value);
-    ConstantValue result = *path.base;
+    const ConstantValue* cursor = path.base;
+    ConstantValue owned;
+
     for (auto& elem : path.elements) {
-        if (!result)
+        if (!*cursor)
             return nullptr;
 
         std::visit(
-            [&result](auto&& arg) {
+            [&cursor, &owned](auto&& arg) {
                 using T = std::decay_t<decltype(arg)>;
                 if constexpr (std::is_same_v<T, BitSlice>) {
-                    result = result.getSlice(arg.range.upper(), arg.range.lower(), nullptr);
+                    owned = cursor->getSlice(arg.range.upper(), arg.range.lower(), nullptr);
+                    cursor = &owned;
                 }
                 else if constexpr (std::is_same_v<T, ElementIndex>) {
                     if (arg.forceOutOfBounds) {
-                        result = arg.defaultValue;
+                        owned = arg.defaultValue;
+                        cursor = &owned;
                     }
-                    else if (result.isUnion()) {
+                    else if (cursor->isUnion()) {
                         // If we're selecting the active member all is well. If not,
                         // we need to return the default value because we have no
                         // idea what type this should be.
-                        if (arg.index < 0 || result.unionVal()->activeMember != uint32_t(arg.index))
-                            result = arg.defaultValue;
+                        if (arg.index < 0 ||
+                            cursor->unionVal()->activeMember != uint32_t(arg.index)) {
+                            owned = arg.defaultValue;
+                            cursor = &owned;
+                        }
                     }
-                    else if (arg.index < 0 || size_t(arg.index) >= result.size()) {
-                        result = arg.defaultValue;
+                    else if (arg.index < 0 || size_t(arg.index) >= cursor->size()) {
+                        owned = arg.defaultValue;
+                        cursor = &owned;
                     }
-                    else if (result.isString()) {
-                        result = SVInt(8, (uint64_t)result.str()[size_t(arg.index)], false);
+                    else if (cursor->isString()) {
+                        owned = SVInt(8, (uint64_t)cursor->str()[size_t(arg.index)], false);
+                        cursor = &owned;
                     }
                     else {
-                        // Be careful not to assign to the result while
-                        // still referencing its elements.
-                        ConstantValue temp(std::move(result.at(size_t(arg.index))));
-                        result = std::move(temp);
+                        cursor = &cursor->at(size_t(arg.index));
                     }
                 }
                 else if constexpr (std::is_same_v<T, ArraySlice>) {
-                    result = result.getSlice(arg.range.upper(), arg.range.lower(),
+                    owned = cursor->getSlice(arg.range.upper(), arg.range.lower(),
                                              arg.defaultValue);
+                    cursor = &owned;
                 }
                 else if constexpr (std::is_same_v<T, ArrayLookup>) {
-                    auto& map = *result.map();
+                    auto& map = *cursor->map();
                     if (auto it = map.find(arg.index); it != map.end()) {
                         // If we find the index in the target map, return the value.
-                        ConstantValue temp(std::move(it->second));
-                        result = std::move(temp);
+                        cursor = &it->second;
                     }
                     else if (map.defaultValue) {
                         // Otherwise, if the map itself has a default set, use that.
-                        ConstantValue temp(std::move(map.defaultValue));
-                        result = std::move(temp);
+                        cursor = &map.defaultValue;
                     }
                     else {
                         // Finally, fall back on whatever the default default is.
-                        result = arg.defaultValue;
+                        owned = arg.defaultValue;
+                        cursor = &owned;
                     }
                 }
                 else {
@@ -115,7 +124,47 @@ ConstantValue LValue::load() const {
             elem);
     }
 
-    return result;
+    if (cursor == &owned)
+        return std::move(owned);
+    return *cursor;
+}
+
+// Assigns to the slice of @a target selected by @a range, reading out of @a newValue.
+static void storeSlice(ConstantValue& target, ConstantRange range,
+                       const ConstantValue& newValue) {
+    if (target.isInteger()) {
+        target.integer().set(range.upper(), range.lower(), newValue.integer());
+    }
+    else if (target.isString()) {
+        SLANG_ASSERT(range.left == range.right);
+        SLANG_ASSERT(range.left >= 0);
+
+        char c = (char)*newValue.integer().as<uint8_t>();
+        if (c)
+            target.str()[size_t(range.left)] = c;
+    }
+    else if (target.isQueue()) {
+        int32_t l = range.lower();
+        int32_t u = range.upper();
+
+        auto& src = *newValue.queue();
+        auto& dest = *target.queue();
+
+        u = std::min(u, int32_t(dest.size()));
+        for (int32_t i = std::max(l, 0); i <= u; i++)
+            dest[size_t(i)] = src[size_t(i - l)];
+    }
+    else {
+        int32_t l = range.lower();
+        int32_t u = range.upper();
+
+        auto src = newValue.elements();
+        auto dest = target.elements();
+
+        u = std::min(u, int32_t(dest.size()));
+        for (int32_t i = std::max(l, 0); i <= u; i++)
+            dest[size_t(i)] = src[size_t(i - l)];
+    }
 }
 
 void LValue::store(const ConstantValue& newValue) {
@@ -170,39 +219,57 @@ void LValue::store(const ConstantValue& newValue) {
     }
 
     // Otherwise, assign to the slice.
-    if (target->isInteger()) {
-        target->integer().set(range->upper(), range->lower(), newValue.integer());
-    }
-    else if (target->isString()) {
-        SLANG_ASSERT(range->left == range->right);
-        SLANG_ASSERT(range->left >= 0);
-
-        char c = (char)*newValue.integer().as<uint8_t>();
-        if (c)
-            target->str()[size_t(range->left)] = c;
-    }
-    else if (target->isQueue()) {
-        int32_t l = range->lower();
-        int32_t u = range->upper();
+    storeSlice(*target, *range, newValue);
+}
 
-        auto& src = *newValue.queue();
-        auto& dest = *target->queue();
+void LValue::store(ConstantValue&& newValue) {
+    if (bad())
+        return;
 
-        u = std::min(u, int32_t(dest.size()));
-        for (int32_t i = std::max(l, 0); i <= u; i++)
-            dest[size_t(i)] = src[size_t(i - l)];
+    auto concat = std::get_if<Concat>(&value);
+    if (concat) {
+        if (concat->kind == Concat::Packed) {
+            // Packed concats only read out of the value; share the copying path.
+            store(newValue);
+        }
+        else {
+            // Move each element of the value into the corresponding lvalue.
+            auto newElems = newValue.elements();
+            auto& lvalElems = concat->elems;
+            SLANG_ASSERT(newElems.size() == lvalElems.size());
+            for (size_t i = 0; i < lvalElems.size(); i++)
+                lvalElems[i].store(std::move(newElems[i]));
+        }
+        return;
     }
-    else {
-        int32_t l = range->lower();
-        int32_t u = range->upper();
 
-        auto src = newValue.elements();
-        auto dest = target->elements();
+    std::optional<ConstantRange> range;
+    ConstantValue* target = resolveInternal(range);
+    if (!target || target->bad())
+        return;
 
-        u = std::min(u, int32_t(dest.size()));
-        for (int32_t i = std::max(l, 0); i <= u; i++)
-            dest[size_t(i)] = src[size_t(i - l)];
+    // Whole-value stores can take ownership of the value instead of copying it,
+    // which matters when assigning large unpacked arrays element by element in
+    // initialization loops.
+    if (!range) {
+        // If this is a queue with a max bound make sure to limit the assigned value.
+        if (target->isQueue()) {
+            auto& dest = *target->queue();
+            if (dest.maxBound) {
+                auto maxBound = dest.maxBound;
+                dest = std::move(*newValue.queue());
+                dest.maxBound = maxBound;
+                dest.resizeToBound();
+                return;
+            }
+        }
+
+        *target = std::move(newValue);
+        return;
     }
+
+    // Otherwise, assign to the slice; only part of the value is consumed.
+    storeSlice(*target, *range, newValue);
 }
 
 ConstantValue* LValue::resolveInternal(std::optional<ConstantRange>& range) {
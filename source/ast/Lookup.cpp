@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #include "slang/ast/Lookup.h"
 
+#include <mutex>
+
 #include "slang/ast/Compilation.h"
 #include "slang/ast/Scope.h"
 #include "slang/ast/Symbol.h"
@@ -409,6 +411,13 @@ bool lookupDownward(std::span<const NamePlusLoc> nameParts, NameComponents name,
             auto& body = symbol->as<InstanceSymbol>().body;
             symbol = &body;
 
+            // Remember that names reach into this definition's bodies from
+            // the outside; binding such a name can register drivers and
+            // issue diagnostics inside the body, so elaboration must not
+            // deduplicate its instance bodies.
+            if (result.flags.has(LookupResultFlags::IsHierarchical))
+                context.getCompilation().noteHierarchicalReference(body.getDefinition());
+
             // If we had a modport restriction on an interface port lookup
             // we should switch to doing the next lookup in that modport's scope.
             // We need to re-lookup the modport symbol because the one we have
@@ -567,9 +576,15 @@ bool lookupUpward(std::span<const NamePlusLoc> nameParts, const NameComponents&
             scope = symbol->getHierarchicalParent();
         }
         else {
-            auto inst = symbol->as<InstanceBodySymbol>().parentInstance;
+            auto& body = symbol->as<InstanceBodySymbol>();
+            auto inst = body.parentInstance;
             SLANG_ASSERT(inst);
 
+            // Remember that this definition contains an upward name; name
+            // resolution within it depends on where it's instantiated, so
+            // elaboration must not deduplicate its instance bodies.
+            context.getCompilation().noteUpwardNames(body.getDefinition());
+
             // If the instance's definition name matches our target name,
             // try to match from the current instance.
             scope = inst->getParentScope();
@@ -1007,6 +1022,27 @@ bool withinCovergroup(const Symbol& symbol, const Scope& initialScope) {
     return false;
 }
 
+// Appends a cache key for a scoped name consisting only of plain identifier
+// parts. Returns false for anything fancier (selects, parameterized class
+// names, $unit/$root prefixes), which can depend on the resolution context.
+bool appendNameKey(const syntax::NameSyntax& syntax, std::string& key) {
+    if (syntax.kind == SyntaxKind::ScopedName) {
+        auto& scoped = syntax.as<ScopedNameSyntax>();
+        if (!appendNameKey(*scoped.left, key))
+            return false;
+
+        key += scoped.separator.valueText();
+        return appendNameKey(*scoped.right, key);
+    }
+
+    if (syntax.kind == SyntaxKind::IdentifierName) {
+        key += syntax.as<IdentifierNameSyntax>().identifier.valueText();
+        return true;
+    }
+
+    return false;
+}
+
 } // namespace
 
 void Lookup::name(const NameSyntax& syntax, const ASTContext& context, bitmask<LookupFlags> flags,
@@ -1019,13 +1055,44 @@ void Lookup::name(const NameSyntax& syntax, const ASTContext& context, bitmask<L
         case SyntaxKind::ClassName:
             name = syntax;
             break;
-        case SyntaxKind::ScopedName:
-            // Handle qualified names separately.
-            qualified(syntax.as<ScopedNameSyntax>(), context, flags, result);
-            unwrapResult(scope, syntax.sourceRange(), result);
+        case SyntaxKind::ScopedName: {
+            // Handle qualified names separately. Once the compilation has been
+            // frozen the hierarchy can never change, so repeated lookups of the
+            // same name path from the same place are served from a cache
+            // instead of re-walking the scope chain every time.
+            auto& compilation = scope.getCompilation();
+            std::string pathText;
+            const bool cacheable = compilation.isFrozen() && appendNameKey(syntax, pathText);
+
+            bool hit = false;
+            std::tuple<const Scope*, std::string, uint64_t, uint32_t> key;
+            if (cacheable) {
+                key = {&scope, std::move(pathText), uint64_t(flags.bits()),
+                       uint32_t(context.lookupIndex)};
+
+                std::scoped_lock lock(compilation.hierLookupMutex);
+                if (auto it = compilation.hierLookupCache.find(key);
+                    it != compilation.hierLookupCache.end()) {
+                    result = *it->second;
+                    hit = true;
+                }
+            }
+
+            if (!hit) {
+                qualified(syntax.as<ScopedNameSyntax>(), context, flags, result);
+                unwrapResult(scope, syntax.sourceRange(), result);
+
+                if (cacheable) {
+                    std::scoped_lock lock(compilation.hierLookupMutex);
+                    compilation.hierLookupCache.try_emplace(
+                        std::move(key), std::make_unique<LookupResult>(result));
+                }
+            }
+
             if (flags.has(LookupFlags::NoSelectors))
                 result.errorIfSelectors(context);
             return;
+        }
         case SyntaxKind::ThisHandle:
             result.found = findThisHandle(scope, flags, syntax.sourceRange(), result);
             return;
@@ -1190,7 +1257,7 @@ static const Symbol* selectSingleChild(const Symbol& symbol, const BitSelectSynt
         if (!array.valid)
             return nullptr;
 
-        for (auto entry : array.entries) {
+        for (auto entry : array.getEntries()) {
             if (entry->arrayIndex && *entry->arrayIndex == *index) {
                 result.path.emplace_back(*entry, *index);
                 return entry;
@@ -1667,14 +1734,74 @@ bool Lookup::findAssertionLocalVar(const ASTContext& context, const NameSyntax&
     return lookupDownward(nameParts, name, context, LookupFlags::None, result);
 }
 
-void Lookup::unqualifiedImpl(const Scope& scope, std::string_view name, LookupLocation location,
+// Walks the same scope chain that unqualifiedImpl traverses, probing only the
+// name maps and cached wildcard import results, to prove that an unqualified
+// lookup of the name finds nothing from any location and produces no
+// diagnostics. This is intentionally conservative: any name map hit (even one
+// that would fail the location check), any unprobed wildcard import, or any
+// class scope with an errored base counts as "maybe present". Only meaningful
+// on a frozen compilation, where name maps no longer grow.
+static bool isNameMissingFromChain(const Scope& scope, const HashedName& name) {
+    const Scope* current = &scope;
+    while (current) {
+        auto& nameMap = current->getNameMap();
+        if (nameMap.find(name) != nameMap.end())
+            return false;
+
+        if (auto wildcardImportData = current->getWildcardImportData()) {
+            auto& importedSymbols = wildcardImportData->importedSymbols;
+            if (importedSymbols.find(name) != importedSymbols.end())
+                return false;
+
+            // A full-chain negative probe entry proves no package provides
+            // the name; with fewer imports visible the answer is still a
+            // miss, so this holds for every lookup location.
+            auto it = wildcardImportData->probeCache.find(name);
+            if (it == wildcardImportData->probeCache.end() ||
+                it->second.importCount != wildcardImportData->wildcardImports.size() ||
+                it->second.imported || it->second.suppressUndeclared) {
+                return false;
+            }
+        }
+
+        auto& sym = current->asSymbol();
+        if (sym.kind == SymbolKind::ClassType) {
+            auto baseClass = sym.as<ClassType>().getBaseClass();
+            if (baseClass && baseClass->isError())
+                return false;
+        }
+
+        current = LookupLocation::after(sym).getScope();
+    }
+    return true;
+}
+
+void Lookup::unqualifiedImpl(const Scope& scope, const HashedName& name, LookupLocation location,
                              std::optional<SourceRange> sourceRange, bitmask<LookupFlags> flags,
                              SymbolIndex outOfBlockIndex, LookupResult& result,
                              const Scope& originalScope) {
+    // Once the compilation is frozen, misses can be cached per starting
+    // scope: builtin and system names probed as user names first are looked
+    // up over and over, and each miss would otherwise walk the whole chain
+    // to the root. DisallowWildcardImport lookups take a different path
+    // through the import data, so they neither consult nor seed the cache.
+    if (&scope == &originalScope && !flags.has(LookupFlags::DisallowWildcardImport)) {
+        auto& comp = scope.getCompilation();
+        if (comp.isFrozen()) {
+            if (comp.isLookupMissCached(scope, name.text))
+                return;
+
+            if (isNameMissingFromChain(scope, name)) {
+                comp.cacheLookupMiss(scope, name.text);
+                return;
+            }
+        }
+    }
+
     auto reportRecursiveError = [&](const Symbol& symbol) {
         if (sourceRange) {
             auto& diag = result.addDiag(scope, diag::RecursiveDefinition, *sourceRange);
-            diag << name;
+            diag << name.text;
             diag.addNote(diag::NoteDeclarationHere, symbol.location);
         }
         result.found = nullptr;
@@ -1854,19 +1981,73 @@ void Lookup::unqualifiedImpl(const Scope& scope, std::string_view name, LookupLo
             SmallVector<Import, 4> imports;
             SmallSet<const Symbol*, 2> importDedup;
 
-            for (auto import : wildcardImportData->wildcardImports) {
-                if (location < LookupLocation::after(*import))
-                    break;
+            // If this lookup's location can see the whole import chain, a
+            // previously recorded probe of the full chain can answer without
+            // searching every package again. Entries made when fewer imports
+            // were registered are stale and get re-probed below.
+            auto& importList = wildcardImportData->wildcardImports;
+            bool seesAllImports = !importList.empty() &&
+                                  !(location < LookupLocation::after(*importList.back()));
+            bool skipImportSearch = false;
+            if (seesAllImports) {
+                if (auto it = wildcardImportData->probeCache.find(name);
+                    it != wildcardImportData->probeCache.end() &&
+                    it->second.importCount == importList.size()) {
+
+                    auto& entry = it->second;
+                    if (entry.suppressUndeclared)
+                        result.flags |= LookupResultFlags::SuppressUndeclared;
+
+                    if (!entry.imported) {
+                        // Negative entry; nothing imports this name, so skip
+                        // the search and continue up the scope chain below.
+                        skipImportSearch = true;
+                    }
+                    else if (!symbol) {
+                        // Reuse the cached resolution. When there's a local
+                        // symbol to diagnose a collision against we take the
+                        // slow path instead so the diagnostic is emitted.
+                        result.flags |= LookupResultFlags::WasImported;
+                        result.found = entry.imported;
+                        scope.getCompilation().noteReference(*entry.import);
+                        wildcardImportData->importedSymbols.try_emplace(entry.imported->name,
+                                                                        entry.imported);
+                        return;
+                    }
+                }
+            }
+
+            if (!skipImportSearch) {
+                bool probedAll = true;
+                bool suppressUndeclared = false;
+                for (auto import : importList) {
+                    if (location < LookupLocation::after(*import)) {
+                        probedAll = false;
+                        break;
+                    }
 
-                auto package = import->getPackage();
-                if (!package) {
-                    result.flags |= LookupResultFlags::SuppressUndeclared;
-                    continue;
+                    auto package = import->getPackage();
+                    if (!package) {
+                        suppressUndeclared = true;
+                        result.flags |= LookupResultFlags::SuppressUndeclared;
+                        continue;
+                    }
+
+                    const Symbol* imported = package->findForImport(name);
+                    if (imported && importDedup.emplace(imported).second)
+                        imports.emplace_back(Import{imported, import});
                 }
 
-                const Symbol* imported = package->findForImport(name);
-                if (imported && importDedup.emplace(imported).second)
-                    imports.emplace_back(Import{imported, import});
+                // Record the probe result (positive or negative) so later
+                // lookups of this name can skip the package search. Ambiguous
+                // results aren't cached since they diagnose per use site.
+                if (probedAll && imports.size() <= 1) {
+                    wildcardImportData->probeCache.insert_or_assign(
+                        name.text, Scope::WildcardImportData::ImportProbe{
+                                  imports.empty() ? nullptr : imports[0].imported,
+                                  imports.empty() ? nullptr : imports[0].import,
+                                  (uint32_t)importList.size(), suppressUndeclared});
+                }
             }
 
             if (!imports.empty()) {
@@ -1874,7 +2055,7 @@ void Lookup::unqualifiedImpl(const Scope& scope, std::string_view name, LookupLo
                     if (sourceRange) {
                         auto& diag = result.addDiag(scope, diag::AmbiguousWildcardImport,
                                                     *sourceRange);
-                        diag << name;
+                        diag << name.text;
                         for (const auto& pair : imports) {
                             diag.addNote(diag::NoteImportedFrom, pair.import->location);
                             diag.addNote(diag::NoteDeclarationHere, pair.imported->location);
@@ -1891,7 +2072,7 @@ void Lookup::unqualifiedImpl(const Scope& scope, std::string_view name, LookupLo
                             imports[0].imported) {
 
                         auto& diag = result.addDiag(scope, diag::ImportNameCollision, *sourceRange);
-                        diag << name;
+                        diag << name.text;
                         diag.addNote(diag::NoteDeclarationHere, symbol->location);
                         diag.addNote(diag::NoteImportedFrom, imports[0].import->location);
                         diag.addNote(diag::NoteDeclarationHere, imports[0].imported->location);
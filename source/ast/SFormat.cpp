@@ -169,8 +169,10 @@ bool parse(std::string_view str, function_ref<void(std::string_view)> onText,
 void formatInt(std::string& result, const SVInt& value, LiteralBase base,
                const FormatOptions& options) {
     SmallVector<char> buffer;
-    if (base != LiteralBase::Decimal && value.isSigned()) {
-        // Non-decimal bases don't print as signed ever.
+    if (base != LiteralBase::Decimal && value.isSigned() && !value.hasUnknown() &&
+        value.isNegative()) {
+        // Non-decimal bases don't print as signed ever. Only negative values
+        // print differently, so only copy the value when it matters.
         SVInt copy = value;
         copy.setSigned(false);
         copy.writeTo(buffer, base, /* includeBase */ false);
@@ -250,7 +252,7 @@ static void formatChar(std::string& result, const SVInt& value) {
     result.push_back(c);
 }
 
-static void formatString(std::string& result, const std::string& value,
+static void formatString(std::string& result, std::string_view value,
                          const FormatOptions& options) {
     if (options.width) {
         uint32_t width = *options.width;
@@ -395,7 +397,11 @@ void formatArg(std::string& result, const ConstantValue& arg, char specifier,
             // TODO:
             return;
         case 's':
-            formatString(result, arg.convertToStr().str(), options);
+            // Avoid copying the argument when it's already a string.
+            if (arg.isString())
+                formatString(result, arg.str(), options);
+            else
+                formatString(result, arg.convertToStr().str(), options);
             return;
         default:
             SLANG_UNREACHABLE;
@@ -26,6 +26,7 @@
 #include "slang/diagnostics/LookupDiags.h"
 #include "slang/diagnostics/ParserDiags.h"
 #include "slang/syntax/AllSyntax.h"
+#include "slang/util/ActivityProfiler.h"
 #include "slang/util/TimeTrace.h"
 
 namespace {
@@ -55,8 +56,24 @@ using namespace syntax;
 
 static size_t countMembers(const SyntaxNode& syntax);
 
+// All scopes without named members share this one immutable empty map
+// instead of each allocating their own. A design with millions of tiny
+// statement and generate scopes otherwise pays for a map apiece that never
+// holds an entry. The map is swapped for a real per-scope one the first
+// time a named member is inserted.
+static SymbolMap& sharedEmptyNameMap() {
+    static SymbolMap map;
+    return map;
+}
+
 Scope::Scope(Compilation& compilation_, const Symbol* thisSym_) :
-    compilation(compilation_), thisSym(thisSym_), nameMap(compilation.allocSymbolMap()) {
+    compilation(compilation_), thisSym(thisSym_), nameMap(&sharedEmptyNameMap()) {
+}
+
+void Scope::reserveMembers(size_t count) const {
+    if (nameMap == &sharedEmptyNameMap())
+        nameMap = compilation.allocSymbolMap();
+    nameMap->reserve(nameMap->size() + count);
 }
 
 const NetType& Scope::getDefaultNetType() const {
@@ -552,6 +569,24 @@ void Scope::addMembers(const SyntaxNode& syntax) {
     }
 }
 
+std::span<const Symbol* const> Scope::membersArray() const {
+    ensureElaborated();
+    if (cachedMemberArray.empty() && firstMember) {
+        size_t count = 0;
+        for (auto sym = firstMember; sym; sym = sym->nextInScope)
+            count++;
+
+        auto arr = (const Symbol**)compilation.allocate(count * sizeof(const Symbol*),
+                                                        alignof(const Symbol*));
+        size_t i = 0;
+        for (auto sym = firstMember; sym; sym = sym->nextInScope)
+            arr[i++] = sym;
+
+        cachedMemberArray = {arr, count};
+    }
+    return cachedMemberArray;
+}
+
 const Symbol* Scope::find(std::string_view name) const {
     // Just do a simple lookup and return the result if we have one.
     ensureElaborated();
@@ -633,9 +668,14 @@ void Scope::insertMember(const Symbol* member, const Symbol* at, bool isElaborat
     if (!member->nextInScope)
         lastMember = member;
 
+    cachedMemberArray = {};
+
     // Add to the name map if the symbol has a name and can be looked up
     // by name in the default namespace.
     if (!member->name.empty() && canLookupByName(member->kind)) {
+        if (nameMap == &sharedEmptyNameMap())
+            nameMap = compilation.allocSymbolMap();
+
         auto pair = nameMap->emplace(member->name, member);
         if (!pair.second)
             handleNameConflict(*member, pair.first->second, isElaborating);
@@ -822,10 +862,30 @@ void Scope::elaborate() const {
         });
     }
 
+    ActivityScope activityScope("elaborate"sv, thisSym->name);
+
+    // Take ownership of the sideband data rather than copying it; elaboration
+    // of our members below can add new entries to the compilation's table,
+    // which would invalidate a reference, and this scope is done with its
+    // slot either way.
     SLANG_ASSERT(deferredMemberIndex != DeferredMemberIndex::Invalid);
-    auto deferredData = compilation.getOrAddDeferredData(deferredMemberIndex);
+    auto deferredData = compilation.popDeferredData(deferredMemberIndex);
     deferredMemberIndex = DeferredMemberIndex::Invalid;
 
+    auto deferred = deferredData.getMembers();
+
+    // We already know how much index space each deferred node reserved for the
+    // members it expands into, so size up the name map once now instead of
+    // rehashing repeatedly as each construct is elaborated below. Hoisted
+    // transparent members (like enum values) land in the same map, so this
+    // happens before they're processed too.
+    if (!deferred.empty()) {
+        size_t expected = 0;
+        for (auto symbol : deferred)
+            expected += countMembers(symbol->as<DeferredMemberSymbol>().node);
+        reserveMembers(expected);
+    }
+
     SmallSet<const SyntaxNode*, 8> enumDecls;
     for (const auto& pair : deferredData.getTransparentTypes()) {
         auto insertAt = pair.first;
@@ -863,8 +923,6 @@ void Scope::elaborate() const {
         }
     }
 
-    auto deferred = deferredData.getMembers();
-
     if (thisSym->kind == SymbolKind::ClassType) {
         // If this is a class type being elaborated, let it inherit members from parent classes.
         thisSym->as<ClassType>().inheritMembers(
@@ -1188,6 +1246,8 @@ void Scope::elaborate() const {
 
     // Finally unlink any deferred members we had; we no longer need them.
     if (!deferred.empty()) {
+        cachedMemberArray = {};
+
         const Symbol* symbol = firstMember;
         const Symbol* prev = nullptr;
 
@@ -1238,6 +1298,16 @@ void Scope::elaborate() const {
             at = &member;
         });
     }
+    else if (thisSym->kind == SymbolKind::GenerateBlockArray) {
+        // Generate block arrays don't create their per-iteration blocks up
+        // front; they're materialized here from the stored genvar values.
+        const Symbol* at = nullptr;
+        thisSym->as<GenerateBlockArraySymbol>().elaborateEntries(
+            [this, &at](const Symbol& member) {
+                insertMember(&member, at, true, true);
+                at = &member;
+            });
+    }
 
     SLANG_ASSERT(deferredMemberIndex == DeferredMemberIndex::Invalid);
     if (thisSym->kind == SymbolKind::InstanceBody && TimeTrace::isEnabled())
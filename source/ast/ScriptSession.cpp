@@ -7,6 +7,9 @@
 //------------------------------------------------------------------------------
 #include "slang/ast/ScriptSession.h"
 
+#include <mutex>
+
+#include "slang/ast/ASTVisitor.h"
 #include "slang/ast/Expression.h"
 #include "slang/ast/Statements.h"
 #include "slang/ast/symbols/BlockSymbols.h"
@@ -14,6 +17,7 @@
 #include "slang/ast/symbols/VariableSymbols.h"
 #include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxTree.h"
+#include "slang/util/ThreadPool.h"
 
 namespace slang::ast {
 
@@ -82,6 +86,112 @@ ConstantValue ScriptSession::eval(std::string_view text) {
     }
 }
 
+// Forces any lazily-computed state that evaluating the given expressions
+// could otherwise touch for the first time on several threads at once:
+// called subroutines' signatures, bodies, and cached evaluation hints,
+// parameter / enum / specparam values, and case dispatch tables.
+static void warmForConcurrentEval(std::span<const Expression* const> exprs,
+                                  EvalContext& evalCtx) {
+    flat_hash_set<const SubroutineSymbol*> seen;
+    std::vector<const SubroutineSymbol*> workList;
+
+    auto visitor = makeVisitor(
+        [&](auto& v, const CallExpression& call) {
+            if (!call.isSystemCall()) {
+                auto sub = std::get<const SubroutineSymbol*>(call.subroutine);
+                if (seen.insert(sub).second)
+                    workList.push_back(sub);
+            }
+            v.visitDefault(call);
+        },
+        [&](auto& v, const NamedValueExpression& expr) {
+            if (auto param = expr.symbol.as_if<ParameterSymbol>())
+                param->getValue();
+            else if (auto enumVal = expr.symbol.as_if<EnumValueSymbol>())
+                enumVal->getValue();
+            else if (auto specparam = expr.symbol.as_if<SpecparamSymbol>())
+                specparam->getValue();
+            v.visitDefault(expr);
+        },
+        [&](auto& v, const CaseStatement& stmt) {
+            stmt.warmMatchTable(evalCtx);
+            v.visitDefault(stmt);
+        });
+
+    for (auto expr : exprs) {
+        if (expr)
+            expr->visit(visitor);
+    }
+
+    while (!workList.empty()) {
+        auto sub = workList.back();
+        workList.pop_back();
+
+        sub->getReturnType();
+        sub->isConstEvalCompatible();
+        sub->getInlinedReturnExpr();
+        for (auto arg : sub->getArguments())
+            arg->getType();
+
+        sub->visit(visitor);
+        sub->getBody().visit(visitor);
+    }
+}
+
+std::vector<ConstantValue> ScriptSession::evalBatch(std::span<const std::string_view> texts,
+                                                    ThreadPool* pool) {
+    // Parse and bind everything up front so that all mutation of shared
+    // compilation state happens serially on this thread.
+    std::vector<const Expression*> bound;
+    bound.reserve(texts.size());
+
+    ASTContext context(scope, LookupLocation::max);
+    for (auto text : texts) {
+        syntaxTrees.emplace_back(SyntaxTree::fromText(text, options));
+
+        const auto& node = syntaxTrees.back()->root();
+        if (ExpressionSyntax::isKind(node.kind)) {
+            bound.push_back(&Expression::bind(node.as<ExpressionSyntax>(), context,
+                                              ASTFlags::AssignmentAllowed));
+        }
+        else {
+            bound.push_back(nullptr);
+        }
+    }
+
+    auto evalBlock = [&](size_t from, size_t to, std::vector<ConstantValue>& results) {
+        EvalContext localCtx(astCtx, EvalFlags::IsScript);
+        localCtx.pushEmptyFrame();
+        for (auto [symbol, value] : evalContext.topFrame().temporaries)
+            localCtx.createLocal(symbol, *value);
+
+        for (size_t i = from; i < to; i++) {
+            if (bound[i])
+                results[i] = bound[i]->eval(localCtx);
+        }
+        return localCtx.getAllDiagnostics();
+    };
+
+    std::vector<ConstantValue> results(bound.size());
+    if (!pool || bound.size() < 2) {
+        batchDiags.append_range(evalBlock(0, bound.size(), results));
+        return results;
+    }
+
+    warmForConcurrentEval(bound, evalContext);
+
+    std::mutex diagMutex;
+    pool->pushLoop(size_t(0), bound.size(), [&](size_t from, size_t to) {
+        auto diags = evalBlock(from, to, results);
+
+        std::scoped_lock lock(diagMutex);
+        batchDiags.append_range(diags);
+    });
+    pool->waitForAll();
+
+    return results;
+}
+
 ConstantValue ScriptSession::evalExpression(const ExpressionSyntax& expr) {
     ASTContext context(scope, LookupLocation::max);
     auto& bound = Expression::bind(expr, context, ASTFlags::AssignmentAllowed);
@@ -104,6 +214,7 @@ Diagnostics ScriptSession::getDiagnostics() {
 
     result.append_range(compilation.getAllDiagnostics());
     result.append_range(evalContext.getAllDiagnostics());
+    result.append_range(batchDiags);
     result.sort(SyntaxTree::getDefaultSourceManager());
     return result;
 }
@@ -1223,6 +1223,79 @@ static bool checkMatch(CaseStatementCondition condition, const ConstantValue& cv
     return cvl == cvr;
 }
 
+// Tries to lower the arms of a case statement into a match table. Arms are
+// evaluated in a scratch context; any arm that fails there (e.g. because it
+// refers to a local variable), or that isn't an integer of the statement's
+// comparison width, disqualifies the whole statement.
+static const CaseMatchTable* buildCaseMatchTable(const CaseStatement& stmt,
+                                                 EvalContext& context) {
+    EvalContext scratch(context.astCtx);
+    CaseMatchTable table;
+
+    uint32_t order = 0;
+    for (uint32_t groupIndex = 0; groupIndex < stmt.items.size(); groupIndex++) {
+        for (auto item : stmt.items[groupIndex].expressions) {
+            if (item->kind == ExpressionKind::ValueRange)
+                return nullptr;
+
+            auto val = item->eval(scratch);
+            if (!val.isInteger())
+                return nullptr;
+
+            auto& sv = val.integer();
+            if (order == 0)
+                table.bitWidth = sv.getBitWidth();
+            else if (sv.getBitWidth() != table.bitWidth)
+                return nullptr;
+
+            if (stmt.condition != CaseStatementCondition::Normal && sv.hasUnknown()) {
+                // Reduce the arm to the set of bits it actually cares about.
+                // An X bit in a care position under casez can never match the
+                // two-state selectors the table serves, so drop that arm.
+                SVInt careMask(table.bitWidth, 0, false);
+                SVInt careValue(table.bitWidth, 0, false);
+                const SVInt one(1, 1, false);
+                bool canMatch = true;
+
+                for (bitwidth_t i = 0; i < table.bitWidth; i++) {
+                    logic_t bit = sv[int32_t(i)];
+                    if (bit.isUnknown()) {
+                        if (bit.value == logic_t::z.value ||
+                            stmt.condition == CaseStatementCondition::WildcardXOrZ) {
+                            continue;
+                        }
+                        canMatch = false;
+                        break;
+                    }
+
+                    careMask.set(int32_t(i), int32_t(i), one);
+                    if (bit.value)
+                        careValue.set(int32_t(i), int32_t(i), one);
+                }
+
+                if (canMatch) {
+                    table.wildcards.push_back(
+                        {std::move(careMask), std::move(careValue), order, groupIndex});
+                }
+            }
+            else {
+                // On duplicate arms, keep the first one to preserve match order.
+                table.exact.try_emplace(sv, std::pair{order, groupIndex});
+            }
+            order++;
+        }
+    }
+
+    return context.getCompilation().allocCaseMatchTable(std::move(table));
+}
+
+void CaseStatement::warmMatchTable(EvalContext& context) const {
+    if (!matchTableTried) {
+        matchTableTried = true;
+        matchTable = buildCaseMatchTable(*this, context);
+    }
+}
+
 ER CaseStatement::evalImpl(EvalContext& context) const {
     const Type* condType = nullptr;
     auto cv = expr.eval(context);
@@ -1236,50 +1309,92 @@ ER CaseStatement::evalImpl(EvalContext& context) const {
     const Statement* matchedStmt = nullptr;
     SourceRange matchRange;
     bool unique = check == UniquePriorityCheck::Unique || check == UniquePriorityCheck::Unique0;
+    bool fastPathTaken = false;
+
+    // When all arms are context-independent integral constants we can dispatch
+    // through a match table instead of evaluating every arm. Uniqueness checks
+    // and set membership have to visit each arm anyway, so they stay on the
+    // general path below.
+    if (!unique && cv.isInteger() && condition != CaseStatementCondition::Inside) {
+        warmMatchTable(context);
+
+        auto& sel = cv.integer();
+        if (matchTable && matchTable->bitWidth == sel.getBitWidth() &&
+            (condition == CaseStatementCondition::Normal || !sel.hasUnknown())) {
+
+            uint32_t bestOrder = UINT32_MAX;
+            uint32_t bestGroup = 0;
+            if (auto it = matchTable->exact.find(sel); it != matchTable->exact.end()) {
+                bestOrder = it->second.first;
+                bestGroup = it->second.second;
+            }
 
-    for (auto& group : items) {
-        for (auto item : group.expressions) {
-            bool matched;
-            if (item->kind == ExpressionKind::ValueRange) {
-                ConstantValue val = item->as<ValueRangeExpression>().checkInside(context, cv);
-                if (!val)
-                    return ER::Fail;
+            for (auto& arm : matchTable->wildcards) {
+                // Wildcard arms are stored in declaration order, so the first
+                // hit is the winner unless an exact arm matched earlier.
+                if (arm.order >= bestOrder)
+                    break;
 
-                matched = (bool)(logic_t)val.integer();
-            }
-            else {
-                auto val = item->eval(context);
-                if (val)
-                    matched = checkMatch(condition, cv, val);
-                else if (condType && item->kind == ExpressionKind::TypeReference)
-                    matched = item->as<TypeReferenceExpression>().targetType.isMatching(*condType);
-                else
-                    return ER::Fail;
+                if (exactlyEqual(sel & arm.careMask, arm.careValue)) {
+                    bestOrder = arm.order;
+                    bestGroup = arm.group;
+                    break;
+                }
             }
 
-            if (matched) {
-                // If we already matched with a previous item, the only we reason
-                // we'd still get here is to check for uniqueness. The presence of
-                // another match means we failed the uniqueness check.
-                if (matchedStmt) {
-                    auto& diag =
-                        context.addDiag(diag::ConstEvalCaseItemsNotUnique, item->sourceRange) << cv;
-                    diag.addNote(diag::NotePreviousMatch, matchRange);
-                    unique = false;
+            if (bestOrder != UINT32_MAX)
+                matchedStmt = items[bestGroup].stmt;
+            fastPathTaken = true;
+        }
+    }
+
+    if (!fastPathTaken) {
+        for (auto& group : items) {
+            for (auto item : group.expressions) {
+                bool matched;
+                if (item->kind == ExpressionKind::ValueRange) {
+                    ConstantValue val = item->as<ValueRangeExpression>().checkInside(context, cv);
+                    if (!val)
+                        return ER::Fail;
+
+                    matched = (bool)(logic_t)val.integer();
                 }
                 else {
-                    // Always break out of the item group once we find a match -- even when
-                    // checking uniqueness, expressions in a single group are not required
-                    // to be unique.
-                    matchedStmt = group.stmt;
-                    matchRange = item->sourceRange;
+                    auto val = item->eval(context);
+                    if (val)
+                        matched = checkMatch(condition, cv, val);
+                    else if (condType && item->kind == ExpressionKind::TypeReference)
+                        matched = item->as<TypeReferenceExpression>().targetType.isMatching(
+                            *condType);
+                    else
+                        return ER::Fail;
+                }
+
+                if (matched) {
+                    // If we already matched with a previous item, the only we reason
+                    // we'd still get here is to check for uniqueness. The presence of
+                    // another match means we failed the uniqueness check.
+                    if (matchedStmt) {
+                        auto& diag = context.addDiag(diag::ConstEvalCaseItemsNotUnique,
+                                                     item->sourceRange)
+                                     << cv;
+                        diag.addNote(diag::NotePreviousMatch, matchRange);
+                        unique = false;
+                    }
+                    else {
+                        // Always break out of the item group once we find a match -- even when
+                        // checking uniqueness, expressions in a single group are not required
+                        // to be unique.
+                        matchedStmt = group.stmt;
+                        matchRange = item->sourceRange;
+                    }
+                    break;
                 }
-                break;
             }
-        }
 
-        if (matchedStmt && !unique)
-            break;
+            if (matchedStmt && !unique)
+                break;
+        }
     }
 
     if (!matchedStmt)
@@ -1648,9 +1763,11 @@ private:
                                                             *state.longestStaticPrefix,
                                                             containingSym, AssignFlags::None);
 
+                    SmallVector<DriverBitRange, 8> boundsList;
                     for (auto it = state.intervals.begin(); it != state.intervals.end(); ++it)
-                        state.symbol->addDriver(it.bounds(), *driver);
+                        boundsList.push_back(it.bounds());
 
+                    state.symbol->addDrivers(boundsList, *driver);
                     state.intervals.clear(comp.getUnrollIntervalMapAllocator());
                 }
             }
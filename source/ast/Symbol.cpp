@@ -105,7 +105,20 @@ static void getHierarchicalPathImpl(const Symbol& symbol, FormatBuffer& buffer)
     if (scope) {
         auto& parent = scope->asSymbol();
         if (parent.kind != SymbolKind::Root && parent.kind != SymbolKind::CompilationUnit) {
-            getHierarchicalPathImpl(parent, buffer);
+            // Parent prefixes are shared by all of a scope's members, so they
+            // are interned in the compilation once computed; querying paths
+            // for many symbols is then linear in total output bytes instead
+            // of rebuilding each prefix from scratch.
+            auto& comp = scope->getCompilation();
+            if (auto cached = comp.getCachedHierarchicalPath(parent)) {
+                buffer.append(*cached);
+            }
+            else {
+                getHierarchicalPathImpl(parent, buffer);
+                comp.cacheHierarchicalPath(parent,
+                                           std::string_view(buffer.data(), buffer.size()));
+            }
+
             if (parent.kind == SymbolKind::Package || parent.kind == SymbolKind::ClassType ||
                 parent.kind == SymbolKind::CovergroupType) {
                 separator = "::"sv;
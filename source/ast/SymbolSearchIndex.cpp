@@ -0,0 +1,143 @@
+//------------------------------------------------------------------------------
+// SymbolSearchIndex.cpp
+// Ranked substring search over all symbol names in a design
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/ast/SymbolSearchIndex.h"
+
+#include <algorithm>
+
+#include "slang/ast/ASTVisitor.h"
+#include "slang/ast/Compilation.h"
+#include "slang/util/String.h"
+
+namespace slang::ast {
+
+static uint32_t trigramKey(const char* text) {
+    return (uint32_t(uint8_t(text[0])) << 16) | (uint32_t(uint8_t(text[1])) << 8) |
+           uint32_t(uint8_t(text[2]));
+}
+
+static std::string foldCase(std::string_view text) {
+    std::string result(text);
+    strToLower(result);
+    return result;
+}
+
+namespace {
+
+struct IndexBuilder : public ASTVisitor<IndexBuilder, false, false> {
+    std::vector<const Symbol*>& symbols;
+    std::vector<std::string>& foldedNames;
+    flat_hash_map<uint32_t, std::vector<uint32_t>>& trigrams;
+
+    IndexBuilder(std::vector<const Symbol*>& symbols, std::vector<std::string>& foldedNames,
+                 flat_hash_map<uint32_t, std::vector<uint32_t>>& trigrams) :
+        symbols(symbols), foldedNames(foldedNames), trigrams(trigrams) {}
+
+    template<typename T>
+    void handle(const T& node) {
+        if constexpr (std::is_base_of_v<Symbol, T>)
+            record(node);
+        visitDefault(node);
+    }
+
+    void record(const Symbol& symbol) {
+        if (symbol.name.empty())
+            return;
+
+        auto id = uint32_t(symbols.size());
+        symbols.push_back(&symbol);
+        foldedNames.push_back(foldCase(symbol.name));
+
+        // Ids are handed out in increasing order, so appending (with a
+        // check for names that repeat a trigram) keeps each posting list
+        // sorted and deduplicated for free.
+        auto& name = foldedNames.back();
+        for (size_t i = 2; i < name.size(); i++) {
+            auto& list = trigrams[trigramKey(name.data() + i - 2)];
+            if (list.empty() || list.back() != id)
+                list.push_back(id);
+        }
+    }
+};
+
+} // namespace
+
+SymbolSearchIndex::SymbolSearchIndex(Compilation& compilation) {
+    IndexBuilder builder(symbols, foldedNames, trigrams);
+    compilation.getRoot().visit(builder);
+}
+
+std::vector<SymbolSearchIndex::Result> SymbolSearchIndex::lookup(std::string_view query,
+                                                                 size_t maxResults) const {
+    std::vector<Result> results;
+    if (query.empty() || maxResults == 0)
+        return results;
+
+    auto folded = foldCase(query);
+    auto tryMatch = [&](uint32_t id) {
+        auto& name = foldedNames[id];
+        auto pos = name.find(folded);
+        if (pos == std::string::npos)
+            return;
+
+        // Exact matches beat prefixes, prefixes beat interior substrings;
+        // within a tier, earlier and tighter matches rank higher. A small
+        // bonus rewards matching the original case exactly.
+        int score;
+        if (name.size() == folded.size())
+            score = 100000;
+        else if (pos == 0)
+            score = 50000;
+        else
+            score = 25000 - int(pos);
+
+        score -= int(name.size());
+        if (symbols[id]->name == query)
+            score += 1000;
+
+        results.push_back({symbols[id], score});
+    };
+
+    if (folded.size() >= 3) {
+        // Gather the posting lists for every trigram in the query; any
+        // symbol containing the query must appear in all of them.
+        std::vector<const std::vector<uint32_t>*> lists;
+        for (size_t i = 2; i < folded.size(); i++) {
+            auto it = trigrams.find(trigramKey(folded.data() + i - 2));
+            if (it == trigrams.end())
+                return results;
+            lists.push_back(&it->second);
+        }
+
+        std::ranges::sort(lists, {}, [](auto* list) { return list->size(); });
+        for (auto id : *lists[0]) {
+            bool inAll = true;
+            for (size_t i = 1; i < lists.size() && inAll; i++)
+                inAll = std::ranges::binary_search(*lists[i], id);
+            if (inAll)
+                tryMatch(id);
+        }
+    }
+    else {
+        // Queries shorter than a trigram fall back to a scan; they're rare
+        // and the per-name check is a single short substring search.
+        for (uint32_t id = 0; id < symbols.size(); id++)
+            tryMatch(id);
+    }
+
+    std::ranges::sort(results, [&](const Result& a, const Result& b) {
+        if (a.score != b.score)
+            return a.score > b.score;
+        return a.symbol->name < b.symbol->name;
+    });
+
+    if (results.size() > maxResults)
+        results.resize(maxResults);
+    return results;
+}
+
+} // namespace slang::ast
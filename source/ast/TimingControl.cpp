@@ -27,6 +27,33 @@ TimingControl& TimingControl::bind(const TimingControlSyntax& syntax, const ASTC
         return badCtrl(comp, nullptr);
     }
 
+    // An assertion clocking event like @(posedge clk) gets rebound once per
+    // assertion it applies to, so a design with thousands of assertions and
+    // a handful of clocks binds the same syntax from the same place over and
+    // over. The result depends only on the syntax node and the binding
+    // position unless the context carries instance-specific binding state,
+    // so return the canonical node for repeat binds. An assertion expansion
+    // context is fine as long as there are no formal arguments or local
+    // variables that could change what the event's names resolve to.
+    // Procedural controls are excluded since their syntax is unique per
+    // process and caching them would only grow the table.
+    auto instanceAllowsCaching = [&] {
+        auto inst = context.assertionInstance;
+        if (!inst)
+            return true;
+        return inst->argumentMap.empty() && inst->localVars.empty() && !inst->isRecursive &&
+               !inst->argDetails;
+    };
+    const bool cacheable = context.flags.has(ASTFlags::NonProcedural) && !context.firstTempVar &&
+                           !context.randomizeDetails && instanceAllowsCaching();
+    if (cacheable) {
+        if (auto cached = comp.findCachedTimingControl(syntax, *context.scope,
+                                                       context.lookupIndex,
+                                                       context.flags.bits())) {
+            return *cached;
+        }
+    }
+
     TimingControl* result;
     switch (syntax.kind) {
         case SyntaxKind::DelayControl:
@@ -64,6 +91,10 @@ TimingControl& TimingControl::bind(const TimingControlSyntax& syntax, const ASTC
     }
 
     result->syntax = &syntax;
+    if (cacheable) {
+        comp.cacheTimingControl(syntax, *context.scope, context.lookupIndex,
+                                context.flags.bits(), *result);
+    }
     return *result;
 }
 
@@ -51,7 +51,9 @@ public:
     flat_hash_map<std::tuple<std::string_view, SymbolKind>, std::shared_ptr<SystemSubroutine>>
         methodMap;
 
-    static Builtins Instance;
+    /// Gets the process-wide instance, constructing it (and registering
+    /// every builtin subroutine) on first use.
+    static Builtins& getInstance();
 
     Builtins() {
         registerArrayMethods();
@@ -235,7 +235,26 @@ Expression* Expression::tryConnectPortArray(const ASTContext& context, const Typ
                                             Expression& expr, const InstanceSymbolBase& instance) {
     // This lambda is shared code for reporting an error and returning an invalid expression.
     auto& comp = context.getCompilation();
+
+    // Anything selected out of the connection below depends on the particular
+    // element being connected, so the result can't be shared with the other
+    // elements of the instance array.
+    comp.notePortArraySlice();
+
+    // The slicing attempt below speculatively builds chains of selection
+    // expressions that are discarded wholesale if the connection turns out not
+    // to match the shape of the instance array. Snapshot the arena so that the
+    // mismatch paths can release that garbage instead of keeping it alive for
+    // the rest of the compilation -- everything reachable after a failure
+    // predates the attempt. The exception is once a fresh type has been
+    // created for shape checking; type compatibility results against it may
+    // have been memoized, so from that point the attempt keeps its memory.
+    auto snapshot = comp.snapshot();
+    bool canRollback = true;
     auto bad = [&]() {
+        if (canRollback)
+            comp.rollbackTo(snapshot);
+
         auto& diag = context.addDiag(diag::PortConnArrayMismatch, expr.sourceRange);
         diag << *expr.type << portType;
 
@@ -308,6 +327,7 @@ Expression* Expression::tryConnectPortArray(const ASTContext& context, const Typ
         // all of the instance dims and whatever is left should match
         // the actual port type to connect.
         if (!unpackedDims.empty()) {
+            canRollback = false;
             auto& unpackedType = FixedSizeUnpackedArrayType::fromDims(*context.scope, *ct,
                                                                       unpackedDims,
                                                                       expr.sourceRange);
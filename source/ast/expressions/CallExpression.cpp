@@ -342,7 +342,7 @@ Expression& CallExpression::fromArgs(Compilation& compilation, const Subroutine&
                                      const Expression* thisClass,
                                      const ArgumentListSyntax* argSyntax, SourceRange range,
                                      const ASTContext& context) {
-    SmallVector<const Expression*> boundArgs;
+    SmallVector<const Expression*, 8> boundArgs;
     const SubroutineSymbol& symbol = *std::get<0>(subroutine);
     bool bad = !bindArgs(argSyntax, symbol.getArguments(), symbol.name, range, context, boundArgs,
                          symbol.flags.has(MethodFlags::BuiltIn));
@@ -537,7 +537,9 @@ Expression& CallExpression::createSystemCall(
     const ASTContext& context, const Scope* randomizeScope) {
 
     SystemCallInfo callInfo{&subroutine, context.scope, {}};
-    SmallVector<const Expression*> buffer;
+    // System tasks like $display routinely take more arguments than the
+    // default inline capacity would hold.
+    SmallVector<const Expression*, 8> buffer;
     if (firstArg)
         buffer.push_back(firstArg);
 
@@ -736,6 +738,19 @@ ConstantValue CallExpression::evalImpl(EvalContext& context) const {
         args.emplace_back(std::move(v));
     }
 
+    // Outside of script mode the result depends only on the argument values;
+    // checkConstant has already rejected anything with output args, and class
+    // methods are excluded since they can also read member state via 'this'.
+    // See if we've memoized the result of an identical previous call.
+    auto& comp = context.getCompilation();
+    const bool canMemoize = !symbol.thisVar && !context.flags.has(EvalFlags::IsScript);
+    if (canMemoize) {
+        if (auto cached = comp.findMemoizedCall(symbol, args))
+            return *cached;
+    }
+
+    const size_t prevDiagCount = context.getDiagCount();
+
     // Push a new stack frame, push argument values as locals.
     if (!context.pushFrame(symbol, sourceRange.start(), lookupLocation))
         return nullptr;
@@ -744,25 +759,47 @@ ConstantValue CallExpression::evalImpl(EvalContext& context) const {
     for (size_t i = 0; i < formals.size(); i++)
         context.createLocal(formals[i], args[i]);
 
-    SLANG_ASSERT(symbol.returnValVar);
-    context.createLocal(symbol.returnValVar);
-
+    ConstantValue result;
     using ER = Statement::EvalResult;
-    ER er = symbol.getBody().eval(context);
+    ER er;
+
+    // Functions whose body is a lone return statement are extremely common in
+    // constant expressions (clog2 / min / max style helpers); evaluate the
+    // return expression directly for those instead of dispatching through the
+    // statement machinery and the return value variable.
+    if (auto inlined = symbol.getInlinedReturnExpr()) {
+        result = inlined->eval(context);
+        er = result ? ER::Return : ER::Fail;
+    }
+    else {
+        SLANG_ASSERT(symbol.returnValVar);
+        context.createLocal(symbol.returnValVar);
 
-    // If we got a disable result, it means a disable statement was evaluated that
-    // targeted a block that wasn't executing. This isn't allowed in a constant expression.
-    // Handle this before popping the frame so that we get the stack reported.
-    if (er == ER::Disable)
-        context.addDiag(diag::ConstEvalDisableTarget, context.getDisableRange());
+        er = symbol.getBody().eval(context);
+
+        // If we got a disable result, it means a disable statement was evaluated that
+        // targeted a block that wasn't executing. This isn't allowed in a constant
+        // expression. Handle this before popping the frame so that we get the stack
+        // reported.
+        if (er == ER::Disable)
+            context.addDiag(diag::ConstEvalDisableTarget, context.getDisableRange());
+
+        result = std::move(*context.findLocal(symbol.returnValVar));
+    }
 
-    ConstantValue result = std::move(*context.findLocal(symbol.returnValVar));
     context.popFrame();
 
     if (er == ER::Fail || er == ER::Disable)
         return nullptr;
 
     SLANG_ASSERT(er == ER::Success || er == ER::Return);
+
+    // Only memoize if evaluation didn't produce any diagnostics; otherwise
+    // later calls would be silently missing them. This also excludes functions
+    // with static locals, which warn each time their initializer is skipped.
+    if (canMemoize && context.getDiagCount() == prevDiagCount)
+        comp.memoizeCall(symbol, args, result);
+
     return result;
 }
 
@@ -780,6 +817,11 @@ bool CallExpression::checkConstant(EvalContext& context, const SubroutineSymbol&
     if (context.flags.has(EvalFlags::IsScript))
         return true;
 
+    // The remaining checks depend only on the subroutine itself, so once a
+    // given subroutine has passed them we can skip rechecking on every call.
+    if (subroutine.isConstEvalCompatible())
+        return true;
+
     if (subroutine.subroutineKind == SubroutineKind::Task) {
         context.addDiag(diag::ConstEvalTaskNotConstant, range);
         return false;
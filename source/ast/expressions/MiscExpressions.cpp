@@ -844,15 +844,21 @@ Expression& AssertionInstanceExpression::fromLookup(const Symbol& symbol,
     ASTContext context = parentContext;
     context.tryFillAssertionDetails();
 
-    AssertionInstanceDetails instance;
+    // The details object is arena-allocated (rather than stack-allocated)
+    // so that its address can serve as a unique identifier for the enclosing
+    // expansion environment in the assertion instance cache below.
+    auto& instance = *comp.allocAssertionDetails();
     instance.symbol = &symbol;
     instance.prevContext = &context;
     instance.instanceLoc = range.start();
 
     // Check for recursive instantiation. This is illegal for sequences, and allowed in
-    // some forms for properties.
+    // some forms for properties. Count the nesting depth along the way for
+    // the expansion statistics.
+    size_t depth = 0;
     auto currInst = context.assertionInstance;
     while (currInst) {
+        depth++;
         if (currInst->symbol == &symbol) {
             if (symbol.kind == SymbolKind::Sequence) {
                 context.addDiag(diag::RecursiveSequence, range) << symbol.name;
@@ -885,6 +891,39 @@ Expression& AssertionInstanceExpression::fromLookup(const Symbol& symbol,
         }
     }
 
+    // Repeated instantiations of the same declaration from the same use site
+    // and environment produce identical expansions, so share the previously
+    // expanded body instead of re-expanding the whole subtree.
+    //
+    // When the declaration has no formal ports, no arguments were provided,
+    // and we're not nested inside another assertion expansion, the expanded
+    // body can't observe anything about the use site at all, so every
+    // instantiation anywhere in the design shares one body. Those entries use
+    // a null scope (which per-site keys never have) and keep only the one
+    // caller flag the body binding inherits.
+    Compilation::AssertionInstanceKey cacheKey{&symbol,
+                                               syntax,
+                                               context.scope.get(),
+                                               uint32_t(context.lookupIndex),
+                                               context.assertionInstance,
+                                               context.flags.bits()};
+    if (formalPorts.empty() && orderedArgs.empty() && namedArgs.empty() &&
+        !context.assertionInstance && symbol.kind != SymbolKind::LetDecl) {
+        cacheKey = Compilation::AssertionInstanceKey{
+            &symbol, nullptr, nullptr, 0, nullptr,
+            (context.flags & ASTFlags::PropertyTimeAdvance).bits()};
+    }
+    if (symbol.kind != SymbolKind::LetDecl && !instance.isRecursive) {
+        if (auto cached = comp.findCachedAssertionInstance(cacheKey)) {
+            auto& prev = cached->as<AssertionInstanceExpression>();
+            auto result = comp.emplace<AssertionInstanceExpression>(
+                *prev.type, symbol, prev.body, /* isRecursiveProperty */ false, range);
+            result->arguments = prev.arguments;
+            result->localVars = prev.localVars;
+            return *result;
+        }
+    }
+
     // Now map all arguments to their formal ports.
     bool bad = false;
     uint32_t orderedIndex = 0;
@@ -1009,6 +1048,8 @@ Expression& AssertionInstanceExpression::fromLookup(const Symbol& symbol,
     if (context.flags.has(ASTFlags::PropertyTimeAdvance))
         bodyContext.flags |= ASTFlags::PropertyTimeAdvance;
 
+    comp.noteAssertionExpansion(symbol, depth + 1);
+
     // Let declarations expand directly to an expression.
     if (symbol.kind == SymbolKind::LetDecl)
         return create(comp, *symbol.as<LetDeclSymbol>().exprSyntax, bodyContext);
@@ -1036,6 +1077,9 @@ Expression& AssertionInstanceExpression::fromLookup(const Symbol& symbol,
     if (bad || body.bad())
         return badExpr(comp, result);
 
+    if (!instance.isRecursive)
+        comp.cacheAssertionInstance(cacheKey, *result);
+
     return *result;
 }
 
@@ -103,6 +103,43 @@ bool isShortCircuitOp(BinaryOperator op) {
     }
 }
 
+// Binary operator kinds whose lhs binds with no special casing -- every kind
+// that routes to BinaryExpression::fromSyntax except the equality operators,
+// which need the virtual interface special case for their operands. Chains of
+// these can be bound iteratively instead of recursing once per operand.
+bool isLeftChainable(syntax::SyntaxKind kind) {
+    using syntax::SyntaxKind;
+    switch (kind) {
+        case SyntaxKind::AddExpression:
+        case SyntaxKind::SubtractExpression:
+        case SyntaxKind::MultiplyExpression:
+        case SyntaxKind::DivideExpression:
+        case SyntaxKind::ModExpression:
+        case SyntaxKind::BinaryAndExpression:
+        case SyntaxKind::BinaryOrExpression:
+        case SyntaxKind::BinaryXorExpression:
+        case SyntaxKind::BinaryXnorExpression:
+        case SyntaxKind::GreaterThanEqualExpression:
+        case SyntaxKind::GreaterThanExpression:
+        case SyntaxKind::LessThanEqualExpression:
+        case SyntaxKind::LessThanExpression:
+        case SyntaxKind::WildcardEqualityExpression:
+        case SyntaxKind::WildcardInequalityExpression:
+        case SyntaxKind::LogicalAndExpression:
+        case SyntaxKind::LogicalOrExpression:
+        case SyntaxKind::LogicalImplicationExpression:
+        case SyntaxKind::LogicalEquivalenceExpression:
+        case SyntaxKind::LogicalShiftLeftExpression:
+        case SyntaxKind::LogicalShiftRightExpression:
+        case SyntaxKind::ArithmeticShiftLeftExpression:
+        case SyntaxKind::ArithmeticShiftRightExpression:
+        case SyntaxKind::PowerExpression:
+            return true;
+        default:
+            return false;
+    }
+}
+
 } // namespace
 
 namespace slang::ast {
@@ -644,31 +681,65 @@ Expression& BinaryExpression::fromSyntax(Compilation& compilation,
         }
     }
     else {
-        lhs = &create(compilation, syntaxLeft, context, flags);
-
-        if (isShortCircuitOp(op)) {
-            // We want to evaluate the lhs as a constant if possible, to know whether
-            // the rhs is for sure in an unevaluated context. This is required for
-            // correctness in cases where the condition on the lhs gates off otherwise
-            // invalid code on the rhs.
-            if (auto val = context.tryEval(*lhs)) {
-                switch (op) {
-                    case BinaryOperator::LogicalAnd:
-                    case BinaryOperator::LogicalImplication:
-                        if (val.isFalse())
-                            flags |= ASTFlags::UnevaluatedBranch;
-                        break;
-                    case BinaryOperator::LogicalOr:
-                        if (val.isTrue())
-                            flags |= ASTFlags::UnevaluatedBranch;
-                        break;
-                    default:
-                        SLANG_UNREACHABLE;
+        auto bindRhs = [&](const ASTContext& ctx, const BinaryExpressionSyntax& binSyntax,
+                           BinaryOperator binOp, Expression& lhsExpr) {
+            bitmask<ASTFlags> rhsFlags = flags;
+            if (isShortCircuitOp(binOp)) {
+                // We want to evaluate the lhs as a constant if possible, to know whether
+                // the rhs is for sure in an unevaluated context. This is required for
+                // correctness in cases where the condition on the lhs gates off otherwise
+                // invalid code on the rhs.
+                if (auto val = ctx.tryEval(lhsExpr)) {
+                    switch (binOp) {
+                        case BinaryOperator::LogicalAnd:
+                        case BinaryOperator::LogicalImplication:
+                            if (val.isFalse())
+                                rhsFlags |= ASTFlags::UnevaluatedBranch;
+                            break;
+                        case BinaryOperator::LogicalOr:
+                            if (val.isTrue())
+                                rhsFlags |= ASTFlags::UnevaluatedBranch;
+                            break;
+                        default:
+                            SLANG_UNREACHABLE;
+                    }
                 }
             }
+            return &create(compilation, *binSyntax.right, ctx, rhsFlags);
+        };
+
+        // Generated code frequently hands us enormous left-associated operator
+        // chains; the parser builds those iteratively so they sail through its
+        // depth limit, but recursing into create() once per operand here would
+        // blow the stack. Walk the left spine iteratively instead and fold it
+        // back up with fromComponents.
+        SmallVector<const BinaryExpressionSyntax*> spine;
+        const ExpressionSyntax* spineLeft = &syntaxLeft;
+        while (isLeftChainable(spineLeft->kind)) {
+            auto& bin = spineLeft->as<BinaryExpressionSyntax>();
+            spine.push_back(&bin);
+            spineLeft = bin.left;
+        }
+
+        ASTContext chainCtx = context.resetFlags(flags);
+        lhs = &create(compilation, *spineLeft, chainCtx, flags);
+
+        for (auto it = spine.rbegin(); it != spine.rend(); it++) {
+            auto& binSyntax = **it;
+            auto binOp = getBinaryOperator(binSyntax.kind);
+            auto binRhs = bindRhs(chainCtx, binSyntax, binOp, *lhs);
+            auto& chainExpr = fromComponents(*lhs, *binRhs, binOp, binSyntax.operatorToken.range(),
+                                             binSyntax.sourceRange(), chainCtx);
+
+            // Expression::create normally assigns the syntax pointer after its
+            // dispatch returns; since the interior chain nodes bypass create(),
+            // set it here so consumers of syntax see no difference.
+            chainExpr.syntax = &binSyntax;
+            chainCtx.setAttributes(chainExpr, binSyntax.attributes);
+            lhs = &chainExpr;
         }
 
-        rhs = &create(compilation, syntaxRight, context, flags);
+        rhs = bindRhs(context, syntax, op, *lhs);
     }
 
     auto& result = fromComponents(*lhs, *rhs, op, syntax.operatorToken.range(),
@@ -1190,21 +1261,48 @@ Expression::EffectiveSign BinaryExpression::getEffectiveSignImpl(bool isForConve
 }
 
 ConstantValue BinaryExpression::evalImpl(EvalContext& context) const {
-    if (left().kind == ExpressionKind::TypeReference &&
-        right().kind == ExpressionKind::TypeReference) {
-        auto& lt = left().as<TypeReferenceExpression>().targetType;
-        auto& rt = right().as<TypeReferenceExpression>().targetType;
+    // Long left-associated operator chains would recurse once per operand
+    // here and can overflow the stack for generated code; walk down the
+    // left spine iteratively and fold the values back up instead.
+    SmallVector<const BinaryExpression*> spine;
+    const BinaryExpression* node = this;
+    while (node->left().kind == ExpressionKind::BinaryOp) {
+        spine.push_back(node);
+        node = &node->left().as<BinaryExpression>();
+    }
+
+    ConstantValue cv;
+    if (node->left().kind == ExpressionKind::TypeReference &&
+        node->right().kind == ExpressionKind::TypeReference) {
+        auto& lt = node->left().as<TypeReferenceExpression>().targetType;
+        auto& rt = node->right().as<TypeReferenceExpression>().targetType;
         bool val = lt.isMatching(rt);
-        if (op == BinaryOperator::Inequality || op == BinaryOperator::CaseInequality)
+        if (node->op == BinaryOperator::Inequality || node->op == BinaryOperator::CaseInequality)
             val = !val;
 
-        return SVInt(1, val, false);
+        cv = SVInt(1, val, false);
+    }
+    else {
+        cv = node->left().eval(context);
+        if (!cv)
+            return nullptr;
+
+        cv = node->evalWithLhs(context, std::move(cv));
     }
 
-    ConstantValue cvl = left().eval(context);
-    if (!cvl)
-        return nullptr;
+    while (!spine.empty()) {
+        if (!cv)
+            return nullptr;
+
+        node = spine.back();
+        spine.pop_back();
+        cv = node->evalWithLhs(context, std::move(cv));
+    }
+
+    return cv;
+}
 
+ConstantValue BinaryExpression::evalWithLhs(EvalContext& context, ConstantValue&& cvl) const {
     // Handle short-circuiting operators up front, as we need to avoid
     // evaluating the rhs entirely in those cases.
     if (isShortCircuitOp(op)) {
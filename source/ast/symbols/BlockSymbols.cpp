@@ -556,9 +556,9 @@ static uint64_t getGenerateLoopCount(const Scope& parent) {
         if (sym.kind == SymbolKind::GenerateBlockArray) {
             auto& gba = sym.as<GenerateBlockArraySymbol>();
             if (!count)
-                count = gba.entries.size();
+                count = gba.getEntries().size();
             else
-                count *= gba.entries.size();
+                count *= gba.getEntries().size();
         }
         else if (sym.kind != SymbolKind::GenerateBlock) {
             break;
@@ -570,6 +570,30 @@ static uint64_t getGenerateLoopCount(const Scope& parent) {
     return count ? count : 1;
 }
 
+static GenerateBlockSymbol& createLoopBlock(Compilation& compilation,
+                                            const LoopGenerateSyntax& syntax, SourceLocation loc,
+                                            uint32_t index, ConstantValue value,
+                                            bool isUninstantiated) {
+    // Spec: each generate block gets their own scope, with an implicit
+    // localparam of the same name as the genvar.
+    auto block = compilation.emplace<GenerateBlockSymbol>(compilation, "", loc, index,
+                                                          isUninstantiated);
+    auto genvar = syntax.identifier;
+    auto implicitParam = compilation.emplace<ParameterSymbol>(
+        genvar.valueText(), genvar.location(), true /* isLocal */, false /* isPort */);
+
+    block->addMember(*implicitParam);
+    block->setSyntax(*syntax.block);
+
+    addBlockMembers(*block, *syntax.block);
+
+    implicitParam->setType(compilation.getIntegerType());
+    implicitParam->setValue(compilation, std::move(value), /* needsCoercion */ false);
+
+    block->arrayIndex = &implicitParam->getValue().integer();
+    return *block;
+}
+
 GenerateBlockArraySymbol& GenerateBlockArraySymbol::fromSyntax(Compilation& compilation,
                                                                const LoopGenerateSyntax& syntax,
                                                                SymbolIndex scopeIndex,
@@ -609,28 +633,6 @@ GenerateBlockArraySymbol& GenerateBlockArraySymbol::fromSyntax(Compilation& comp
         compilation.noteReference(*symbol);
     }
 
-    SmallVector<const GenerateBlockSymbol*> entries;
-    auto createBlock = [&, blockLoc = loc](ConstantValue value, bool isUninstantiated) {
-        // Spec: each generate block gets their own scope, with an implicit
-        // localparam of the same name as the genvar.
-        auto block = compilation.emplace<GenerateBlockSymbol>(compilation, "", blockLoc,
-                                                              (uint32_t)entries.size(),
-                                                              isUninstantiated);
-        auto implicitParam = compilation.emplace<ParameterSymbol>(
-            genvar.valueText(), genvar.location(), true /* isLocal */, false /* isPort */);
-
-        block->addMember(*implicitParam);
-        block->setSyntax(*syntax.block);
-
-        addBlockMembers(*block, *syntax.block);
-
-        implicitParam->setType(compilation.getIntegerType());
-        implicitParam->setValue(compilation, std::move(value), /* needsCoercion */ false);
-
-        block->arrayIndex = &implicitParam->getValue().integer();
-        entries.push_back(block);
-    };
-
     // Bind the initialization expression.
     auto& initial = Expression::bindRValue(compilation.getIntegerType(), *syntax.initialExpr,
                                            syntax.equals.range(), context);
@@ -711,25 +713,43 @@ GenerateBlockArraySymbol& GenerateBlockArraySymbol::fromSyntax(Compilation& comp
 
     evalContext.reportAllDiags();
 
-    // If the generate loop completed successfully, go through and create blocks.
-    if (result->valid) {
-        bool isUninstantiated = context.scope->isUninstantiated();
+    // If the generate loop completed successfully, stash the evaluated genvar
+    // values; the iteration scopes themselves are identical templates over
+    // those values and are only materialized when the array is elaborated.
+    if (result->valid && !indices.empty()) {
+        SmallVector<const ConstantValue*> values;
         for (auto& index : indices)
-            createBlock(index, isUninstantiated);
-    }
+            values.push_back(compilation.allocConstant(std::move(index)));
 
-    result->entries = entries.copy(compilation);
-    if (entries.empty()) {
-        createBlock(SVInt(32, 0, true), true);
+        result->indexValues = values.copy(compilation);
+        result->setNeedElaboration();
     }
     else {
-        for (auto entry : entries)
-            result->addMember(*entry);
+        createLoopBlock(compilation, syntax, loc, 0, SVInt(32, 0, true), true);
     }
 
     return *result;
 }
 
+void GenerateBlockArraySymbol::elaborateEntries(function_ref<void(const Symbol&)> insertCB) const {
+    if (indexValues.empty())
+        return;
+
+    auto& comp = getCompilation();
+    auto& syntax = getSyntax()->as<LoopGenerateSyntax>();
+    const bool isUninst = isUninstantiated();
+
+    SmallVector<const GenerateBlockSymbol*> blocks;
+    for (auto value : indexValues) {
+        auto& block = createLoopBlock(comp, syntax, location, (uint32_t)blocks.size(), *value,
+                                      isUninst);
+        blocks.push_back(&block);
+        insertCB(block);
+    }
+
+    entries = blocks.copy(comp);
+}
+
 std::string GenerateBlockArraySymbol::getExternalName() const {
     if (!name.empty())
         return std::string(name);
@@ -175,6 +175,7 @@ void ClassType::populate(const Scope& scope, const ClassDeclarationSyntax& synta
         isFinal = true;
 
     setSyntax(syntax);
+    reserveMembers(syntax.items.size());
     for (auto member : syntax.items)
         addMembers(*member);
 
@@ -995,7 +996,10 @@ const Type* GenericClassDefSymbol::getSpecializationImpl(
         }
     }
 
-    detail::ClassSpecializationKey key(*this, paramValues.copy(comp), typeParams.copy(comp));
+    // Probe with a key built over the stack-allocated parameter arrays;
+    // they're only copied into the compilation's arena when we actually
+    // insert a new specialization, so cache hits don't allocate.
+    detail::ClassSpecializationKey key(*this, paramValues, typeParams);
     if (auto it = specMap.find(key); it != specMap.end())
         return it->second;
 
@@ -1007,8 +1011,11 @@ const Type* GenericClassDefSymbol::getSpecializationImpl(
     else
         classType->populate(*scope, getSyntax()->as<ClassDeclarationSyntax>());
 
-    if (!forceInvalidParams && !context.scope->isUninstantiated())
-        specMap.emplace(key, classType);
+    if (!forceInvalidParams && !context.scope->isUninstantiated()) {
+        specMap.emplace(detail::ClassSpecializationKey(*this, paramValues.copy(comp),
+                                                       typeParams.copy(comp)),
+                        classType);
+    }
 
     return classType;
 }
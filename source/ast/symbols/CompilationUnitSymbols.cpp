@@ -33,10 +33,10 @@ CompilationUnitSymbol::CompilationUnitSymbol(Compilation& compilation,
     timeScale = compilation.getDefaultTimeScale();
 
     // All compilation units import the std package automatically.
-    auto& stdPkg = compilation.getStdPackage();
-    auto import = compilation.emplace<WildcardImportSymbol>(stdPkg.name,
-                                                            SourceLocation::NoLocation);
-    import->setPackage(stdPkg);
+    // The import resolves its target by name on first use so that we don't
+    // force construction of the std package here.
+    auto import = compilation.emplace<WildcardImportSymbol>("std"sv, SourceLocation::NoLocation);
+    import->setParent(*this);
     addWildcardImport(*import);
 }
 
@@ -115,7 +115,7 @@ PackageSymbol& PackageSymbol::fromSyntax(const Scope& scope, const ModuleDeclara
     return *result;
 }
 
-const Symbol* PackageSymbol::findForImport(std::string_view lookupName) const {
+const Symbol* PackageSymbol::findForImport(const HashedName& lookupName) const {
     auto& scopeNameMap = getNameMap();
     if (auto it = scopeNameMap.find(lookupName); it != scopeNameMap.end()) {
         auto symbol = it->second;
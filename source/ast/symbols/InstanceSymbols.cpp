@@ -1024,6 +1024,7 @@ InstanceBodySymbol& InstanceBodySymbol::fromDefinition(Compilation& comp,
         result->addMembers(*definition.portList);
 
     // Finally add members from the body.
+    result->reserveMembers(declSyntax.members.size());
     for (auto member : declSyntax.members) {
         // If this is a parameter declaration we will create the symbol manually
         // as we need to apply any overrides.
@@ -1091,6 +1092,12 @@ const Symbol* InstanceBodySymbol::findPort(std::string_view portName) const {
     return nullptr;
 }
 
+const ParameterEnvironment& InstanceBodySymbol::getParameterEnv() const {
+    if (!paramEnv)
+        paramEnv = &getCompilation().getParameterEnv(*this);
+    return *paramEnv;
+}
+
 bool InstanceBodySymbol::hasSameType(const InstanceBodySymbol& other) const {
     if (&other == this)
         return true;
@@ -1098,6 +1105,13 @@ bool InstanceBodySymbol::hasSameType(const InstanceBodySymbol& other) const {
     if (&definition != &other.definition)
         return false;
 
+    // Identical parameterizations share one interned environment, so the
+    // common exact-match case is a pointer comparison. A mismatch still
+    // falls through to the full check, since type parameters can match
+    // without sharing a canonical type.
+    if (&getParameterEnv() == &other.getParameterEnv())
+        return true;
+
     if (parameters.size() != other.parameters.size())
         return false;
 
@@ -1126,6 +1140,60 @@ bool InstanceBodySymbol::hasSameType(const InstanceBodySymbol& other) const {
     return true;
 }
 
+namespace {
+
+// Hashes the semantic content of an instance body's members. Child instance
+// bodies contribute their own cached structural hash instead of being
+// descended into, making the overall scheme merkle-style.
+class StructuralHashVisitor : public ASTVisitor<StructuralHashVisitor, true, true> {
+public:
+    size_t hash = 0;
+
+    template<typename T>
+    void handle(const T& node) {
+        if constexpr (std::is_same_v<InstanceSymbol, T>) {
+            hash_combine(hash, node.kind, node.name, node.body.getStructuralHash());
+            return;
+        }
+        else if constexpr (std::is_same_v<ParameterSymbol, T>) {
+            hash_combine(hash, node.kind, node.name, node.getValue().toString());
+        }
+        else if constexpr (std::is_same_v<TypeParameterSymbol, T>) {
+            hash_combine(hash, node.kind, node.name, node.targetType.getType().toString());
+        }
+        else if constexpr (std::is_base_of_v<Symbol, T>) {
+            hash_combine(hash, node.kind, node.name);
+            if constexpr (std::is_base_of_v<ValueSymbol, T>)
+                hash_combine(hash, node.getType().toString());
+        }
+        else {
+            hash_combine(hash, node.kind);
+            if constexpr (std::is_base_of_v<ValueExpressionBase, T>)
+                hash_combine(hash, node.symbol.name);
+            if constexpr (std::is_base_of_v<Expression, T>) {
+                if (node.constant)
+                    hash_combine(hash, node.constant->toString());
+            }
+        }
+        visitDefault(node);
+    }
+};
+
+} // namespace
+
+uint64_t InstanceBodySymbol::getStructuralHash() const {
+    if (structuralHash)
+        return *structuralHash;
+
+    StructuralHashVisitor visitor;
+    hash_combine(visitor.hash, definition.name);
+    for (auto& member : members())
+        member.visit(visitor);
+
+    structuralHash = visitor.hash;
+    return *structuralHash;
+}
+
 void InstanceBodySymbol::serializeTo(ASTSerializer& serializer) const {
     serializer.writeLink("definition", definition);
 }
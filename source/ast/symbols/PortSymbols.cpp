@@ -1119,55 +1119,81 @@ private:
         if (!portDims)
             return {nullptr, nullptr};
 
-        auto expr = Expression::tryBindInterfaceRef(context, syntax,
-                                                    /* isInterfacePort */ true);
-        if (!expr || expr->bad())
-            return {nullptr, nullptr};
+        // All elements of an instance array share a single connection expression,
+        // so everything below except the final slice selection resolves identically
+        // for every element. Memoize that invariant part on the compilation, keyed
+        // by the containing scope and the shared instance syntax, so that wide
+        // arrays only pay for the lookup and compatibility checks once. The scope
+        // matters: the same syntax elaborates in every instance of the enclosing
+        // body, where the connection can resolve to a different interface.
+        const Symbol* symbol = nullptr;
+        const ModportSymbol* modport = nullptr;
+        std::span<const ConstantRange> dims;
+
+        const SyntaxNode* instanceSyntax = instance.arrayPath.empty() ? nullptr
+                                                                      : instance.getSyntax();
+        if (instanceSyntax) {
+            if (auto memo = comp.findMemoizedIfaceConn(scope, *instanceSyntax, port.name))
+                std::tie(symbol, modport, dims) = *memo;
+        }
+
+        SmallVector<ConstantRange, 4> localDims;
+        if (!symbol) {
+            auto expr = Expression::tryBindInterfaceRef(context, syntax,
+                                                        /* isInterfacePort */ true);
+            if (!expr || expr->bad())
+                return {nullptr, nullptr};
 
-        // Pull out the expression type, which should always be a virtual interface or
-        // array of such types, and decompose into dims and interface info.
-        SmallVector<ConstantRange, 4> dims;
-        auto type = expr->type;
-        while (type->isUnpackedArray()) {
-            dims.push_back(type->getFixedRange());
-            type = type->getArrayElementType();
-        }
+            // Pull out the expression type, which should always be a virtual interface or
+            // array of such types, and decompose into dims and interface info.
+            auto type = expr->type;
+            while (type->isUnpackedArray()) {
+                localDims.push_back(type->getFixedRange());
+                type = type->getArrayElementType();
+            }
+            dims = localDims;
 
-        auto& vit = type->as<VirtualInterfaceType>();
-        auto& connDef = vit.iface.getDefinition();
+            auto& vit = type->as<VirtualInterfaceType>();
+            auto& connDef = vit.iface.getDefinition();
 
-        SLANG_ASSERT(vit.isRealIface);
-        SLANG_ASSERT(port.isGeneric || port.interfaceDef);
-        if (&connDef != port.interfaceDef && !port.isGeneric) {
-            std::string path;
-            connDef.getHierarchicalPath(path);
+            SLANG_ASSERT(vit.isRealIface);
+            SLANG_ASSERT(port.isGeneric || port.interfaceDef);
+            if (&connDef != port.interfaceDef && !port.isGeneric) {
+                std::string path;
+                connDef.getHierarchicalPath(path);
 
-            auto& diag = context.addDiag(diag::InterfacePortTypeMismatch, syntax.sourceRange());
-            diag << path << port.interfaceDef->name;
-            diag.addNote(diag::NoteDeclarationHere, port.location);
-            return {nullptr, nullptr};
-        }
-
-        // Modport must match the specified requirement, if we have one.
-        auto modport = vit.modport;
-        if (!port.modport.empty()) {
-            if (modport && modport->name != port.modport) {
-                auto& diag = context.addDiag(diag::ModportConnMismatch, syntax.sourceRange());
-                diag << connDef.name << modport->name;
-                diag << (port.isGeneric ? "interface"sv : port.interfaceDef->name);
-                diag << port.modport;
+                auto& diag = context.addDiag(diag::InterfacePortTypeMismatch, syntax.sourceRange());
+                diag << path << port.interfaceDef->name;
+                diag.addNote(diag::NoteDeclarationHere, port.location);
                 return {nullptr, nullptr};
             }
 
-            auto sym = port.getModport(context, vit.iface, syntax);
-            if (!sym)
-                return {nullptr, nullptr};
+            // Modport must match the specified requirement, if we have one.
+            modport = vit.modport;
+            if (!port.modport.empty()) {
+                if (modport && modport->name != port.modport) {
+                    auto& diag = context.addDiag(diag::ModportConnMismatch, syntax.sourceRange());
+                    diag << connDef.name << modport->name;
+                    diag << (port.isGeneric ? "interface"sv : port.interfaceDef->name);
+                    diag << port.modport;
+                    return {nullptr, nullptr};
+                }
+
+                auto sym = port.getModport(context, vit.iface, syntax);
+                if (!sym)
+                    return {nullptr, nullptr};
+
+                modport = sym;
+            }
 
-            modport = sym;
+            symbol = expr->as<ArbitrarySymbolExpression>().symbol;
+            if (instanceSyntax) {
+                dims = localDims.copy(comp);
+                comp.memoizeIfaceConn(scope, *instanceSyntax, port.name, {symbol, modport, dims});
+            }
         }
 
         // Make the connection if the dimensions match exactly what the port is expecting.
-        const Symbol* symbol = expr->as<ArbitrarySymbolExpression>().symbol;
         if (areDimSizesEqual(*portDims, dims))
             return {symbol, modport};
 
@@ -1772,7 +1798,35 @@ const Expression* PortConnection::getExpression() const {
             }
         }
         else {
+            // All elements of an instance array bind the same connection syntax,
+            // and unless the connection gets sliced up on a per-element basis the
+            // resulting expression is identical for every sibling. Share the bound
+            // tree through the compilation in that case so that wide arrays don't
+            // pay for rebinding (and don't allocate) the same expression per
+            // element. The memo is scoped to the containing scope since the same
+            // syntax elaborates in every instance of the enclosing body, where
+            // its names can resolve differently. Restricted to input ports since
+            // binding an output connection also registers a driver for the
+            // containing instance.
+            auto& comp = context.getCompilation();
+            const SyntaxNode* instSyntax = parentInstance.arrayPath.empty()
+                                               ? nullptr
+                                               : parentInstance.getSyntax();
+            const bool canShare = instSyntax && !port.name.empty() &&
+                                  direction == ArgumentDirection::In &&
+                                  !parentInstance.body.hierarchyOverrideNode;
+            if (canShare) {
+                if (auto memoized = comp.findMemoizedPortConn(*scope, *instSyntax, port.name)) {
+                    expr = memoized;
+                    return expr;
+                }
+            }
+
+            auto prevSlices = comp.getPortArraySliceCount();
             expr = &Expression::bindArgument(*type, direction, {}, *exprSyntax, context);
+
+            if (canShare && !expr->bad() && comp.getPortArraySliceCount() == prevSlices)
+                comp.memoizePortConn(*scope, *instSyntax, port.name, *expr);
         }
     }
     else if (useDefault) {
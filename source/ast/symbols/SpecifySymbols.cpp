@@ -57,6 +57,21 @@ SpecifyBlockSymbol& SpecifyBlockSymbol::fromSyntax(const Scope& scope,
     return *result;
 }
 
+std::span<const SpecifyBlockSymbol::TimingArc> SpecifyBlockSymbol::getTimingArcs() const {
+    if (arcsResolved)
+        return timingArcs;
+    arcsResolved = true;
+
+    SmallVector<TimingArc> arcs;
+    for (auto& path : membersOfType<TimingPathSymbol>()) {
+        arcs.push_back({&path, path.getInputs(), path.getOutputs(), path.getDelays(),
+                        path.getConditionExpr(), path.getEdgeSourceExpr()});
+    }
+
+    timingArcs = arcs.copy(getCompilation());
+    return timingArcs;
+}
+
 bool SpecifyBlockSymbol::checkPathTerminal(const ValueSymbol& terminal, const Type& type,
                                            const Scope& specifyParent, SpecifyTerminalDir dir,
                                            SourceRange sourceRange) {
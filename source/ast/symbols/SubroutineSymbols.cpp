@@ -749,6 +749,60 @@ bool SubroutineSymbol::hasOutputArgs() const {
     return *cachedHasOutputArgs;
 }
 
+bool SubroutineSymbol::isConstEvalCompatible() const {
+    // Note: these conditions must be kept in sync with the diagnostic-issuing
+    // checks in CallExpression::checkConstant.
+    if (!cachedConstEvalOk.has_value()) {
+        auto check = [&] {
+            if (subroutineKind == SubroutineKind::Task)
+                return false;
+
+            if (flags.has(MethodFlags::DPIImport | MethodFlags::Virtual | MethodFlags::Pure |
+                          MethodFlags::Constructor | MethodFlags::BuiltIn |
+                          MethodFlags::InterfaceExtern | MethodFlags::ModportExport |
+                          MethodFlags::ModportImport)) {
+                return false;
+            }
+
+            if (getReturnType().isVoid())
+                return false;
+
+            for (auto arg : getArguments()) {
+                if (arg->direction != ArgumentDirection::In)
+                    return false;
+            }
+
+            auto scope = getParentScope();
+            SLANG_ASSERT(scope);
+            return scope->asSymbol().kind != SymbolKind::GenerateBlock;
+        };
+        cachedConstEvalOk = check();
+    }
+    return *cachedConstEvalOk;
+}
+
+const Expression* SubroutineSymbol::getInlinedReturnExpr() const {
+    if (!cachedInlineExpr.has_value()) {
+        cachedInlineExpr = nullptr;
+
+        // Unwrap statement list wrappers; a body containing anything other
+        // than a lone return statement is not inlineable. Note that this
+        // deliberately doesn't look through block statements, which can
+        // declare locals and be targeted by disable statements.
+        const Statement* body = &getBody();
+        while (body->kind == StatementKind::List) {
+            auto list = body->as<StatementList>().list;
+            if (list.size() != 1)
+                break;
+            body = list[0];
+        }
+
+        if (body->kind == StatementKind::Return)
+            cachedInlineExpr = body->as<ReturnStatement>().expr;
+    }
+    return *cachedInlineExpr;
+}
+
 void SubroutineSymbol::connectExternInterfacePrototype() const {
     if (prototype)
         return;
@@ -219,6 +219,14 @@ void ValueSymbol::addDriver(DriverKind driverKind, DriverBitRange bounds,
 }
 
 void ValueSymbol::addDriver(DriverBitRange bounds, const ValueDriver& driver) const {
+    addDrivers({&bounds, 1}, driver);
+}
+
+void ValueSymbol::addDrivers(std::span<const DriverBitRange> boundsList,
+                             const ValueDriver& driver) const {
+    if (boundsList.empty())
+        return;
+
     auto scope = getParentScope();
     SLANG_ASSERT(scope);
 
@@ -254,8 +262,10 @@ void ValueSymbol::addDriver(DriverBitRange bounds, const ValueDriver& driver) co
         }
 
         if (driverMap.empty()) {
-            driverMap.insert(bounds, &driver, comp.getDriverMapAllocator());
-            return;
+            driverMap.insert(boundsList[0], &driver, comp.getDriverMapAllocator());
+            boundsList = boundsList.subspan(1);
+            if (boundsList.empty())
+                return;
         }
     }
 
@@ -281,60 +291,62 @@ void ValueSymbol::addDriver(DriverBitRange bounds, const ValueDriver& driver) co
                               kind == SymbolKind::LocalAssertionVar;
 
     // TODO: try to clean these conditions up a bit more
-    auto end = driverMap.end();
-    for (auto it = driverMap.find(bounds); it != end; ++it) {
-        // Check whether this pair of drivers overlapping constitutes a problem.
-        // The conditions for reporting a problem are:
-        // - If this is for a mix of input/output and inout ports, always report.
-        // - Don't report for "Other" drivers (procedural force / release, etc)
-        // - Otherwise, if is this a static var or uwire net:
-        //      - Report if a mix of continuous and procedural assignments
-        //      - Don't report if both drivers are sliced ports from an array
-        //        of instances. We already sliced these up correctly when the
-        //        connections were made and the overlap logic here won't work correctly.
-        //      - Report if multiple continuous assignments
-        //      - If both procedural, report if there aren multiple
-        //        always_comb / always_ff procedures.
-        //          - If the allowDupInitialDrivers option is set, allow an initial
-        //            block to overlap even if the other block is an always_comb/ff.
-        // - Assertion local variable formal arguments can't drive more than
-        //   one output to the same local variable.
-        bool isProblem = false;
-        auto curr = *it;
-
-        if (curr->isUnidirectionalPort() != driver.isUnidirectionalPort()) {
-            isProblem = true;
-        }
-        else if (checkOverlap && driver.kind != DriverKind::Other &&
-                 curr->kind != DriverKind::Other) {
-            if (driver.kind == DriverKind::Continuous || curr->kind == DriverKind::Continuous) {
-                if (!driver.flags.has(AssignFlags::SlicedPort) ||
-                    !curr->flags.has(AssignFlags::SlicedPort)) {
-                    isProblem = true;
-                }
-            }
-            else if (curr->containingSymbol != driver.containingSymbol &&
-                     curr->containingSymbol->kind == SymbolKind::ProceduralBlock &&
-                     driver.containingSymbol->kind == SymbolKind::ProceduralBlock &&
-                     (curr->isInSingleDriverProcedure() || driver.isInSingleDriverProcedure()) &&
-                     (!comp.hasFlag(CompilationFlags::AllowDupInitialDrivers) ||
-                      (!curr->isInInitialBlock() && !driver.isInInitialBlock()))) {
+    for (auto& bounds : boundsList) {
+        auto end = driverMap.end();
+        for (auto it = driverMap.find(bounds); it != end; ++it) {
+            // Check whether this pair of drivers overlapping constitutes a problem.
+            // The conditions for reporting a problem are:
+            // - If this is for a mix of input/output and inout ports, always report.
+            // - Don't report for "Other" drivers (procedural force / release, etc)
+            // - Otherwise, if is this a static var or uwire net:
+            //      - Report if a mix of continuous and procedural assignments
+            //      - Don't report if both drivers are sliced ports from an array
+            //        of instances. We already sliced these up correctly when the
+            //        connections were made and the overlap logic here won't work correctly.
+            //      - Report if multiple continuous assignments
+            //      - If both procedural, report if there aren multiple
+            //        always_comb / always_ff procedures.
+            //          - If the allowDupInitialDrivers option is set, allow an initial
+            //            block to overlap even if the other block is an always_comb/ff.
+            // - Assertion local variable formal arguments can't drive more than
+            //   one output to the same local variable.
+            bool isProblem = false;
+            auto curr = *it;
+
+            if (curr->isUnidirectionalPort() != driver.isUnidirectionalPort()) {
                 isProblem = true;
             }
-            else if (curr->isLocalVarFormalArg() && driver.isLocalVarFormalArg()) {
-                isProblem = true;
+            else if (checkOverlap && driver.kind != DriverKind::Other &&
+                     curr->kind != DriverKind::Other) {
+                if (driver.kind == DriverKind::Continuous || curr->kind == DriverKind::Continuous) {
+                    if (!driver.flags.has(AssignFlags::SlicedPort) ||
+                        !curr->flags.has(AssignFlags::SlicedPort)) {
+                        isProblem = true;
+                    }
+                }
+                else if (curr->containingSymbol != driver.containingSymbol &&
+                         curr->containingSymbol->kind == SymbolKind::ProceduralBlock &&
+                         driver.containingSymbol->kind == SymbolKind::ProceduralBlock &&
+                         (curr->isInSingleDriverProcedure() || driver.isInSingleDriverProcedure()) &&
+                         (!comp.hasFlag(CompilationFlags::AllowDupInitialDrivers) ||
+                          (!curr->isInInitialBlock() && !driver.isInInitialBlock()))) {
+                    isProblem = true;
+                }
+                else if (curr->isLocalVarFormalArg() && driver.isLocalVarFormalArg()) {
+                    isProblem = true;
+                }
             }
-        }
 
-        if (isProblem) {
-            if (!handleOverlap(*scope, name, *curr, driver, isNet, isUWire, isSingleDriverUDNT,
-                               netType)) {
-                break;
+            if (isProblem) {
+                if (!handleOverlap(*scope, name, *curr, driver, isNet, isUWire, isSingleDriverUDNT,
+                                   netType)) {
+                    break;
+                }
             }
         }
-    }
 
-    driverMap.insert(bounds, &driver, comp.getDriverMapAllocator());
+        driverMap.insert(bounds, &driver, comp.getDriverMapAllocator());
+    }
 }
 
 void ValueSymbol::addPortBackref(const PortSymbol& port) const {
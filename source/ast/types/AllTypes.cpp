@@ -670,11 +670,7 @@ const Type& PackedArrayType::fromDim(const Scope& scope, const Type& elementType
         return comp.getErrorType();
     }
 
-    auto result = comp.emplace<PackedArrayType>(elementType, dim, bitwidth_t(*width));
-    if (auto syntax = sourceRange.syntax())
-        result->setSyntax(*syntax);
-
-    return *result;
+    return comp.getPackedArrayType(elementType, dim, bitwidth_t(*width));
 }
 
 FixedSizeUnpackedArrayType::FixedSizeUnpackedArrayType(const Type& elementType, ConstantRange range,
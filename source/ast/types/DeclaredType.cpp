@@ -38,9 +38,12 @@ DeclaredType::DeclaredType(const Symbol& parent, bitmask<DeclaredTypeFlags> flag
 }
 
 const Type& DeclaredType::getType() const {
-    if (!type)
+    auto result = type.load(std::memory_order_acquire);
+    if (!result) {
         resolveType(getASTContext<false>(), getASTContext<true>());
-    return *type;
+        result = type.load(std::memory_order_relaxed);
+    }
+    return *result;
 }
 
 void DeclaredType::setLink(const DeclaredType& target) {
@@ -68,16 +71,17 @@ void DeclaredType::resolveType(const ASTContext& typeContext,
     auto& comp = typeContext.getCompilation();
     if (hasLink) {
         SLANG_ASSERT(typeOrLink.link);
-        type = &typeOrLink.link->getType();
+        auto result = &typeOrLink.link->getType();
         if (dimensions)
-            type = &comp.getType(*type, *dimensions, typeContext);
+            result = &comp.getType(*result, *dimensions, typeContext);
+        type.store(result, std::memory_order_release);
         return;
     }
 
     auto syntax = typeOrLink.typeSyntax;
     SLANG_ASSERT(syntax);
     if (!syntax) {
-        type = &comp.getErrorType();
+        type.store(&comp.getErrorType(), std::memory_order_release);
         return;
     }
 
@@ -85,52 +89,59 @@ void DeclaredType::resolveType(const ASTContext& typeContext,
     evaluating = true;
     auto guard = ScopeGuard([this] { evaluating = false; });
 
+    // Resolve into a local and publish with a single release store at the
+    // end so that concurrent readers never observe a partially built type.
+    const Type* result;
+
     // If we are configured to infer implicit types, bind the initializer expression
     // first so that we can derive our type from whatever that happens to be.
     if (syntax->kind == SyntaxKind::ImplicitType && flags.has(DeclaredTypeFlags::InferImplicit)) {
         if (dimensions) {
             auto& its = syntax->as<ImplicitTypeSyntax>();
             if (its.signing || !its.dimensions.empty()) {
-                type = &comp.getType(*syntax, typeContext, nullptr);
-                type = &comp.getType(*type, *dimensions, typeContext);
+                result = &comp.getType(*syntax, typeContext, nullptr);
+                result = &comp.getType(*result, *dimensions, typeContext);
             }
             else {
                 typeContext.addDiag(diag::UnpackedArrayParamType, dimensions->sourceRange());
-                type = &comp.getErrorType();
+                result = &comp.getErrorType();
             }
         }
         else if (!initializerSyntax) {
-            type = &comp.getErrorType();
+            result = &comp.getErrorType();
         }
         else {
             bitmask<ASTFlags> extraFlags;
             if (flags.has(DeclaredTypeFlags::AllowUnboundedLiteral))
                 extraFlags = ASTFlags::AllowUnboundedLiteral;
 
-            std::tie(initializer, type) = Expression::bindImplicitParam(
+            const Expression* init;
+            std::tie(init, result) = Expression::bindImplicitParam(
                 *syntax, *initializerSyntax, {initializerLocation, initializerLocation + 1},
                 initializerContext, typeContext, extraFlags);
-            SLANG_ASSERT(initializer);
+            SLANG_ASSERT(init);
+            initializer.store(init, std::memory_order_release);
         }
     }
     else if (flags.has(DeclaredTypeFlags::InterconnectNet)) {
         // An interconnect net is always untyped (or some array of untyped elements).
-        type = &comp.getType(SyntaxKind::Untyped);
+        result = &comp.getType(SyntaxKind::Untyped);
         if (syntax->kind == SyntaxKind::ImplicitType) {
             // This should always be an implicit type unless there's an
             // error (diagnosed by the parser).
             auto& its = syntax->as<ImplicitTypeSyntax>();
             if (!its.dimensions.empty())
-                type = &comp.getType(*type, its.dimensions,
-                                     typeContext.resetFlags(ASTFlags::AllowInterconnect));
+                result = &comp.getType(*result, its.dimensions,
+                                       typeContext.resetFlags(ASTFlags::AllowInterconnect));
         }
 
         if (dimensions) {
-            type = &comp.getType(*type, *dimensions,
-                                 typeContext.resetFlags(ASTFlags::AllowInterconnect));
+            result = &comp.getType(*result, *dimensions,
+                                   typeContext.resetFlags(ASTFlags::AllowInterconnect));
         }
 
         // Return early to skip additional checks for net types.
+        type.store(result, std::memory_order_release);
         return;
     }
     else {
@@ -142,12 +153,13 @@ void DeclaredType::resolveType(const ASTContext& typeContext,
                 typedefTarget = &parent.as<Type>();
         }
 
-        type = &comp.getType(*syntax, typeContext, typedefTarget);
+        result = &comp.getType(*syntax, typeContext, typedefTarget);
         if (dimensions)
-            type = &comp.getType(*type, *dimensions, typeContext);
+            result = &comp.getType(*result, *dimensions, typeContext);
     }
 
-    if (flags.has(DeclaredTypeFlags::NeedsTypeCheck) && !type->isError())
+    type.store(result, std::memory_order_release);
+    if (flags.has(DeclaredTypeFlags::NeedsTypeCheck) && !result->isError())
         checkType(initializerContext);
 }
 
@@ -228,18 +240,19 @@ void DeclaredType::checkType(const ASTContext& context) const {
     uint32_t masked = (flags & DeclaredTypeFlags::NeedsTypeCheck).bits();
     SLANG_ASSERT(std::popcount(masked) == 1);
 
+    auto resolved = type.load(std::memory_order_relaxed);
     switch (masked) {
         case uint32_t(DeclaredTypeFlags::NetType): {
             auto& net = parent.as<NetSymbol>();
-            if (net.netType.netKind != NetType::UserDefined && !isValidForNet(*type))
-                context.addDiag(diag::InvalidNetType, parent.location) << *type;
-            else if (type->getBitWidth() == 1 && net.expansionHint != NetSymbol::None)
+            if (net.netType.netKind != NetType::UserDefined && !isValidForNet(*resolved))
+                context.addDiag(diag::InvalidNetType, parent.location) << *resolved;
+            else if (resolved->getBitWidth() == 1 && net.expansionHint != NetSymbol::None)
                 context.addDiag(diag::SingleBitVectored, parent.location);
             break;
         }
         case uint32_t(DeclaredTypeFlags::UserDefinedNetType):
-            if (!isValidForUserDefinedNet(*type))
-                context.addDiag(diag::InvalidUserDefinedNetType, parent.location) << *type;
+            if (!isValidForUserDefinedNet(*resolved))
+                context.addDiag(diag::InvalidUserDefinedNetType, parent.location) << *resolved;
             break;
         case uint32_t(DeclaredTypeFlags::FormalArgMergeVar):
             if (auto var = parent.as<FormalArgumentSymbol>().getMergedVariable()) {
@@ -253,8 +266,8 @@ void DeclaredType::checkType(const ASTContext& context) const {
             break;
         case uint32_t(DeclaredTypeFlags::Rand): {
             RandMode mode = parent.getRandMode();
-            if (!type->isValidForRand(mode, lv)) {
-                auto& diag = context.addDiag(diag::InvalidRandType, parent.location) << *type;
+            if (!resolved->isValidForRand(mode, lv)) {
+                auto& diag = context.addDiag(diag::InvalidRandType, parent.location) << *resolved;
                 if (mode == RandMode::Rand)
                     diag << "rand"sv;
                 else
@@ -263,26 +276,30 @@ void DeclaredType::checkType(const ASTContext& context) const {
             break;
         }
         case uint32_t(DeclaredTypeFlags::DPIReturnType): {
-            if (!type->isValidForDPIReturn())
-                context.addDiag(diag::InvalidDPIReturnType, parent.location) << *type;
-            else if (parent.as<SubroutineSymbol>().flags.has(MethodFlags::Pure) && type->isVoid())
+            if (!resolved->isValidForDPIReturn())
+                context.addDiag(diag::InvalidDPIReturnType, parent.location) << *resolved;
+            else if (parent.as<SubroutineSymbol>().flags.has(MethodFlags::Pure) &&
+                     resolved->isVoid()) {
                 context.addDiag(diag::DPIPureReturn, parent.location);
+            }
             break;
         }
         case uint32_t(DeclaredTypeFlags::DPIArg):
-            if (!type->isValidForDPIArg())
-                context.addDiag(diag::InvalidDPIArgType, parent.location) << *type;
+            if (!resolved->isValidForDPIArg())
+                context.addDiag(diag::InvalidDPIArgType, parent.location) << *resolved;
             break;
         case uint32_t(DeclaredTypeFlags::RequireSequenceType):
-            if (!type->isValidForSequence())
-                context.addDiag(diag::AssertionExprType, parent.location) << *type;
+            if (!resolved->isValidForSequence())
+                context.addDiag(diag::AssertionExprType, parent.location) << *resolved;
             break;
         case uint32_t(DeclaredTypeFlags::CoverageType):
-            if (!type->isIntegral() && (lv < LanguageVersion::v1800_2023 || !type->isFloating()))
-                context.addDiag(diag::InvalidCoverageExpr, parent.location) << *type;
+            if (!resolved->isIntegral() &&
+                (lv < LanguageVersion::v1800_2023 || !resolved->isFloating())) {
+                context.addDiag(diag::InvalidCoverageExpr, parent.location) << *resolved;
+            }
             break;
         case uint32_t(DeclaredTypeFlags::InterfaceVariable):
-            if (!isValidForIfaceVar(*type))
+            if (!isValidForIfaceVar(*resolved))
                 context.addDiag(diag::VirtualInterfaceIfaceMember, parent.location);
             break;
         default:
@@ -359,7 +376,7 @@ void DeclaredType::mergePortTypes(
     }
 
     // Our declared type takes on the merged type from the variable definition.
-    this->type = destType;
+    this->type.store(destType, std::memory_order_release);
 
     auto errorDims = [&](auto& dims) {
         auto& diag = context.addDiag(diag::PortDeclDimensionsMismatch, dims.sourceRange());
@@ -401,14 +418,14 @@ void DeclaredType::mergePortTypes(
 }
 
 void DeclaredType::resolveAt(const ASTContext& context) const {
-    if (!type) {
+    if (!type.load(std::memory_order_acquire)) {
         resolveType(getASTContext<false>(), context);
-        if (initializer)
+        if (initializer.load(std::memory_order_relaxed))
             return;
     }
 
     if (!initializerSyntax) {
-        initializer = NoInitializer;
+        initializer.store(NoInitializer, std::memory_order_release);
         return;
     }
 
@@ -417,7 +434,7 @@ void DeclaredType::resolveAt(const ASTContext& context) const {
     // normal integral values).
     auto& scope = *context.scope;
     bitmask<ASTFlags> extraFlags;
-    const Type* targetType = type;
+    const Type* targetType = type.load(std::memory_order_relaxed);
     if (targetType->isEnum() && scope.asSymbol().kind == SymbolKind::EnumType) {
         targetType = &targetType->as<EnumType>().baseType;
         extraFlags = ASTFlags::UnevaluatedBranch;
@@ -426,24 +443,28 @@ void DeclaredType::resolveAt(const ASTContext& context) const {
         extraFlags = ASTFlags::AllowUnboundedLiteral;
     }
 
-    initializer = &Expression::bindRValue(*targetType, *initializerSyntax,
-                                          {initializerLocation, initializerLocation + 1}, context,
-                                          extraFlags);
+    initializer.store(&Expression::bindRValue(*targetType, *initializerSyntax,
+                                              {initializerLocation, initializerLocation + 1},
+                                              context, extraFlags),
+                      std::memory_order_release);
 }
 
 void DeclaredType::forceResolveAt(const ASTContext& context) const {
-    if (!type)
+    if (!type.load(std::memory_order_acquire))
         resolveType(context, context);
 
-    if (!initializer)
+    if (!initializer.load(std::memory_order_acquire))
         resolveAt(context);
 }
 
 const Expression* DeclaredType::getInitializer() const {
-    if (!initializer)
+    auto result = initializer.load(std::memory_order_acquire);
+    if (!result) {
         resolveAt(getASTContext<true>());
+        result = initializer.load(std::memory_order_relaxed);
+    }
 
-    return initializer == NoInitializer ? nullptr : initializer;
+    return result == NoInitializer ? nullptr : result;
 }
 
 void DeclaredType::setFromDeclarator(const DeclaratorSyntax& decl) {
@@ -127,6 +127,19 @@ uint64_t Type::getSelectableWidth() const {
     }
 }
 
+const TypeBitLayout* Type::getBitLayout() const {
+    auto& ct = getCanonicalType();
+    switch (ct.kind) {
+        case SymbolKind::PackedStructType:
+        case SymbolKind::PackedUnionType:
+        case SymbolKind::UnpackedStructType:
+        case SymbolKind::UnpackedUnionType:
+            return &ct.as<Scope>().getCompilation().getTypeBitLayout(ct);
+        default:
+            return nullptr;
+    }
+}
+
 bool Type::isSigned() const {
     const Type& ct = getCanonicalType();
     return ct.isIntegral() && ct.as<IntegralType>().isSigned;
@@ -402,19 +415,38 @@ bool Type::isTaggedUnion() const {
     }
 }
 
-bool Type::isMatching(const Type& rhs) const {
-    // See [6.22.1] for Matching Types.
-    const Type* l = &getCanonicalType();
-    const Type* r = &rhs.getCanonicalType();
+// Finds a compilation whose memo table can hold type compatibility results
+// for the given canonical type pair. Memoizing only pays off for checks that
+// recurse through aggregates, so drill through array elements looking for a
+// scope-based type (struct, union, enum, class, covergroup); comparisons of
+// plain scalars skip the table entirely since the direct check is cheaper
+// than a hash probe.
+static Compilation* typeCompatCompilation(const Type& l, const Type& r) {
+    for (const Type* t : {&l, &r}) {
+        while (t->isArray()) {
+            auto elem = t->getArrayElementType();
+            if (!elem)
+                break;
+            t = &elem->getCanonicalType();
+        }
 
-    // If the two types have the same address, they are literally the same type.
-    // This handles all built-in types, which are allocated once and then shared,
-    // and also handles simple bit vector types that share the same range, signedness,
-    // and four-stateness because we uniquify them in the compilation cache.
-    // This handles checks [6.22.1] (a), (b), (c), (d), (g), and (h).
-    if (l == r)
-        return true;
+        switch (t->kind) {
+            case SymbolKind::PackedStructType:
+            case SymbolKind::UnpackedStructType:
+            case SymbolKind::PackedUnionType:
+            case SymbolKind::UnpackedUnionType:
+            case SymbolKind::EnumType:
+            case SymbolKind::ClassType:
+            case SymbolKind::CovergroupType:
+                return &t->as<Scope>().getCompilation();
+            default:
+                break;
+        }
+    }
+    return nullptr;
+}
 
+static bool isMatchingImpl(const Type* l, const Type* r) {
     if (l->getSyntax() && l->getSyntax() == r->getSyntax() &&
         l->getParentScope() == r->getParentScope()) {
         return true;
@@ -496,10 +528,38 @@ bool Type::isMatching(const Type& rhs) const {
     return false;
 }
 
-bool Type::isEquivalent(const Type& rhs) const {
-    // See [6.22.2] for Equivalent Types
+bool Type::isMatching(const Type& rhs) const {
+    // See [6.22.1] for Matching Types.
     const Type* l = &getCanonicalType();
     const Type* r = &rhs.getCanonicalType();
+
+    // If the two types have the same address, they are literally the same type.
+    // This handles all built-in types, which are allocated once and then shared,
+    // and also handles simple bit vector types that share the same range, signedness,
+    // and four-stateness because we uniquify them in the compilation cache.
+    // This handles checks [6.22.1] (a), (b), (c), (d), (g), and (h).
+    if (l == r)
+        return true;
+
+    // Aggregate comparisons recurse through their full structure, so memoize
+    // the result; wide structs connected across thousands of instances would
+    // otherwise re-prove the same relation on every bind. This is valid
+    // because types are immutable once created.
+    auto comp = typeCompatCompilation(*l, *r);
+    if (comp) {
+        if (auto cached = comp->findCachedTypeCompat(*l, *r,
+                                                     Compilation::TypeCompatKind::Matching)) {
+            return *cached;
+        }
+    }
+
+    bool result = isMatchingImpl(l, r);
+    if (comp)
+        comp->cacheTypeCompat(*l, *r, Compilation::TypeCompatKind::Matching, result);
+    return result;
+}
+
+static bool isEquivalentImpl(const Type* l, const Type* r) {
     if (l->isMatching(*r))
         return true;
 
@@ -565,10 +625,28 @@ bool Type::isEquivalent(const Type& rhs) const {
     return false;
 }
 
-bool Type::isAssignmentCompatible(const Type& rhs) const {
-    // See [6.22.3] for Assignment Compatible
+bool Type::isEquivalent(const Type& rhs) const {
+    // See [6.22.2] for Equivalent Types
     const Type* l = &getCanonicalType();
     const Type* r = &rhs.getCanonicalType();
+    if (l == r)
+        return true;
+
+    auto comp = typeCompatCompilation(*l, *r);
+    if (comp) {
+        if (auto cached = comp->findCachedTypeCompat(*l, *r,
+                                                     Compilation::TypeCompatKind::Equivalent)) {
+            return *cached;
+        }
+    }
+
+    bool result = isEquivalentImpl(l, r);
+    if (comp)
+        comp->cacheTypeCompat(*l, *r, Compilation::TypeCompatKind::Equivalent, result);
+    return result;
+}
+
+static bool isAssignmentCompatibleImpl(const Type* l, const Type* r) {
     if (l->isEquivalent(*r))
         return true;
 
@@ -638,6 +716,28 @@ bool Type::isAssignmentCompatible(const Type& rhs) const {
     return false;
 }
 
+bool Type::isAssignmentCompatible(const Type& rhs) const {
+    // See [6.22.3] for Assignment Compatible
+    const Type* l = &getCanonicalType();
+    const Type* r = &rhs.getCanonicalType();
+    if (l == r)
+        return true;
+
+    auto comp = typeCompatCompilation(*l, *r);
+    if (comp) {
+        if (auto cached = comp->findCachedTypeCompat(
+                *l, *r, Compilation::TypeCompatKind::AssignmentCompatible)) {
+            return *cached;
+        }
+    }
+
+    bool result = isAssignmentCompatibleImpl(l, r);
+    if (comp) {
+        comp->cacheTypeCompat(*l, *r, Compilation::TypeCompatKind::AssignmentCompatible, result);
+    }
+    return result;
+}
+
 bool Type::isCastCompatible(const Type& rhs) const {
     // See [6.22.4] for Cast Compatible
     const Type* l = &getCanonicalType();
@@ -914,7 +1014,7 @@ static const Type* changeSign(Compilation& compilation, const Type& type, bool s
     for (size_t i = 0; i < count; i++) {
         // There's no worry about size overflow here because we started with a valid type.
         ConstantRange dim = dims[count - i - 1];
-        curr = compilation.emplace<PackedArrayType>(*curr, dim, curr->getBitWidth() * dim.width());
+        curr = &compilation.getPackedArrayType(*curr, dim, curr->getBitWidth() * dim.width());
     }
 
     return curr;
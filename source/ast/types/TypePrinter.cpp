@@ -529,9 +529,34 @@ std::string TypeArgFormatter::format(const std::any& arg) {
     printer.options.printAKA = unique;
     printer.options.elideScopeNames = !type.isAlias() || !typesToDisambiguate.count(&type);
 
+    // The same handful of types tend to show up in diagnostics over and over
+    // again in error-heavy builds, and rendering a deeply nested struct or
+    // parameterized class name walks the whole type each time. Memoize the
+    // finished strings, keyed on the type plus the two option bits that vary
+    // per call. Types without a parent scope (the builtins) print trivially
+    // and don't identify a compilation, so they skip the cache.
+    auto scope = type.getParentScope();
+    if (!scope) {
+        printer.clear();
+        printer.append(type);
+        return printer.toString();
+    }
+
+    auto& comp = scope->getCompilation();
+    if (&comp != cachedCompilation) {
+        cachedCompilation = &comp;
+        formatCache.clear();
+    }
+
+    uintptr_t key = reinterpret_cast<uintptr_t>(&type) |
+                    uintptr_t(printer.options.printAKA ? 1 : 0) |
+                    uintptr_t(printer.options.elideScopeNames ? 2 : 0);
+    if (auto it = formatCache.find(key); it != formatCache.end())
+        return it->second;
+
     printer.clear();
     printer.append(type);
-    return printer.toString();
+    return formatCache.emplace(key, printer.toString()).first->second;
 }
 
 } // namespace slang::ast
@@ -30,6 +30,12 @@ const DiagGroup* findDefaultDiagGroup(std::string_view name);
 
 DiagnosticEngine::FormatterMap DiagnosticEngine::defaultFormatters;
 
+// Maps a diagnostic code to its bit in the mappedCodesFilter member.
+static constexpr uint64_t mappedCodeBit(DiagCode code) {
+    uint64_t key = (uint64_t(uint32_t(code.getSubsystem())) << 16) | code.getCode();
+    return 1ull << ((key * 0x9E3779B97F4A7C15ull) >> 58);
+}
+
 DiagnosticEngine::DiagnosticEngine(const SourceManager& sourceManager) :
     sourceManager(sourceManager), formatters(defaultFormatters) {
 }
@@ -65,8 +71,10 @@ DiagnosticSeverity DiagnosticEngine::getSeverity(DiagCode code, SourceLocation l
     if (auto sev = findMappedSeverity(code, location); sev.has_value())
         return *sev;
 
-    if (auto it = severityTable.find(code); it != severityTable.end())
-        return it->second;
+    if (!severityTable.empty()) {
+        if (auto it = severityTable.find(code); it != severityTable.end())
+            return it->second;
+    }
 
     auto result = getDefaultSeverity(code);
     switch (result) {
@@ -96,6 +104,7 @@ DiagnosticSeverity DiagnosticEngine::getSeverity(DiagCode code, SourceLocation l
 
 void DiagnosticEngine::setMessage(DiagCode code, const std::string& message) {
     messageTable[code] = message;
+    formatCache.erase(code);
 }
 
 std::string_view DiagnosticEngine::getMessage(DiagCode code) const {
@@ -119,6 +128,7 @@ const DiagGroup* DiagnosticEngine::findDiagGroup(std::string_view name) const {
 void DiagnosticEngine::clearMappings() {
     severityTable.clear();
     messageTable.clear();
+    formatCache.clear();
 }
 
 void DiagnosticEngine::clearMappings(DiagnosticSeverity severity) {
@@ -246,7 +256,13 @@ bool DiagnosticEngine::issueImpl(const Diagnostic& diagnostic, DiagnosticSeverit
         }
     }
 
-    std::string message = formatMessage(diagnostic);
+    // Formatting arguments is comparatively expensive (type names and values
+    // are stringified via the registered formatters) so skip it entirely when
+    // no client is registered to see the result, e.g. when an engine is used
+    // only to count errors and warnings.
+    std::string message;
+    if (!clients.empty())
+        message = formatMessage(diagnostic);
 
     ReportedDiagnostic report(diagnostic);
     report.expansionLocs = std::span<SourceLocation>(expansionLocs).subspan(ignoreExpansionsUntil);
@@ -269,6 +285,58 @@ bool DiagnosticEngine::issueImpl(const Diagnostic& diagnostic, DiagnosticSeverit
     return true;
 }
 
+const DiagnosticEngine::CompiledFormat& DiagnosticEngine::getCompiledFormat(DiagCode code) const {
+    if (auto it = formatCache.find(code); it != formatCache.end())
+        return it->second;
+
+    CompiledFormat result;
+    result.simple = true;
+
+    std::string_view fmtStr = getMessage(code);
+    std::string literal;
+
+    for (size_t i = 0; i < fmtStr.size(); i++) {
+        char c = fmtStr[i];
+        if (c == '{') {
+            if (i + 1 < fmtStr.size() && fmtStr[i + 1] == '{') {
+                literal += '{';
+                i++;
+            }
+            else if (i + 1 < fmtStr.size() && fmtStr[i + 1] == '}') {
+                result.pieces.push_back({std::move(literal), true});
+                result.argSlots++;
+                literal.clear();
+                i++;
+            }
+            else {
+                // An explicit index or format spec; let fmt deal with it.
+                result.simple = false;
+                break;
+            }
+        }
+        else if (c == '}') {
+            if (i + 1 < fmtStr.size() && fmtStr[i + 1] == '}') {
+                literal += '}';
+                i++;
+            }
+            else {
+                result.simple = false;
+                break;
+            }
+        }
+        else {
+            literal += c;
+        }
+    }
+
+    if (!result.simple)
+        result.pieces.clear();
+    else if (!literal.empty())
+        result.pieces.push_back({std::move(literal), false});
+
+    return formatCache.emplace(code, std::move(result)).first->second;
+}
+
 std::string DiagnosticEngine::formatMessage(const Diagnostic& diag) const {
     // If we have no arguments, the format string is the entire message.
     if (diag.args.empty())
@@ -281,6 +349,49 @@ std::string DiagnosticEngine::formatMessage(const Diagnostic& diag) const {
     for (auto& [key, formatter] : formatters)
         formatter->startMessage(diag);
 
+    // Nearly all diagnostic messages use only sequential "{}" fields, so the
+    // common path stitches the precompiled pieces together with each argument
+    // formatted to its default representation, skipping fmt's per-issuance
+    // format string parse.
+    auto& compiled = getCompiledFormat(diag.code);
+    if (compiled.simple && compiled.argSlots <= diag.args.size()) {
+        // Arguments are formatted eagerly and in order, matching the
+        // fallback path's behavior even when the format string doesn't
+        // reference all of them.
+        SmallVector<std::string, 4> formatted;
+        for (auto& arg : diag.args) {
+            formatted.push_back(std::visit(
+                [&](auto&& t) -> std::string {
+                    using T = std::decay_t<decltype(t)>;
+                    if constexpr (std::is_same_v<Diagnostic::CustomArgType, T>) {
+                        if (auto it = formatters.find(t.first); it != formatters.end())
+                            return it->second->format(t.second);
+                        SLANG_THROW(std::runtime_error("No diagnostic formatter for type"));
+                    }
+                    else if constexpr (std::is_same_v<ConstantValue, T>) {
+                        if (t.isReal())
+                            return fmt::to_string(double(t.real()));
+                        if (t.isShortReal())
+                            return fmt::to_string(float(t.shortReal()));
+                        return t.toString();
+                    }
+                    else {
+                        return fmt::to_string(t);
+                    }
+                },
+                arg));
+        }
+
+        std::string result;
+        size_t argIndex = 0;
+        for (auto& piece : compiled.pieces) {
+            result += piece.literal;
+            if (piece.hasArg)
+                result += formatted[argIndex++];
+        }
+        return result;
+    }
+
     // Dynamically build up the list of arguments to pass to the formatting routines.
     fmt::dynamic_format_arg_store<fmt::format_context> args;
     for (auto& arg : diag.args) {
@@ -512,6 +623,7 @@ void DiagnosticEngine::setMappingsFromPragmasImpl(BufferID buffer,
 
     auto noteDiag = [&](DiagCode code, auto& directive) {
         diagMappings[code][buffer].emplace_back(directive.offset, directive.severity);
+        mappedCodesFilter |= mappedCodeBit(code);
         mappingStack.back()[code] = directive.severity;
     };
 
@@ -581,6 +693,13 @@ Diagnostics DiagnosticEngine::setMappingsFromPragmas(BufferID buffer) {
 
 std::optional<DiagnosticSeverity> DiagnosticEngine::findMappedSeverity(
     DiagCode code, SourceLocation location) const {
+    // In the common case the issued code has no in-source severity pragmas at
+    // all (often there are none anywhere); a single bit test in the filter
+    // skips the map probe for it. False positives just fall through to the
+    // exact lookup below.
+    if (!(mappedCodesFilter & mappedCodeBit(code)))
+        return std::nullopt;
+
     auto byCode = diagMappings.find(code);
     if (byCode == diagMappings.end())
         return std::nullopt;
@@ -139,25 +139,88 @@ Diagnostic& Diagnostics::add(const ast::Symbol& source, DiagCode code, SourceRan
     return add(source, code, range.start()) << range;
 }
 
-void Diagnostics::sort(const SourceManager& sourceManager) {
-    auto compare = [&sourceManager](auto& x, auto& y) {
-        SourceLocation xl = sourceManager.getFullyExpandedLoc(x.location);
-        SourceLocation yl = sourceManager.getFullyExpandedLoc(y.location);
-
-        auto xb = sourceManager.getSortKey(xl.buffer());
-        auto yb = sourceManager.getSortKey(yl.buffer());
-        if (xb < yb)
-            return true;
-        if (xb == yb) {
-            if (xl.offset() < yl.offset())
-                return true;
-            if (xl == yl)
-                return x.code < y.code;
+namespace {
+
+struct DiagSortEntry {
+    uint64_t bufferKey;
+    uint64_t offset;
+    DiagCode code;
+    uint32_t index;
+};
+
+// Sorts entries by (bufferKey, offset, code, index) using a least significant
+// digit radix sort over 16-bit digits. Each pass is a stable counting sort,
+// so running the passes from the least significant part of the key to the
+// most significant yields the full lexicographic order; the initial order is
+// already ascending by index so that part needs no pass of its own. Passes
+// where every entry shares the same digit (the common case for the high bits
+// of offsets and buffer keys) are skipped entirely.
+void radixSortDiags(std::vector<DiagSortEntry>& entries) {
+    static constexpr size_t Radix = 1 << 16;
+    std::vector<DiagSortEntry> scratch(entries.size());
+    auto counts = std::make_unique<uint32_t[]>(Radix);
+
+    auto doPass = [&](auto&& digitOf) {
+        std::fill_n(counts.get(), Radix, 0u);
+        for (auto& entry : entries)
+            counts[digitOf(entry)]++;
+
+        if (counts[digitOf(entries[0])] == entries.size())
+            return;
+
+        uint32_t total = 0;
+        for (size_t i = 0; i < Radix; i++) {
+            uint32_t c = counts[i];
+            counts[i] = total;
+            total += c;
         }
-        return false;
+
+        for (auto& entry : entries)
+            scratch[counts[digitOf(entry)]++] = entry;
+        entries.swap(scratch);
     };
 
-    std::ranges::stable_sort(*this, compare);
+    doPass([](const DiagSortEntry& e) { return e.code.getCode(); });
+    doPass([](const DiagSortEntry& e) { return uint16_t(e.code.getSubsystem()); });
+    for (int shift = 0; shift < 64; shift += 16)
+        doPass([shift](const DiagSortEntry& e) { return (e.offset >> shift) & 0xffff; });
+    for (int shift = 0; shift < 64; shift += 16)
+        doPass([shift](const DiagSortEntry& e) { return (e.bufferKey >> shift) & 0xffff; });
+}
+
+} // namespace
+
+void Diagnostics::sort(const SourceManager& sourceManager) {
+    // Expanding locations and looking up buffer sort keys goes through the
+    // source manager's lock, so compute each diagnostic's key once up front
+    // instead of on every comparison. Diagnostics themselves are relatively
+    // heavy to move around, so sort the keys and then apply the permutation.
+    std::vector<DiagSortEntry> entries;
+    entries.reserve(size());
+    for (size_t i = 0; i < size(); i++) {
+        SourceLocation loc = sourceManager.getFullyExpandedLoc((*this)[i].location);
+        entries.push_back({sourceManager.getSortKey(loc.buffer()), loc.offset(), (*this)[i].code,
+                           uint32_t(i)});
+    }
+
+    // For large batches a radix sort over the packed keys beats a comparison
+    // sort handily; below that the counting passes don't pay for themselves.
+    if (entries.size() >= 4096) {
+        radixSortDiags(entries);
+    }
+    else {
+        std::ranges::sort(entries, [](const DiagSortEntry& x, const DiagSortEntry& y) {
+            return std::tie(x.bufferKey, x.offset, x.code, x.index) <
+                   std::tie(y.bufferKey, y.offset, y.code, y.index);
+        });
+    }
+
+    Diagnostics result;
+    result.reserve(size());
+    for (auto& entry : entries)
+        result.emplace_back(std::move((*this)[entry.index]));
+
+    *this = std::move(result);
 }
 
 Diagnostics Diagnostics::filter(std::initializer_list<DiagCode> list) const {
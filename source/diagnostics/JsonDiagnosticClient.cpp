@@ -0,0 +1,80 @@
+//------------------------------------------------------------------------------
+// JsonDiagnosticClient.cpp
+// Diagnostic client that streams one JSON record per diagnostic
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/diagnostics/JsonDiagnosticClient.h"
+
+#include <ostream>
+
+#include "slang/text/Json.h"
+#include "slang/text/SourceManager.h"
+
+namespace slang {
+
+static void writeLocation(JsonWriter& writer, const SourceManager& sm, SourceLocation loc) {
+    writer.writeProperty("file");
+    writer.writeValue(sm.getFileName(loc));
+    writer.writeProperty("line");
+    writer.writeValue(uint64_t(sm.getLineNumber(loc)));
+    writer.writeProperty("col");
+    writer.writeValue(uint64_t(sm.getColumnNumber(loc)));
+}
+
+void JsonDiagnosticClient::report(const ReportedDiagnostic& diag) {
+    // Each record gets its own writer so that nothing accumulates across
+    // diagnostics; the finished record is written and flushed immediately.
+    JsonWriter writer;
+    writer.startObject();
+
+    writer.writeProperty("severity");
+    writer.writeValue(getSeverityString(diag.severity));
+    writer.writeProperty("message");
+    writer.writeValue(diag.formattedMessage);
+
+    SourceLocation loc = diag.location;
+    const bool hasLocation = loc.buffer() != SourceLocation::NoLocation.buffer();
+    if (hasLocation)
+        writeLocation(writer, *sourceManager, loc);
+
+    auto optionName = engine->getOptionName(diag.originalDiagnostic.code);
+    if (!optionName.empty()) {
+        writer.writeProperty("option");
+        writer.writeValue(optionName);
+    }
+
+    if (includeSourceLine && hasLocation) {
+        size_t col = sourceManager->getColumnNumber(loc);
+        if (auto line = getSourceLine(loc, col); !line.empty()) {
+            writer.writeProperty("source");
+            writer.writeValue(line);
+        }
+    }
+
+    if (includeExpansion && !diag.expansionLocs.empty()) {
+        writer.writeProperty("expansion");
+        writer.startArray();
+        for (auto it = diag.expansionLocs.rbegin(); it != diag.expansionLocs.rend(); it++) {
+            SourceLocation expLoc = *it;
+            writer.startObject();
+            if (auto name = sourceManager->getMacroName(expLoc); !name.empty()) {
+                writer.writeProperty("macro");
+                writer.writeValue(name);
+            }
+            writeLocation(writer, *sourceManager, sourceManager->getFullyOriginalLoc(expLoc));
+            writer.endObject();
+        }
+        writer.endArray();
+    }
+
+    writer.endObject();
+
+    auto text = writer.view();
+    os.write(text.data(), std::streamsize(text.size()));
+    os.put('\n');
+    os.flush();
+}
+
+} // namespace slang
@@ -0,0 +1,36 @@
+//------------------------------------------------------------------------------
+// StreamingDiagnosticClient.cpp
+// Diagnostic client that streams one line per diagnostic
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/diagnostics/StreamingDiagnosticClient.h"
+
+#include <fmt/format.h>
+#include <ostream>
+
+#include "slang/text/SourceManager.h"
+
+namespace slang {
+
+void StreamingDiagnosticClient::report(const ReportedDiagnostic& diag) {
+    std::string line;
+    SourceLocation loc = diag.location;
+    if (loc.buffer() != SourceLocation::NoLocation.buffer()) {
+        line = fmt::format("{}:{}:{}: ", sourceManager->getFileName(loc),
+                           sourceManager->getLineNumber(loc),
+                           sourceManager->getColumnNumber(loc));
+    }
+
+    line += fmt::format("{}: {}", getSeverityString(diag.severity), diag.formattedMessage);
+
+    auto optionName = engine->getOptionName(diag.originalDiagnostic.code);
+    if (!optionName.empty())
+        line += fmt::format(" [-W{}]", optionName);
+
+    line += '\n';
+    os.write(line.data(), std::streamsize(line.size()));
+}
+
+} // namespace slang
@@ -8,7 +8,13 @@
 //------------------------------------------------------------------------------
 #include "slang/driver/Driver.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <fmt/color.h>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
 
 #include "slang/ast/Compilation.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
@@ -18,13 +24,18 @@
 #include "slang/diagnostics/LookupDiags.h"
 #include "slang/diagnostics/ParserDiags.h"
 #include "slang/diagnostics/StatementsDiags.h"
+#include "slang/diagnostics/JsonDiagnosticClient.h"
+#include "slang/diagnostics/StreamingDiagnosticClient.h"
 #include "slang/diagnostics/SysFuncsDiags.h"
 #include "slang/diagnostics/TextDiagnosticClient.h"
 #include "slang/parsing/Parser.h"
 #include "slang/parsing/Preprocessor.h"
+#include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxPrinter.h"
 #include "slang/syntax/SyntaxTree.h"
+#include "slang/text/Json.h"
 #include "slang/util/Random.h"
+#include "slang/util/ScopeGuard.h"
 #include "slang/util/String.h"
 #include "slang/util/ThreadPool.h"
 
@@ -83,9 +94,23 @@ void Driver::addStandardArgs() {
     cmdLine.add("--libraries-inherit-macros", options.librariesInheritMacros,
                 "If true, library files will inherit macro definitions from the primary source "
                 "files. --single-unit must also be passed when this option is used.");
+    cmdLine.add("--lazy-libraries", options.lazyLibraries,
+                "If true, library files are pre-scanned for the names of the declarations "
+                "they provide and are only fully parsed when one of those declarations is "
+                "actually referenced from the rest of the design. Declarations hidden "
+                "behind user-defined macros cause the file to be parsed eagerly.");
     cmdLine.add("--enable-legacy-protect", options.enableLegacyProtect,
                 "If true, the preprocessor will support legacy protected envelope directives, "
                 "for compatibility with old Verilog tools.");
+    cmdLine.add("--compact-whitespace-trivia", options.compactWhitespaceTrivia,
+                "If true, the lexer will canonicalize whitespace trivia on tokens instead "
+                "of recording the original text, which saves time and memory when the "
+                "trivia is never otherwise inspected");
+    cmdLine.add("--enable-macro-cache", options.enableMacroCache,
+                "If true, fully expanded macro usages will be cached and replayed for later "
+                "textually identical usages of the same macro, which can greatly speed up "
+                "heavily macro-based code at the cost of diagnostics in replayed expansions "
+                "pointing at the first such usage");
 
     // Legacy vendor commands support
     cmdLine.add(
@@ -109,8 +134,15 @@ void Driver::addStandardArgs() {
                 "Maximum number of errors that can occur during lexing before the rest of the file "
                 "is skipped",
                 "<count>");
+    cmdLine.add("--error-recovery-limit", options.errorRecoveryLimit,
+                "Maximum number of tokens to skip during parser error recovery in a single "
+                "member before scanning ahead to the next member boundary",
+                "<count>");
     cmdLine.add("-j,--threads", options.numThreads,
                 "The number of threads to use to parallelize parsing", "<count>");
+    cmdLine.add("--thread-affinity", options.threadAffinity,
+                "Pin worker threads to distinct CPUs; on multi-socket machines this "
+                "keeps each parallel job's memory local to the node running it");
 
     cmdLine.add(
         "-C",
@@ -146,9 +178,17 @@ void Driver::addStandardArgs() {
                 "Attempt to increase compatibility with the specified tool", "vcs");
     cmdLine.add("-T,--timing", options.minTypMax,
                 "Select which value to consider in min:typ:max expressions", "min|typ|max");
+    cmdLine.add("--elab-mode", options.elabMode,
+                "Select how deeply the design is elaborated; shallower modes "
+                "skip statement and expression binding for faster design queries",
+                "defs|skeleton|full");
     cmdLine.add("--timescale", options.timeScale,
                 "Default time scale to use for design elements that don't specify one explicitly",
                 "<base>/<precision>");
+    cmdLine.add("--hint-design-size", options.designSizeHint,
+                "Hint about the expected scale of the design, used to pre-size "
+                "compilation data structures",
+                "small|large");
 
     auto addCompFlag = [&](CompilationFlags flag, std::string_view name, std::string_view desc) {
         auto [it, inserted] = options.compilationFlags.emplace(flag, std::nullopt);
@@ -195,6 +235,23 @@ void Driver::addStandardArgs() {
                 "One or more top-level modules to instantiate "
                 "(instead of figuring it out automatically)",
                 "<name>", CommandLineFlags::CommaList);
+    cmdLine.add("--compile-per-top", options.compilePerTop,
+                "Elaborate and diagnose each --top module in its own isolated "
+                "compilation, sharing the parsed sources across all of them");
+    cmdLine.add("--elab-profile", options.elabProfile,
+                "Record per-top elaboration times to the given file and, when it "
+                "already exists from a previous run, use its times to start the "
+                "most expensive tops first during concurrent per-top compilation",
+                "<file>");
+    cmdLine.add("--shard-count", options.shardCount,
+                "Partition the top modules into this many disjoint shards so "
+                "that separate processes can each elaborate one subset of the "
+                "design; use together with --shard-index",
+                "<count>");
+    cmdLine.add("--shard-index", options.shardIndex,
+                "The zero-based index of the shard of top modules to elaborate "
+                "in this process when --shard-count is set",
+                "<index>");
     cmdLine.add("-G", options.paramOverrides,
                 "One or more parameter overrides to apply when "
                 "instantiating top-level modules",
@@ -223,6 +280,45 @@ void Driver::addStandardArgs() {
                 "Show macro expansion backtraces in diagnostic output.");
     cmdLine.add("--diag-hierarchy", options.diagHierarchy,
                 "Show hierarchy locations in diagnostic output.", "always|never|auto");
+    cmdLine.add("--diag-format", options.diagFormat,
+                "Control the diagnostic output format: 'text' (the default) prints "
+                "decorated diagnostics with source excerpts after collection, "
+                "'oneline' streams a single plain line per diagnostic to stderr as "
+                "it is issued, and 'json' streams one newline-delimited JSON record "
+                "per diagnostic to stderr as it is issued. For 'json' the source "
+                "line and macro expansion fields are off unless --diag-source or "
+                "--diag-macro-expansion is given explicitly.",
+                "text|oneline|json");
+    cmdLine.add("--result-file", options.resultFile,
+                "Write a compact binary summary of the compile (diagnostics, file "
+                "dependencies, top-level modules) to the given file for consumption "
+                "by build tooling",
+                "<file>");
+    cmdLine.add("--telemetry-file", options.telemetryFile,
+                "Write a structured JSON telemetry report (phase timings, memory "
+                "usage, cache statistics, diagnostic counts) to the given file "
+                "for ingestion by performance dashboards",
+                "<file>");
+    cmdLine.add("--mem-report", options.memReport,
+                "Print a report of memory usage by category (tokens, syntax nodes, "
+                "symbols, types, etc) after compilation finishes");
+    cmdLine.add("--progress", options.showProgress,
+                "Periodically report elaboration progress (current phase, instances "
+                "processed, live memory) to stderr while analysis runs");
+    cmdLine.add("--assertion-report", options.assertionReport,
+                "Print a report of sequence, property, and let declaration expansion "
+                "counts and nesting depths after compilation finishes, sorted by "
+                "expansion count");
+    cmdLine.add("--elab-cost-report", options.elabCostReport,
+                "Print a report of per-definition elaboration cost estimates (symbols "
+                "visited and instance counts) after compilation finishes, sorted by "
+                "symbols visited");
+    cmdLine.add("--memory-limit", options.memoryLimit,
+                "Soft limit in megabytes on the memory retained by parsed syntax "
+                "trees. When the parsed trees exceed the limit they are compacted "
+                "in place, largest first, to shed parse-time allocation slack "
+                "before elaboration begins.",
+                "<mb>");
     cmdLine.add("--error-limit", options.errorLimit,
                 "Limit on the number of errors that will be printed. Setting this to zero will "
                 "disable the limit.",
@@ -255,6 +351,15 @@ void Driver::addStandardArgs() {
     cmdLine.add("--single-unit", options.singleUnit,
                 "Treat all input files as a single compilation unit");
 
+    cmdLine.add("--enable-mmap", options.enableMemoryMapping,
+                "If true, source files will be memory mapped instead of copied into "
+                "allocated buffers, reducing peak memory usage for large designs");
+
+    cmdLine.add("--load-precompiled", options.loadPackages,
+                "Load library files from the given source package file, "
+                "previously written via the --precompile flow",
+                "<file>", CommandLineFlags::FilePath);
+
     cmdLine.add(
         "-v,--libfile",
         [this](std::string_view value) {
@@ -466,6 +571,12 @@ bool Driver::processOptions() {
         return false;
     }
 
+    if (options.elabMode.has_value() && options.elabMode != "defs" &&
+        options.elabMode != "skeleton" && options.elabMode != "full") {
+        printError(fmt::format("invalid value for elab-mode option: '{}'", *options.elabMode));
+        return false;
+    }
+
     if (options.diagHierarchy.has_value() && options.diagHierarchy != "always" &&
         options.diagHierarchy != "never" && options.diagHierarchy != "auto") {
         printError(
@@ -473,6 +584,12 @@ bool Driver::processOptions() {
         return false;
     }
 
+    if (options.diagFormat.has_value() && options.diagFormat != "text" &&
+        options.diagFormat != "oneline" && options.diagFormat != "json") {
+        printError(fmt::format("invalid value for diag-format option: '{}'", *options.diagFormat));
+        return false;
+    }
+
     if (options.librariesInheritMacros == true && !options.singleUnit.value_or(false)) {
         printError("--single-unit must be set when --libraries-inherit-macros is used");
         return false;
@@ -483,12 +600,39 @@ bool Driver::processOptions() {
         return false;
     }
 
+    if (options.designSizeHint.has_value() && options.designSizeHint != "small" &&
+        options.designSizeHint != "large") {
+        printError(fmt::format("invalid value for hint-design-size option: '{}'",
+                               *options.designSizeHint));
+        return false;
+    }
+
     if (options.lintMode()) {
         auto& opt = options.compilationFlags.at(CompilationFlags::IgnoreUnknownModules);
         if (!opt.has_value())
             opt = true;
     }
 
+    if (options.shardCount.has_value() != options.shardIndex.has_value()) {
+        printError("--shard-count and --shard-index must be used together");
+        return false;
+    }
+
+    if (options.shardCount.has_value()) {
+        if (*options.shardCount == 0) {
+            printError("--shard-count must be at least 1");
+            return false;
+        }
+        if (*options.shardIndex >= *options.shardCount) {
+            printError(fmt::format("--shard-index must be less than --shard-count ({})",
+                                   *options.shardCount));
+            return false;
+        }
+    }
+
+    for (auto& path : options.loadPackages)
+        sourceLoader.loadPackage(path);
+
     if (!reportLoadErrors())
         return false;
 
@@ -511,6 +655,24 @@ bool Driver::processOptions() {
     else if (options.diagHierarchy == "never")
         dc.showHierarchyInstance(ShowHierarchyPathOption::Never);
 
+    if (options.diagFormat == "oneline") {
+        // Replace the buffered text client entirely; diagnostics stream out
+        // as they are issued and the text client's buffer stays empty, so
+        // the later getString() printouts are harmless no-ops.
+        diagEngine.clearClients();
+        diagEngine.addClient(std::make_shared<StreamingDiagnosticClient>(std::cerr));
+    }
+    else if (options.diagFormat == "json") {
+        // As with oneline, but streaming NDJSON records. The expensive
+        // per-record fields default off here regardless of the text client
+        // defaults; structured consumers ask for them explicitly.
+        diagEngine.clearClients();
+        auto client = std::make_shared<JsonDiagnosticClient>(std::cerr);
+        client->showSourceLine(options.diagSourceLine.value_or(false));
+        client->showMacroExpansion(options.diagMacroExpansion.value_or(false));
+        diagEngine.addClient(std::move(client));
+    }
+
     diagEngine.setErrorLimit((int)options.errorLimit.value_or(20));
     diagEngine.setDefaultWarnings();
 
@@ -567,6 +729,12 @@ bool Driver::runPreprocessor(bool includeComments, bool includeDirectives, bool
     Bag optionBag;
     addParseOptions(optionBag);
 
+    // The preprocessed output is reconstructed from token trivia, so always
+    // record the full whitespace text here regardless of what the user asked for.
+    auto loptions = optionBag.getOrDefault<LexerOptions>();
+    loptions.compactWhitespaceTrivia = false;
+    optionBag.set(loptions);
+
     BumpAllocator alloc;
     Diagnostics diagnostics;
     Preprocessor preprocessor(sourceManager, alloc, diagnostics, optionBag);
@@ -589,6 +757,13 @@ bool Driver::runPreprocessor(bool includeComments, bool includeDirectives, bool
             rng = createRandomGenerator<std::mt19937>();
     }
 
+    // Stream the output in bounded chunks as tokens are printed rather than
+    // materializing all of it first; preprocessing a large unified compilation
+    // unit can otherwise require gigabytes of buffer. Note that this means a
+    // late error can leave partial output behind, but diagnostics still go to
+    // stderr and the exit code still reflects the failure.
+    static constexpr size_t MaxBufferedOutput = 1024 * 1024;
+
     while (true) {
         Token token = preprocessor.next();
         if (token.kind == TokenKind::IntegerBase) {
@@ -613,6 +788,9 @@ bool Driver::runPreprocessor(bool includeComments, bool includeDirectives, bool
         }
 
         output.print(token);
+        if (output.size() >= MaxBufferedOutput)
+            OS::print(output.extract());
+
         if (token.kind == TokenKind::EndOfFile)
             break;
     }
@@ -625,7 +803,8 @@ bool Driver::runPreprocessor(bool includeComments, bool includeDirectives, bool
         }
     }
 
-    OS::print(fmt::format("{}\n", output.str()));
+    OS::print(output.extract());
+    OS::print("\n"sv);
     return true;
 }
 
@@ -667,6 +846,12 @@ void Driver::reportMacros() {
 }
 
 bool Driver::parseAllSources() {
+    auto startTime = std::chrono::steady_clock::now();
+    auto recordTime = ScopeGuard([&] {
+        parseSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime)
+                           .count();
+    });
+
     Bag optionBag;
     addParseOptions(optionBag);
 
@@ -678,9 +863,110 @@ bool Driver::parseAllSources() {
     for (auto& diag : pragmaDiags)
         diagEngine.issue(diag);
 
+    if (options.memoryLimit.has_value())
+        enforceMemoryLimit();
+
+    if (options.shardCount.has_value() && !selectShardTops())
+        return false;
+
+    return true;
+}
+
+bool Driver::selectShardTops() {
+    // Every shard must arrive at the same partition independently, so the
+    // full list of tops is computed deterministically: the explicit --top
+    // list when one was given, otherwise the module and program declarations
+    // at the root of a compilation unit that are never instantiated by name
+    // anywhere in the design -- the same candidates top-level inference
+    // would produce during elaboration.
+    std::vector<std::string> allTops = options.topModules;
+    if (allTops.empty()) {
+        flat_hash_set<std::string_view> candidates;
+        for (auto& tree : syntaxTrees) {
+            if (tree->root().kind != SyntaxKind::CompilationUnit)
+                continue;
+
+            for (auto member : tree->root().as<CompilationUnitSyntax>().members) {
+                if (member->kind == SyntaxKind::ModuleDeclaration ||
+                    member->kind == SyntaxKind::ProgramDeclaration) {
+                    auto name = member->as<ModuleDeclarationSyntax>().header->name.valueText();
+                    if (!name.empty())
+                        candidates.emplace(name);
+                }
+            }
+        }
+
+        for (auto& tree : syntaxTrees) {
+            for (auto name : tree->getMetadata().globalInstances)
+                candidates.erase(name);
+        }
+
+        allTops.assign(candidates.begin(), candidates.end());
+    }
+    std::ranges::sort(allTops);
+
+    // Round-robin assignment by sorted position keeps shard sizes balanced
+    // to within one top.
+    std::vector<std::string> selected;
+    for (size_t i = *options.shardIndex; i < allTops.size(); i += *options.shardCount)
+        selected.push_back(std::move(allTops[i]));
+
+    if (selected.empty()) {
+        printError(fmt::format("shard {} of {} has no top modules to elaborate",
+                               *options.shardIndex, *options.shardCount));
+        return false;
+    }
+
+    options.topModules = std::move(selected);
     return true;
 }
 
+void Driver::enforceMemoryLimit() {
+    const uint64_t limitBytes = *options.memoryLimit * 1024 * 1024;
+
+    uint64_t total = 0;
+    for (auto& tree : syntaxTrees)
+        total += tree->allocator().liveBytes();
+
+    if (total <= limitBytes)
+        return;
+
+    // Compact the largest trees first; parse-time allocation slack (macro
+    // expansion scratch, partially filled allocator segments) tends to
+    // concentrate in the biggest files, so those yield the most memory back.
+    std::vector<size_t> order;
+    order.reserve(syntaxTrees.size());
+    for (size_t i = 0; i < syntaxTrees.size(); i++)
+        order.push_back(i);
+
+    std::ranges::sort(order, [this](size_t a, size_t b) {
+        return syntaxTrees[a]->allocator().liveBytes() >
+               syntaxTrees[b]->allocator().liveBytes();
+    });
+
+    for (size_t index : order) {
+        if (total <= limitBytes)
+            return;
+
+        auto& tree = syntaxTrees[index];
+        const size_t before = tree->allocator().liveBytes();
+        auto compacted = tree->compact();
+        const size_t after = compacted->allocator().liveBytes();
+
+        // Keep the compacted copy only if it's actually smaller.
+        if (after < before) {
+            tree = std::move(compacted);
+            total -= before - after;
+        }
+    }
+
+    if (total > limitBytes) {
+        printWarning(fmt::format("syntax trees still use {} MB after compaction, exceeding the "
+                                 "--memory-limit of {} MB",
+                                 total / (1024 * 1024), *options.memoryLimit));
+    }
+}
+
 Bag Driver::createOptionBag() const {
     Bag bag;
     addParseOptions(bag);
@@ -691,9 +977,12 @@ Bag Driver::createOptionBag() const {
 void Driver::addParseOptions(Bag& bag) const {
     SourceOptions soptions;
     soptions.numThreads = options.numThreads;
+    soptions.threadAffinity = options.threadAffinity == true;
     soptions.singleUnit = options.singleUnit == true;
     soptions.onlyLint = options.lintMode();
     soptions.librariesInheritMacros = options.librariesInheritMacros == true;
+    soptions.lazyLibraries = options.lazyLibraries == true;
+    soptions.enableMemoryMapping = options.enableMemoryMapping == true;
 
     PreprocessorOptions ppoptions;
     ppoptions.predefines = options.defines;
@@ -704,10 +993,12 @@ void Driver::addParseOptions(Bag& bag) const {
         ppoptions.maxIncludeDepth = *options.maxIncludeDepth;
     for (const auto& d : options.ignoreDirectives)
         ppoptions.ignoreDirectives.emplace(d);
+    ppoptions.enableMacroCache = options.enableMacroCache == true;
 
     LexerOptions loptions;
     loptions.languageVersion = languageVersion;
     loptions.enableLegacyProtect = options.enableLegacyProtect == true;
+    loptions.compactWhitespaceTrivia = options.compactWhitespaceTrivia == true;
     if (options.maxLexerErrors.has_value())
         loptions.maxErrors = *options.maxLexerErrors;
 
@@ -715,6 +1006,8 @@ void Driver::addParseOptions(Bag& bag) const {
     poptions.languageVersion = languageVersion;
     if (options.maxParseDepth.has_value())
         poptions.maxRecursionDepth = *options.maxParseDepth;
+    if (options.errorRecoveryLimit.has_value())
+        poptions.errorRecoveryLimit = *options.errorRecoveryLimit;
 
     bag.set(soptions);
     bag.set(ppoptions);
@@ -765,13 +1058,37 @@ void Driver::addCompilationOptions(Bag& bag) const {
             coptions.minTypMax = MinTypMax::Max;
     }
 
+    if (options.elabMode.has_value()) {
+        if (options.elabMode == "defs")
+            coptions.elaborationMode = ElaborationMode::DefinitionsOnly;
+        else if (options.elabMode == "skeleton")
+            coptions.elaborationMode = ElaborationMode::HierarchySkeleton;
+        else if (options.elabMode == "full")
+            coptions.elaborationMode = ElaborationMode::Full;
+    }
+
     if (options.timeScale.has_value())
         coptions.defaultTimeScale = TimeScale::fromString(*options.timeScale);
 
+    if (options.designSizeHint == "small")
+        coptions.expectedDesignElements = 64;
+    else if (options.designSizeHint == "large")
+        coptions.expectedDesignElements = 16384;
+    else {
+        // No explicit hint; derive a rough estimate from the number of
+        // source files that have been added to the loader.
+        coptions.expectedDesignElements =
+            uint32_t(std::min<size_t>(sourceLoader.getFileCount() * 2, 16384));
+    }
+
     bag.set(coptions);
 }
 
 std::unique_ptr<Compilation> Driver::createCompilation() {
+    return createCompilation(createOptionBag());
+}
+
+std::unique_ptr<Compilation> Driver::createCompilation(Bag&& optionBag) {
     SourceLibrary* defaultLib;
     if (options.defaultLibName && !options.defaultLibName->empty())
         defaultLib = sourceLoader.getOrAddLibrary(*options.defaultLibName);
@@ -781,7 +1098,7 @@ std::unique_ptr<Compilation> Driver::createCompilation() {
     SLANG_ASSERT(defaultLib);
     defaultLib->isDefault = true;
 
-    auto compilation = std::make_unique<Compilation>(createOptionBag(), defaultLib);
+    auto compilation = std::make_unique<Compilation>(std::move(optionBag), defaultLib);
     for (auto& tree : sourceLoader.getLibraryMaps())
         compilation->addSyntaxTree(tree);
     for (auto& tree : syntaxTrees)
@@ -790,6 +1107,19 @@ std::unique_ptr<Compilation> Driver::createCompilation() {
     return compilation;
 }
 
+void Driver::runParameterSweep(std::span<const std::vector<std::string>> sweepPoints,
+                               function_ref<void(size_t, Compilation&)> callback) {
+    for (size_t i = 0; i < sweepPoints.size(); i++) {
+        Bag bag = createOptionBag();
+        CompilationOptions coptions = bag.getOrDefault<CompilationOptions>();
+        coptions.paramOverrides.assign(sweepPoints[i].begin(), sweepPoints[i].end());
+        bag.set(coptions);
+
+        auto compilation = createCompilation(std::move(bag));
+        callback(i, *compilation);
+    }
+}
+
 bool Driver::reportParseDiags() {
     Diagnostics diags;
     for (auto& tree : sourceLoader.getLibraryMaps())
@@ -805,6 +1135,49 @@ bool Driver::reportParseDiags() {
     return diagEngine.getNumErrors() == 0;
 }
 
+// Periodically prints elaboration progress to stderr while a long analysis
+// call runs on the constructing thread. The compilation publishes progress
+// through atomic counters, so sampling them from here is safe.
+namespace {
+
+class ProgressReporter {
+public:
+    ProgressReporter(const Compilation& compilation, bool enabled) {
+        if (!enabled)
+            return;
+
+        thread = std::thread([&compilation, this] {
+            std::unique_lock lock(mutex);
+            while (!cv.wait_for(lock, std::chrono::seconds(2), [this] { return done; })) {
+                auto& progress = compilation.getProgress();
+                OS::printE(fmt::format(
+                    "[analysis] {}: {} instances, {:.1f} MB\n", progress.phaseName(),
+                    progress.instancesProcessed.load(std::memory_order_relaxed),
+                    progress.liveBytes.load(std::memory_order_relaxed) / (1024.0 * 1024.0)));
+            }
+        });
+    }
+
+    ~ProgressReporter() {
+        if (thread.joinable()) {
+            {
+                std::scoped_lock lock(mutex);
+                done = true;
+            }
+            cv.notify_all();
+            thread.join();
+        }
+    }
+
+private:
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+};
+
+} // namespace
+
 bool Driver::reportCompilation(Compilation& compilation, bool quiet) {
     if (!quiet) {
         auto topInstances = compilation.getRoot().topInstances;
@@ -816,8 +1189,15 @@ bool Driver::reportCompilation(Compilation& compilation, bool quiet) {
         }
     }
 
-    for (auto& diag : compilation.getAllDiagnostics())
-        diagEngine.issue(diag);
+    {
+        auto startTime = std::chrono::steady_clock::now();
+        ProgressReporter reporter(compilation, options.showProgress == true);
+        for (auto& diag : compilation.getAllDiagnostics())
+            diagEngine.issue(diag);
+
+        elabSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime)
+                          .count();
+    }
 
     bool succeeded = diagEngine.getNumErrors() == 0;
 
@@ -839,9 +1219,359 @@ bool Driver::reportCompilation(Compilation& compilation, bool quiet) {
                               diagEngine.getNumWarnings() == 1 ? "" : "s"));
     }
 
+    if (options.memReport == true) {
+        auto stats = compilation.getMemoryStats();
+        auto printLine = [](std::string_view name, size_t bytes) {
+            OS::print(fmt::format("    {:<14}{:>12} bytes\n", name, bytes));
+        };
+
+        OS::print("\nMemory usage:\n");
+        printLine("tokens", stats.tokens);
+        printLine("trivia", stats.trivia);
+        printLine("syntax nodes", stats.syntaxNodes);
+        printLine("symbols", stats.symbols);
+        printLine("types", stats.types);
+        printLine("constants", stats.constants);
+        printLine("other", stats.other);
+        printLine("total live", stats.liveBytes);
+    }
+
+    if (options.assertionReport == true) {
+        auto& stats = compilation.getAssertionExpansionStats();
+        std::vector<std::pair<const Symbol*, Compilation::AssertionExpansionStats>> sorted(
+            stats.begin(), stats.end());
+        std::ranges::sort(sorted, [](auto& a, auto& b) {
+            if (a.second.count != b.second.count)
+                return a.second.count > b.second.count;
+            return a.first->name < b.first->name;
+        });
+
+        OS::print("\nAssertion expansions:\n");
+        OS::print(fmt::format("    {:<30}{:>12}{:>12}\n", "name", "count", "max depth"));
+        for (auto& [symbol, stat] : sorted) {
+            OS::print(
+                fmt::format("    {:<30}{:>12}{:>12}\n", symbol->name, stat.count, stat.maxDepth));
+        }
+    }
+
+    if (options.elabCostReport == true) {
+        auto& stats = compilation.getElaborationCostStats();
+        std::vector<std::pair<const DefinitionSymbol*, Compilation::ElaborationCostStats>> sorted(
+            stats.begin(), stats.end());
+        std::ranges::sort(sorted, [](auto& a, auto& b) {
+            if (a.second.symbolsVisited != b.second.symbolsVisited)
+                return a.second.symbolsVisited > b.second.symbolsVisited;
+            return a.first->name < b.first->name;
+        });
+
+        OS::print("\nElaboration costs:\n");
+        OS::print(fmt::format("    {:<30}{:>16}{:>12}\n", "name", "symbols visited", "instances"));
+        for (auto& [def, stat] : sorted) {
+            OS::print(fmt::format("    {:<30}{:>16}{:>12}\n", def->name, stat.symbolsVisited,
+                                  stat.instanceCount));
+        }
+    }
+
     return succeeded;
 }
 
+bool Driver::reportPerTopCompilations(bool quiet) {
+    if (options.topModules.size() <= 1) {
+        auto compilation = createCompilation();
+        return reportCompilation(*compilation, quiet);
+    }
+
+    // Build one compilation per requested top. All of them share the parsed
+    // (immutable) syntax trees, so shared libraries and packages are parsed
+    // only once for the whole batch; each compilation then elaborates just
+    // the hierarchy its own top actually uses.
+    std::vector<std::unique_ptr<Compilation>> compilations;
+    compilations.reserve(options.topModules.size());
+    for (auto& top : options.topModules) {
+        Bag bag = createOptionBag();
+        CompilationOptions coptions = bag.getOrDefault<CompilationOptions>();
+        coptions.topModules.clear();
+        coptions.topModules.emplace(top);
+        bag.set(coptions);
+        compilations.push_back(createCompilation(std::move(bag)));
+    }
+
+    // When a profile from a previous run is available, submit the most
+    // expensive tops first. With more tops than worker threads this is the
+    // classic longest-processing-time heuristic: starting the long
+    // elaborations immediately keeps them off the tail of the schedule.
+    // Tops without a recorded time are assumed expensive and go first.
+    std::vector<size_t> schedule;
+    schedule.reserve(compilations.size());
+    for (size_t i = 0; i < compilations.size(); i++)
+        schedule.push_back(i);
+
+    if (options.elabProfile.has_value()) {
+        flat_hash_map<std::string, uint64_t> profile;
+        std::ifstream in(fs::path(*options.elabProfile));
+        std::string name;
+        uint64_t millis;
+        while (in >> name >> millis)
+            profile[name] = millis;
+
+        if (!profile.empty()) {
+            auto costOf = [&](size_t i) {
+                auto it = profile.find(options.topModules[i]);
+                return it == profile.end() ? UINT64_MAX : it->second;
+            };
+            std::ranges::stable_sort(schedule,
+                                     [&](size_t a, size_t b) { return costOf(a) > costOf(b); });
+        }
+    }
+
+    // Force full elaboration of each design concurrently. The compilations
+    // are isolated from each other; the only state the workers share is the
+    // source manager and the syntax trees, which are no longer mutated.
+    std::vector<std::future<void>> futures(compilations.size());
+    std::vector<uint64_t> elapsed(compilations.size());
+    ThreadPool threadPool(options.numThreads.value_or(0u),
+                          options.threadAffinity.value_or(false));
+    for (size_t index : schedule) {
+        futures[index] = threadPool.submit(
+            [&comp = compilations[index], &millis = elapsed[index]] {
+                auto start = std::chrono::steady_clock::now();
+                comp->getAllDiagnostics();
+                millis = uint64_t(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                      std::chrono::steady_clock::now() - start)
+                                      .count());
+            });
+    }
+
+    // Report serially in the order the tops were given; getting each future
+    // rethrows any exception from the corresponding worker. Counts are reset
+    // between tops so each report looks like a standalone run of that top.
+    bool ok = true;
+    for (size_t i = 0; i < compilations.size(); i++) {
+        futures[i].get();
+        if (i != 0) {
+            diagEngine.clearCounts();
+            diagClient->clear();
+        }
+        ok &= reportCompilation(*compilations[i], quiet);
+    }
+
+    if (options.elabProfile.has_value()) {
+        std::ofstream out(fs::path(*options.elabProfile));
+        for (size_t i = 0; i < compilations.size(); i++)
+            out << options.topModules[i] << ' ' << elapsed[i] << '\n';
+        if (!out) {
+            printWarning(
+                fmt::format("unable to write elaboration profile to '{}'", *options.elabProfile));
+        }
+    }
+
+    return ok;
+}
+
+bool Driver::writeResultFile(ast::Compilation& compilation, const fs::path& path) {
+    // Layout (integers are native-endian):
+    //   header:  "SVCR" magic, uint32 version,
+    //            uint32 numFiles, uint32 numDiags, uint32 numTops,
+    //            uint64 stringTableOffset, uint64 stringTableSize
+    //   files:   { uint32 pathOff, uint32 pathLen, uint32 includedFrom,
+    //              uint32 libOff, uint32 libLen } per file, where includedFrom
+    //            is the index of the including file or ~0 for none
+    //   diags:   { uint32 code, uint32 severity, uint32 file, uint32 line,
+    //              uint32 column, uint32 msgOff, uint32 msgLen } per diagnostic,
+    //            where code packs the subsystem in the upper 16 bits and
+    //            file is ~0 if the diagnostic has no source location
+    //   tops:    { uint32 nameOff, uint32 nameLen } per top-level instance
+    //   strings: the raw character data referenced by the records above
+    std::string stringTable;
+    auto addString = [&](std::string_view str) {
+        auto offset = uint32_t(stringTable.size());
+        stringTable.append(str);
+        return std::pair{offset, uint32_t(str.size())};
+    };
+
+    struct FileRecord {
+        uint32_t pathOff, pathLen, includedFrom, libOff, libLen;
+    };
+    struct DiagRecord {
+        uint32_t code, severity, file, line, column, msgOff, msgLen;
+    };
+    struct TopRecord {
+        uint32_t nameOff, nameLen;
+    };
+
+    auto& sm = sourceManager;
+    std::vector<FileRecord> files;
+    flat_hash_map<uint32_t, uint32_t> fileIndexMap;
+
+    auto buffers = sm.getAllBuffers();
+    for (auto buf : buffers) {
+        if (sm.isMacroLoc(SourceLocation(buf, 0)))
+            continue;
+
+        auto [pathOff, pathLen] = addString(sm.getRawFileName(buf));
+        uint32_t libOff = 0, libLen = 0;
+        if (auto lib = sm.getLibraryFor(buf))
+            std::tie(libOff, libLen) = addString(lib->name);
+
+        fileIndexMap[buf.getId()] = uint32_t(files.size());
+        files.push_back({pathOff, pathLen, UINT32_MAX, libOff, libLen});
+    }
+
+    // Resolve include parents now that every file has an index.
+    size_t fileIndex = 0;
+    for (auto buf : buffers) {
+        if (sm.isMacroLoc(SourceLocation(buf, 0)))
+            continue;
+
+        if (auto incLoc = sm.getIncludedFrom(buf); incLoc != SourceLocation()) {
+            if (auto it = fileIndexMap.find(incLoc.buffer().getId()); it != fileIndexMap.end())
+                files[fileIndex].includedFrom = it->second;
+        }
+        fileIndex++;
+    }
+
+    std::vector<DiagRecord> diags;
+    for (auto& diag : compilation.getAllDiagnostics()) {
+        DiagRecord rec{};
+        rec.code = (uint32_t(diag.code.getSubsystem()) << 16) | diag.code.getCode();
+        rec.severity = uint32_t(diagEngine.getSeverity(diag.code, diag.location));
+        rec.file = UINT32_MAX;
+
+        if (diag.location != SourceLocation()) {
+            auto loc = sm.getFullyOriginalLoc(diag.location);
+            if (auto it = fileIndexMap.find(loc.buffer().getId()); it != fileIndexMap.end()) {
+                rec.file = it->second;
+                rec.line = uint32_t(sm.getLineNumber(loc));
+                rec.column = uint32_t(sm.getColumnNumber(loc));
+            }
+        }
+
+        std::tie(rec.msgOff, rec.msgLen) = addString(diagEngine.formatMessage(diag));
+        diags.push_back(rec);
+    }
+
+    std::vector<TopRecord> tops;
+    for (auto inst : compilation.getRoot().topInstances) {
+        auto [nameOff, nameLen] = addString(inst->name);
+        tops.push_back({nameOff, nameLen});
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    auto writeInt = [&](auto value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    constexpr uint64_t HeaderSize = 4 + 4 * sizeof(uint32_t) + 2 * sizeof(uint64_t);
+    out.write("SVCR", 4);
+    writeInt(uint32_t(1));
+    writeInt(uint32_t(files.size()));
+    writeInt(uint32_t(diags.size()));
+    writeInt(uint32_t(tops.size()));
+    writeInt(HeaderSize + files.size() * 5 * sizeof(uint32_t) +
+             diags.size() * 7 * sizeof(uint32_t) + tops.size() * 2 * sizeof(uint32_t));
+    writeInt(uint64_t(stringTable.size()));
+
+    for (auto& rec : files) {
+        writeInt(rec.pathOff);
+        writeInt(rec.pathLen);
+        writeInt(rec.includedFrom);
+        writeInt(rec.libOff);
+        writeInt(rec.libLen);
+    }
+
+    for (auto& rec : diags) {
+        writeInt(rec.code);
+        writeInt(rec.severity);
+        writeInt(rec.file);
+        writeInt(rec.line);
+        writeInt(rec.column);
+        writeInt(rec.msgOff);
+        writeInt(rec.msgLen);
+    }
+
+    for (auto& rec : tops) {
+        writeInt(rec.nameOff);
+        writeInt(rec.nameLen);
+    }
+
+    out.write(stringTable.data(), std::streamsize(stringTable.size()));
+
+    if (!out.flush()) {
+        printError(fmt::format("unable to write result file to '{}'", getU8Str(path)));
+        return false;
+    }
+    return true;
+}
+
+bool Driver::writeTelemetry(ast::Compilation& compilation, const fs::path& path) {
+    JsonWriter json;
+    json.setPrettyPrint(true);
+    json.startObject();
+
+    json.writeProperty("timings");
+    json.startObject();
+    json.writeProperty("parseSeconds");
+    json.writeValue(parseSeconds);
+    json.writeProperty("elabSeconds");
+    json.writeValue(elabSeconds);
+    json.endObject();
+
+    json.writeProperty("diagnostics");
+    json.startObject();
+    json.writeProperty("errors");
+    json.writeValue(uint64_t(diagEngine.getNumErrors()));
+    json.writeProperty("warnings");
+    json.writeValue(uint64_t(diagEngine.getNumWarnings()));
+    json.endObject();
+
+    auto memStats = compilation.getMemoryStats();
+    json.writeProperty("memoryBytes");
+    json.startObject();
+    auto writeMem = [&](std::string_view name, size_t bytes) {
+        json.writeProperty(name);
+        json.writeValue(uint64_t(bytes));
+    };
+    writeMem("tokens", memStats.tokens);
+    writeMem("trivia", memStats.trivia);
+    writeMem("syntaxNodes", memStats.syntaxNodes);
+    writeMem("symbols", memStats.symbols);
+    writeMem("types", memStats.types);
+    writeMem("constants", memStats.constants);
+    writeMem("other", memStats.other);
+    writeMem("totalLive", memStats.liveBytes);
+    json.endObject();
+
+    auto cacheStats = compilation.getCacheStats();
+    json.writeProperty("caches");
+    json.startObject();
+    auto writeCache = [&](std::string_view name, const Compilation::CacheStats::Entry& entry) {
+        json.writeProperty(name);
+        json.startObject();
+        json.writeProperty("entries");
+        json.writeValue(uint64_t(entry.entries));
+        json.writeProperty("hits");
+        json.writeValue(uint64_t(entry.hits));
+        json.endObject();
+    };
+    writeCache("memoizedCalls", cacheStats.memoizedCalls);
+    writeCache("ifaceConns", cacheStats.ifaceConns);
+    writeCache("portConns", cacheStats.portConns);
+    writeCache("typeCompat", cacheStats.typeCompat);
+    writeCache("timingControls", cacheStats.timingControls);
+    writeCache("lookupMisses", cacheStats.lookupMisses);
+    json.endObject();
+
+    json.endObject();
+
+    std::ofstream out(path);
+    out << json.view() << '\n';
+    if (!out.flush()) {
+        printError(fmt::format("unable to write telemetry to '{}'", getU8Str(path)));
+        return false;
+    }
+    return true;
+}
+
 bool Driver::parseUnitListing(std::string_view text) {
     CommandLine unitCmdLine;
     std::vector<std::string> includes;
@@ -8,10 +8,12 @@
 #include "slang/driver/SourceLoader.h"
 
 #include <fmt/core.h>
+#include <fstream>
 
 #include "slang/parsing/Preprocessor.h"
 #include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxTree.h"
+#include "slang/text/CharInfo.h"
 #include "slang/text/SourceManager.h"
 #include "slang/util/String.h"
 #include "slang/util/ThreadPool.h"
@@ -167,10 +169,270 @@ std::vector<SourceBuffer> SourceLoader::loadSources() {
     return results;
 }
 
+static constexpr std::string_view PackageMagic = "SVPK"sv;
+static constexpr uint32_t PackageVersion = 1;
+
+bool SourceLoader::writePackage(const fs::path& path) {
+    // Read everything up front so that a failed load doesn't
+    // leave a truncated package behind.
+    struct PackageEntry {
+        std::string libName;
+        std::string pathStr;
+        std::string_view contents;
+    };
+
+    std::vector<PackageEntry> packageEntries;
+    packageEntries.reserve(fileEntries.size());
+
+    bool ok = true;
+    for (auto& entry : fileEntries) {
+        if (entry.unit) {
+            errors.emplace_back(fmt::format("'{}': files in separate compilation units "
+                                            "cannot be placed in a source package",
+                                            getU8Str(entry.path)));
+            ok = false;
+            continue;
+        }
+
+        auto buffer = sourceManager.readSource(entry.path, entry.library);
+        if (!buffer) {
+            addError(entry.path, buffer.error());
+            ok = false;
+            continue;
+        }
+
+        packageEntries.push_back({entry.library ? std::string(entry.library->name) : std::string(),
+                                  getU8Str(entry.path), buffer->data});
+    }
+
+    if (!ok)
+        return false;
+
+    std::ofstream out(path, std::ios::binary);
+    auto writeInt = [&](auto value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto writeStr = [&](std::string_view str) {
+        writeInt(uint64_t(str.size()));
+        out.write(str.data(), std::streamsize(str.size()));
+    };
+
+    out.write(PackageMagic.data(), std::streamsize(PackageMagic.size()));
+    writeInt(PackageVersion);
+    writeInt(uint64_t(packageEntries.size()));
+
+    for (auto& entry : packageEntries) {
+        writeStr(entry.libName);
+        writeStr(entry.pathStr);
+        writeStr(entry.contents);
+    }
+
+    if (!out.flush()) {
+        addError(path, std::make_error_code(std::errc::io_error));
+        return false;
+    }
+    return true;
+}
+
+bool SourceLoader::loadPackage(const fs::path& path) {
+    std::error_code ec;
+    std::ifstream in(path, std::ios::binary);
+    std::string contents;
+    if (in) {
+        in.seekg(0, std::ios::end);
+        contents.resize(size_t(in.tellg()));
+        in.seekg(0);
+        in.read(contents.data(), std::streamsize(contents.size()));
+    }
+
+    if (!in) {
+        addError(path, std::make_error_code(std::errc::io_error));
+        return false;
+    }
+
+    size_t offset = 0;
+    bool valid = true;
+    auto readInt = [&](auto& value) {
+        if (offset + sizeof(value) > contents.size()) {
+            valid = false;
+            value = {};
+        }
+        else {
+            memcpy(&value, contents.data() + offset, sizeof(value));
+            offset += sizeof(value);
+        }
+    };
+    auto readStr = [&]() -> std::string_view {
+        uint64_t len = 0;
+        readInt(len);
+        if (len > contents.size() - offset) {
+            valid = false;
+            return {};
+        }
+        auto result = std::string_view(contents).substr(offset, size_t(len));
+        offset += size_t(len);
+        return result;
+    };
+
+    uint32_t version = 0;
+    uint64_t count = 0;
+    valid = contents.size() >= PackageMagic.size() &&
+            std::string_view(contents).starts_with(PackageMagic);
+    offset = PackageMagic.size();
+    readInt(version);
+    readInt(count);
+
+    if (!valid || version != PackageVersion) {
+        errors.emplace_back(fmt::format("'{}': not a valid source package", getU8Str(path)));
+        return false;
+    }
+
+    std::vector<SourceBuffer> newBuffers;
+    newBuffers.reserve(size_t(count));
+
+    for (uint64_t i = 0; i < count; i++) {
+        auto libName = readStr();
+        auto pathStr = readStr();
+        auto text = readStr();
+        if (!valid) {
+            errors.emplace_back(fmt::format("'{}': source package is truncated or corrupted",
+                                            getU8Str(path)));
+            return false;
+        }
+
+        auto library = getOrAddLibrary(libName);
+        newBuffers.push_back(sourceManager.assignText(pathStr, text, {}, library));
+    }
+
+    packageBuffers.insert(packageBuffers.end(), newBuffers.begin(), newBuffers.end());
+    return true;
+}
+
+// Cheaply scans raw source text for the names of the design elements, packages,
+// and classes it declares, without preprocessing or parsing it. Returns false
+// if the scan can't be sure it found every declaration -- for example because
+// the file expands user-defined macros at file scope -- in which case the
+// caller should fall back to parsing the file eagerly.
+static bool scanDeclarationNames(std::string_view text, SmallVectorBase<std::string_view>& names) {
+    // Directives that cannot introduce declarations themselves; seeing one of
+    // these doesn't invalidate the scan, but any other macro usage might
+    // expand to anything at all.
+    static const flat_hash_set<std::string_view> BenignDirectives = {
+        "begin_keywords"sv,    "celldefine"sv,          "default_nettype"sv,
+        "define"sv,            "else"sv,                "elsif"sv,
+        "end_keywords"sv,      "endcelldefine"sv,       "endif"sv,
+        "ifdef"sv,             "ifndef"sv,              "include"sv,
+        "line"sv,              "nounconnected_drive"sv, "pragma"sv,
+        "resetall"sv,          "timescale"sv,           "unconnected_drive"sv,
+        "undef"sv,             "undefineall"sv};
+
+    static const flat_hash_set<std::string_view> DeclKeywords = {
+        "checker"sv, "class"sv,   "config"sv,  "interface"sv, "macromodule"sv,
+        "module"sv,  "package"sv, "primitive"sv, "program"sv};
+
+    size_t i = 0;
+    const size_t len = text.size();
+
+    auto skipToEndOfLine = [&] {
+        while (i < len && !isNewline(text[i]))
+            i++;
+    };
+    auto readWord = [&] {
+        size_t start = i;
+        while (i < len && (isValidCIdChar(text[i]) || text[i] == '$'))
+            i++;
+        return text.substr(start, i - start);
+    };
+
+    // Reads the next token-ish thing, skipping whitespace and comments.
+    // Returns an identifier or keyword if one is next, an empty view at
+    // end of text, and "\0" for anything else (including macro usages).
+    auto nextWord = [&]() -> std::string_view {
+        while (i < len) {
+            char c = text[i];
+            if (c == '/' && i + 1 < len && text[i + 1] == '/') {
+                skipToEndOfLine();
+            }
+            else if (c == '/' && i + 1 < len && text[i + 1] == '*') {
+                i += 2;
+                while (i + 1 < len && !(text[i] == '*' && text[i + 1] == '/'))
+                    i++;
+                i = std::min(i + 2, len);
+            }
+            else if (isValidCIdChar(c) && !isDecimalDigit(c)) {
+                return readWord();
+            }
+            else if (c == '\\') {
+                // Escaped identifier; extends until whitespace.
+                size_t start = i++;
+                while (i < len && !isWhitespace(text[i]))
+                    i++;
+                return text.substr(start, i - start);
+            }
+            else if (isWhitespace(c)) {
+                i++;
+            }
+            else {
+                return "\0"sv;
+            }
+        }
+        return {};
+    };
+
+    while (i < len) {
+        char c = text[i];
+        if (c == '/' && i + 1 < len && text[i + 1] == '/') {
+            skipToEndOfLine();
+        }
+        else if (c == '/' && i + 1 < len && text[i + 1] == '*') {
+            i += 2;
+            while (i + 1 < len && !(text[i] == '*' && text[i + 1] == '/'))
+                i++;
+            i = std::min(i + 2, len);
+        }
+        else if (c == '"') {
+            i++;
+            while (i < len && text[i] != '"') {
+                if (text[i] == '\\')
+                    i++;
+                if (i < len)
+                    i++;
+            }
+            i++;
+        }
+        else if (c == '`') {
+            i++;
+            if (BenignDirectives.find(readWord()) == BenignDirectives.end())
+                return false;
+        }
+        else if (isValidCIdChar(c) && !isDecimalDigit(c)) {
+            if (DeclKeywords.find(readWord()) != DeclKeywords.end()) {
+                auto name = nextWord();
+
+                // Skip over lifetime specifiers and the "class" in
+                // "interface class" to get to the actual name.
+                while (name == "static"sv || name == "automatic"sv || name == "class"sv)
+                    name = nextWord();
+
+                if (name.empty() || name == "\0"sv)
+                    return false;
+
+                names.push_back(name);
+            }
+        }
+        else {
+            i++;
+        }
+    }
+
+    return true;
+}
+
 SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& optionBag) {
     SyntaxTreeList syntaxTrees;
     std::vector<SourceBuffer> singleUnitBuffers;
     std::vector<SourceBuffer> deferredLibBuffers;
+    std::vector<SourceBuffer> lazyLibBuffers;
     std::span<const DefineDirectiveSyntax* const> inheritedMacros;
     flat_hash_map<const UnitEntry*, std::vector<SourceBuffer>> unitToBufferMap;
 
@@ -180,6 +442,7 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
     deferredLibBuffers.reserve(fileEntryCount);
 
     auto srcOptions = optionBag.getOrDefault<SourceOptions>();
+    sourceManager.setEnableMemoryMapping(srcOptions.enableMemoryMapping);
 
     auto handleLoadResult = [&](LoadResult&& result) {
         switch (result.index()) {
@@ -191,10 +454,12 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
                 // File was loaded but it's a library file and we
                 // need to wait to include it in a parse operation.
                 auto [buffer, isDeferredLib] = std::get<1>(result);
-                if (isDeferredLib)
-                    deferredLibBuffers.push_back(buffer);
-                else
+                if (!isDeferredLib)
                     singleUnitBuffers.push_back(buffer);
+                else if (srcOptions.lazyLibraries)
+                    lazyLibBuffers.push_back(buffer);
+                else
+                    deferredLibBuffers.push_back(buffer);
                 break;
             }
             case 2: {
@@ -239,19 +504,50 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
     };
 
     if (fileEntries.size() >= MinFilesForThreading && srcOptions.numThreads != 1u) {
+        // Cold-cache file loads are latency-bound rather than CPU-bound, so
+        // for large file lists start with a read-ahead pass that issues the
+        // reads through a much wider pool than the parser below will use.
+        // Each read lands in the source manager's buffer cache -- the final
+        // storage the parse tasks consume it from -- so the reads here are
+        // pure prefetch and any errors are ignored; the parse tasks repeat
+        // the (now cached) lookup and report failures through the usual path.
+        if (fileEntries.size() >= MinFilesForReadAhead) {
+            size_t ioThreads = std::min(MaxReadAheadThreads, fileEntries.size());
+            if (srcOptions.numThreads)
+                ioThreads = std::min(ioThreads, size_t(*srcOptions.numThreads));
+
+            ThreadPool ioPool{unsigned(ioThreads)};
+            ioPool.pushLoop(
+                size_t(0), fileEntries.size(),
+                [&](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        (void)sourceManager.readSource(fileEntries[i].path,
+                                                       fileEntries[i].library, i);
+                    }
+                },
+                fileEntries.size());
+            ioPool.waitForAll();
+        }
+
         // If there are enough files to parse and the user hasn't disabled
         // the use of threads, do the parsing via a thread pool.
-        ThreadPool threadPool(srcOptions.numThreads.value_or(0u));
+        ThreadPool threadPool(srcOptions.numThreads.value_or(0u), srcOptions.threadAffinity);
 
         std::vector<LoadResult> loadResults;
         loadResults.resize(fileEntries.size());
 
         // Load all source files that were specified on the command line
-        // or via library maps.
-        threadPool.pushLoop(size_t(0), fileEntries.size(), [&](size_t start, size_t end) {
-            for (size_t i = start; i < end; i++)
-                loadResults[i] = loadAndParse(fileEntries[i], optionBag, srcOptions, i);
-        });
+        // or via library maps. Use one task per file rather than one block
+        // per thread so that a file that's slow to come back from the
+        // filesystem only stalls its own task; the other workers keep
+        // loading and parsing instead of idling behind it.
+        threadPool.pushLoop(
+            size_t(0), fileEntries.size(),
+            [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; i++)
+                    loadResults[i] = loadAndParse(fileEntries[i], optionBag, srcOptions, i);
+            },
+            fileEntries.size());
         threadPool.waitForAll();
 
         for (auto&& result : loadResults)
@@ -269,12 +565,15 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
             const size_t numTrees = syntaxTrees.size();
             syntaxTrees.resize(numTrees + unitList.size());
 
-            threadPool.pushLoop(size_t(0), unitList.size(), [&](size_t start, size_t end) {
-                for (size_t i = start; i < end; i++) {
-                    syntaxTrees[i + numTrees] = parseSeparateUnit(*unitList[i]->first,
-                                                                  unitList[i]->second);
-                }
-            });
+            threadPool.pushLoop(
+                size_t(0), unitList.size(),
+                [&](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        syntaxTrees[i + numTrees] = parseSeparateUnit(*unitList[i]->first,
+                                                                      unitList[i]->second);
+                    }
+                },
+                unitList.size());
             threadPool.waitForAll();
         }
 
@@ -283,16 +582,36 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
             const size_t numTrees = syntaxTrees.size();
             syntaxTrees.resize(numTrees + deferredLibBuffers.size());
 
-            threadPool.pushLoop(size_t(0), deferredLibBuffers.size(),
-                                [&](size_t start, size_t end) {
-                                    for (size_t i = start; i < end; i++) {
-                                        auto tree = SyntaxTree::fromBuffer(deferredLibBuffers[i],
-                                                                           sourceManager, optionBag,
-                                                                           inheritedMacros);
-                                        tree->isLibraryUnit = true;
-                                        syntaxTrees[i + numTrees] = std::move(tree);
-                                    }
-                                });
+            threadPool.pushLoop(
+                size_t(0), deferredLibBuffers.size(),
+                [&](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        auto tree = SyntaxTree::fromBuffer(deferredLibBuffers[i], sourceManager,
+                                                           optionBag, inheritedMacros);
+                        tree->isLibraryUnit = true;
+                        syntaxTrees[i + numTrees] = std::move(tree);
+                    }
+                },
+                deferredLibBuffers.size());
+            threadPool.waitForAll();
+        }
+
+        // Parse any buffers that came from preloaded source packages.
+        if (!packageBuffers.empty()) {
+            const size_t numTrees = syntaxTrees.size();
+            syntaxTrees.resize(numTrees + packageBuffers.size());
+
+            threadPool.pushLoop(
+                size_t(0), packageBuffers.size(),
+                [&](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        auto tree = SyntaxTree::fromBuffer(packageBuffers[i], sourceManager,
+                                                           optionBag, inheritedMacros);
+                        tree->isLibraryUnit = true;
+                        syntaxTrees[i + numTrees] = std::move(tree);
+                    }
+                },
+                packageBuffers.size());
             threadPool.waitForAll();
         }
     }
@@ -319,11 +638,18 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
                 syntaxTrees.emplace_back(std::move(tree));
             }
         }
+
+        // Parse any buffers that came from preloaded source packages.
+        for (auto& buffer : packageBuffers) {
+            auto tree = SyntaxTree::fromBuffer(buffer, sourceManager, optionBag, inheritedMacros);
+            tree->isLibraryUnit = true;
+            syntaxTrees.emplace_back(std::move(tree));
+        }
     }
 
-    if (!searchDirectories.empty()) {
-        // If library directories are specified, see if we have any unknown instantiations
-        // or package names for which we should search for additional source files to load.
+    if (!searchDirectories.empty() || !lazyLibBuffers.empty()) {
+        // See if we have any unknown instantiations or package names for which
+        // we should load and parse additional source files.
         flat_hash_set<std::string_view> knownNames;
         auto addKnownNames = [&](const std::shared_ptr<SyntaxTree>& tree) {
             auto& meta = tree->getMetadata();
@@ -370,6 +696,32 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
             }
         };
 
+        // Pre-scan each lazily deferred library file for the names of the
+        // declarations it provides. Files whose declarations can't all be
+        // discovered by scanning are parsed right away instead.
+        flat_hash_map<std::string_view, size_t> lazyDeclNames;
+        std::vector<bool> lazyParsed(lazyLibBuffers.size());
+        auto parseLazyLib = [&](size_t index) {
+            lazyParsed[index] = true;
+            auto tree = SyntaxTree::fromBuffer(lazyLibBuffers[index], sourceManager, optionBag,
+                                               inheritedMacros);
+            tree->isLibraryUnit = true;
+            syntaxTrees.emplace_back(tree);
+            addKnownNames(tree);
+            return tree;
+        };
+
+        for (size_t i = 0; i < lazyLibBuffers.size(); i++) {
+            SmallVector<std::string_view> declNames;
+            if (!scanDeclarationNames(lazyLibBuffers[i].data, declNames) || declNames.empty()) {
+                parseLazyLib(i);
+            }
+            else {
+                for (auto name : declNames)
+                    lazyDeclNames.try_emplace(name, i);
+            }
+        }
+
         for (auto& tree : syntaxTrees)
             addKnownNames(tree);
 
@@ -377,9 +729,36 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
         for (auto& tree : syntaxTrees)
             findMissingNames(tree, missingNames);
 
+        // Parse any lazily deferred library files that provide missing names,
+        // repeating for any new names referenced by the files we parse.
+        if (!lazyDeclNames.empty()) {
+            flat_hash_set<std::string_view> worklist = missingNames;
+            flat_hash_set<std::string_view> newNames;
+            while (!worklist.empty()) {
+                for (auto name : worklist) {
+                    if (auto it = lazyDeclNames.find(name);
+                        it != lazyDeclNames.end() && !lazyParsed[it->second]) {
+                        findMissingNames(parseLazyLib(it->second), newNames);
+                    }
+                }
+
+                worklist.clear();
+                for (auto name : newNames) {
+                    if (missingNames.emplace(name).second)
+                        worklist.emplace(name);
+                }
+                newNames.clear();
+            }
+
+            // Anything satisfied by a lazily parsed file is no longer missing.
+            erase_if(missingNames, [&](std::string_view name) {
+                return knownNames.find(name) != knownNames.end();
+            });
+        }
+
         // Keep loading new files as long as we are making forward progress.
         flat_hash_set<std::string_view> nextMissingNames;
-        while (true) {
+        while (!searchDirectories.empty()) {
             for (auto name : missingNames) {
                 SourceBuffer buffer;
                 for (auto& dir : searchDirectories) {
@@ -540,9 +919,11 @@ SourceLoader::LoadResult SourceLoader::loadAndParse(const FileEntry& entry, cons
         // collect it for later parsing.
         return std::pair{*buffer, false};
     }
-    else if (srcOptions.librariesInheritMacros) {
-        // If libraries inherit macros then we can't parse here,
-        // we need to wait for the main compilation unit to be parsed.
+    else if (srcOptions.librariesInheritMacros ||
+             (srcOptions.lazyLibraries && entry.isLibraryFile)) {
+        // If libraries inherit macros then we can't parse here, we need to
+        // wait for the main compilation unit to be parsed. Similarly, lazily
+        // loaded library files wait until we know whether they're referenced.
         SLANG_ASSERT(entry.isLibraryFile);
         return std::pair{*buffer, true};
     }
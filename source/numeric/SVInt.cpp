@@ -257,9 +257,9 @@ SVInt SVInt::fromDigits(bitwidth_t bits, LiteralBase base, bool isSigned, bool a
 SVInt SVInt::fromDecimalDigits(bitwidth_t bits, bool isSigned, std::span<logic_t const> digits) {
     SVInt result = allocZeroed(bits, isSigned, false);
 
-    constexpr int charsPerWord = 18; // 18 decimal digits can fit in a 64-bit word
+    constexpr int charsPerWord = 19; // 19 decimal digits can fit in a 64-bit word
     const logic_t* d = digits.data();
-    uint64_t maxWord = (uint64_t)std::pow(10, charsPerWord);
+    uint64_t maxWord = UINT64_C(10'000'000'000'000'000'000);
     uint32_t count = 0;
     uint64_t word;
 
@@ -315,6 +315,40 @@ SVInt SVInt::fromPow2Digits(bitwidth_t bits, bool isSigned, bool anyUnknown, uin
 
     uint32_t numWords = getNumWords(bits, false);
     uint32_t ones = (1 << shift) - 1;
+
+    // Fast path for hex and binary digits with no unknown bits: these pack
+    // evenly into 64-bit words, so build each word with a tight shift-or loop
+    // and defer digit validation to a single accumulated check instead of
+    // branching on every digit.
+    if (!anyUnknown && (BITS_PER_WORD % shift) == 0) {
+        const size_t digitsPerWord = BITS_PER_WORD / shift;
+        uint64_t invalid = 0;
+        size_t pos = digits.size();
+        for (uint32_t w = 0; w < numWords && pos > 0; w++) {
+            const size_t chunk = std::min(digitsPerWord, pos);
+            uint64_t word = 0;
+            for (size_t j = pos - chunk; j < pos; j++) {
+                const uint64_t value = digits[j].value;
+                invalid |= value & ~uint64_t(ones);
+                word = (word << shift) | value;
+            }
+            pos -= chunk;
+            result.pVal[w] = word;
+        }
+
+        if (invalid) {
+            for (ptrdiff_t i = ptrdiff_t(digits.size()) - 1; i >= 0; i--) {
+                uint64_t value = digits[size_t(i)].value;
+                if (value >= radix) {
+                    SLANG_THROW(std::invalid_argument(
+                        fmt::format("Digit {} too large for radix {}", value, radix)));
+                }
+            }
+        }
+
+        result.clearUnusedBits();
+        return result;
+    }
     uint64_t word = 0;
     uint64_t unknownWord = 0;
     uint64_t* dest = result.pVal;
@@ -682,16 +716,19 @@ void SVInt::writeTo(SmallVectorBase<char>& buffer, LiteralBase base,
 
 void SVInt::writeTo(SmallVectorBase<char>& buffer, LiteralBase base, bool includeBase,
                     bitwidth_t abbreviateThresholdBits) const {
-    // negative sign if necessary
-    SVInt tmp(*this);
+    // Negative sign if necessary; only copy the value if it actually
+    // needs to be negated.
+    const SVInt* src = this;
+    SVInt negated;
     if (signFlag && !unknownFlag && isNegative()) {
-        tmp = -tmp;
+        negated = -(*this);
+        src = &negated;
         buffer.push_back('-');
     }
 
     // If the number is larger than the threshold to abbreviate,
     // force it to print as a decimal.
-    bitwidth_t activeBits = tmp.getActiveBits();
+    bitwidth_t activeBits = src->getActiveBits();
     if (activeBits > abbreviateThresholdBits) {
         includeBase = true;
         base = LiteralBase::Decimal;
@@ -762,7 +799,17 @@ void SVInt::writeTo(SmallVectorBase<char>& buffer, LiteralBase base, bool includ
             else
                 buffer.push_back('Z');
         }
+        else if (activeBits <= BITS_PER_WORD && activeBits <= abbreviateThresholdBits) {
+            // Values that fit in a single word don't need bignum division.
+            uint64_t value = src->getRawData()[0];
+            while (value) {
+                buffer.push_back(Digits[value % 10]);
+                value /= 10;
+            }
+        }
         else {
+            SVInt tmp(*src);
+
             // Limit the size of the output string based on the given threshold.
             if (activeBits > abbreviateThresholdBits) {
                 base10Exponent =
@@ -812,42 +859,69 @@ void SVInt::writeTo(SmallVectorBase<char>& buffer, LiteralBase base, bool includ
                 SLANG_UNREACHABLE;
         }
 
-        // if we have unknown values here, the comparison will return X
-        // we want to keep going so that we print the unknowns
-        int bitsLeft = int(tmp.getBitWidth());
-        logic_t x = tmp != 0;
-        while (x || x.isUnknown()) {
-            if (bitsLeft < int(shiftAmount))
-                maskAmount = (1 << bitsLeft) - 1;
+        // Digits are read directly out of the raw words instead of
+        // repeatedly shifting the whole value, which would allocate a
+        // fresh copy for every digit of a multiword value.
+        const uint32_t words = getNumWords(bitWidth, false);
+        const uint64_t* valPtr = src->getRawData();
+        const uint64_t* unkPtr = unknownFlag ? valPtr + words : nullptr;
+
+        auto extractDigit = [&](const uint64_t* p, uint32_t lsb, uint32_t mask) {
+            uint32_t word = lsb / BITS_PER_WORD;
+            uint32_t offset = lsb % BITS_PER_WORD;
+            uint64_t bits = p[word] >> offset;
+            if (offset + shiftAmount > BITS_PER_WORD && word + 1 < words)
+                bits |= p[word + 1] << (BITS_PER_WORD - offset);
+            return uint32_t(bits) & mask;
+        };
+
+        const uint32_t totalDigits = (bitWidth + shiftAmount - 1) / shiftAmount;
+        const uint32_t partialBits = bitWidth % shiftAmount;
+        const uint32_t topMask = partialBits ? (1u << partialBits) - 1 : maskAmount;
+        auto maskFor = [&](uint32_t k) { return k == totalDigits - 1 ? topMask : maskAmount; };
+
+        // Find the most significant digit with any set or unknown bits;
+        // leading zero digits aren't printed.
+        uint32_t digitCount = 0;
+        for (uint32_t k = totalDigits; k > 0; k--) {
+            uint32_t lsb = (k - 1) * shiftAmount;
+            uint32_t mask = maskFor(k - 1);
+            if (extractDigit(valPtr, lsb, mask) || (unkPtr && extractDigit(unkPtr, lsb, mask))) {
+                digitCount = k;
+                break;
+            }
+        }
 
-            uint32_t digit = uint32_t(tmp.getRawData()[0]) & maskAmount;
-            if (!tmp.unknownFlag)
+        // Digits are pushed least significant first; the shared tail below
+        // reverses them into place.
+        for (uint32_t k = 0; k < digitCount; k++) {
+            uint32_t mask = maskFor(k);
+            uint32_t digit = extractDigit(valPtr, k * shiftAmount, mask);
+            if (!unkPtr) {
                 buffer.push_back(Digits[digit]);
+            }
             else {
-                uint32_t u = uint32_t(tmp.pVal[getNumWords(bitWidth, false)]) & maskAmount;
+                uint32_t u = extractDigit(unkPtr, k * shiftAmount, mask);
                 if (!u)
                     buffer.push_back(Digits[digit]);
-                else if (u == maskAmount && (digit & maskAmount) == 0)
+                else if (u == mask && digit == 0)
                     buffer.push_back('x');
-                else if (u == maskAmount && digit == maskAmount)
+                else if (u == mask && digit == mask)
                     buffer.push_back('z');
                 else if (~digit & u)
                     buffer.push_back('X');
                 else
                     buffer.push_back('Z');
             }
-            // this shift might shift away the unknown digits, at which point
-            // it converts back to being a normal 2-state value
-            tmp = tmp.lshr(shiftAmount);
-            bitsLeft -= int(shiftAmount);
-            x = tmp != 0;
         }
 
         // If there are bits left over and the last digit we pushed was
         // an unknown we need to insert an extra 0 to indicate that the
         // leading bits are actually zeroes and not extended unknowns.
-        if (bitsLeft > 0 && !buffer.empty() && (buffer.back() == 'x' || buffer.back() == 'z'))
+        if (digitCount > 0 && digitCount < totalDigits &&
+            (buffer.back() == 'x' || buffer.back() == 'z')) {
             buffer.push_back('0');
+        }
     }
 
     // no digits means this is zero
@@ -1295,19 +1369,19 @@ SVInt SVInt::xnor(const SVInt& rhs) const {
     return result;
 }
 
-SVInt SVInt::operator+(const SVInt& rhs) const {
+SVInt SVInt::addSlowCase(const SVInt& rhs) const {
     SVInt tmp(*this);
     tmp += rhs;
     return tmp;
 }
 
-SVInt SVInt::operator-(const SVInt& rhs) const {
+SVInt SVInt::subSlowCase(const SVInt& rhs) const {
     SVInt tmp(*this);
     tmp -= rhs;
     return tmp;
 }
 
-SVInt SVInt::operator*(const SVInt& rhs) const {
+SVInt SVInt::mulSlowCase(const SVInt& rhs) const {
     SVInt tmp(*this);
     tmp *= rhs;
     return tmp;
@@ -1389,7 +1463,7 @@ SVInt SVInt::operator^(const SVInt& rhs) const {
     return tmp;
 }
 
-logic_t SVInt::operator<(const SVInt& rhs) const {
+logic_t SVInt::lessThanSlowCase(const SVInt& rhs) const {
     if (unknownFlag || rhs.hasUnknown())
         return logic_t::x;
 
@@ -1854,9 +1928,31 @@ SVInt& SVInt::assignSlowCase(const SVInt& rhs) {
 
 logic_t SVInt::equalsSlowCase(const SVInt& rhs) const {
     if (unknownFlag || rhs.unknownFlag) {
-        // We can't know whether the numbers are definitely equal, but if there is a 0/1 pair, it is
-        // definitely not equal. xor detects 0/1 pairs for each bit and !reductionOr collects all
-        // pairs.
+        // We can't know whether the numbers are definitely equal, but if there is a 0/1 pair, it
+        // is definitely not equal: a bit where neither unknown plane is set and the value planes
+        // differ. Equal widths accumulate that test one word of each plane at a time instead of
+        // materializing the xor temporary; unequal widths fall back to the xor formulation since
+        // they need an extension allocation either way.
+        if (bitWidth == rhs.bitWidth) {
+            uint32_t words = getNumWords(bitWidth, false);
+            auto valueWord = [](const SVInt& v, uint32_t i) {
+                return v.isSingleWord() ? v.val : v.pVal[i];
+            };
+            auto unknownWord = [words](const SVInt& v, uint32_t i) {
+                return v.unknownFlag ? v.pVal[i + words] : 0;
+            };
+
+            uint64_t anyDiff = 0;
+            for (uint32_t i = 0; i < words; i++) {
+                uint64_t unk = unknownWord(*this, i) | unknownWord(rhs, i);
+                anyDiff |= ~unk & (valueWord(*this, i) ^ valueWord(rhs, i));
+            }
+
+            // checkUnknown keeps the unknown flags exact, so with no definite
+            // mismatch the result is always X here.
+            return anyDiff ? logic_t(false) : logic_t::x;
+        }
+
         return !(*this ^ rhs).reductionOr();
     }
 
@@ -2217,6 +2313,29 @@ SVInt SVInt::udiv(const SVInt& lhs, const SVInt& rhs, bool bothSigned) {
     if (lhsWords == 1 && rhsWords == 1)
         return SVInt(lhs.bitWidth, lhs.pVal[0] / rhs.pVal[0], bothSigned);
 
+    // Note: the multiword paths below derive result signedness from the
+    // operands, matching what divide() does for the general case.
+    // Power-of-two divisors reduce to a shift. This shows up constantly in
+    // address and stride calculations.
+    if (rhs.countOnes() == 1) {
+        auto result = lhs.lshr(rhsBits - 1);
+        result.setSigned(lhs.signFlag && rhs.signFlag);
+        return result;
+    }
+
+#ifdef SLANG_HAS_DIV_128
+    // A single-word divisor doesn't need the full Knuth machinery; one
+    // 128-by-64 divide per dividend word does it.
+    if (rhsWords == 1) {
+        SVInt quotient(lhs.bitWidth, 0, lhs.signFlag && rhs.signFlag);
+        uint64_t d = rhs.pVal[0];
+        uint64_t rem = 0;
+        for (int i = int(lhsWords) - 1; i >= 0; i--)
+            quotient.pVal[i] = divWord(rem, lhs.pVal[i], d, &rem);
+        return quotient;
+    }
+#endif
+
     // compute it the hard way with the Knuth algorithm
     SVInt quotient;
     divide(lhs, lhsWords, rhs, rhsWords, &quotient, nullptr);
@@ -2247,6 +2366,27 @@ SVInt SVInt::urem(const SVInt& lhs, const SVInt& rhs, bool bothSigned) {
     if (lhsWords == 1)
         return SVInt(lhs.bitWidth, lhs.pVal[0] % rhs.pVal[0], bothSigned);
 
+    // Note: the multiword paths below derive result signedness from the
+    // operands, matching what divide() does for the general case.
+    // Power-of-two divisors reduce to a mask of the low bits.
+    if (rhs.countOnes() == 1) {
+        auto result = lhs & (rhs - SVInt(rhs.bitWidth, 1, false));
+        result.setSigned(lhs.signFlag && rhs.signFlag);
+        return result;
+    }
+
+#ifdef SLANG_HAS_DIV_128
+    // A single-word divisor doesn't need the full Knuth machinery; one
+    // 128-by-64 divide per dividend word does it.
+    if (rhsWords == 1) {
+        uint64_t d = rhs.pVal[0];
+        uint64_t rem = 0;
+        for (int i = int(lhsWords) - 1; i >= 0; i--)
+            divWord(rem, lhs.pVal[i], d, &rem);
+        return SVInt(lhs.bitWidth, rem, lhs.signFlag && rhs.signFlag);
+    }
+#endif
+
     // compute it the hard way with the Knuth algorithm
     SVInt remainder;
     divide(lhs, lhsWords, rhs, rhsWords, nullptr, &remainder);
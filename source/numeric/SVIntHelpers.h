@@ -102,13 +102,12 @@ private:
 };
 
 static void lshrNear(uint64_t* dst, uint64_t* src, uint32_t words, uint32_t amount) {
-    // fast case for logical right shift of a small amount (less than 64 bits)
-    uint64_t carry = 0;
-    for (int i = int(words - 1); i >= 0; i--) {
-        uint64_t temp = src[i];
-        dst[i] = (temp >> amount) | carry;
-        carry = temp << (64 - amount);
-    }
+    // fast case for logical right shift of a small amount (less than 64 bits);
+    // each result word depends only on the source so there is no loop-carried
+    // dependency and the compiler is free to vectorize this
+    for (uint32_t i = 0; i < words - 1; i++)
+        dst[i] = (src[i] >> amount) | (src[i + 1] << (64 - amount));
+    dst[words - 1] = src[words - 1] >> amount;
 }
 
 static void lshrFar(uint64_t* dst, uint64_t* src, uint32_t wordShift, uint32_t offset,
@@ -116,8 +115,7 @@ static void lshrFar(uint64_t* dst, uint64_t* src, uint32_t wordShift, uint32_t o
     // this function is split out so that if we have an unknown value we can reuse the code
     // optimization: move whole words
     if (wordShift == 0) {
-        for (uint32_t i = start; i < start + numWords - offset; i++)
-            dst[i] = src[i + offset];
+        memmove(dst + start, src + start + offset, (numWords - offset) * sizeof(uint64_t));
     }
     else {
         // shift low order words
@@ -136,8 +134,7 @@ static void shlFar(uint64_t* dst, uint64_t* src, uint32_t wordShift, uint32_t of
                    uint32_t start, uint32_t numWords) {
     // optimization: move whole words
     if (wordShift == 0) {
-        for (uint32_t i = start + offset; i < start + numWords; i++)
-            dst[i] = src[i - offset];
+        memmove(dst + start + offset, src + start, (numWords - offset) * sizeof(uint64_t));
     }
     else {
         for (uint32_t i = start + numWords - 1; i > start + offset; i--) {
@@ -147,8 +144,7 @@ static void shlFar(uint64_t* dst, uint64_t* src, uint32_t wordShift, uint32_t of
         dst[start + offset] = src[start] << wordShift;
     }
 
-    for (uint32_t i = start; i < start + offset; i++)
-        dst[i] = 0;
+    memset(dst + start, 0, offset * sizeof(uint64_t));
 }
 
 static void signExtendCopy(uint64_t* output, const uint64_t* input, bitwidth_t oldBits,
@@ -282,6 +278,27 @@ static uint64_t mulTerm(uint64_t x, uint64_t y, uint64_t& carry) {
 #endif
 }
 
+// A 128-by-64 bit divide, for running single-word divisors over a multiword
+// dividend one word at a time. Not every target has a native way to do this,
+// so its availability is signaled via the define.
+#if (defined(_MSC_VER) && defined(_M_X64)) || defined(__SIZEOF_INT128__)
+#    define SLANG_HAS_DIV_128 1
+
+// Divides the 128-bit value (hi:lo) by d, returning the 64-bit quotient and
+// storing the remainder. The caller must guarantee hi < d so that the
+// quotient fits in 64 bits.
+static uint64_t divWord(uint64_t hi, uint64_t lo, uint64_t d, uint64_t* rem) {
+#    if defined(_MSC_VER) && defined(_M_X64)
+    return _udiv128(hi, lo, d, rem);
+#    else
+    using uint128_t = unsigned __int128;
+    uint128_t n = (uint128_t(hi) << 64) | lo;
+    *rem = uint64_t(n % d);
+    return uint64_t(n / d);
+#    endif
+}
+#endif
+
 // Multiply an integer array by a single uint64
 static uint64_t mulOne(uint64_t* dst, const uint64_t* x, uint32_t len, uint64_t y) {
     uint64_t carry = 0;
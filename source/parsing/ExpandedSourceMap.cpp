@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+// ExpandedSourceMap.cpp
+// Zero-copy reconstruction of preprocessed source with provenance
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/parsing/ExpandedSourceMap.h"
+
+#include "slang/parsing/Preprocessor.h"
+#include "slang/text/SourceManager.h"
+#include "slang/util/SmallVector.h"
+
+namespace slang::parsing {
+
+namespace {
+
+// A piece of text with resolved provenance, before coalescing.
+struct Piece {
+    std::string_view text;
+    BufferID buffer;
+    size_t offset = 0;
+    bool fromMacro = false;
+};
+
+bool shouldKeep(TriviaKind kind) {
+    switch (kind) {
+        case TriviaKind::Whitespace:
+        case TriviaKind::EndOfLine:
+        case TriviaKind::LineComment:
+        case TriviaKind::BlockComment:
+            return true;
+        default:
+            // Directives, disabled text, and skipped tokens don't appear in
+            // the expanded view.
+            return false;
+    }
+}
+
+} // namespace
+
+std::vector<ExpandedSourceSegment> buildExpandedSourceMap(Preprocessor& preprocessor) {
+    auto& sm = preprocessor.getSourceManager();
+    std::vector<ExpandedSourceSegment> segments;
+    size_t expandedOffset = 0;
+
+    auto append = [&](const Piece& piece) {
+        if (piece.text.empty())
+            return;
+
+        // Coalesce with the previous segment when the text literally
+        // continues it, both in memory and in source coordinates.
+        if (!segments.empty()) {
+            auto& last = segments.back();
+            if (last.fromMacro == piece.fromMacro && last.buffer == piece.buffer &&
+                last.offset + last.text.size() == piece.offset &&
+                last.text.data() + last.text.size() == piece.text.data()) {
+                last.text = std::string_view(last.text.data(),
+                                             last.text.size() + piece.text.size());
+                expandedOffset += piece.text.size();
+                return;
+            }
+        }
+
+        segments.push_back({piece.text, piece.buffer, piece.offset, expandedOffset,
+                            piece.fromMacro});
+        expandedOffset += piece.text.size();
+    };
+
+    SmallVector<Piece, 8> pieces;
+    while (true) {
+        Token token = preprocessor.next();
+
+        // Resolve provenance for the token's retained trivia, walking
+        // backwards from the token itself: most trivia has no explicit
+        // location and instead sits immediately before its neighbor in the
+        // same buffer, which memory contiguity of the raw text detects.
+        Piece tokenPiece{token.rawText(), {}, 0, sm.isMacroLoc(token.location())};
+        if (auto loc = sm.getFullyOriginalLoc(token.location()); loc.buffer()) {
+            tokenPiece.buffer = loc.buffer();
+            tokenPiece.offset = loc.offset();
+        }
+        Piece next = tokenPiece;
+
+        pieces.clear();
+        auto trivia = token.trivia();
+        for (auto it = trivia.rbegin(); it != trivia.rend(); it++) {
+            if (!shouldKeep(it->kind))
+                continue;
+
+            Piece piece{it->getRawText(), {}, 0, false};
+            if (piece.text.empty())
+                continue;
+
+            if (next.buffer &&
+                piece.text.data() + piece.text.size() == next.text.data()) {
+                piece.buffer = next.buffer;
+                piece.offset = next.offset - piece.text.size();
+                piece.fromMacro = next.fromMacro;
+            }
+            else if (auto loc = it->getExplicitLocation()) {
+                piece.fromMacro = sm.isMacroLoc(*loc);
+                if (auto orig = sm.getFullyOriginalLoc(*loc); orig.buffer()) {
+                    piece.buffer = orig.buffer();
+                    piece.offset = orig.offset();
+                }
+            }
+
+            pieces.push_back(piece);
+            next = piece;
+        }
+
+        for (auto it = pieces.rbegin(); it != pieces.rend(); it++)
+            append(*it);
+
+        if (token.kind == TokenKind::EndOfFile)
+            break;
+
+        append(tokenPiece);
+    }
+
+    return segments;
+}
+
+} // namespace slang::parsing
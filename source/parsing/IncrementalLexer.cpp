@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+// IncrementalLexer.cpp
+// Incremental re-lexing of edited source buffers
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/parsing/IncrementalLexer.h"
+
+#include <algorithm>
+
+#include "slang/diagnostics/Diagnostics.h"
+#include "slang/util/BumpAllocator.h"
+
+namespace slang::parsing {
+
+// Returns true if the token starting at the given offset is the first
+// non-whitespace on its line and the previous line didn't end in a
+// backslash continuation.
+static bool startsFreshLine(std::string_view text, size_t offset) {
+    while (offset > 0) {
+        char c = text[offset - 1];
+        if (c == '\n' || c == '\r')
+            return offset < 2 || text[offset - 2] != '\\';
+        if (c != ' ' && c != '\t')
+            return false;
+        offset--;
+    }
+    return true;
+}
+
+void IncrementalLexer::prime(std::string_view text) {
+    bounds.clear();
+    update(text, {0, text.size(), text.size()});
+}
+
+size_t IncrementalLexer::update(std::string_view text, Edit edit) {
+    SLANG_ASSERT(!text.empty() && text.back() == '\0');
+    const ptrdiff_t delta = ptrdiff_t(edit.newLength) - ptrdiff_t(edit.oldLength);
+
+    // Retain tokens that start strictly before the edit, then back the
+    // restart point up: two extra tokens in case the edit extended a token
+    // it touches, and from there to a token that begins a fresh line so the
+    // restart can't land in the middle of line-oriented directive text.
+    size_t restart = size_t(std::ranges::lower_bound(bounds, edit.offset) - bounds.begin());
+    for (int i = 0; i < 2 && restart > 0; i++)
+        restart--;
+    while (restart > 0 && !startsFreshLine(text, bounds[restart]))
+        restart--;
+
+    const size_t restartOffset = restart == 0 ? 0 : bounds[restart];
+    std::vector<size_t> newBounds(bounds.begin(), bounds.begin() + std::ptrdiff_t(restart));
+
+    BumpAllocator alloc;
+    Diagnostics diagnostics;
+    SourceBuffer buffer;
+    buffer.data = text.substr(restartOffset);
+    Lexer lexer(buffer, alloc, diagnostics, options);
+
+    // Lex forward until we're past the edited range and hit a token start
+    // that, shifted back by the edit delta, was also a token start in the
+    // old stream. From there on the text is untouched and lexing is
+    // deterministic, so the old boundaries can be reused verbatim.
+    const size_t editEnd = edit.offset + edit.newLength;
+    size_t relexed = 0;
+    while (true) {
+        Token token = lexer.lex();
+        if (token.kind == TokenKind::EndOfFile)
+            break;
+
+        const size_t start = restartOffset + token.location().offset();
+        if (start >= editEnd) {
+            const ptrdiff_t shifted = ptrdiff_t(start) - delta;
+            if (shifted >= 0) {
+                auto it = std::ranges::lower_bound(bounds, size_t(shifted));
+                if (it != bounds.end() && *it == size_t(shifted)) {
+                    for (; it != bounds.end(); it++)
+                        newBounds.push_back(size_t(ptrdiff_t(*it) + delta));
+                    break;
+                }
+            }
+        }
+
+        newBounds.push_back(start);
+        relexed++;
+    }
+
+    bounds = std::move(newBounds);
+    return relexed;
+}
+
+} // namespace slang::parsing
@@ -10,6 +10,8 @@
 #include <cmath>
 #include <fmt/core.h>
 
+#include "ScanKernels.h"
+
 #include "slang/diagnostics/LexerDiags.h"
 #include "slang/diagnostics/NumericDiags.h"
 #include "slang/diagnostics/PreprocessorDiags.h"
@@ -37,6 +39,15 @@ Lexer::Lexer(SourceBuffer buffer, BumpAllocator& alloc, Diagnostics& diagnostics
              LexerOptions options) :
     Lexer(buffer.id, buffer.data, buffer.data.data(), alloc, diagnostics, options) {
     library = buffer.library;
+    knownValidUtf8 = buffer.isValidUtf8;
+}
+
+Lexer::Lexer(SourceBuffer buffer, BumpAllocator& alloc, Diagnostics& diagnostics,
+             size_t startOffset, LexerOptions options) :
+    Lexer(buffer.id, buffer.data, buffer.data.data() + startOffset, alloc, diagnostics, options) {
+    SLANG_ASSERT(startOffset < buffer.data.size());
+    library = buffer.library;
+    knownValidUtf8 = buffer.isValidUtf8;
 }
 
 Lexer::Lexer(BufferID bufferId, std::string_view source, const char* startPtr, BumpAllocator& alloc,
@@ -222,6 +233,41 @@ void Lexer::splitTokens(BumpAllocator& alloc, Diagnostics& diagnostics,
     }
 }
 
+void Lexer::lexRaw(std::string_view source, SmallVectorBase<RawToken>& results,
+                   LexerOptions options) {
+    // The lexer requires NUL-terminated input; take a copy if the caller's
+    // buffer isn't.
+    if (source.empty() || source.back() != '\0') {
+        std::string copy(source);
+        copy.push_back('\0');
+        lexRaw(copy, results, options);
+        return;
+    }
+
+    BumpAllocator alloc;
+    Diagnostics diagnostics;
+    options.maxErrors = std::numeric_limits<uint32_t>::max();
+    Lexer lexer(BufferID::getPlaceholder(), source, source.data(), alloc, diagnostics, options);
+
+    auto keywordVersion = LF::getDefaultKeywordVersion(options.languageVersion);
+    uint32_t sinceReset = 0;
+    while (true) {
+        Token token = lexer.lex(keywordVersion);
+        if (token.kind == TokenKind::EndOfFile)
+            break;
+
+        results.push_back({uint32_t(token.location().offset()),
+                           uint32_t(token.rawText().length()), uint32_t(token.kind)});
+
+        // Nothing from earlier tokens is referenced again, so recycle the
+        // arena periodically to keep memory flat on huge inputs.
+        if (++sinceReset == 4096) {
+            alloc.reset();
+            sinceReset = 0;
+        }
+    }
+}
+
 Token Lexer::lex() {
     return lex(LF::getDefaultKeywordVersion(options.languageVersion));
 }
@@ -573,10 +619,10 @@ Token Lexer::lexToken(KeywordVersion keywordVersion) {
             scanIdentifier();
 
             // might be a keyword
-            auto table = LF::getKeywordTable(keywordVersion);
-            SLANG_ASSERT(table);
-            if (auto it = table->find(lexeme()); it != table->end())
-                return create(it->second);
+            if (auto kind = LF::getKeywordKind(lexeme(), keywordVersion);
+                kind != TokenKind::Unknown) {
+                return create(kind);
+            }
 
             return create(TokenKind::Identifier);
         }
@@ -687,13 +733,30 @@ Token Lexer::lexStringLiteral() {
         advance(2);
     }
 
+    // Most strings contain no escape sequences or embedded nulls, in which
+    // case every byte of the value is copied verbatim and in order from the
+    // source text between the quotes; the value can then refer directly to
+    // the source buffer (which outlives the token, same as its raw text)
+    // instead of being copied into the arena.
+    const char* contentStart = sourceBuffer;
+    bool modified = false;
+
     stringBuffer.clear();
     bool sawUTF8Error = false;
     while (true) {
+        // Bulk copy the run of plain characters leading up to the next
+        // escape, quote, newline, null, or non-ASCII character.
+        if (auto runEnd = scanStringLiteralRun(sourceBuffer, sourceEnd); runEnd != sourceBuffer) {
+            stringBuffer.append(sourceBuffer, runEnd);
+            sourceBuffer = runEnd;
+            sawUTF8Error = false;
+        }
+
         size_t offset = currentOffset();
         char c = peek();
 
         if (c == '\\') {
+            modified = true;
             advance();
             c = peek();
             advance();
@@ -801,6 +864,7 @@ Token Lexer::lexStringLiteral() {
             // otherwise just error and ignore
             errorCount++;
             addDiag(diag::EmbeddedNull, offset);
+            modified = true;
             advance();
         }
         else if (isASCII(c)) {
@@ -808,12 +872,25 @@ Token Lexer::lexStringLiteral() {
             stringBuffer.push_back(c);
             sawUTF8Error = false;
         }
+        else if (knownValidUtf8) {
+            auto runEnd = scanNonAsciiRun(sourceBuffer, sourceEnd);
+            stringBuffer.append(sourceBuffer, runEnd);
+            sourceBuffer = runEnd;
+        }
         else {
             auto curr = sourceBuffer;
 
             uint32_t unused;
             int unicodeLen;
-            sawUTF8Error |= !scanUTF8Char(sawUTF8Error, &unused, unicodeLen);
+            if (!scanUTF8Char(sawUTF8Error, &unused, unicodeLen)) {
+                sawUTF8Error = true;
+
+                // A failed scan can consume fewer bytes than the lead byte
+                // promised (and than we append below), so the value no longer
+                // mirrors the source text byte for byte; the raw-view fast
+                // path at the end must not be used for this literal.
+                modified = true;
+            }
 
             // Regardless of whether the character sequence was valid or not
             // we want to add the bytes to the string, to allow for cases where
@@ -824,6 +901,9 @@ Token Lexer::lexStringLiteral() {
         }
     }
 
+    if (!modified)
+        return create(TokenKind::StringLiteral, std::string_view(contentStart, stringBuffer.size()));
+
     return create(TokenKind::StringLiteral, toStringView(stringBuffer.copy(alloc)));
 }
 
@@ -1171,30 +1251,11 @@ void Lexer::lexTrivia() {
 }
 
 void Lexer::scanIdentifier() {
-    while (true) {
-        char c = peek();
-        if (isAlphaNumeric(c) || c == '_' || c == '$')
-            advance();
-        else
-            return;
-    }
+    sourceBuffer = scanIdentifierRun(sourceBuffer, sourceEnd);
 }
 
 void Lexer::scanWhitespace() {
-    bool done = false;
-    while (!done) {
-        switch (peek()) {
-            case ' ':
-            case '\t':
-            case '\v':
-            case '\f':
-                advance();
-                break;
-            default:
-                done = true;
-                break;
-        }
-    }
+    sourceBuffer = scanWhitespaceRun(sourceBuffer, sourceEnd);
     addTrivia(TriviaKind::Whitespace);
 }
 
@@ -1222,6 +1283,10 @@ void Lexer::scanLineComment() {
 
     bool sawUTF8Error = false;
     while (true) {
+        // Consume the common case in bulk; the scalar code below only needs
+        // to deal with whatever character stopped the run.
+        sourceBuffer = scanLineCommentRun(sourceBuffer, sourceEnd);
+
         char c = peek();
         if (isASCII(c)) {
             if (isNewline(c))
@@ -1238,6 +1303,9 @@ void Lexer::scanLineComment() {
             }
             advance();
         }
+        else if (knownValidUtf8) {
+            sourceBuffer = scanNonAsciiRun(sourceBuffer, sourceEnd);
+        }
         else {
             sawUTF8Error |= !scanUTF8Char(sawUTF8Error);
         }
@@ -1275,6 +1343,9 @@ void Lexer::scanBlockComment() {
                 advance();
             }
         }
+        else if (knownValidUtf8) {
+            sourceBuffer = scanNonAsciiRun(sourceBuffer, sourceEnd);
+        }
         else {
             sawUTF8Error |= !scanUTF8Char(sawUTF8Error);
         }
@@ -1523,11 +1594,54 @@ void Lexer::scanProtectComment() {
 template<typename... Args>
 Token Lexer::create(TokenKind kind, Args&&... args) {
     SourceLocation location(bufferId, size_t(marker - originalBegin));
-    return Token(alloc, kind, triviaBuffer.copy(alloc), lexeme(), location,
-                 std::forward<Args>(args)...);
+
+    // Tokens only store a pointer to their trivia array, so in compact mode
+    // the extremely common cases of a token preceded by nothing but a space,
+    // a newline, or a newline plus indentation can share one statically
+    // allocated trivia instead of copying.
+    static const Trivia SingleSpace[1] = {Trivia(TriviaKind::Whitespace, " "sv)};
+    static const Trivia SingleNewline[1] = {Trivia(TriviaKind::EndOfLine, "\n"sv)};
+    static const Trivia NewlineIndent[2] = {Trivia(TriviaKind::EndOfLine, "\n"sv),
+                                            Trivia(TriviaKind::Whitespace, " "sv)};
+
+    std::span<Trivia const> trivia;
+    if (options.compactWhitespaceTrivia && triviaBuffer.size() == 1 &&
+        triviaBuffer[0].kind == TriviaKind::Whitespace) {
+        trivia = SingleSpace;
+    }
+    else if (options.compactWhitespaceTrivia && triviaBuffer.size() == 1 &&
+             triviaBuffer[0].kind == TriviaKind::EndOfLine) {
+        trivia = SingleNewline;
+    }
+    else if (options.compactWhitespaceTrivia && triviaBuffer.size() == 2 &&
+             triviaBuffer[0].kind == TriviaKind::EndOfLine &&
+             triviaBuffer[1].kind == TriviaKind::Whitespace) {
+        trivia = NewlineIndent;
+    }
+    else {
+        BumpAllocator::CategoryScope scope(alloc, AllocCategory::Trivia);
+        trivia = triviaBuffer.copy(alloc);
+    }
+
+    return Token(alloc, kind, trivia, lexeme(), location, std::forward<Args>(args)...);
 }
 
 void Lexer::addTrivia(TriviaKind kind) {
+    // In compact mode whitespace text is canonicalized to a single space and
+    // end-of-line text to a single newline; only their presence matters to
+    // downstream consumers, and the original text is recoverable from the
+    // source between adjacent token locations.
+    if (options.compactWhitespaceTrivia) {
+        if (kind == TriviaKind::Whitespace) {
+            triviaBuffer.emplace_back(kind, " "sv);
+            return;
+        }
+        if (kind == TriviaKind::EndOfLine) {
+            triviaBuffer.emplace_back(kind, "\n"sv);
+            return;
+        }
+    }
+
     triviaBuffer.emplace_back(kind, lexeme());
 }
 
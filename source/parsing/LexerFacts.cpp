@@ -48,18 +48,6 @@ const static flat_hash_map<std::string_view, TokenKind> systemIdentifierKeywords
     { "delay_mode_unit", SyntaxKind::DelayModeUnitDirective },                 \
     { "delay_mode_zero", SyntaxKind::DelayModeZeroDirective },
 
-const static flat_hash_map<std::string_view, SyntaxKind> directiveTable = {
-    STANDARD_DIRECTIVES
-};
-
-const static flat_hash_map<std::string_view, SyntaxKind> directivesWithLegacyProtect = {
-    STANDARD_DIRECTIVES
-    { "protect", SyntaxKind::ProtectDirective },
-    { "endprotect", SyntaxKind::EndProtectDirective },
-    { "protected", SyntaxKind::ProtectedDirective },
-    { "endprotected", SyntaxKind::EndProtectedDirective }
-};
-
 const static flat_hash_map<std::string_view, KeywordVersion> keywordVersionTable = {
     { "1364-1995", KeywordVersion::v1364_1995 },
     { "1364-2001-noconfig", KeywordVersion::v1364_2001_noconfig },
@@ -182,7 +170,6 @@ const static flat_hash_map<std::string_view, KeywordVersion> keywordVersionTable
     { "endgenerate", TokenKind::EndGenerateKeyword },\
     { "generate", TokenKind::GenerateKeyword },\
     { "genvar", TokenKind::GenVarKeyword },\
-    { "ifnone", TokenKind::IfNoneKeyword },\
     { "localparam", TokenKind::LocalParamKeyword },\
     { "noshowcancelled", TokenKind::NoShowCancelledKeyword },\
     { "pulsestyle_ondetect", TokenKind::PulseStyleOnDetectKeyword },\
@@ -392,6 +379,169 @@ const static flat_hash_map<std::string_view, TokenKind> allKeywords[9] =
     NEWKEYWORDS_1800_2012
 } };
 
+// Keyword sets are strictly cumulative across versions (and 1800-2017 and
+// 1800-2023 added no new keywords), so for classification purposes a single
+// table mapping each keyword to the version that introduced it covers every
+// KeywordVersion.
+struct KeywordEntry {
+    std::string_view text;
+    TokenKind kind;
+    uint8_t minVersion;
+};
+
+constexpr std::pair<std::string_view, TokenKind> keywords1995[] = { KEYWORDS_1364_1995 };
+constexpr std::pair<std::string_view, TokenKind> keywords2001nc[] = { NEWKEYWORDS_1364_2001_noconfig };
+constexpr std::pair<std::string_view, TokenKind> keywords2001[] = { NEWKEYWORDS_1364_2001 };
+constexpr std::pair<std::string_view, TokenKind> keywords2005[] = { NEWKEYWORDS_1364_2005 };
+constexpr std::pair<std::string_view, TokenKind> keywordsSV2005[] = { NEWKEYWORDS_1800_2005 };
+constexpr std::pair<std::string_view, TokenKind> keywordsSV2009[] = { NEWKEYWORDS_1800_2009 };
+constexpr std::pair<std::string_view, TokenKind> keywordsSV2012[] = { NEWKEYWORDS_1800_2012 };
+
+constexpr size_t NumKeywordEntries = std::size(keywords1995) + std::size(keywords2001nc) +
+                                     std::size(keywords2001) + std::size(keywords2005) +
+                                     std::size(keywordsSV2005) + std::size(keywordsSV2009) +
+                                     std::size(keywordsSV2012);
+
+constexpr std::array<KeywordEntry, NumKeywordEntries> keywordEntries = [] {
+    std::array<KeywordEntry, NumKeywordEntries> result{};
+    size_t index = 0;
+    auto add = [&](auto& group, KeywordVersion minVersion) {
+        for (auto& [text, kind] : group)
+            result[index++] = {text, kind, uint8_t(minVersion)};
+    };
+
+    add(keywords1995, KeywordVersion::v1364_1995);
+    add(keywords2001nc, KeywordVersion::v1364_2001_noconfig);
+    add(keywords2001, KeywordVersion::v1364_2001);
+    add(keywords2005, KeywordVersion::v1364_2005);
+    add(keywordsSV2005, KeywordVersion::v1800_2005);
+    add(keywordsSV2009, KeywordVersion::v1800_2009);
+    add(keywordsSV2012, KeywordVersion::v1800_2012);
+    return result;
+}();
+
+struct DirectiveEntry {
+    std::string_view text;
+    SyntaxKind kind;
+    bool legacyProtect = false;
+};
+
+constexpr std::array directiveEntries = std::to_array<DirectiveEntry>({
+    STANDARD_DIRECTIVES
+    { "protect", SyntaxKind::ProtectDirective, true },
+    { "endprotect", SyntaxKind::EndProtectDirective, true },
+    { "protected", SyntaxKind::ProtectedDirective, true },
+    { "endprotected", SyntaxKind::EndProtectedDirective, true },
+});
+
+constexpr uint64_t phfHash(std::string_view str) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : str)
+        hash = (hash ^ uint64_t(uint8_t(c))) * 0x100000001b3ull;
+    return hash ^ (hash >> 32);
+}
+
+constexpr uint64_t phfRemix(uint64_t hash, uint64_t seed) {
+    uint64_t x = hash ^ (seed * 0x9e3779b97f4a7c15ull);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    return x ^ (x >> 33);
+}
+
+constexpr size_t nextPow2(size_t value) {
+    size_t result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+// A perfect hash table constructed entirely at compile time using the
+// "hash and displace" scheme: keys are grouped into buckets by a first-level
+// hash, and each bucket finds a seed for the second-level hash that places
+// all of its keys into unoccupied slots. Lookups are two hashes and two
+// array reads with no collision chains; callers must still compare the
+// candidate entry's text since unknown strings can land on any slot.
+template<size_t N>
+struct PerfectHash {
+    static constexpr size_t TableSize = nextPow2(N * 2);
+    static constexpr size_t NumBuckets = nextPow2(N / 4 + 1);
+
+    std::array<uint32_t, NumBuckets> seeds{};
+    std::array<uint16_t, TableSize> slots{}; // entry index + 1; zero if empty
+
+    template<typename TEntry>
+    constexpr explicit PerfectHash(const std::array<TEntry, N>& entries) {
+        std::array<uint64_t, N> hashes{};
+        std::array<uint32_t, N> bucketOf{};
+        std::array<uint32_t, NumBuckets + 1> offsets{};
+        for (size_t i = 0; i < N; i++) {
+            hashes[i] = phfHash(entries[i].text);
+            bucketOf[i] = uint32_t(hashes[i] & (NumBuckets - 1));
+            offsets[bucketOf[i] + 1]++;
+        }
+
+        // Counting sort the keys by bucket.
+        for (size_t i = 0; i < NumBuckets; i++)
+            offsets[i + 1] += offsets[i];
+
+        std::array<uint32_t, N> keysByBucket{};
+        std::array<uint32_t, NumBuckets> fill{};
+        for (size_t i = 0; i < N; i++) {
+            auto bucket = bucketOf[i];
+            keysByBucket[offsets[bucket] + fill[bucket]++] = uint32_t(i);
+        }
+
+        // Place the largest buckets first while slots are plentiful.
+        std::array<uint32_t, NumBuckets> order{};
+        for (uint32_t i = 0; i < NumBuckets; i++)
+            order[i] = i;
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+            return offsets[a + 1] - offsets[a] > offsets[b + 1] - offsets[b];
+        });
+
+        for (auto bucket : order) {
+            const size_t begin = offsets[bucket];
+            const size_t end = offsets[bucket + 1];
+            if (begin == end)
+                break;
+
+            for (uint32_t seed = 1;; seed++) {
+                uint32_t trySlots[N];
+                bool ok = true;
+
+                for (size_t i = begin; i < end && ok; i++) {
+                    auto slot = uint32_t(phfRemix(hashes[keysByBucket[i]], seed) & (TableSize - 1));
+                    if (slots[slot] != 0)
+                        ok = false;
+                    for (size_t j = begin; j < i; j++) {
+                        if (trySlots[j - begin] == slot)
+                            ok = false;
+                    }
+                    trySlots[i - begin] = slot;
+                }
+
+                if (ok) {
+                    seeds[bucket] = seed;
+                    for (size_t i = begin; i < end; i++)
+                        slots[trySlots[i - begin]] = uint16_t(keysByBucket[i] + 1);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Returns the candidate entry index + 1 for the given text, or zero if
+    // no entry can possibly match.
+    constexpr uint32_t find(std::string_view text) const {
+        uint64_t hash = phfHash(text);
+        uint32_t seed = seeds[hash & (NumBuckets - 1)];
+        return slots[phfRemix(hash, seed) & (TableSize - 1)];
+    }
+};
+
+constexpr PerfectHash<NumKeywordEntries> keywordHash(keywordEntries);
+constexpr PerfectHash<directiveEntries.size()> directiveHash(directiveEntries);
+
 // clang-format on
 bool LexerFacts::isKeyword(TokenKind kind) {
     switch (kind) {
@@ -656,10 +806,21 @@ TokenKind LexerFacts::getSystemKeywordKind(std::string_view text) {
     return TokenKind::Unknown;
 }
 
+TokenKind LexerFacts::getKeywordKind(std::string_view text, KeywordVersion version) {
+    if (auto idx = keywordHash.find(text)) {
+        auto& entry = keywordEntries[idx - 1];
+        if (entry.text == text && uint8_t(version) >= entry.minVersion)
+            return entry.kind;
+    }
+    return TokenKind::Unknown;
+}
+
 SyntaxKind LexerFacts::getDirectiveKind(std::string_view directive, bool enableLegacyProtect) {
-    auto& table = enableLegacyProtect ? directivesWithLegacyProtect : directiveTable;
-    if (auto it = table.find(directive); it != table.end())
-        return it->second;
+    if (auto idx = directiveHash.find(directive)) {
+        auto& entry = directiveEntries[idx - 1];
+        if (entry.text == directive && (enableLegacyProtect || !entry.legacyProtect))
+            return entry.kind;
+    }
     return SyntaxKind::MacroUsage;
 }
 
@@ -35,6 +35,7 @@ NumberParser::NumberParser(Diagnostics& diagnostics, BumpAllocator& alloc,
 void NumberParser::startVector(Token baseToken, Token sizeToken) {
     hasUnknown = false;
     valid = true;
+    fastOk = false;
     digits.clear();
     text.clear();
 
@@ -82,6 +83,21 @@ int NumberParser::append(Token token, bool isFirst) {
         return -1;
     }
 
+    // The overwhelmingly common case is a single clean run of two-state
+    // digits; try to take it into a plain integer without touching the
+    // digit vector. Anything unusual (unknown bits, bad characters, values
+    // wider than 64 bits) falls through to the general loop below, which
+    // also handles all diagnostics.
+    if (isFirst && literalBase != LiteralBase::Decimal && tryScanFast(chars)) {
+        valid = true;
+        return -1;
+    }
+
+    // If a second token shows up the literal isn't the simple single-token
+    // case, so push the fast-scanned digits through the general path first.
+    if (fastOk)
+        replayFastDigits();
+
     int index = 0;
     switch (literalBase) {
         case LiteralBase::Binary:
@@ -228,6 +244,32 @@ Token NumberParser::finishValue(Token firstToken, bool singleToken, bool isNegat
         return createResult(std::move(result));
     }
 
+    if (fastOk) {
+        bitwidth_t bits = fastSigBits;
+        if (signFlag)
+            bits++;
+
+        // SVInt's 64-bit constructor sign extends values wider than a word,
+        // which isn't what literal digits mean, so leave those rare cases
+        // (along with size overflow warnings for wide results) to the
+        // general path below.
+        if (bits <= 64 && sizeBits <= 64) {
+            if (bits > sizeBits) {
+                if (sizeBits == 0) {
+                    sizeBits = std::max(32u, bits);
+                }
+                else {
+                    SVInt result(sizeBits, fastValue, signFlag);
+                    checkOverflow(bits, result);
+                    return createResult(std::move(result));
+                }
+            }
+            return createResult(SVInt(sizeBits ? sizeBits : 32, fastValue, signFlag));
+        }
+
+        replayFastDigits();
+    }
+
     if (digits.empty()) {
         digits.push_back(logic_t(0));
     }
@@ -284,6 +326,68 @@ Token NumberParser::finishValue(Token firstToken, bool singleToken, bool isNegat
         SVInt::fromDigits(sizeBits ? sizeBits : 32, literalBase, signFlag, hasUnknown, digits));
 }
 
+bool NumberParser::tryScanFast(std::string_view chars) {
+    uint32_t shift;
+    switch (literalBase) {
+        case LiteralBase::Binary:
+            shift = 1;
+            break;
+        case LiteralBase::Octal:
+            shift = 3;
+            break;
+        case LiteralBase::Hex:
+            shift = 4;
+            break;
+        default:
+            return false;
+    }
+
+    const uint32_t maxVal = 1u << shift;
+    uint64_t value = 0;
+    bitwidth_t sigBits = 0;
+
+    for (char c : chars) {
+        if (c == '_')
+            continue;
+        if (!isHexDigit(c))
+            return false;
+
+        uint32_t d = getHexDigitValue(c);
+        if (d >= maxVal)
+            return false;
+
+        if (sigBits) {
+            if (sigBits + shift > 64)
+                return false;
+            sigBits += shift;
+        }
+        else if (d) {
+            sigBits = (bitwidth_t)std::bit_width(d);
+        }
+
+        value = (value << shift) | d;
+    }
+
+    fastOk = true;
+    fastShift = shift;
+    fastSigBits = sigBits;
+    fastValue = value;
+    fastChars = chars;
+    return true;
+}
+
+void NumberParser::replayFastDigits() {
+    // Feed the saved raw text through the general digit accumulator. The
+    // fast scan already validated every character so no diagnostics can
+    // result from this.
+    fastOk = false;
+    const int maxVal = 1 << fastShift;
+    for (char c : fastChars) {
+        if (c != '_')
+            addDigit(logic_t(getHexDigitValue(c)), maxVal);
+    }
+}
+
 void NumberParser::addDigit(logic_t digit, int maxValue) {
     // Leading zeros obviously don't count towards our bit limit, so
     // only count them if we've seen other non-zero digits
@@ -77,7 +77,9 @@ Token Parser::parseLifetime() {
 
 AnsiPortListSyntax& Parser::parseAnsiPortList(Token openParen) {
     Token closeParen;
-    SmallVector<TokenOrSyntax, 8> buffer;
+    // Each port contributes two entries (the port and its trailing comma),
+    // so size this for modules with up to 16 ports before spilling.
+    SmallVector<TokenOrSyntax, 32> buffer;
     parseList<isPossibleAnsiPort, isEndOfParenList>(buffer, TokenKind::CloseParenthesis,
                                                     TokenKind::Comma, closeParen,
                                                     RequireItems::False, diag::ExpectedAnsiPort,
@@ -103,7 +105,7 @@ ModuleHeaderSyntax& Parser::parseModuleHeader() {
         }
         else if (isNonAnsiPort()) {
             Token closeParen;
-            SmallVector<TokenOrSyntax, 8> buffer;
+            SmallVector<TokenOrSyntax, 32> buffer;
             parseList<isPossibleNonAnsiPort, isEndOfParenList>(
                 buffer, TokenKind::CloseParenthesis, TokenKind::Comma, closeParen,
                 RequireItems::True, diag::ExpectedNonAnsiPort,
@@ -909,7 +911,7 @@ DeclaratorSyntax& Parser::parseDeclarator(bool allowMinTypMax, bool requireIniti
 template<bool (*IsEnd)(TokenKind)>
 std::span<TokenOrSyntax> Parser::parseDeclarators(TokenKind endKind, Token& end,
                                                   bool allowMinTypMax, bool requireInitializers) {
-    SmallVector<TokenOrSyntax, 4> buffer;
+    SmallVector<TokenOrSyntax, 8> buffer;
     parseList<isIdentifierOrComma, IsEnd>(buffer, endKind, TokenKind::Comma, end,
                                           RequireItems::True, diag::ExpectedDeclarator,
                                           [this, allowMinTypMax, requireInitializers] {
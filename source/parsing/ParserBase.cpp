@@ -124,6 +124,7 @@ void ParserBase::skipToken(std::optional<DiagCode> diagCode) {
     bool haveDiag = haveDiagAtCurrentLoc();
     skippedTokens.push_back(token);
     window.moveToNext();
+    recoverySkipCount++;
 
     if (diagCode && !haveDiag)
         addDiag(*diagCode, token.range());
@@ -92,6 +92,11 @@ public:
         // Needs to come after we visitDefault because visiting the first token
         // might update our preproc state.
         meta.nodeMap[&syntax] = {defaultNetType, unconnectedDrive, timeScale};
+
+        if (syntax.kind == SyntaxKind::PackageDeclaration)
+            meta.packageCount++;
+        else
+            meta.definitionCount++;
     }
 
     void visitToken(Token token) {
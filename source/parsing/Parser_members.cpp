@@ -8,6 +8,7 @@
 #include "slang/diagnostics/ParserDiags.h"
 #include "slang/parsing/Parser.h"
 #include "slang/parsing/Preprocessor.h"
+#include "slang/util/ActivityProfiler.h"
 #include "slang/util/String.h"
 
 namespace slang::parsing {
@@ -94,6 +95,11 @@ MemberSyntax& Parser::parseModule(AttrList attributes, SyntaxKind parentKind,
                                              endName);
 
     meta.nodeMap[&result] = node;
+    if (declKind == SyntaxKind::PackageDeclaration)
+        meta.packageCount++;
+    else
+        meta.definitionCount++;
+
     return result;
 }
 
@@ -127,6 +133,7 @@ ClassDeclarationSyntax& Parser::parseClass() {
 }
 
 MemberSyntax* Parser::parseMember(SyntaxKind parentKind, bool& anyLocalModules) {
+    ActivityScope activityScope("parseMember", toString(peek().kind));
     auto attributes = parseAttributes();
 
     if (isHierarchyInstantiation(/* requireName */ false))
@@ -427,6 +434,7 @@ std::span<TMember*> Parser::parseMemberList(TokenKind endKind, Token& endToken,
     SmallVector<TMember*, 8> members;
     bool errored = false;
     bool anyLocalModules = false;
+    size_t recoveryBase = getRecoverySkipCount();
 
     while (true) {
         auto kind = peek().kind;
@@ -438,6 +446,7 @@ std::span<TMember*> Parser::parseMemberList(TokenKind endKind, Token& endToken,
             checkMemberAllowed(*member, parentKind);
             members.push_back(member);
             errored = false;
+            recoveryBase = getRecoverySkipCount();
         }
         else {
             if (isCloseDelimOrKeyword(kind)) {
@@ -454,6 +463,16 @@ std::span<TMember*> Parser::parseMemberList(TokenKind endKind, Token& endToken,
 
             skipToken(errored ? std::nullopt : std::make_optional(diag::ExpectedMember));
             errored = true;
+
+            // If an error recovery budget is in effect and we've blown
+            // through it since the last successful member, stop re-attempting
+            // member parses token by token and scan ahead to the next likely
+            // member boundary instead.
+            if (parseOptions.errorRecoveryLimit &&
+                getRecoverySkipCount() - recoveryBase > parseOptions.errorRecoveryLimit) {
+                skipToMemberBoundary(endKind);
+                recoveryBase = getRecoverySkipCount();
+            }
         }
     }
 
@@ -464,6 +483,38 @@ std::span<TMember*> Parser::parseMemberList(TokenKind endKind, Token& endToken,
     return members.copy(alloc);
 }
 
+void Parser::skipToMemberBoundary(TokenKind endKind) {
+    // Cheap keyword scan: consume tokens without attempting any member
+    // parsing until we see something that plausibly starts a new definition
+    // or ends the enclosing one. skipToken handles balanced delimiters so
+    // parenthesized / braced regions are skipped in one go, and the skipped
+    // tokens are preserved as trivia as usual.
+    while (true) {
+        auto kind = peek().kind;
+        if (kind == TokenKind::EndOfFile || kind == endKind || isEndKeyword(kind))
+            return;
+
+        switch (kind) {
+            case TokenKind::ModuleKeyword:
+            case TokenKind::MacromoduleKeyword:
+            case TokenKind::ProgramKeyword:
+            case TokenKind::InterfaceKeyword:
+            case TokenKind::PackageKeyword:
+            case TokenKind::ClassKeyword:
+            case TokenKind::CheckerKeyword:
+            case TokenKind::PrimitiveKeyword:
+            case TokenKind::FunctionKeyword:
+            case TokenKind::TaskKeyword:
+            case TokenKind::GenerateKeyword:
+                return;
+            default:
+                break;
+        }
+
+        skipToken(std::nullopt);
+    }
+}
+
 TimeUnitsDeclarationSyntax& Parser::parseTimeUnitsDeclaration(AttrList attributes) {
     auto keyword = consume();
     auto time = expect(TokenKind::TimeLiteral);
@@ -98,12 +98,37 @@ void Preprocessor::pushSource(std::string_view source, std::string_view name) {
 void Preprocessor::pushSource(SourceBuffer buffer) {
     SLANG_ASSERT(buffer.id);
 
+    consumedBuffers.push_back(buffer.id);
     lexerStack.emplace_back(std::make_unique<Lexer>(buffer, alloc, diagnostics, lexerOptions));
+    guardStateStack.push_back(IncludeGuardState{buffer.data.data()});
+}
+
+void Preprocessor::pushSource(SourceBuffer buffer, size_t startOffset) {
+    SLANG_ASSERT(buffer.id);
+
+    consumedBuffers.push_back(buffer.id);
+    lexerStack.emplace_back(
+        std::make_unique<Lexer>(buffer, alloc, diagnostics, startOffset, lexerOptions));
+
+    // Include guard detection reasons about the whole buffer; when starting
+    // mid-buffer that analysis doesn't apply, so disqualify it up front.
+    IncludeGuardState guardState{buffer.data.data() + startOffset};
+    guardState.phase = GuardPhase::Disqualified;
+    guardStateStack.push_back(guardState);
 }
 
 void Preprocessor::popSource() {
     if (includeDepth)
         includeDepth--;
+
+    // If the file we're leaving turned out to be wrapped entirely in an
+    // include guard, remember that so future inclusions of it can be
+    // skipped while the guard macro remains defined.
+    auto& guardState = guardStateStack.back();
+    if (guardState.phase == GuardPhase::AfterGuard)
+        guardedHeaders.emplace(guardState.contentPtr, guardState.guardMacro);
+
+    guardStateStack.pop_back();
     lexerStack.pop_back();
 }
 
@@ -137,6 +162,7 @@ bool Preprocessor::undefine(std::string_view name) {
 }
 
 void Preprocessor::undefineAll() {
+    macroGeneration++;
     macros.clear();
     macros["__FILE__"] = MacroIntrinsic::File;
     macros["__LINE__"] = MacroIntrinsic::Line;
@@ -178,6 +204,26 @@ void Preprocessor::undefineAll() {
         undefine(undef);
 }
 
+struct MacroSnapshot::Impl {
+    flat_hash_map<std::string_view, Preprocessor::MacroDef> macros;
+};
+
+MacroSnapshot Preprocessor::snapshotMacros() const {
+    MacroSnapshot snapshot;
+    snapshot.impl = std::make_shared<MacroSnapshot::Impl>(MacroSnapshot::Impl{macros});
+    return snapshot;
+}
+
+void Preprocessor::restoreMacros(const MacroSnapshot& snapshot) {
+    if (!snapshot.impl) {
+        undefineAll();
+        return;
+    }
+
+    macroGeneration++;
+    macros = snapshot.impl->macros;
+}
+
 bool Preprocessor::isDefined(std::string_view name) {
     return !name.empty() && macros.find(name) != macros.end();
 }
@@ -211,6 +257,9 @@ std::vector<const DefineDirectiveSyntax*> Preprocessor::getDefinedMacros() const
 }
 
 Token Preprocessor::next() {
+    // Everything allocated while producing tokens (including during macro
+    // expansion) is attributed to the token category for memory profiling.
+    BumpAllocator::CategoryScope scope(alloc, AllocCategory::Tokens);
     return consume();
 }
 
@@ -418,6 +467,7 @@ Token Preprocessor::nextRaw() {
     // This is the common case.
     auto& source = lexerStack.back();
     auto token = source->lex(keywordVersionStack.back());
+    updateIncludeGuardState(token);
     if (token.kind != TokenKind::EndOfFile)
         return token;
 
@@ -448,6 +498,7 @@ Token Preprocessor::nextRaw() {
     while (true) {
         auto& nextSource = lexerStack.back();
         token = nextSource->lex(keywordVersionStack.back());
+        updateIncludeGuardState(token);
         appendTrivia(token);
         if (token.kind != TokenKind::EndOfFile)
             break;
@@ -544,7 +595,7 @@ Trivia Preprocessor::handleIncludeDirective(Token directive) {
         else if (includeDepth >= options.maxIncludeDepth) {
             addDiag(diag::ExceededMaxIncludeDepth, fileName.range());
         }
-        else if (includeOnceHeaders.find(buffer->data.data()) == includeOnceHeaders.end()) {
+        else if (!shouldSkipIncludeFile(*buffer)) {
             includeDepth++;
             pushSource(*buffer);
         }
@@ -554,6 +605,78 @@ Trivia Preprocessor::handleIncludeDirective(Token directive) {
     return Trivia(TriviaKind::Directive, syntax);
 }
 
+bool Preprocessor::shouldSkipIncludeFile(const SourceBuffer& buffer) const {
+    auto contentPtr = buffer.data.data();
+    if (includeOnceHeaders.find(contentPtr) != includeOnceHeaders.end())
+        return true;
+
+    // If the file is known to be wrapped entirely in an include guard and
+    // the guard macro is currently defined the file's contents would all be
+    // skipped anyway, so don't bother lexing it again.
+    if (auto it = guardedHeaders.find(contentPtr); it != guardedHeaders.end())
+        return macros.find(it->second) != macros.end();
+
+    return false;
+}
+
+void Preprocessor::updateIncludeGuardState(Token token) {
+    auto& state = guardStateStack.back();
+    switch (state.phase) {
+        case GuardPhase::AtStart:
+            // Anything other than an `ifndef as the very first token means
+            // this isn't a simple guarded file.
+            state.phase = (token.kind == TokenKind::Directive &&
+                           token.directiveKind() == SyntaxKind::IfNDefDirective)
+                              ? GuardPhase::CondName
+                              : GuardPhase::Disqualified;
+            break;
+        case GuardPhase::CondName:
+            // Only a plain identifier condition qualifies as a guard; a
+            // parenthesized condition expression can't be checked with a
+            // simple macro lookup.
+            if (token.kind == TokenKind::Identifier) {
+                state.guardMacro = token.valueText();
+                state.depth = 1;
+                state.phase = GuardPhase::InGuard;
+            }
+            else {
+                state.phase = GuardPhase::Disqualified;
+            }
+            break;
+        case GuardPhase::InGuard:
+            // Track the lexical nesting of conditional directives so we can
+            // tell when the guard itself is closed. An `else or `elsif
+            // attached to the guard means the file isn't a pure guard.
+            if (token.kind == TokenKind::Directive) {
+                switch (token.directiveKind()) {
+                    case SyntaxKind::IfDefDirective:
+                    case SyntaxKind::IfNDefDirective:
+                        state.depth++;
+                        break;
+                    case SyntaxKind::ElsIfDirective:
+                    case SyntaxKind::ElseDirective:
+                        if (state.depth == 1)
+                            state.phase = GuardPhase::Disqualified;
+                        break;
+                    case SyntaxKind::EndIfDirective:
+                        if (--state.depth == 0)
+                            state.phase = GuardPhase::AfterGuard;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            break;
+        case GuardPhase::AfterGuard:
+            // Only the end of the file may follow the closing `endif.
+            if (token.kind != TokenKind::EndOfFile)
+                state.phase = GuardPhase::Disqualified;
+            break;
+        case GuardPhase::Disqualified:
+            break;
+    }
+}
+
 Trivia Preprocessor::handleResetAllDirective(Token directive) {
     checkOutsideDesignElement(directive);
     resetAllDirectives();
@@ -563,6 +686,7 @@ Trivia Preprocessor::handleResetAllDirective(Token directive) {
 Trivia Preprocessor::handleDefineDirective(Token directive) {
     MacroFormalArgumentListSyntax* formalArguments = nullptr;
     bool bad = false;
+    macroGeneration++;
 
     // Next token should be the macro name. We allow the name to be
     // a keyword token for compatibility with other tools.
@@ -946,6 +1070,7 @@ Trivia Preprocessor::handleDefaultNetTypeDirective(Token directive) {
 
 Trivia Preprocessor::handleUndefDirective(Token directive) {
     Token nameToken = expect(TokenKind::Identifier);
+    macroGeneration++;
 
     if (!nameToken.isMissing()) {
         std::string_view name = nameToken.valueText();
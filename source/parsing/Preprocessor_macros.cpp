@@ -91,6 +91,53 @@ std::pair<MacroActualArgumentListSyntax*, Trivia> Preprocessor::handleTopLevelMa
             return {nullptr, Trivia()};
     }
 
+    // When the macro cache is enabled, check whether we've already fully
+    // expanded this exact usage. The raw argument text (including trivia,
+    // which affects stringification) determines the result.
+    SmallVector<char> argsText;
+    uint64_t argsHash = 0;
+    std::vector<MacroCacheEntry>* cacheSlot = nullptr;
+    if (options.enableMacroCache && !macro.isIntrinsic()) {
+        bool cacheable = true;
+        if (actualArgs) {
+            for (auto arg : actualArgs->args) {
+                for (Token tok : arg->tokens) {
+                    for (auto& trivia : tok.trivia()) {
+                        // Trivia backed by syntax nodes has no raw text of its
+                        // own, so don't try to cache through it.
+                        if (trivia.syntax()) {
+                            cacheable = false;
+                            break;
+                        }
+                        argsText.push_back(char(trivia.kind));
+                        argsText.append_range(trivia.getRawText());
+                    }
+                    argsText.append_range(tok.rawText());
+                }
+                argsText.push_back('\0');
+            }
+        }
+
+        if (cacheable) {
+            auto textView = std::string_view(argsText.data(), argsText.size());
+            argsHash = hash<std::string_view>()(textView);
+            cacheSlot = &macroCache[macro.syntax];
+            for (auto& entry : *cacheSlot) {
+                if (entry.generation == macroGeneration && entry.argsHash == argsHash &&
+                    entry.argsText == textView) {
+                    expandedTokens.clear();
+                    expandedTokens.append_range(entry.tokens);
+                    if (!expandedTokens.empty())
+                        currentMacroToken = expandedTokens.begin();
+                    return {actualArgs, Trivia()};
+                }
+            }
+        }
+    }
+
+    expandedIntrinsic = false;
+    const size_t prevDiagCount = diagnostics.size();
+
     // Expand out the macro
     SmallVector<Token, 32> buffer;
     MacroExpansion expansion{sourceManager, alloc, buffer, directive, true};
@@ -124,6 +171,19 @@ std::pair<MacroActualArgumentListSyntax*, Trivia> Preprocessor::handleTopLevelMa
         tokens = expandedTokens;
     }
 
+    // Remember this expansion for replay by later identical usages, as long
+    // as it didn't involve usage-site-dependent intrinsics and didn't issue
+    // any diagnostics (which wouldn't be reissued on replay).
+    if (cacheSlot && !expandedIntrinsic && diagnostics.size() == prevDiagCount) {
+        std::erase_if(*cacheSlot,
+                      [this](auto& entry) { return entry.generation != macroGeneration; });
+
+        auto savedText = argsText.copy(alloc);
+        cacheSlot->push_back({expandedTokens.copy(alloc),
+                              std::string_view(savedText.data(), savedText.size()), argsHash,
+                              macroGeneration});
+    }
+
     // if the macro expanded into any tokens at all, set the pointer
     // so that we'll pull from them next
     if (!expandedTokens.empty())
@@ -703,6 +763,7 @@ bool Preprocessor::expandReplacementList(
 }
 
 bool Preprocessor::expandIntrinsic(MacroIntrinsic intrinsic, MacroExpansion& expansion) {
+    expandedIntrinsic = true;
     auto loc = expansion.getRange().start();
     SmallVector<char> text;
     switch (intrinsic) {
@@ -0,0 +1,292 @@
+//------------------------------------------------------------------------------
+// ScanKernels.cpp
+// Bulk character scanning kernels used by the lexer
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "ScanKernels.h"
+
+#include <bit>
+#include <cstdint>
+
+#include "slang/text/CharInfo.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#    define SLANG_SCAN_X86
+#    include <immintrin.h>
+#    if defined(__GNUC__) || defined(__clang__)
+#        define SLANG_SCAN_AVX2
+#    endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    define SLANG_SCAN_NEON
+#    include <arm_neon.h>
+#endif
+
+namespace slang::parsing {
+
+// Scalar predicates matching the character classes scanned below.
+// These serve both as the fallback implementation and to finish off
+// the unaligned tail after the vector loops.
+static constexpr bool isIdentChar(char c) {
+    return isAlphaNumeric(c) || c == '_' || c == '$';
+}
+
+static constexpr bool isHorizontalWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\v' || c == '\f';
+}
+
+static constexpr bool isLineCommentChar(char c) {
+    return isASCII(c) && c != '\0' && !isNewline(c);
+}
+
+static constexpr bool isPlainStringChar(char c) {
+    return isASCII(c) && c != '\0' && !isNewline(c) && c != '"' && c != '\\';
+}
+
+static constexpr bool isNonAsciiChar(char c) {
+    return !isASCII(c);
+}
+
+template<typename TPred>
+static const char* scanScalar(const char* cur, const char* end, TPred&& pred) {
+    while (cur != end && pred(*cur))
+        cur++;
+    return cur;
+}
+
+#if defined(SLANG_SCAN_X86)
+
+// All comparisons here are on signed bytes, so non-ASCII characters
+// (which are negative) never fall inside any of the matched ranges and
+// always terminate a run, handing control back to the scalar code.
+static inline __m128i matchRange(__m128i v, char lo, char hi) {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(lo - 1)),
+                         _mm_cmpgt_epi8(_mm_set1_epi8(hi + 1), v));
+}
+
+static inline __m128i matchIdent(__m128i v) {
+    __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i m = _mm_or_si128(matchRange(folded, 'a', 'z'), matchRange(v, '0', '9'));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+    return _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('$')));
+}
+
+static inline __m128i matchWhitespace(__m128i v) {
+    __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                             _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+    return _mm_or_si128(m, _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\v')),
+                                        _mm_cmpeq_epi8(v, _mm_set1_epi8('\f'))));
+}
+
+static inline __m128i matchLineComment(__m128i v) {
+    __m128i excluded = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')),
+                                    _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+    return _mm_andnot_si128(excluded, _mm_cmpgt_epi8(v, _mm_setzero_si128()));
+}
+
+static inline __m128i matchPlainString(__m128i v) {
+    __m128i excluded = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')),
+                                    _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+    excluded = _mm_or_si128(excluded, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+    excluded = _mm_or_si128(excluded, _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')));
+    return _mm_andnot_si128(excluded, _mm_cmpgt_epi8(v, _mm_setzero_si128()));
+}
+
+static inline __m128i matchNonAscii(__m128i v) {
+    return _mm_cmpgt_epi8(_mm_setzero_si128(), v);
+}
+
+#    define SLANG_SCAN_SSE2_LOOP(matcher)                                             \
+        while (end - cur >= 16) {                                                     \
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cur));       \
+            uint32_t stop = uint32_t(_mm_movemask_epi8(matcher(v))) ^ 0xffffu;        \
+            if (stop)                                                                 \
+                return cur + std::countr_zero(stop);                                  \
+            cur += 16;                                                                \
+        }
+
+#    if defined(SLANG_SCAN_AVX2)
+
+static const bool HasAVX2 = __builtin_cpu_supports("avx2");
+
+#        define SLANG_AVX2 __attribute__((target("avx2"))) static inline
+
+SLANG_AVX2 __m256i matchRange256(__m256i v, char lo, char hi) {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(lo - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), v));
+}
+
+SLANG_AVX2 __m256i matchIdent256(__m256i v) {
+    __m256i folded = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    __m256i m = _mm256_or_si256(matchRange256(folded, 'a', 'z'), matchRange256(v, '0', '9'));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')));
+    return _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('$')));
+}
+
+SLANG_AVX2 __m256i matchWhitespace256(__m256i v) {
+    __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                                _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t')));
+    return _mm256_or_si256(m, _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\v')),
+                                              _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\f'))));
+}
+
+SLANG_AVX2 __m256i matchLineComment256(__m256i v) {
+    __m256i excluded = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r')),
+                                       _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')));
+    return _mm256_andnot_si256(excluded, _mm256_cmpgt_epi8(v, _mm256_setzero_si256()));
+}
+
+SLANG_AVX2 __m256i matchPlainString256(__m256i v) {
+    __m256i excluded = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r')),
+                                       _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')));
+    excluded = _mm256_or_si256(excluded, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')));
+    excluded = _mm256_or_si256(excluded, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\')));
+    return _mm256_andnot_si256(excluded, _mm256_cmpgt_epi8(v, _mm256_setzero_si256()));
+}
+
+SLANG_AVX2 __m256i matchNonAscii256(__m256i v) {
+    return _mm256_cmpgt_epi8(_mm256_setzero_si256(), v);
+}
+
+#        define SLANG_SCAN_AVX2_FUNC(name, matcher)                                         \
+            __attribute__((target("avx2"))) static const char* name(const char* cur,        \
+                                                                    const char* end) {      \
+                while (end - cur >= 32) {                                                   \
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cur));  \
+                    uint32_t stop = ~uint32_t(_mm256_movemask_epi8(matcher(v)));            \
+                    if (stop)                                                               \
+                        return cur + std::countr_zero(stop);                                \
+                    cur += 32;                                                              \
+                }                                                                           \
+                return cur;                                                                 \
+            }
+
+SLANG_SCAN_AVX2_FUNC(scanIdentifierAVX2, matchIdent256)
+SLANG_SCAN_AVX2_FUNC(scanWhitespaceAVX2, matchWhitespace256)
+SLANG_SCAN_AVX2_FUNC(scanLineCommentAVX2, matchLineComment256)
+SLANG_SCAN_AVX2_FUNC(scanStringAVX2, matchPlainString256)
+SLANG_SCAN_AVX2_FUNC(scanNonAsciiAVX2, matchNonAscii256)
+
+#        undef SLANG_SCAN_AVX2_FUNC
+#        undef SLANG_AVX2
+#    endif
+
+#elif defined(SLANG_SCAN_NEON)
+
+// Narrow the 16-byte compare result into a 64-bit mask with four bits per
+// input byte; dividing the trailing zero count by four recovers the index.
+static inline uint64_t neonStopMask(uint8x16_t match) {
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(match), 4);
+    return ~vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+static inline uint8x16_t matchIdent(uint8x16_t v) {
+    uint8x16_t folded = vorrq_u8(v, vdupq_n_u8(0x20));
+    uint8x16_t m = vandq_u8(vcgeq_u8(folded, vdupq_n_u8('a')), vcleq_u8(folded, vdupq_n_u8('z')));
+    m = vorrq_u8(m, vandq_u8(vcgeq_u8(v, vdupq_n_u8('0')), vcleq_u8(v, vdupq_n_u8('9'))));
+    m = vorrq_u8(m, vceqq_u8(v, vdupq_n_u8('_')));
+    return vorrq_u8(m, vceqq_u8(v, vdupq_n_u8('$')));
+}
+
+static inline uint8x16_t matchWhitespace(uint8x16_t v) {
+    uint8x16_t m = vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vceqq_u8(v, vdupq_n_u8('\t')));
+    return vorrq_u8(m, vorrq_u8(vceqq_u8(v, vdupq_n_u8('\v')), vceqq_u8(v, vdupq_n_u8('\f'))));
+}
+
+static inline uint8x16_t matchLineComment(uint8x16_t v) {
+    uint8x16_t ascii = vandq_u8(vcgeq_u8(v, vdupq_n_u8(1)), vcltq_u8(v, vdupq_n_u8(0x80)));
+    uint8x16_t excluded = vorrq_u8(vceqq_u8(v, vdupq_n_u8('\r')), vceqq_u8(v, vdupq_n_u8('\n')));
+    return vbicq_u8(ascii, excluded);
+}
+
+static inline uint8x16_t matchPlainString(uint8x16_t v) {
+    uint8x16_t ascii = vandq_u8(vcgeq_u8(v, vdupq_n_u8(1)), vcltq_u8(v, vdupq_n_u8(0x80)));
+    uint8x16_t excluded = vorrq_u8(vceqq_u8(v, vdupq_n_u8('\r')), vceqq_u8(v, vdupq_n_u8('\n')));
+    excluded = vorrq_u8(excluded, vceqq_u8(v, vdupq_n_u8('"')));
+    excluded = vorrq_u8(excluded, vceqq_u8(v, vdupq_n_u8('\\')));
+    return vbicq_u8(ascii, excluded);
+}
+
+static inline uint8x16_t matchNonAscii(uint8x16_t v) {
+    return vcgeq_u8(v, vdupq_n_u8(0x80));
+}
+
+#    define SLANG_SCAN_NEON_LOOP(matcher)                       \
+        while (end - cur >= 16) {                               \
+            uint8x16_t v = vld1q_u8(                            \
+                reinterpret_cast<const uint8_t*>(cur));         \
+            uint64_t stop = neonStopMask(matcher(v));           \
+            if (stop)                                           \
+                return cur + (std::countr_zero(stop) >> 2);     \
+            cur += 16;                                          \
+        }
+
+#endif
+
+const char* scanIdentifierRun(const char* cur, const char* end) {
+#if defined(SLANG_SCAN_X86)
+#    if defined(SLANG_SCAN_AVX2)
+    if (HasAVX2)
+        cur = scanIdentifierAVX2(cur, end);
+#    endif
+    SLANG_SCAN_SSE2_LOOP(matchIdent)
+#elif defined(SLANG_SCAN_NEON)
+    SLANG_SCAN_NEON_LOOP(matchIdent)
+#endif
+    return scanScalar(cur, end, isIdentChar);
+}
+
+const char* scanWhitespaceRun(const char* cur, const char* end) {
+#if defined(SLANG_SCAN_X86)
+#    if defined(SLANG_SCAN_AVX2)
+    if (HasAVX2)
+        cur = scanWhitespaceAVX2(cur, end);
+#    endif
+    SLANG_SCAN_SSE2_LOOP(matchWhitespace)
+#elif defined(SLANG_SCAN_NEON)
+    SLANG_SCAN_NEON_LOOP(matchWhitespace)
+#endif
+    return scanScalar(cur, end, isHorizontalWhitespace);
+}
+
+const char* scanLineCommentRun(const char* cur, const char* end) {
+#if defined(SLANG_SCAN_X86)
+#    if defined(SLANG_SCAN_AVX2)
+    if (HasAVX2)
+        cur = scanLineCommentAVX2(cur, end);
+#    endif
+    SLANG_SCAN_SSE2_LOOP(matchLineComment)
+#elif defined(SLANG_SCAN_NEON)
+    SLANG_SCAN_NEON_LOOP(matchLineComment)
+#endif
+    return scanScalar(cur, end, isLineCommentChar);
+}
+
+const char* scanStringLiteralRun(const char* cur, const char* end) {
+#if defined(SLANG_SCAN_X86)
+#    if defined(SLANG_SCAN_AVX2)
+    if (HasAVX2)
+        cur = scanStringAVX2(cur, end);
+#    endif
+    SLANG_SCAN_SSE2_LOOP(matchPlainString)
+#elif defined(SLANG_SCAN_NEON)
+    SLANG_SCAN_NEON_LOOP(matchPlainString)
+#endif
+    return scanScalar(cur, end, isPlainStringChar);
+}
+
+const char* scanNonAsciiRun(const char* cur, const char* end) {
+#if defined(SLANG_SCAN_X86)
+#    if defined(SLANG_SCAN_AVX2)
+    if (HasAVX2)
+        cur = scanNonAsciiAVX2(cur, end);
+#    endif
+    SLANG_SCAN_SSE2_LOOP(matchNonAscii)
+#elif defined(SLANG_SCAN_NEON)
+    SLANG_SCAN_NEON_LOOP(matchNonAscii)
+#endif
+    return scanScalar(cur, end, isNonAsciiChar);
+}
+
+} // namespace slang::parsing
@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// ScanKernels.h
+// Bulk character scanning kernels used by the lexer
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+namespace slang::parsing {
+
+/// The functions in this header scan runs of characters belonging to a
+/// particular character class, consuming many bytes per iteration on targets
+/// with SIMD support instead of the byte-at-a-time loops the lexer would
+/// otherwise use. Each function returns a pointer to the first character at
+/// or after @a cur (and strictly before @a end) that is *not* part of the
+/// given class. The embedded null at the end of every source buffer is never
+/// part of any class, so these can't run off the end of the buffer.
+
+/// Scans a run of identifier characters (alphanumerics, underscore, dollar sign).
+const char* scanIdentifierRun(const char* cur, const char* end);
+
+/// Scans a run of horizontal whitespace (space, tab, vertical tab, form feed).
+const char* scanWhitespaceRun(const char* cur, const char* end);
+
+/// Scans a run of line comment body characters; stops at newlines,
+/// embedded nulls, and non-ASCII bytes (which need UTF-8 validation).
+const char* scanLineCommentRun(const char* cur, const char* end);
+
+/// Scans a run of plain string literal characters; stops at backslashes,
+/// quotes, newlines, embedded nulls, and non-ASCII bytes.
+const char* scanStringLiteralRun(const char* cur, const char* end);
+
+/// Scans a run of non-ASCII bytes; stops at the first ASCII byte. Only
+/// valid to use for buffers already known to contain valid UTF-8, where
+/// every multi-byte sequence consists solely of non-ASCII bytes.
+const char* scanNonAsciiRun(const char* cur, const char* end);
+
+} // namespace slang::parsing
@@ -0,0 +1,99 @@
+//------------------------------------------------------------------------------
+// ParseSession.cpp
+// Reusable parsing context that pools allocator memory across parses
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/syntax/ParseSession.h"
+
+#include "slang/parsing/Parser.h"
+#include "slang/parsing/ParserMetadata.h"
+#include "slang/parsing/Preprocessor.h"
+#include "slang/syntax/SyntaxTree.h"
+
+namespace slang::syntax {
+
+using namespace parsing;
+
+// Don't let the pool grow without bound if a caller recycles more trees
+// than they ever parse concurrently; beyond this the extras are freed.
+static constexpr size_t MaxPooledAllocators = 8;
+
+ParseSession::ParseSession(const Bag& options) : options(options) {
+}
+
+ParseSession::~ParseSession() = default;
+
+std::shared_ptr<SyntaxTree> ParseSession::parse(std::string_view text, std::string_view name) {
+    SourceBuffer buffer = sourceManager.assignText(""sv, text);
+    if (!buffer)
+        return nullptr;
+
+    if (!name.empty())
+        sourceManager.addLineDirective(SourceLocation(buffer.id, 0), 2, name, 0);
+
+    BumpAllocator alloc;
+    if (!pool.empty()) {
+        alloc = std::move(pool.back());
+        pool.pop_back();
+    }
+    alloc.setDefaultCategory(AllocCategory::SyntaxNodes);
+
+    // Mirrors SyntaxTree::create with a single buffer and content guessing:
+    // first try parsing as a snippet, and if that doesn't consume everything
+    // rewind the arena and reparse as a full compilation unit.
+    for (bool guess : {true, false}) {
+        Diagnostics diagnostics;
+        Preprocessor preprocessor(sourceManager, alloc, diagnostics, options, {});
+        preprocessor.pushSource(buffer);
+
+        Parser parser(preprocessor, options);
+
+        SyntaxNode* root;
+        if (guess) {
+            root = &parser.parseGuess();
+            if (!parser.isDone()) {
+                alloc.reset();
+                continue;
+            }
+        }
+        else {
+            root = &parser.parseCompilationUnit();
+        }
+
+        std::vector<BufferID> consumed(preprocessor.getConsumedBuffers().begin(),
+                                       preprocessor.getConsumedBuffers().end());
+        auto result = std::shared_ptr<SyntaxTree>(
+            new SyntaxTree(root, buffer.library, sourceManager, std::move(alloc),
+                           std::move(diagnostics), parser.getMetadata(),
+                           preprocessor.getDefinedMacros(), std::move(consumed), options));
+        result->verbatimSource = true;
+        return result;
+    }
+    SLANG_UNREACHABLE;
+}
+
+void ParseSession::recycle(std::shared_ptr<SyntaxTree>&& tree) {
+    if (!tree)
+        return;
+
+    // Only the sole owner may donate the tree's memory, and only memory this
+    // session's parses actually produced is worth pooling. Trees that retain
+    // a parent share that parent's allocations, so their arena can't be
+    // rewound for reuse either way.
+    if (tree.use_count() != 1 || &tree->sourceManager() != &sourceManager || tree->parentTree) {
+        tree.reset();
+        return;
+    }
+
+    BumpAllocator alloc = std::move(tree->alloc);
+    tree.reset();
+
+    if (pool.size() < MaxPooledAllocators) {
+        alloc.reset();
+        pool.push_back(std::move(alloc));
+    }
+}
+
+} // namespace slang::syntax
@@ -134,16 +134,77 @@ SourceRange SyntaxNode::sourceRange() const {
 }
 
 ConstTokenOrSyntax SyntaxNode::getChild(size_t index) const {
+    // Fixed-shape nodes are described by generated per-kind child tables,
+    // making this a couple of loads instead of nested kind and index
+    // switches. List nodes (and Unknown) have no fixed shape and keep
+    // dispatching through their virtual accessors.
+    if (kind > SyntaxKind::SeparatedList) {
+        auto& table = detail::childTables[size_t(kind)];
+        if (index >= table.count)
+            return nullptr;
+
+        auto& entry = table.entries[index];
+        auto ptr = reinterpret_cast<const char*>(this) + entry.offset;
+        switch (entry.kind) {
+            case detail::ChildEntry::TokenChild:
+                return *reinterpret_cast<const parsing::Token*>(ptr);
+            case detail::ChildEntry::NodeChild:
+                return *reinterpret_cast<const SyntaxNode* const*>(ptr);
+            case detail::ChildEntry::ListChild:
+                // List members have a vtable, so the SyntaxNode subobject is
+                // not at offset zero; static_cast applies the adjustment.
+                return static_cast<const SyntaxNode*>(
+                    reinterpret_cast<const SyntaxListBase*>(ptr));
+        }
+        SLANG_UNREACHABLE;
+    }
+
     ConstGetChildVisitor visitor;
     return visit(visitor, index);
 }
 
 PtrTokenOrSyntax SyntaxNode::getChildPtr(size_t index) {
+    if (kind > SyntaxKind::SeparatedList) {
+        auto& table = detail::childTables[size_t(kind)];
+        if (index >= table.count)
+            return nullptr;
+
+        auto& entry = table.entries[index];
+        auto ptr = reinterpret_cast<char*>(this) + entry.offset;
+        switch (entry.kind) {
+            case detail::ChildEntry::TokenChild:
+                return reinterpret_cast<parsing::Token*>(ptr);
+            case detail::ChildEntry::NodeChild:
+                return *reinterpret_cast<SyntaxNode**>(ptr);
+            case detail::ChildEntry::ListChild:
+                return static_cast<SyntaxNode*>(reinterpret_cast<SyntaxListBase*>(ptr));
+        }
+        SLANG_UNREACHABLE;
+    }
+
     PtrGetChildVisitor visitor;
     return visit(visitor, index);
 }
 
 TokenOrSyntax SyntaxNode::getChild(size_t index) {
+    if (kind > SyntaxKind::SeparatedList) {
+        auto& table = detail::childTables[size_t(kind)];
+        if (index >= table.count)
+            return nullptr;
+
+        auto& entry = table.entries[index];
+        auto ptr = reinterpret_cast<char*>(this) + entry.offset;
+        switch (entry.kind) {
+            case detail::ChildEntry::TokenChild:
+                return *reinterpret_cast<parsing::Token*>(ptr);
+            case detail::ChildEntry::NodeChild:
+                return *reinterpret_cast<SyntaxNode**>(ptr);
+            case detail::ChildEntry::ListChild:
+                return static_cast<SyntaxNode*>(reinterpret_cast<SyntaxListBase*>(ptr));
+        }
+        SLANG_UNREACHABLE;
+    }
+
     GetChildVisitor visitor;
     return visit(visitor, index);
 }
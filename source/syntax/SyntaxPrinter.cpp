@@ -9,6 +9,7 @@
 
 #include "slang/parsing/ParserMetadata.h"
 #include "slang/syntax/SyntaxNode.h"
+#include "slang/syntax/SyntaxTokenStore.h"
 #include "slang/syntax/SyntaxTree.h"
 #include "slang/text/SourceManager.h"
 
@@ -97,17 +98,46 @@ SyntaxPrinter& SyntaxPrinter::print(Token token) {
 }
 
 SyntaxPrinter& SyntaxPrinter::print(const SyntaxNode& node) {
-    size_t childCount = node.getChildCount();
-    for (size_t i = 0; i < childCount; i++) {
-        if (auto childNode = node.childNode(i); childNode)
-            print(*childNode);
-        else if (auto token = node.childToken(i); token)
+    for (auto child : node.children()) {
+        if (child.isNode()) {
+            if (auto childNode = child.node())
+                print(*childNode);
+        }
+        else if (auto token = child.token()) {
             print(token);
+        }
+    }
+    return *this;
+}
+
+SyntaxPrinter& SyntaxPrinter::print(const SyntaxTokenStore& store) {
+    for (size_t i = 0; i < store.size(); i++) {
+        for (uint32_t t = store.triviaOffsets[i]; t < store.triviaOffsets[i + 1]; t++)
+            append(store.triviaTexts[t]);
+        append(store.texts[i]);
     }
     return *this;
 }
 
 SyntaxPrinter& SyntaxPrinter::print(const SyntaxTree& tree) {
+    // A tree that came straight from the parser renders back to exactly the
+    // text of its main source buffer. When the settings ask for a faithful
+    // reproduction anyway -- all trivia, comments, directives, and skipped
+    // text included, expansions excluded, no newline squashing -- the
+    // original text can be block-copied from the source manager instead of
+    // walking every node and token. This is the printFile configuration, so
+    // whole-file printing of unmodified trees is a single copy.
+    if (tree.isVerbatimSource() && includeTrivia && includeComments && includeDirectives &&
+        includeSkipped && !includePreprocessed && !squashNewlines &&
+        !tree.getConsumedBuffers().empty()) {
+        auto text = tree.sourceManager().getSourceText(tree.getConsumedBuffers()[0]);
+        if (!text.empty() && text.back() == '\0')
+            text.remove_suffix(1);
+
+        buffer.append(text);
+        return *this;
+    }
+
     print(tree.root());
     if (tree.root().kind != SyntaxKind::CompilationUnit && tree.getMetadata().eofToken)
         print(tree.getMetadata().eofToken);
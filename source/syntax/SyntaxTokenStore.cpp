@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// SyntaxTokenStore.cpp
+// Columnar storage of the tokens in a syntax tree
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/syntax/SyntaxTokenStore.h"
+
+#include "slang/parsing/ParserMetadata.h"
+#include "slang/syntax/SyntaxNode.h"
+#include "slang/syntax/SyntaxTree.h"
+
+namespace slang::syntax {
+
+using namespace parsing;
+
+SyntaxTokenStore SyntaxTokenStore::build(const SyntaxNode& node) {
+    SyntaxTokenStore store;
+    store.triviaOffsets.push_back(0);
+    store.addNode(node);
+    return store;
+}
+
+SyntaxTokenStore SyntaxTokenStore::build(const SyntaxTree& tree) {
+    SyntaxTokenStore store;
+    store.triviaOffsets.push_back(0);
+    store.addNode(tree.root());
+    if (tree.root().kind != SyntaxKind::CompilationUnit && tree.getMetadata().eofToken)
+        store.addToken(tree.getMetadata().eofToken);
+    return store;
+}
+
+void SyntaxTokenStore::addNode(const SyntaxNode& node) {
+    size_t childCount = node.getChildCount();
+    for (size_t i = 0; i < childCount; i++) {
+        if (auto childNode = node.childNode(i); childNode)
+            addNode(*childNode);
+        else if (auto token = node.childToken(i); token)
+            addToken(token);
+    }
+}
+
+void SyntaxTokenStore::addToken(Token token) {
+    for (const auto& t : token.trivia())
+        addTrivia(t);
+
+    kinds.push_back(token.kind);
+    locations.push_back(token.location());
+    texts.push_back(token.rawText());
+    triviaOffsets.push_back(uint32_t(triviaTexts.size()));
+}
+
+void SyntaxTokenStore::addTrivia(Trivia trivia) {
+    switch (trivia.kind) {
+        case TriviaKind::Directive:
+        case TriviaKind::SkippedSyntax:
+            // Flatten the nested tokens into the store so that the flat
+            // sequence still covers the full source text.
+            addNode(*trivia.syntax());
+            break;
+        case TriviaKind::SkippedTokens:
+            for (Token t : trivia.getSkippedTokens())
+                addToken(t);
+            break;
+        default:
+            triviaTexts.push_back(trivia.getRawText());
+            break;
+    }
+}
+
+} // namespace slang::syntax
@@ -10,6 +10,7 @@
 #include "slang/parsing/Parser.h"
 #include "slang/parsing/ParserMetadata.h"
 #include "slang/parsing/Preprocessor.h"
+#include "slang/syntax/SyntaxTokenStore.h"
 #include "slang/text/SourceManager.h"
 #include "slang/util/TimeTrace.h"
 
@@ -30,6 +31,10 @@ SyntaxTree::SyntaxTree(SyntaxNode* root, SourceManager& sourceManager, BumpAlloc
         }
         if (!metadata->eofToken)
             metadata->eofToken = parent->getMetadata().eofToken.deepClone(this->alloc);
+
+        // The root may reference nodes still owned by the parent tree,
+        // so keep it alive alongside us.
+        parentTree = std::move(parent);
     }
 }
 
@@ -116,6 +121,39 @@ std::shared_ptr<SyntaxTree> SyntaxTree::fromBuffers(std::span<const SourceBuffer
     return create(sourceManager, buffers, options, inheritedMacros, false);
 }
 
+const SyntaxTokenStore& SyntaxTree::getTokenStore() const {
+    if (!tokenStore)
+        tokenStore = std::make_unique<SyntaxTokenStore>(SyntaxTokenStore::build(*this));
+    return *tokenStore;
+}
+
+uint64_t SyntaxTree::getContentHash() const {
+    if (contentHash)
+        return *contentHash;
+
+    // Hash the text of every buffer consumed during the parse, in order,
+    // then fold in the preprocessor options that can change the result of
+    // parsing the same text.
+    namespace hashing = slang::detail::hashing;
+    uint64_t result = hashing::hash(uint64_t(consumedBuffers.size()));
+    auto mixIn = [&](std::string_view text) {
+        result = hashing::mix(result, hashing::hash(text.data(), text.size()));
+    };
+
+    for (auto id : consumedBuffers)
+        mixIn(sourceMan.getSourceText(id));
+
+    auto ppOptions = options_.getOrDefault<PreprocessorOptions>();
+    for (auto& def : ppOptions.predefines)
+        mixIn(def);
+    for (auto& undef : ppOptions.undefines)
+        mixIn(undef);
+    mixIn(toString(ppOptions.languageVersion));
+
+    contentHash = result;
+    return result;
+}
+
 SourceManager& SyntaxTree::getDefaultSourceManager() {
     static SourceManager instance;
     return instance;
@@ -123,10 +161,39 @@ SourceManager& SyntaxTree::getDefaultSourceManager() {
 
 SyntaxTree::SyntaxTree(SyntaxNode* root, const SourceLibrary* library, SourceManager& sourceManager,
                        BumpAllocator&& alloc, Diagnostics&& diagnostics, ParserMetadata&& metadata,
-                       std::vector<const DefineDirectiveSyntax*>&& macros, Bag options) :
+                       std::vector<const DefineDirectiveSyntax*>&& macros,
+                       std::vector<BufferID>&& consumedBuffers, Bag options) :
     rootNode(root), library(library), sourceMan(sourceManager), alloc(std::move(alloc)),
     diagnosticsBuffer(std::move(diagnostics)), options_(std::move(options)),
-    metadata(std::make_unique<ParserMetadata>(std::move(metadata))), macros(std::move(macros)) {
+    metadata(std::make_unique<ParserMetadata>(std::move(metadata))), macros(std::move(macros)),
+    consumedBuffers(std::move(consumedBuffers)) {
+}
+
+std::shared_ptr<SyntaxTree> SyntaxTree::compact() const {
+    BumpAllocator newAlloc;
+    auto newRoot = deepClone(*rootNode, newAlloc);
+
+    std::vector<const DefineDirectiveSyntax*> newMacros;
+    newMacros.reserve(macros.size());
+    for (auto macro : macros) {
+        if (macro)
+            macro = deepClone(*macro, newAlloc);
+        newMacros.push_back(macro);
+    }
+
+    auto result = std::shared_ptr<SyntaxTree>(
+        new SyntaxTree(newRoot, library, sourceMan, std::move(newAlloc),
+                       Diagnostics(diagnosticsBuffer), ParserMetadata::fromSyntax(*newRoot),
+                       std::move(newMacros), std::vector<BufferID>(consumedBuffers), options_));
+    result->isLibraryUnit = isLibraryUnit;
+    result->verbatimSource = verbatimSource;
+
+    // The EOF token lives in the metadata rather than the tree itself,
+    // so carry it over explicitly.
+    if (!result->metadata->eofToken && metadata->eofToken)
+        result->metadata->eofToken = metadata->eofToken.deepClone(result->alloc);
+
+    return result;
 }
 
 std::shared_ptr<SyntaxTree> SyntaxTree::create(SourceManager& sourceManager,
@@ -144,6 +211,8 @@ std::shared_ptr<SyntaxTree> SyntaxTree::create(SourceManager& sourceManager,
     });
 
     BumpAllocator alloc;
+    alloc.setDefaultCategory(AllocCategory::SyntaxNodes);
+
     Diagnostics diagnostics;
     Preprocessor preprocessor(sourceManager, alloc, diagnostics, options, inheritedMacros);
 
@@ -170,9 +239,104 @@ std::shared_ptr<SyntaxTree> SyntaxTree::create(SourceManager& sourceManager,
             return create(sourceManager, sources, options, inheritedMacros, false);
     }
 
-    return std::shared_ptr<SyntaxTree>(
+    std::vector<BufferID> consumed(preprocessor.getConsumedBuffers().begin(),
+                                   preprocessor.getConsumedBuffers().end());
+    auto result = std::shared_ptr<SyntaxTree>(
         new SyntaxTree(root, library, sourceManager, std::move(alloc), std::move(diagnostics),
-                       parser.getMetadata(), preprocessor.getDefinedMacros(), options));
+                       parser.getMetadata(), preprocessor.getDefinedMacros(), std::move(consumed),
+                       options));
+
+    // A freshly parsed single-source tree renders back to exactly the text of
+    // its buffer, which printing can exploit.
+    result->verbatimSource = sources.size() == 1;
+    return result;
+}
+
+std::shared_ptr<SyntaxTree> SyntaxTree::reparse(const std::shared_ptr<SyntaxTree>& oldTree,
+                                                const SourceBuffer& buffer, size_t editOffset,
+                                                const Bag& options) {
+    SLANG_ASSERT(oldTree);
+    auto& sourceManager = oldTree->sourceManager();
+    auto fullParse = [&] { return fromBuffer(buffer, sourceManager, options); };
+
+    // Reuse requires a plain single-buffer compilation unit; library maps,
+    // guessed snippets, and trees that pulled in include files get a full parse.
+    if (oldTree->root().kind != SyntaxKind::CompilationUnit ||
+        oldTree->consumedBuffers.size() != 1) {
+        return fullParse();
+    }
+
+    auto oldBuffer = oldTree->consumedBuffers[0];
+    auto& oldUnit = oldTree->root().as<CompilationUnitSyntax>();
+
+    // Find the first top-level member whose text extends past the start of
+    // the edit; everything before that is structurally unchanged. Lexing
+    // restarts right after the previous member, so the trivia between the
+    // two is re-lexed as part of the new tail.
+    size_t firstAffected = 0;
+    size_t restartOffset = 0;
+    for (auto member : oldUnit.members) {
+        Token first = member->getFirstToken();
+        Token last = member->getLastToken();
+        if (!first || !last || first.location().buffer() != oldBuffer)
+            return fullParse();
+
+        size_t endOffset = last.location().offset() + last.rawText().size();
+        if (endOffset > editOffset)
+            break;
+
+        firstAffected++;
+        restartOffset = endOffset;
+    }
+
+    if (restartOffset >= buffer.data.size())
+        return fullParse();
+
+    // Any directive or macro usage ahead of the restart point could change
+    // how the rest of the file lexes or parses, so don't try to resume in
+    // the middle of that.
+    if (std::string_view(buffer.data.data(), restartOffset).find('`') != std::string_view::npos)
+        return fullParse();
+
+    BumpAllocator alloc;
+    alloc.setDefaultCategory(AllocCategory::SyntaxNodes);
+
+    // Diagnostics issued against the unchanged prefix are still valid (the
+    // old buffer's text matches the new one up to the restart point), so
+    // carry them over ahead of whatever the tail parse produces.
+    Diagnostics diagnostics;
+    for (auto& diag : oldTree->diagnosticsBuffer) {
+        if (diag.location.buffer() == oldBuffer && diag.location.offset() < restartOffset)
+            diagnostics.push_back(diag);
+    }
+
+    Preprocessor preprocessor(sourceManager, alloc, diagnostics, options);
+    preprocessor.pushSource(buffer, restartOffset);
+
+    Parser parser(preprocessor, options);
+    auto& tailUnit = parser.parseCompilationUnit();
+
+    // Splice the reused prefix together with the freshly parsed tail.
+    SmallVector<MemberSyntax*> memberBuf;
+    for (size_t i = 0; i < firstAffected; i++)
+        memberBuf.push_back(oldUnit.members[i]);
+    for (auto member : tailUnit.members)
+        memberBuf.push_back(member);
+
+    auto root = alloc.emplace<CompilationUnitSyntax>(SyntaxList<MemberSyntax>(memberBuf.copy(alloc)),
+                                                     tailUnit.endOfFile);
+
+    std::vector<BufferID> consumed(preprocessor.getConsumedBuffers().begin(),
+                                   preprocessor.getConsumedBuffers().end());
+    auto result = std::shared_ptr<SyntaxTree>(
+        new SyntaxTree(root, oldTree->library, sourceManager, std::move(alloc),
+                       std::move(diagnostics), ParserMetadata::fromSyntax(*root),
+                       preprocessor.getDefinedMacros(), std::move(consumed), options));
+    result->isLibraryUnit = oldTree->isLibraryUnit;
+
+    // The reused members still live in the old tree's allocator.
+    result->parentTree = oldTree;
+    return result;
 }
 
 std::shared_ptr<SyntaxTree> SyntaxTree::fromLibraryMapFile(std::string_view path,
@@ -211,9 +375,14 @@ std::shared_ptr<SyntaxTree> SyntaxTree::fromLibraryMapBuffer(const SourceBuffer&
     Parser parser(preprocessor, options);
     auto& root = parser.parseLibraryMap();
 
-    return std::shared_ptr<SyntaxTree>(
+    std::vector<BufferID> consumed(preprocessor.getConsumedBuffers().begin(),
+                                   preprocessor.getConsumedBuffers().end());
+    auto result = std::shared_ptr<SyntaxTree>(
         new SyntaxTree(&root, nullptr, sourceManager, std::move(alloc), std::move(diagnostics),
-                       parser.getMetadata(), preprocessor.getDefinedMacros(), options));
+                       parser.getMetadata(), preprocessor.getDefinedMacros(), std::move(consumed),
+                       options));
+    result->verbatimSource = true;
+    return result;
 }
 
 } // namespace slang::syntax
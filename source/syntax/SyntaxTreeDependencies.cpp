@@ -0,0 +1,187 @@
+//------------------------------------------------------------------------------
+// SyntaxTreeDependencies.cpp
+// Tracks name-level dependencies between syntax trees
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/syntax/SyntaxTreeDependencies.h"
+
+#include "slang/parsing/ParserMetadata.h"
+#include "slang/syntax/AllSyntax.h"
+#include "slang/syntax/SyntaxTree.h"
+
+namespace slang::syntax {
+
+using namespace parsing;
+
+static void collectDeclaredNames(const SyntaxNode& node, flat_hash_set<std::string_view>& names) {
+    auto addName = [&](Token name) {
+        if (!name.valueText().empty())
+            names.emplace(name.valueText());
+    };
+
+    switch (node.kind) {
+        case SyntaxKind::CompilationUnit:
+            for (auto member : node.as<CompilationUnitSyntax>().members)
+                collectDeclaredNames(*member, names);
+            break;
+        case SyntaxKind::ModuleDeclaration:
+        case SyntaxKind::InterfaceDeclaration:
+        case SyntaxKind::ProgramDeclaration:
+        case SyntaxKind::PackageDeclaration:
+            addName(node.as<ModuleDeclarationSyntax>().header->name);
+            break;
+        case SyntaxKind::UdpDeclaration:
+            addName(node.as<UdpDeclarationSyntax>().name);
+            break;
+        case SyntaxKind::ConfigDeclaration:
+            addName(node.as<ConfigDeclarationSyntax>().name);
+            break;
+        case SyntaxKind::ClassDeclaration:
+            addName(node.as<ClassDeclarationSyntax>().name);
+            break;
+        default:
+            break;
+    }
+}
+
+SyntaxTreeDependencyGraph::Entry SyntaxTreeDependencyGraph::makeEntry(
+    std::shared_ptr<SyntaxTree> tree) {
+
+    Entry entry;
+    collectDeclaredNames(tree->root(), entry.declares);
+
+    auto& meta = tree->getMetadata();
+    for (auto& name : meta.globalInstances)
+        entry.references.emplace(name);
+
+    for (auto idName : meta.classPackageNames) {
+        if (!idName->identifier.valueText().empty())
+            entry.references.emplace(idName->identifier.valueText());
+    }
+
+    for (auto import : meta.packageImports) {
+        for (auto item : import->items) {
+            if (!item->package.valueText().empty())
+                entry.references.emplace(item->package.valueText());
+        }
+    }
+
+    for (auto port : meta.interfacePorts) {
+        if (port->nameOrKeyword.kind == TokenKind::Identifier)
+            entry.references.emplace(port->nameOrKeyword.valueText());
+    }
+
+    // Defparams and bind directives can reach across the hierarchy in ways
+    // that name matching doesn't capture, so flag the tree as having global
+    // side effects and treat it conservatively.
+    entry.hasSideEffects = meta.hasDefparams || meta.hasBindDirectives;
+    entry.tree = std::move(tree);
+    return entry;
+}
+
+void SyntaxTreeDependencyGraph::add(std::shared_ptr<SyntaxTree> tree) {
+    trees.push_back(tree);
+    entries.push_back(makeEntry(std::move(tree)));
+}
+
+std::vector<std::shared_ptr<SyntaxTree>> SyntaxTreeDependencyGraph::collectAffected(
+    flat_hash_set<std::string_view>&& dirtyNames, bool dirtyHasSideEffects,
+    const SyntaxTree* skip) const {
+
+    std::vector<std::shared_ptr<SyntaxTree>> result;
+    if (dirtyHasSideEffects) {
+        // Everything could be affected; no point doing name matching.
+        for (auto& entry : entries) {
+            if (entry.tree.get() != skip)
+                result.push_back(entry.tree);
+        }
+        return result;
+    }
+
+    // Iterate to a fixpoint: a tree that references a dirty name is affected,
+    // and the names it declares become dirty in turn so that its dependents
+    // are picked up transitively.
+    std::vector<bool> affected(entries.size());
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (affected[i])
+                continue;
+
+            auto& entry = entries[i];
+            bool hit = entry.hasSideEffects;
+            if (!hit) {
+                for (auto& name : entry.references) {
+                    if (dirtyNames.contains(name)) {
+                        hit = true;
+                        break;
+                    }
+                }
+            }
+
+            if (hit) {
+                affected[i] = true;
+                changed = true;
+                for (auto& name : entry.declares)
+                    dirtyNames.emplace(name);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (affected[i] && entries[i].tree.get() != skip)
+            result.push_back(entries[i].tree);
+    }
+    return result;
+}
+
+std::vector<std::shared_ptr<SyntaxTree>> SyntaxTreeDependencyGraph::replace(
+    const SyntaxTree& oldTree, std::shared_ptr<SyntaxTree> newTree) {
+
+    auto entry = makeEntry(newTree);
+
+    // Names declared by either version of the tree are dirty; a deleted
+    // declaration affects its users just as much as a changed one does.
+    flat_hash_set<std::string_view> dirtyNames = entry.declares;
+    bool sideEffects = entry.hasSideEffects;
+
+    bool found = false;
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (entries[i].tree.get() == &oldTree) {
+            for (auto& name : entries[i].declares)
+                dirtyNames.emplace(name);
+            sideEffects |= entries[i].hasSideEffects;
+
+            trees[i] = newTree;
+            entries[i] = std::move(entry);
+            found = true;
+            break;
+        }
+    }
+
+    if (!found) {
+        trees.push_back(newTree);
+        entries.push_back(std::move(entry));
+    }
+
+    auto result = collectAffected(std::move(dirtyNames), sideEffects, newTree.get());
+    result.insert(result.begin(), std::move(newTree));
+    return result;
+}
+
+std::vector<std::shared_ptr<SyntaxTree>> SyntaxTreeDependencyGraph::getDependents(
+    const SyntaxTree& tree) const {
+
+    for (auto& entry : entries) {
+        if (entry.tree.get() == &tree) {
+            return collectAffected(flat_hash_set<std::string_view>(entry.declares),
+                                   entry.hasSideEffects, &tree);
+        }
+    }
+    return {};
+}
+
+} // namespace slang::syntax
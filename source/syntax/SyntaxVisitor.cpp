@@ -13,12 +13,50 @@ using namespace slang;
 using namespace slang::syntax;
 using namespace slang::syntax::detail;
 
+// Collects every node that lies on a path from the root down to an edited
+// node. Only these "spine" nodes need to be recreated when applying changes;
+// everything else can be shared with the original tree. The spines are found
+// by descending from the root rather than following parent pointers upward:
+// subtrees shared by a previous transform keep parents pointing into the tree
+// they were first created in, so an upward walk from an edit can leave the
+// tree being transformed entirely once rewrites are chained.
+flat_hash_set<const SyntaxNode*> collectAffected(const SyntaxNode& root,
+                                                 const ChangeCollection& commits) {
+    flat_hash_set<const SyntaxNode*> targets;
+    for (auto& [node, _] : commits.insertBefore)
+        targets.insert(node);
+    for (auto& [node, _] : commits.insertAfter)
+        targets.insert(node);
+    for (auto& [node, _] : commits.removeOrReplace)
+        targets.insert(node);
+    for (auto& [node, _] : commits.listInsertAtFront)
+        targets.insert(node);
+    for (auto& [node, _] : commits.listInsertAtBack)
+        targets.insert(node);
+
+    flat_hash_set<const SyntaxNode*> result;
+    auto descend = [&](auto&& self, const SyntaxNode& node) -> bool {
+        bool affected = targets.contains(&node);
+        for (size_t i = 0; i < node.getChildCount(); i++) {
+            if (auto child = node.childNode(i))
+                affected |= self(self, *child);
+        }
+
+        if (affected)
+            result.insert(&node);
+        return affected;
+    };
+    descend(descend, root);
+    return result;
+}
+
 struct CloneVisitor {
     BumpAllocator& alloc;
     const ChangeCollection& commits;
+    flat_hash_set<const SyntaxNode*> affected;
 
-    CloneVisitor(BumpAllocator& alloc, const ChangeCollection& commits) :
-        alloc(alloc), commits(commits) {}
+    CloneVisitor(BumpAllocator& alloc, const ChangeCollection& commits, const SyntaxNode& root) :
+        alloc(alloc), commits(commits), affected(collectAffected(root, commits)) {}
 
 #ifdef _MSC_VER
 #    pragma warning(push)
@@ -26,6 +64,13 @@ struct CloneVisitor {
 #endif
     template<typename T>
     SyntaxNode* visit(const T& node) {
+        // Subtrees that contain no edits are shared with the original tree
+        // by pointer instead of being cloned; only the spine from the root
+        // down to each edit is recreated. The new tree holds a reference to
+        // the original tree, keeping the shared nodes alive.
+        if (!affected.contains(&node))
+            return const_cast<T*>(&node);
+
         T* cloned = clone(node, alloc);
 
         constexpr bool IsList = std::is_same_v<T, SyntaxListBase>;
@@ -151,7 +196,7 @@ std::shared_ptr<SyntaxTree> transformTree(BumpAllocator&& alloc,
                                           const ChangeCollection& commits,
                                           const std::vector<std::shared_ptr<SyntaxTree>>& tempTrees,
                                           const SourceLibrary* library) {
-    CloneVisitor visitor(alloc, commits);
+    CloneVisitor visitor(alloc, commits, tree->root());
     SyntaxNode* root = tree->root().visit(visitor);
 
     // Steal ownership of any temporary syntax trees that the user created; once we return the
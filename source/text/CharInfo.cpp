@@ -8,6 +8,8 @@
 #include "slang/text/CharInfo.h"
 
 #include <algorithm>
+#include <bit>
+#include <cstring>
 #include <span>
 
 #include "slang/util/Util.h"
@@ -325,4 +327,54 @@ int charWidthUnicode(uint32_t c) {
     return 1;
 }
 
+bool isValidUtf8(std::string_view text) {
+    const char* cur = text.data();
+    const char* end = cur + text.size();
+    while (cur != end) {
+        // Skip over runs of ASCII eight bytes at a time; the sign bits of the
+        // word tell us exactly where the first non-ASCII byte is, if any.
+        while (end - cur >= 8) {
+            uint64_t word;
+            memcpy(&word, cur, sizeof(word));
+            if (uint64_t hits = word & 0x8080808080808080ull) {
+                cur += std::countr_zero(hits) >> 3;
+                break;
+            }
+            cur += 8;
+        }
+
+        if (cur == end)
+            break;
+
+        if (isASCII(*cur)) {
+            cur++;
+            continue;
+        }
+
+        // Decode one multi-byte sequence and check it for errors. Near the
+        // end of the text we have to copy into a padded buffer first since
+        // the decoder always reads four bytes.
+        uint32_t c;
+        int error;
+        int computedLen;
+        if (end - cur >= 4) {
+            cur = utf8Decode(cur, &c, &error, computedLen);
+        }
+        else {
+            char buf[7] = {};
+            auto spaceLeft = end - cur;
+            memcpy(buf, cur, size_t(spaceLeft));
+
+            auto next = utf8Decode(buf, &c, &error, computedLen);
+            if (next - buf > spaceLeft)
+                return false;
+            cur += next - buf;
+        }
+
+        if (error)
+            return false;
+    }
+    return true;
+}
+
 } // namespace slang
@@ -7,9 +7,13 @@
 //------------------------------------------------------------------------------
 #include "slang/text/Glob.h"
 
+#include <algorithm>
+#include <mutex>
+
 #include "slang/util/Hash.h"
 #include "slang/util/OS.h"
 #include "slang/util/String.h"
+#include "slang/util/ThreadPool.h"
 
 namespace fs = std::filesystem;
 
@@ -63,23 +67,53 @@ static void iterDirectory(const fs::path& path, SmallVector<fs::path>& results,
     }
 }
 
-static void iterDirectoriesRecursive(const fs::path& path, SmallVector<fs::path>& results,
-                                     flat_hash_set<std::string>& visited) {
-    SmallVector<fs::path> local;
-    iterDirectory(path, local, GlobMode::Directories);
+// Expands the recursive '...' directory walk by fanning each discovered
+// directory out as its own task on a thread pool. These walks are dominated
+// by stat and readdir calls, so overlapping them hides most of the filesystem
+// latency on large trees. Task completion order is nondeterministic, so the
+// collected directories are sorted before being returned.
+class RecursiveDirWalker {
+public:
+    void run(const fs::path& path, SmallVector<fs::path>& results) {
+        scan(path);
+        pool.waitForAll();
+
+        std::ranges::sort(found);
+        results.reserve(results.size() + found.size());
+        for (auto& p : found)
+            results.emplace_back(std::move(p));
+    }
 
-    results.reserve(results.size() + local.size());
-    for (auto& p : local) {
-        // Avoid recursing into directories we've already visited (via symlinks).
-        std::error_code ec;
-        fs::path canonical = fs::weakly_canonical(p, ec);
+private:
+    void scan(const fs::path& path) {
+        SmallVector<fs::path> local;
+        iterDirectory(path, local, GlobMode::Directories);
 
-        if (!ec && visited.emplace(getU8Str(canonical)).second) {
-            iterDirectoriesRecursive(canonical, results, visited);
-            results.emplace_back(std::move(canonical));
+        for (auto& p : local) {
+            // Avoid recursing into directories we've already visited (via symlinks).
+            std::error_code ec;
+            fs::path canonical = fs::weakly_canonical(p, ec);
+            if (ec)
+                continue;
+
+            bool inserted;
+            {
+                std::scoped_lock lock(mutex);
+                inserted = visited.emplace(getU8Str(canonical)).second;
+                if (inserted)
+                    found.emplace_back(canonical);
+            }
+
+            if (inserted)
+                pool.pushTask([this, dir = std::move(canonical)] { scan(dir); });
         }
     }
-}
+
+    ThreadPool pool;
+    std::mutex mutex;
+    flat_hash_set<std::string> visited;
+    std::vector<fs::path> found;
+};
 
 static void globDir(const fs::path& path, std::string_view pattern, SmallVector<fs::path>& results,
                     GlobMode mode) {
@@ -104,8 +138,7 @@ GlobRank svGlobInternal(const fs::path& basePath, std::string_view pattern, Glob
         // and means to recursively pull all directories.
         if (pattern.starts_with("..."sv)) {
             SmallVector<fs::path> dirs;
-            flat_hash_set<std::string> visited;
-            iterDirectoriesRecursive(currPath, dirs, visited);
+            RecursiveDirWalker().run(currPath, dirs);
             dirs.emplace_back(std::move(currPath));
 
             pattern = pattern.substr(3);
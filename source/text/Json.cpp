@@ -8,20 +8,52 @@
 #include "slang/text/Json.h"
 
 #include <climits>
+#include <ostream>
 
-#include "slang/text/FormatBuffer.h"
+#include "slang/text/SegmentedBuffer.h"
 #include "slang/util/SmallVector.h"
 #include "slang/util/String.h"
 
 namespace slang {
 
-JsonWriter::JsonWriter() : buffer(std::make_unique<FormatBuffer>()) {
+JsonWriter::JsonWriter() : buffer(std::make_unique<SegmentedBuffer>()) {
 }
 
 JsonWriter::~JsonWriter() = default;
 
 std::string_view JsonWriter::view() const {
-    return std::string_view(buffer->data(), findLastComma());
+    viewScratch = buffer->str();
+    viewScratch.resize(findLastComma());
+    return viewScratch;
+}
+
+void JsonWriter::streamTo(std::ostream& os, size_t chunkSize) {
+    stream = &os;
+    streamChunkSize = std::max<size_t>(chunkSize, 256);
+}
+
+void JsonWriter::finishStream() {
+    if (!stream)
+        return;
+
+    buffer->resize(findLastComma());
+    buffer->extractTo(*stream, buffer->size());
+    stream->flush();
+}
+
+void JsonWriter::maybeFlush() {
+    if (!stream || buffer->size() < streamChunkSize)
+        return;
+
+    // The tail of the buffer can still be rewritten later to trim a dangling
+    // comma (plus, when pretty printing, the trailing newline and indentation
+    // that follow it), so retain enough bytes to cover that and flush only
+    // the stable prefix.
+    size_t tail = size_t(currentIndent) + 2;
+    if (buffer->size() <= tail)
+        return;
+
+    buffer->extractTo(*stream, buffer->size() - tail);
 }
 
 void JsonWriter::startObject() {
@@ -42,6 +74,7 @@ void JsonWriter::endObject() {
     else {
         buffer->append("},");
     }
+    maybeFlush();
 }
 
 void JsonWriter::startArray() {
@@ -62,6 +95,7 @@ void JsonWriter::endArray() {
     else {
         buffer->append("],");
     }
+    maybeFlush();
 }
 
 void JsonWriter::writeProperty(std::string_view name) {
@@ -96,6 +130,12 @@ void JsonWriter::writeValue(bool value) {
     endValue();
 }
 
+void JsonWriter::writeDirect(std::string_view rawJson) {
+    buffer->append(rawJson);
+    endValue();
+    maybeFlush();
+}
+
 void JsonWriter::writeNewLine() {
     buffer->append("\n");
 }
@@ -162,19 +202,20 @@ void JsonWriter::endValue() {
     buffer->append(",");
     if (pretty)
         buffer->format("\n{:{}}", "", currentIndent);
+    maybeFlush();
 }
 
 size_t JsonWriter::findLastComma() const {
-    size_t size = buffer->size();
-    if (pretty) {
-        while (size && (buffer->data()[size - 1] == ' ' || buffer->data()[size - 1] == '\n'))
-            size--;
-    }
-
-    if (size && buffer->data()[size - 1] == ',')
-        size--;
-
-    return size;
+    bool sawComma = false;
+    size_t trimmed = buffer->scanBack([&](char c) {
+        if (sawComma)
+            return false;
+        if (pretty && (c == ' ' || c == '\n'))
+            return true;
+        sawComma = c == ',';
+        return sawComma;
+    });
+    return buffer->size() - trimmed;
 }
 
 } // namespace slang
@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+// SegmentedBuffer.cpp
+// A growable character buffer made of fixed-capacity segments
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/text/SegmentedBuffer.h"
+
+#include <algorithm>
+#include <ostream>
+
+namespace slang {
+
+void SegmentedBuffer::append(std::string_view str) {
+    while (!str.empty()) {
+        if (segments.empty() || segments.back().size() == segments.back().capacity())
+            addSegment();
+
+        auto& seg = segments.back();
+        size_t count = std::min(str.size(), seg.capacity() - seg.size());
+        seg.append(str.data(), count);
+        str.remove_prefix(count);
+        totalSize += count;
+    }
+}
+
+void SegmentedBuffer::clear() {
+    segments.clear();
+    totalSize = 0;
+    nextSegmentSize = InitialSegmentSize;
+}
+
+void SegmentedBuffer::resize(size_t newSize) {
+    SLANG_ASSERT(newSize <= totalSize);
+    while (totalSize > newSize) {
+        auto& seg = segments.back();
+        size_t excess = totalSize - newSize;
+        if (seg.size() > excess) {
+            seg.resize(seg.size() - excess);
+            totalSize = newSize;
+        }
+        else {
+            totalSize -= seg.size();
+            segments.pop_back();
+        }
+    }
+}
+
+void SegmentedBuffer::writeTo(std::ostream& os) const {
+    for (auto& seg : segments)
+        os.write(seg.data(), std::streamsize(seg.size()));
+}
+
+void SegmentedBuffer::extractTo(std::ostream& os, size_t count) {
+    SLANG_ASSERT(count <= totalSize);
+
+    size_t wholeSegments = 0;
+    for (auto& seg : segments) {
+        if (count >= seg.size()) {
+            os.write(seg.data(), std::streamsize(seg.size()));
+            count -= seg.size();
+            totalSize -= seg.size();
+            wholeSegments++;
+            if (count == 0)
+                break;
+        }
+        else {
+            os.write(seg.data(), std::streamsize(count));
+            seg.erase(0, count);
+            totalSize -= count;
+            break;
+        }
+    }
+
+    segments.erase(segments.begin(), segments.begin() + ptrdiff_t(wholeSegments));
+}
+
+std::string SegmentedBuffer::str() const {
+    std::string result;
+    result.reserve(totalSize);
+    for (auto& seg : segments)
+        result.append(seg);
+    return result;
+}
+
+void SegmentedBuffer::addSegment() {
+    segments.emplace_back().reserve(nextSegmentSize);
+    nextSegmentSize = std::min(nextSegmentSize * 2, MaxSegmentSize);
+}
+
+} // namespace slang
@@ -7,6 +7,8 @@
 //------------------------------------------------------------------------------
 #include "slang/text/SourceManager.h"
 
+#include <bit>
+#include <cstring>
 #include <string>
 
 #include "slang/text/Glob.h"
@@ -20,9 +22,9 @@ namespace slang {
 static const fs::path emptyPath;
 
 SourceManager::SourceManager() {
-    // add a dummy entry to the start of the directory list so that our file IDs line up
-    FileInfo file;
-    bufferEntries.emplace_back(file);
+    // add a dummy entry to the start of the buffer list so that our file IDs line up
+    std::unique_lock lock(mutex);
+    appendBufferEntry(FileInfo(), lock);
 }
 
 std::error_code SourceManager::addSystemDirectories(std::string_view pattern) {
@@ -48,13 +50,15 @@ std::error_code SourceManager::addUserDirectories(std::string_view pattern) {
 }
 
 size_t SourceManager::getLineNumber(SourceLocation location) const {
-    std::shared_lock lock(mutex);
-    SourceLocation fileLocation = getFullyExpandedLocImpl(location, lock);
-    size_t rawLineNumber = getRawLineNumber(fileLocation, lock);
+    SourceLocation fileLocation = getFullyExpandedLocImpl(location);
+    size_t rawLineNumber = getRawLineNumber(fileLocation);
     if (rawLineNumber == 0)
         return 0;
 
-    auto info = getFileInfo(fileLocation.buffer(), lock);
+    // Line directives can be appended while we're reading them,
+    // so hold the lock here.
+    std::shared_lock lock(mutex);
+    auto info = getFileInfo(fileLocation.buffer());
 
     auto lineDirective = info->getPreviousLineDirective(rawLineNumber);
     if (!lineDirective)
@@ -63,26 +67,82 @@ size_t SourceManager::getLineNumber(SourceLocation location) const {
         return lineDirective->lineOfDirective + (rawLineNumber - lineDirective->lineInFile) - 1;
 }
 
-size_t SourceManager::getColumnNumber(SourceLocation location) const {
+void SourceManager::getLineNumbers(std::span<const SourceLocation> locations,
+                                   std::span<size_t> results) const {
+    SLANG_ASSERT(locations.size() == results.size());
+
+    // Hold the lock for the whole batch since we consult line directives.
     std::shared_lock lock(mutex);
-    auto info = getFileInfo(location.buffer(), lock);
+
+    const FileInfo* info = nullptr;
+    const std::vector<size_t>* lineOffsets = nullptr;
+    std::vector<size_t>::const_iterator cursor;
+    BufferID lastBuffer;
+    size_t lastOffset = 0;
+
+    for (size_t i = 0; i < locations.size(); i++) {
+        SourceLocation fileLocation = getFullyExpandedLocImpl(locations[i]);
+        if (fileLocation.buffer() != lastBuffer || !lineOffsets) {
+            lastBuffer = fileLocation.buffer();
+            lastOffset = 0;
+            lineOffsets = nullptr;
+
+            info = getFileInfo(lastBuffer);
+            if (info && info->data) {
+                lineOffsets = &info->data->getLineOffsets();
+                cursor = lineOffsets->begin();
+            }
+        }
+
+        if (!lineOffsets) {
+            results[i] = 0;
+            continue;
+        }
+
+        // Sorted locations only ever move the cursor forward; an out of order
+        // location falls back to searching from the start of the index.
+        size_t offset = fileLocation.offset();
+        if (offset < lastOffset)
+            cursor = lineOffsets->begin();
+        lastOffset = offset;
+
+        // Same logic as getRawLineNumber: the resulting line is strictly
+        // greater than the given location offset.
+        cursor = std::lower_bound(cursor, lineOffsets->end(), offset);
+        size_t rawLine = size_t(cursor - lineOffsets->begin());
+        if (cursor != lineOffsets->end() && *cursor == offset)
+            rawLine++;
+
+        auto lineDirective = info->getPreviousLineDirective(rawLine);
+        if (!lineDirective)
+            results[i] = rawLine;
+        else
+            results[i] = lineDirective->lineOfDirective + (rawLine - lineDirective->lineInFile) - 1;
+    }
+}
+
+size_t SourceManager::getColumnNumber(SourceLocation location) const {
+    auto info = getFileInfo(location.buffer());
     if (!info || !info->data)
         return 0;
 
     // walk backward to find start of line
-    auto fd = info->data;
+    auto text = info->data->contents();
     size_t lineStart = location.offset();
-    SLANG_ASSERT(lineStart < fd->mem.size());
-    while (lineStart > 0 && fd->mem[lineStart - 1] != '\n' && fd->mem[lineStart - 1] != '\r')
+    SLANG_ASSERT(lineStart < text.size());
+    while (lineStart > 0 && text[lineStart - 1] != '\n' && text[lineStart - 1] != '\r')
         lineStart--;
 
     return location.offset() - lineStart + 1;
 }
 
 std::string_view SourceManager::getFileName(SourceLocation location) const {
+    SourceLocation fileLocation = getFullyExpandedLocImpl(location);
+
+    // Line directives can be appended while we're reading them,
+    // so hold the lock here.
     std::shared_lock lock(mutex);
-    SourceLocation fileLocation = getFullyExpandedLocImpl(location, lock);
-    auto info = getFileInfo(fileLocation.buffer(), lock);
+    auto info = getFileInfo(fileLocation.buffer());
     if (!info || !info->data)
         return "";
 
@@ -90,7 +150,7 @@ std::string_view SourceManager::getFileName(SourceLocation location) const {
     if (info->lineDirectives.empty())
         return info->data->name;
 
-    size_t rawLine = getRawLineNumber(fileLocation, lock);
+    size_t rawLine = getRawLineNumber(fileLocation);
     auto lineDirective = info->getPreviousLineDirective(rawLine);
     if (!lineDirective)
         return info->data->name;
@@ -99,8 +159,7 @@ std::string_view SourceManager::getFileName(SourceLocation location) const {
 }
 
 std::string_view SourceManager::getRawFileName(BufferID buffer) const {
-    std::shared_lock lock(mutex);
-    auto info = getFileInfo(buffer, lock);
+    auto info = getFileInfo(buffer);
     if (!info || !info->data)
         return "";
 
@@ -108,8 +167,7 @@ std::string_view SourceManager::getRawFileName(BufferID buffer) const {
 }
 
 const fs::path& SourceManager::getFullPath(BufferID buffer) const {
-    std::shared_lock lock(mutex);
-    auto info = getFileInfo(buffer, lock);
+    auto info = getFileInfo(buffer);
     if (!info || !info->data)
         return emptyPath;
 
@@ -117,8 +175,7 @@ const fs::path& SourceManager::getFullPath(BufferID buffer) const {
 }
 
 SourceLocation SourceManager::getIncludedFrom(BufferID buffer) const {
-    std::shared_lock lock(mutex);
-    auto info = getFileInfo(buffer, lock);
+    auto info = getFileInfo(buffer);
     if (!info)
         return SourceLocation();
 
@@ -126,8 +183,7 @@ SourceLocation SourceManager::getIncludedFrom(BufferID buffer) const {
 }
 
 const SourceLibrary* SourceManager::getLibraryFor(BufferID buffer) const {
-    std::shared_lock lock(mutex);
-    auto info = getFileInfo(buffer, lock);
+    auto info = getFileInfo(buffer);
     if (!info)
         return nullptr;
 
@@ -135,16 +191,14 @@ const SourceLibrary* SourceManager::getLibraryFor(BufferID buffer) const {
 }
 
 std::string_view SourceManager::getMacroName(SourceLocation location) const {
-    std::shared_lock lock(mutex);
-    while (isMacroArgLocImpl(location, lock))
-        location = getExpansionRangeImpl(location, lock).start();
+    while (isMacroArgLocImpl(location))
+        location = getExpansionRangeImpl(location).start();
 
-    auto buffer = location.buffer();
-    if (!buffer)
+    auto entry = lookupEntry(location.buffer());
+    if (!entry)
         return {};
 
-    SLANG_ASSERT(buffer.getId() < bufferEntries.size());
-    auto info = std::get_if<ExpansionInfo>(&bufferEntries[buffer.getId()]);
+    auto info = std::get_if<ExpansionInfo>(entry);
     if (!info)
         return {};
 
@@ -155,18 +209,15 @@ bool SourceManager::isFileLoc(SourceLocation location) const {
     if (location.buffer() == SourceLocation::NoLocation.buffer())
         return false;
 
-    std::shared_lock lock(mutex);
-    return getFileInfo(location.buffer(), lock) != nullptr;
+    return getFileInfo(location.buffer()) != nullptr;
 }
 
 bool SourceManager::isMacroLoc(SourceLocation location) const {
-    std::shared_lock lock(mutex);
-    return isMacroLocImpl(location, lock);
+    return isMacroLocImpl(location);
 }
 
 bool SourceManager::isMacroArgLoc(SourceLocation location) const {
-    std::shared_lock lock(mutex);
-    return isMacroArgLocImpl(location, lock);
+    return isMacroArgLocImpl(location);
 }
 
 bool SourceManager::isIncludedFileLoc(SourceLocation location) const {
@@ -178,45 +229,37 @@ bool SourceManager::isPreprocessedLoc(SourceLocation location) const {
 }
 
 SourceLocation SourceManager::getExpansionLoc(SourceLocation location) const {
-    std::shared_lock lock(mutex);
-    return getExpansionRangeImpl(location, lock).start();
+    return getExpansionRangeImpl(location).start();
 }
 
 SourceRange SourceManager::getExpansionRange(SourceLocation location) const {
-    std::shared_lock lock(mutex);
-    return getExpansionRangeImpl(location, lock);
+    return getExpansionRangeImpl(location);
 }
 
 SourceLocation SourceManager::getOriginalLoc(SourceLocation location) const {
-    std::shared_lock lock(mutex);
-    return getOriginalLocImpl(location, lock);
+    return getOriginalLocImpl(location);
 }
 
 SourceLocation SourceManager::getFullyOriginalLoc(SourceLocation location) const {
-    std::shared_lock lock(mutex);
-    while (isMacroLocImpl(location, lock))
-        location = getOriginalLocImpl(location, lock);
+    while (isMacroLocImpl(location))
+        location = getOriginalLocImpl(location);
     return location;
 }
 
 SourceLocation SourceManager::getFullyExpandedLoc(SourceLocation location) const {
-    std::shared_lock lock(mutex);
-    return getFullyExpandedLocImpl(location, lock);
+    return getFullyExpandedLocImpl(location);
 }
 
 std::string_view SourceManager::getSourceText(BufferID buffer) const {
-    std::shared_lock lock(mutex);
-    auto info = getFileInfo(buffer, lock);
+    auto info = getFileInfo(buffer);
     if (!info || !info->data)
         return "";
 
-    auto fd = info->data;
-    return std::string_view(fd->mem.data(), fd->mem.size());
+    return info->data->contents();
 }
 
 uint64_t SourceManager::getSortKey(BufferID buffer) const {
-    std::shared_lock lock(mutex);
-    auto info = getFileInfo(buffer, lock);
+    auto info = getFileInfo(buffer);
     if (!info)
         return uint64_t(buffer.getId()) << 32;
 
@@ -227,8 +270,8 @@ SourceLocation SourceManager::createExpansionLoc(SourceLocation originalLoc,
                                                  SourceRange expansionRange, bool isMacroArg) {
     std::unique_lock lock(mutex);
 
-    bufferEntries.emplace_back(ExpansionInfo(originalLoc, expansionRange, isMacroArg));
-    return SourceLocation(BufferID((uint32_t)(bufferEntries.size() - 1), ""sv), 0);
+    auto index = appendBufferEntry(ExpansionInfo(originalLoc, expansionRange, isMacroArg), lock);
+    return SourceLocation(BufferID((uint32_t)index, ""sv), 0);
 }
 
 SourceLocation SourceManager::createExpansionLoc(SourceLocation originalLoc,
@@ -236,8 +279,8 @@ SourceLocation SourceManager::createExpansionLoc(SourceLocation originalLoc,
                                                  std::string_view macroName) {
     std::unique_lock lock(mutex);
 
-    bufferEntries.emplace_back(ExpansionInfo(originalLoc, expansionRange, macroName));
-    return SourceLocation(BufferID((uint32_t)(bufferEntries.size() - 1), macroName), 0);
+    auto index = appendBufferEntry(ExpansionInfo(originalLoc, expansionRange, macroName), lock);
+    return SourceLocation(BufferID((uint32_t)index, macroName), 0);
 }
 
 SourceBuffer SourceManager::assignText(std::string_view text, SourceLocation includedFrom,
@@ -287,6 +330,29 @@ SourceManager::BufferOrError SourceManager::readSource(const fs::path& path,
     return openCached(path, SourceLocation(), library, sortKey);
 }
 
+// Returns the first component of the given relative path, ASCII-lowercased,
+// for matching against cached directory listings. Returns nullopt if the
+// component contains non-ASCII characters, since we can't case fold those
+// the way a case insensitive filesystem would, or if it's a dot entry
+// ("." or ".."), which never appears in a listing even though the path
+// can still resolve through it.
+static std::optional<std::string> getListingProbeName(const fs::path& p) {
+    auto it = p.begin();
+    if (it == p.end())
+        return std::nullopt;
+
+    std::string name = getU8Str(*it);
+    if (name == "." || name == "..")
+        return std::nullopt;
+
+    for (char& c : name) {
+        if (uint8_t(c) >= 0x80)
+            return std::nullopt;
+        c = charToLower(c);
+    }
+    return name;
+}
+
 SourceManager::BufferOrError SourceManager::readHeader(
     std::string_view path, SourceLocation includedFrom, const SourceLibrary* library,
     bool isSystemPath, std::span<std::filesystem::path const> additionalIncludePaths) {
@@ -297,36 +363,56 @@ SourceManager::BufferOrError SourceManager::readHeader(
     if (p.is_absolute())
         return openCached(p, includedFrom, library);
 
+    // Candidate directories are first checked against their in-memory
+    // listing; most of them won't contain the header, and rejecting them
+    // here avoids hitting the filesystem once per directory per directive.
+    auto probeName = getListingProbeName(p);
+    std::string pathKey(path);
+    auto constexpr notFound = std::errc::no_such_file_or_directory;
+
     // system path lookups only look in system directories
     if (isSystemPath) {
         // Separate lock for the include dirs here so that we can iterate
         // over them without having to make a copy. It's unlikely that the
         // list is being modified while we're reading headers anyway.
         std::shared_lock includeDirLock(includeDirMutex);
+        {
+            std::scoped_lock cacheLock(listingMutex);
+            if (auto it = systemHeaderMisses.find(pathKey);
+                it != systemHeaderMisses.end() && it->second == systemDirectories.size()) {
+                return nonstd::make_unexpected(make_error_code(notFound));
+            }
+        }
+
         for (auto& d : systemDirectories) {
+            if (probeName && !directoryMightContain(d, *probeName))
+                continue;
+
             auto result = openCached(d / p, includedFrom, library);
             if (result)
                 return result;
         }
-        return nonstd::make_unexpected(make_error_code(std::errc::no_such_file_or_directory));
+
+        std::scoped_lock cacheLock(listingMutex);
+        systemHeaderMisses.insert_or_assign(std::move(pathKey), systemDirectories.size());
+        return nonstd::make_unexpected(make_error_code(notFound));
     }
 
     // search relative to the current file
     const fs::path* currFileDir = nullptr;
-    {
-        std::shared_lock lock(mutex);
-        auto info = getFileInfo(includedFrom.buffer(), lock);
-        if (info && info->data)
-            currFileDir = info->data->directory;
-    }
+    if (auto info = getFileInfo(includedFrom.buffer()); info && info->data)
+        currFileDir = info->data->directory;
 
-    if (currFileDir) {
+    if (currFileDir && (!probeName || directoryMightContain(*currFileDir, *probeName))) {
         auto result = openCached(*currFileDir / p, includedFrom, library);
         if (result)
             return result;
     }
 
     for (auto& dir : additionalIncludePaths) {
+        if (probeName && !directoryMightContain(dir, *probeName))
+            continue;
+
         auto result = openCached(dir / p, includedFrom, library);
         if (result)
             return result;
@@ -335,6 +421,9 @@ SourceManager::BufferOrError SourceManager::readHeader(
     // Use library-specific include dirs if they exist.
     if (library) {
         for (auto& dir : library->includeDirs) {
+            if (probeName && !directoryMightContain(dir, *probeName))
+                continue;
+
             auto result = openCached(dir / p, includedFrom, library);
             if (result)
                 return result;
@@ -343,20 +432,65 @@ SourceManager::BufferOrError SourceManager::readHeader(
 
     // See comment above about this separate mutex / lock.
     std::shared_lock includeDirLock(includeDirMutex);
+    {
+        // The earlier search stages vary per call site but this final stage
+        // doesn't, so a header that already failed a full scan of the user
+        // directories can skip it entirely.
+        std::scoped_lock cacheLock(listingMutex);
+        if (auto it = userHeaderMisses.find(pathKey);
+            it != userHeaderMisses.end() && it->second == userDirectories.size()) {
+            return nonstd::make_unexpected(make_error_code(notFound));
+        }
+    }
+
     for (auto& d : userDirectories) {
+        if (probeName && !directoryMightContain(d, *probeName))
+            continue;
+
         auto result = openCached(d / p, includedFrom, library);
         if (result)
             return result;
     }
 
-    return nonstd::make_unexpected(make_error_code(std::errc::no_such_file_or_directory));
+    std::scoped_lock cacheLock(listingMutex);
+    userHeaderMisses.insert_or_assign(std::move(pathKey), userDirectories.size());
+    return nonstd::make_unexpected(make_error_code(notFound));
+}
+
+bool SourceManager::directoryMightContain(const fs::path& dir, const std::string& name) {
+    std::scoped_lock lock(listingMutex);
+
+    auto key = getU8Str(dir);
+    auto it = dirListings.find(key);
+    if (it == dirListings.end()) {
+        std::optional<flat_hash_set<std::string>> listing;
+        std::error_code ec;
+        fs::directory_iterator dirIt(dir, ec);
+        if (!ec) {
+            listing.emplace();
+            for (; !ec && dirIt != fs::directory_iterator(); dirIt.increment(ec)) {
+                std::string entry = getU8Str(dirIt->path().filename());
+                for (char& c : entry)
+                    c = charToLower(c);
+                listing->emplace(std::move(entry));
+            }
+
+            // If the listing failed partway through don't trust it.
+            if (ec)
+                listing.reset();
+        }
+
+        it = dirListings.emplace(std::move(key), std::move(listing)).first;
+    }
+
+    return !it->second || it->second->contains(name);
 }
 
 void SourceManager::addLineDirective(SourceLocation location, size_t lineNum, std::string_view name,
                                      uint8_t level) {
     std::unique_lock lock(mutex);
-    SourceLocation fileLocation = getFullyExpandedLocImpl(location, lock);
-    FileInfo* info = getFileInfo(fileLocation.buffer(), lock);
+    SourceLocation fileLocation = getFullyExpandedLocImpl(location);
+    FileInfo* info = getFileInfo(fileLocation.buffer());
     if (!info || !info->data)
         return;
 
@@ -368,14 +502,14 @@ void SourceManager::addLineDirective(SourceLocation location, size_t lineNum, st
     else
         full = fs::path(info->data->name).replace_filename(linePath);
 
-    size_t sourceLineNum = getRawLineNumber(fileLocation, lock);
+    size_t sourceLineNum = getRawLineNumber(fileLocation);
     info->lineDirectives.emplace_back(std::string(getU8Str(full)), sourceLineNum, lineNum, level);
 }
 
 void SourceManager::addDiagnosticDirective(SourceLocation location, std::string_view name,
                                            DiagnosticSeverity severity) {
     std::unique_lock lock(mutex);
-    SourceLocation fileLocation = getFullyExpandedLocImpl(location, lock);
+    SourceLocation fileLocation = getFullyExpandedLocImpl(location);
 
     size_t offset = fileLocation.offset();
     auto& vec = diagDirectives[fileLocation.buffer()];
@@ -398,43 +532,67 @@ std::span<const SourceManager::DiagnosticDirectiveInfo> SourceManager::getDiagno
 }
 
 std::vector<BufferID> SourceManager::getAllBuffers() const {
-    std::shared_lock lock(mutex);
     std::vector<BufferID> result;
-    for (size_t i = 1; i < bufferEntries.size(); i++)
+    size_t count = bufferEntryCount.load(std::memory_order_acquire);
+    for (size_t i = 1; i < count; i++)
         result.push_back(BufferID((uint32_t)i, ""sv));
 
     return result;
 }
 
-template<IsLock TLock>
-SourceManager::FileInfo* SourceManager::getFileInfo(BufferID buffer, TLock&) {
-    if (!buffer || buffer.getId() >= bufferEntries.size())
+const SourceManager::BufferEntry* SourceManager::lookupEntry(BufferID buffer) const {
+    // An acquire load of the count pairs with the release store in
+    // appendBufferEntry, guaranteeing that any entry covered by the
+    // count we observe is fully constructed.
+    if (!buffer || buffer.getId() >= bufferEntryCount.load(std::memory_order_acquire))
         return nullptr;
 
-    return std::get_if<FileInfo>(&bufferEntries[buffer.getId()]);
+    // Chunk N holds 2^N entries, so the chunk and offset for a given
+    // index fall out of the bit width of (index + 1).
+    const size_t index = buffer.getId();
+    const size_t chunk = size_t(std::bit_width(index + 1)) - 1;
+    return &bufferChunks[chunk][index + 1 - (size_t(1) << chunk)];
 }
 
-template<IsLock TLock>
-const SourceManager::FileInfo* SourceManager::getFileInfo(BufferID buffer, TLock&) const {
-    if (!buffer || buffer.getId() >= bufferEntries.size())
-        return nullptr;
+size_t SourceManager::appendBufferEntry(BufferEntry&& entry,
+                                        std::unique_lock<std::shared_mutex>&) {
+    const size_t index = bufferEntryCount.load(std::memory_order_relaxed);
+    const size_t chunk = size_t(std::bit_width(index + 1)) - 1;
+    const size_t offset = index + 1 - (size_t(1) << chunk);
+    SLANG_ASSERT(chunk < MaxBufferChunks);
 
-    return std::get_if<FileInfo>(&bufferEntries[buffer.getId()]);
+    if (offset == 0)
+        bufferChunks[chunk] = std::make_unique<BufferEntry[]>(size_t(1) << chunk);
+    bufferChunks[chunk][offset] = std::move(entry);
+
+    // Publish the new entry for lock-free readers.
+    bufferEntryCount.store(index + 1, std::memory_order_release);
+    return index;
+}
+
+SourceManager::FileInfo* SourceManager::getFileInfo(BufferID buffer) {
+    auto entry = lookupEntry(buffer);
+    return entry ? const_cast<FileInfo*>(std::get_if<FileInfo>(entry)) : nullptr;
+}
+
+const SourceManager::FileInfo* SourceManager::getFileInfo(BufferID buffer) const {
+    auto entry = lookupEntry(buffer);
+    return entry ? std::get_if<FileInfo>(entry) : nullptr;
 }
 
 SourceBuffer SourceManager::createBufferEntry(FileData* fd, SourceLocation includedFrom,
                                               const SourceLibrary* library, uint64_t sortKey,
-                                              std::unique_lock<std::shared_mutex>&) {
+                                              std::unique_lock<std::shared_mutex>& lock) {
     SLANG_ASSERT(fd);
 
     // If no sort key is provided we use the bufferID, but shifted up
     // so that the bottom 32 bits are reserved for custom sort keys.
     if (sortKey == UINT64_MAX)
-        sortKey = bufferEntries.size() << 32;
+        sortKey = bufferEntryCount.load(std::memory_order_relaxed) << 32;
 
-    bufferEntries.emplace_back(FileInfo(fd, library, includedFrom, sortKey));
-    return SourceBuffer{std::string_view(fd->mem.data(), fd->mem.size()), library,
-                        BufferID((uint32_t)(bufferEntries.size() - 1), fd->name)};
+    auto index = appendBufferEntry(FileInfo(fd, library, includedFrom, sortKey), lock);
+    return SourceBuffer{fd->contents(), library, BufferID((uint32_t)index, fd->name),
+                        fd->validUtf8};
 }
 
 bool SourceManager::isCached(const fs::path& path) const {
@@ -484,21 +642,29 @@ SourceManager::BufferOrError SourceManager::openCached(const fs::path& fullPath,
         }
     }
 
-    // do the read
+    // Try to memory map the file if that's been enabled; on any failure
+    // just fall back to doing a normal copying read.
+    std::unique_ptr<MappedFile> mapped;
+    if (enableMemoryMapping)
+        mapped = OS::mapFile(absPath);
+
     SmallVector<char> buffer;
-    if (std::error_code ec = OS::readFile(absPath, buffer)) {
-        std::unique_lock lock(mutex);
-        lookupCache.emplace(pathStr, std::pair{nullptr, ec});
-        return nonstd::make_unexpected(ec);
+    if (!mapped) {
+        if (std::error_code ec = OS::readFile(absPath, buffer)) {
+            std::unique_lock lock(mutex);
+            lookupCache.emplace(pathStr, std::pair{nullptr, ec});
+            return nonstd::make_unexpected(ec);
+        }
     }
 
     return cacheBuffer(std::move(absPath), std::move(pathStr), includedFrom, library, sortKey,
-                       std::move(buffer));
+                       std::move(buffer), std::move(mapped));
 }
 
 SourceBuffer SourceManager::cacheBuffer(fs::path&& path, std::string&& pathStr,
                                         SourceLocation includedFrom, const SourceLibrary* library,
-                                        uint64_t sortKey, SmallVector<char>&& buffer) {
+                                        uint64_t sortKey, SmallVector<char>&& buffer,
+                                        std::unique_ptr<MappedFile> mapped) {
     std::string name;
     if (!disableProximatePaths) {
         std::error_code ec;
@@ -514,7 +680,7 @@ SourceBuffer SourceManager::cacheBuffer(fs::path&& path, std::string&& pathStr,
 
     auto directory = &*directories.insert(path.parent_path()).first;
     auto fd = std::make_unique<FileData>(directory, std::move(name), std::move(buffer),
-                                         std::move(path));
+                                         std::move(mapped), std::move(path));
 
     // Note: it's possible that insertion here fails due to another thread
     // racing against us to open and insert the same file. We do a lookup
@@ -528,126 +694,100 @@ SourceBuffer SourceManager::cacheBuffer(fs::path&& path, std::string&& pathStr,
     return createBufferEntry(fdPtr, includedFrom, library, sortKey, lock);
 }
 
-template<IsLock TLock>
-size_t SourceManager::getRawLineNumber(SourceLocation location, TLock& readLock) const {
-    FileData* fd;
-    {
-        // Separate scope so that info isn't used after it may potentially
-        // get invalidated when we briefly unloack a read lock and grab a
-        // write lock below.
-        const FileInfo* info = getFileInfo(location.buffer(), readLock);
-        if (!info || !info->data)
-            return 0;
-
-        fd = info->data;
-    }
-
-    if (fd->lineOffsets.empty()) {
-        // We need to compute line offsets. If the lock is a write lock then
-        // we can just go ahead and do that; if not we need to unlock the
-        // read lock and grab a write lock.
-        if constexpr (std::is_same_v<TLock, std::shared_lock<std::shared_mutex>>) {
-            readLock.unlock();
-
-            std::unique_lock writeLock(mutex);
-            computeLineOffsets(fd->mem, fd->lineOffsets);
+size_t SourceManager::getRawLineNumber(SourceLocation location) const {
+    const FileInfo* info = getFileInfo(location.buffer());
+    if (!info || !info->data)
+        return 0;
 
-            writeLock.unlock();
-            readLock.lock();
-        }
-        else {
-            computeLineOffsets(fd->mem, fd->lineOffsets);
-        }
-    }
+    // The line offset index is immutable once built so no write lock is
+    // needed here even if we're the ones to trigger its construction.
+    auto& lineOffsets = info->data->getLineOffsets();
 
     // Find the first line offset that is greater than the given location offset. That iterator
     // then tells us how many lines away from the beginning we are.
-    auto it = std::ranges::lower_bound(fd->lineOffsets, location.offset());
+    auto it = std::ranges::lower_bound(lineOffsets, location.offset());
 
     // We want to ensure the line we return is strictly greater than the given location offset.
     // So if it is equal, add one to the lower bound we got.
-    size_t line = size_t(it - fd->lineOffsets.begin());
-    if (it != fd->lineOffsets.end() && *it == location.offset())
+    size_t line = size_t(it - lineOffsets.begin());
+    if (it != lineOffsets.end() && *it == location.offset())
         line++;
     return line;
 }
 
-template<IsLock TLock>
-SourceLocation SourceManager::getFullyExpandedLocImpl(SourceLocation location, TLock& lock) const {
-    while (isMacroLocImpl(location, lock)) {
-        if (isMacroArgLocImpl(location, lock))
-            location = getOriginalLocImpl(location, lock);
+SourceLocation SourceManager::getFullyExpandedLocImpl(SourceLocation location) const {
+    while (isMacroLocImpl(location)) {
+        if (isMacroArgLocImpl(location))
+            location = getOriginalLocImpl(location);
         else
-            location = getExpansionRangeImpl(location, lock).start();
+            location = getExpansionRangeImpl(location).start();
     }
     return location;
 }
 
-template<IsLock TLock>
-bool SourceManager::isMacroLocImpl(SourceLocation location, TLock&) const {
+bool SourceManager::isMacroLocImpl(SourceLocation location) const {
     if (location.buffer() == SourceLocation::NoLocation.buffer())
         return false;
 
-    auto buffer = location.buffer();
-    if (!buffer)
+    auto entry = lookupEntry(location.buffer());
+    if (!entry)
         return false;
 
-    SLANG_ASSERT(buffer.getId() < bufferEntries.size());
-    return std::get_if<ExpansionInfo>(&bufferEntries[buffer.getId()]) != nullptr;
+    return std::get_if<ExpansionInfo>(entry) != nullptr;
 }
 
-template<IsLock TLock>
-bool SourceManager::isMacroArgLocImpl(SourceLocation location, TLock&) const {
+bool SourceManager::isMacroArgLocImpl(SourceLocation location) const {
     if (location == SourceLocation::NoLocation)
         return false;
 
-    auto buffer = location.buffer();
-    if (!buffer)
+    auto entry = lookupEntry(location.buffer());
+    if (!entry)
         return false;
 
-    SLANG_ASSERT(buffer.getId() < bufferEntries.size());
-    auto info = std::get_if<ExpansionInfo>(&bufferEntries[buffer.getId()]);
+    auto info = std::get_if<ExpansionInfo>(entry);
     return info && info->isMacroArg;
 }
 
-template<IsLock TLock>
-SourceRange SourceManager::getExpansionRangeImpl(SourceLocation location, TLock&) const {
-    auto buffer = location.buffer();
-    if (!buffer)
+SourceRange SourceManager::getExpansionRangeImpl(SourceLocation location) const {
+    auto entry = lookupEntry(location.buffer());
+    if (!entry)
         return SourceRange();
 
-    SLANG_ASSERT(buffer.getId() < bufferEntries.size());
-    return std::get<ExpansionInfo>(bufferEntries[buffer.getId()]).expansionRange;
+    return std::get<ExpansionInfo>(*entry).expansionRange;
 }
 
-template<IsLock TLock>
-SourceLocation SourceManager::getOriginalLocImpl(SourceLocation location, TLock&) const {
-    auto buffer = location.buffer();
-    if (!buffer)
+SourceLocation SourceManager::getOriginalLocImpl(SourceLocation location) const {
+    auto entry = lookupEntry(location.buffer());
+    if (!entry)
         return SourceLocation();
 
-    SLANG_ASSERT(buffer.getId() < bufferEntries.size());
-    return std::get<ExpansionInfo>(bufferEntries[buffer.getId()]).originalLoc + location.offset();
+    return std::get<ExpansionInfo>(*entry).originalLoc + location.offset();
 }
 
-void SourceManager::computeLineOffsets(const SmallVector<char>& buffer,
+void SourceManager::computeLineOffsets(std::string_view buffer,
                                        std::vector<size_t>& offsets) noexcept {
     // first line always starts at offset 0
     offsets.push_back(0);
 
-    const char* ptr = buffer.data();
-    const char* end = buffer.data() + buffer.size();
+    const char* base = buffer.data();
+    const char* ptr = base;
+    const char* end = base + buffer.size();
     while (ptr != end) {
-        if (ptr[0] == '\n' || ptr[0] == '\r') {
-            // if we see \r\n or \n\r skip both chars
-            if ((ptr[1] == '\n' || ptr[1] == '\r') && ptr[0] != ptr[1])
-                ptr++;
+        // memchr is typically vectorized by the C library, so use it to jump
+        // to the next line terminator instead of inspecting one character at
+        // a time. Lone '\r' terminators are vanishingly rare so only bother
+        // looking for one in the region before the next '\n'.
+        auto nl = (const char*)memchr(ptr, '\n', size_t(end - ptr));
+        auto cr = (const char*)memchr(ptr, '\r', size_t((nl ? nl : end) - ptr));
+        ptr = cr ? cr : nl;
+        if (!ptr)
+            break;
+
+        // if we see \r\n or \n\r skip both chars
+        if ((ptr[1] == '\n' || ptr[1] == '\r') && ptr[0] != ptr[1])
             ptr++;
-            offsets.push_back((size_t)(ptr - buffer.data()));
-        }
-        else {
-            ptr++;
-        }
+        ptr++;
+        offsets.push_back((size_t)(ptr - base));
     }
 }
 
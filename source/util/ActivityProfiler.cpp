@@ -0,0 +1,160 @@
+//------------------------------------------------------------------------------
+// ActivityProfiler.cpp
+// Sampling profiler keyed by compiler activity
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/util/ActivityProfiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include "slang/util/Hash.h"
+
+namespace slang {
+
+namespace {
+
+// Each frame stores a bounded copy of its label rather than pointers into
+// caller-owned strings: the sampler reads frames without synchronization,
+// and a torn read of inline bytes yields at worst a garbled label for that
+// one sample, never a dangling pointer dereference.
+struct ActivityStack {
+    static constexpr uint32_t MaxDepth = 64;
+    struct Frame {
+        char text[55];
+        uint8_t length;
+    };
+    Frame frames[MaxDepth];
+    std::atomic<uint32_t> depth{0};
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<ActivityStack*> stacks;
+};
+
+Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+ActivityStack& localStack() {
+    // Stacks are registered once per thread and intentionally never freed;
+    // the sampler may read them after the owning thread has exited.
+    static thread_local ActivityStack* stack = [] {
+        auto s = new ActivityStack();
+        auto& r = registry();
+        std::scoped_lock lock(r.mutex);
+        r.stacks.push_back(s);
+        return s;
+    }();
+    return *stack;
+}
+
+} // namespace
+
+struct ActivityProfiler::Sampler {
+    std::thread thread;
+    std::atomic<bool> running{true};
+    uint32_t intervalUs;
+    flat_hash_map<std::string, uint64_t> counts;
+
+    explicit Sampler(uint32_t intervalUs) : intervalUs(intervalUs) {
+        thread = std::thread([this] { run(); });
+    }
+
+    void stop() {
+        running.store(false);
+        if (thread.joinable())
+            thread.join();
+    }
+
+    void run() {
+        std::vector<ActivityStack*> snapshot;
+        std::string key;
+        while (running.load(std::memory_order_relaxed)) {
+            std::this_thread::sleep_for(std::chrono::microseconds(intervalUs));
+
+            {
+                auto& r = registry();
+                std::scoped_lock lock(r.mutex);
+                snapshot = r.stacks;
+            }
+
+            for (auto stack : snapshot) {
+                uint32_t depth = std::min(stack->depth.load(std::memory_order_acquire),
+                                          ActivityStack::MaxDepth);
+                if (depth == 0)
+                    continue;
+
+                key.clear();
+                for (uint32_t i = 0; i < depth; i++) {
+                    auto& frame = stack->frames[i];
+                    if (i != 0)
+                        key += ';';
+                    key.append(frame.text, std::min(size_t(frame.length), sizeof(frame.text)));
+                }
+                counts[key]++;
+            }
+        }
+    }
+};
+
+std::unique_ptr<ActivityProfiler::Sampler> ActivityProfiler::sampler;
+
+void ActivityProfiler::start(uint32_t intervalUs) {
+    SLANG_ASSERT(!sampler);
+    sampler = std::make_unique<Sampler>(intervalUs);
+}
+
+void ActivityProfiler::write(std::ostream& os) {
+    SLANG_ASSERT(sampler);
+    sampler->stop();
+
+    // Sort for stable output; flamegraph tools don't care about order but
+    // diffs between runs do.
+    std::vector<std::pair<std::string_view, uint64_t>> sorted(sampler->counts.begin(),
+                                                              sampler->counts.end());
+    std::ranges::sort(sorted);
+    for (auto& [stack, count] : sorted)
+        os << stack << ' ' << count << '\n';
+
+    sampler.reset();
+}
+
+void ActivityProfiler::push(std::string_view name, std::string_view detail) {
+    auto& stack = localStack();
+    uint32_t depth = stack.depth.load(std::memory_order_relaxed);
+    if (depth < ActivityStack::MaxDepth) {
+        auto& frame = stack.frames[depth];
+        size_t len = std::min(name.size(), sizeof(frame.text));
+        memcpy(frame.text, name.data(), len);
+
+        if (!detail.empty() && len + 1 < sizeof(frame.text)) {
+            frame.text[len++] = ':';
+            size_t detailLen = std::min(detail.size(), sizeof(frame.text) - len);
+            memcpy(frame.text + len, detail.data(), detailLen);
+            len += detailLen;
+        }
+        frame.length = uint8_t(len);
+    }
+
+    // Frames past MaxDepth are dropped but the depth still counts them so
+    // that pops stay balanced.
+    stack.depth.store(depth + 1, std::memory_order_release);
+}
+
+void ActivityProfiler::pop() {
+    auto& stack = localStack();
+    stack.depth.store(stack.depth.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+}
+
+} // namespace slang
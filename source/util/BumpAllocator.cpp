@@ -7,10 +7,38 @@
 //------------------------------------------------------------------------------
 #include "slang/util/BumpAllocator.h"
 
+#include <algorithm>
+#include <mutex>
 #include <new>
+#include <vector>
+
+namespace {
+
+// A process-wide pool of standard-sized segments. Long-running processes
+// that build compilations back to back would otherwise return every page
+// to the system between runs and fault them all back in on the next one;
+// recycling the (already warm) segments here avoids that entirely. The
+// lock is only taken on the segment slow path, once per SEGMENT_SIZE of
+// allocation, so contention is negligible even with parallel parsing.
+struct SegmentPool {
+    std::mutex mutex;
+    std::vector<void*> segments;
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t capacityBytes = 64 * 1024 * 1024;
+};
+
+SegmentPool& segmentPool() {
+    static SegmentPool pool;
+    return pool;
+}
+
+} // namespace
 
 namespace slang {
 
+std::atomic<size_t> BumpAllocator::totalBytes{0};
+
 BumpAllocator::BumpAllocator() {
     head = allocSegment(nullptr, INITIAL_SIZE);
     endPtr = (byte*)head + INITIAL_SIZE;
@@ -20,13 +48,15 @@ BumpAllocator::~BumpAllocator() {
     Segment* seg = head;
     while (seg) {
         Segment* prev = seg->prev;
-        ::operator delete(seg);
+        freeSegment(seg);
         seg = prev;
     }
 }
 
 BumpAllocator::BumpAllocator(BumpAllocator&& other) noexcept :
-    head(std::exchange(other.head, nullptr)), endPtr(other.endPtr) {
+    head(std::exchange(other.head, nullptr)), endPtr(other.endPtr),
+    currentBytes(std::exchange(other.currentBytes, 0)), maxBytes(std::exchange(other.maxBytes, 0)),
+    categoryBytes(std::exchange(other.categoryBytes, {})), category(other.category) {
 }
 
 BumpAllocator& BumpAllocator::operator=(BumpAllocator&& other) noexcept {
@@ -47,6 +77,74 @@ void BumpAllocator::steal(BumpAllocator&& other) {
 
     seg->prev = head->prev;
     head->prev = std::exchange(other.head, nullptr);
+
+    currentBytes += std::exchange(other.currentBytes, 0);
+    maxBytes = std::max(maxBytes, currentBytes);
+
+    for (size_t i = 0; i < NumCategories; i++)
+        categoryBytes[i] += std::exchange(other.categoryBytes[i], size_t(0));
+}
+
+void BumpAllocator::rollbackTo(Snapshot snap) {
+    auto destroy = [this](Segment* seg) {
+        currentBytes -= seg->size;
+        freeSegment(seg);
+    };
+
+    auto snapHead = (Segment*)snap.head;
+    auto snapHeadPrev = (Segment*)snap.headPrev;
+
+    // Free whole segments allocated since the snapshot was taken. Oversized
+    // allocations get spliced in behind the active head segment, so once
+    // we're back at the snapshot's head we also have to unlink anything that
+    // was chained in behind it in the meantime.
+    while (head != snapHead) {
+        Segment* prev = head->prev;
+        destroy(head);
+        head = prev;
+    }
+
+    while (head->prev != snapHeadPrev) {
+        Segment* seg = head->prev;
+        head->prev = seg->prev;
+        destroy(seg);
+    }
+
+    head->current = snap.current;
+    endPtr = snap.endPtr;
+}
+
+void BumpAllocator::reset() {
+    // A moved-from allocator has nothing to retain; reinitialize it.
+    if (!head) {
+        head = allocSegment(nullptr, INITIAL_SIZE);
+        endPtr = (byte*)head + INITIAL_SIZE;
+        categoryBytes = {};
+        return;
+    }
+
+    // Keep the largest segment and free the rest.
+    Segment* keep = head;
+    for (Segment* seg = head->prev; seg; seg = seg->prev) {
+        if (seg->size > keep->size)
+            keep = seg;
+    }
+
+    Segment* seg = head;
+    while (seg) {
+        Segment* prev = seg->prev;
+        if (seg != keep) {
+            currentBytes -= seg->size;
+            freeSegment(seg);
+        }
+        seg = prev;
+    }
+
+    keep->prev = nullptr;
+    keep->current = (byte*)keep + sizeof(Segment);
+    head = keep;
+    endPtr = (byte*)keep + keep->size;
+    categoryBytes = {};
 }
 
 byte* BumpAllocator::allocateSlow(size_t size, size_t alignment) {
@@ -64,10 +162,81 @@ byte* BumpAllocator::allocateSlow(size_t size, size_t alignment) {
 }
 
 BumpAllocator::Segment* BumpAllocator::allocSegment(Segment* prev, size_t size) {
-    auto seg = (Segment*)::operator new(size);
+    totalBytes.fetch_add(size, std::memory_order_relaxed);
+    currentBytes += size;
+    maxBytes = std::max(maxBytes, currentBytes);
+
+    // Standard-sized segments come from the process-wide pool when it has
+    // any; odd sizes (the initial block and oversized allocations) always
+    // go to the system allocator.
+    void* mem = nullptr;
+    if (size == SEGMENT_SIZE) {
+        auto& pool = segmentPool();
+        std::scoped_lock lock(pool.mutex);
+        if (!pool.segments.empty()) {
+            mem = pool.segments.back();
+            pool.segments.pop_back();
+            pool.hits++;
+        }
+        else {
+            pool.misses++;
+        }
+    }
+    if (!mem)
+        mem = ::operator new(size);
+
+    auto seg = (Segment*)mem;
     seg->prev = prev;
     seg->current = (byte*)seg + sizeof(Segment);
+    seg->size = size;
     return seg;
 }
 
+void BumpAllocator::freeSegment(Segment* seg) {
+    if (seg->size == SEGMENT_SIZE) {
+        auto& pool = segmentPool();
+        std::scoped_lock lock(pool.mutex);
+        if ((pool.segments.size() + 1) * size_t(SEGMENT_SIZE) <= pool.capacityBytes) {
+            pool.segments.push_back(seg);
+            return;
+        }
+    }
+    ::operator delete(seg);
+}
+
+BumpAllocator::PoolStats BumpAllocator::getPoolStats() {
+    auto& pool = segmentPool();
+    std::scoped_lock lock(pool.mutex);
+
+    PoolStats stats;
+    stats.segmentsHeld = pool.segments.size();
+    stats.bytesHeld = pool.segments.size() * size_t(SEGMENT_SIZE);
+    stats.hits = pool.hits;
+    stats.misses = pool.misses;
+    return stats;
+}
+
+void BumpAllocator::trimPool() {
+    std::vector<void*> segments;
+    {
+        auto& pool = segmentPool();
+        std::scoped_lock lock(pool.mutex);
+        segments.swap(pool.segments);
+    }
+
+    for (auto seg : segments)
+        ::operator delete(seg);
+}
+
+void BumpAllocator::setPoolCapacity(size_t bytes) {
+    auto& pool = segmentPool();
+    std::scoped_lock lock(pool.mutex);
+    pool.capacityBytes = bytes;
+
+    while (pool.segments.size() * size_t(SEGMENT_SIZE) > bytes) {
+        ::operator delete(pool.segments.back());
+        pool.segments.pop_back();
+    }
+}
+
 } // namespace slang
@@ -184,6 +184,28 @@ bool CommandLine::parse(std::string_view argList, ParseOptions options) {
     return parse(args, options);
 }
 
+// Characters that need special handling in parseStr; runs of anything
+// else can be appended to the current argument in bulk.
+static constexpr bool isPlainArgChar(char c) {
+    switch (c) {
+        case ' ':
+        case '\t':
+        case '\v':
+        case '\f':
+        case '\r':
+        case '\n':
+        case '#':
+        case '/':
+        case '$':
+        case '\\':
+        case '\'':
+        case '"':
+            return false;
+        default:
+            return true;
+    }
+}
+
 void CommandLine::parseStr(std::string_view argList, ParseOptions options, bool& hasArg,
                            std::string& current, SmallVectorBase<std::string>& storage) {
     auto pushArg = [&]() {
@@ -262,11 +284,14 @@ void CommandLine::parseStr(std::string_view argList, ParseOptions options, bool&
 
         // Single quotes consume all characters until the next single quote.
         if (c == '\'') {
-            while (ptr != end) {
-                c = *ptr++;
-                if (c == '\'')
-                    break;
-                current += c;
+            size_t closing = std::string_view(ptr, size_t(end - ptr)).find('\'');
+            if (closing == std::string_view::npos) {
+                current.append(ptr, end);
+                ptr = end;
+            }
+            else {
+                current.append(ptr, ptr + closing);
+                ptr += closing + 1;
             }
             continue;
         }
@@ -274,6 +299,13 @@ void CommandLine::parseStr(std::string_view argList, ParseOptions options, bool&
         // Double quotes consume all characters except escaped characters.
         if (c == '"') {
             while (ptr != end) {
+                auto runStart = ptr;
+                while (ptr != end && *ptr != '"' && *ptr != '\\' && *ptr != '$')
+                    ptr++;
+                current.append(runStart, ptr);
+                if (ptr == end)
+                    break;
+
                 c = *ptr++;
                 if (c == '"')
                     break;
@@ -290,8 +322,12 @@ void CommandLine::parseStr(std::string_view argList, ParseOptions options, bool&
             continue;
         }
 
-        // Otherwise we just have a normal character.
-        current += c;
+        // Otherwise we have a run of normal characters; find where the run
+        // ends and append it all at once instead of a character at a time.
+        auto runStart = ptr - 1;
+        while (ptr != end && isPlainArgChar(*ptr))
+            ptr++;
+        current.append(runStart, ptr);
     }
 }
 
@@ -525,7 +561,7 @@ void CommandLine::handlePlusArg(std::string_view arg, ParseOptions options, bool
         arg = arg.substr(0, idx);
     }
 
-    auto it = optionMap.find(std::string(arg));
+    auto it = optionMap.find(arg);
     if (it == optionMap.end()) {
         hadUnknowns = true;
         errors.emplace_back(
@@ -572,7 +608,7 @@ CommandLine::Option* CommandLine::findOption(std::string_view arg, std::string_v
         arg = arg.substr(0, equalsIndex);
     }
 
-    auto it = optionMap.find(std::string(arg));
+    auto it = optionMap.find(arg);
     if (it == optionMap.end())
         return nullptr;
 
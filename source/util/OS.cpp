@@ -26,6 +26,9 @@
 #    include <io.h>
 #else
 #    include <fcntl.h>
+#    include <pthread.h>
+#    include <sched.h>
+#    include <sys/mman.h>
 #    include <sys/stat.h>
 #    include <unistd.h>
 #endif
@@ -177,6 +180,63 @@ std::error_code OS::readFile(const fs::path& path, SmallVector<char>& buffer) {
     return ec;
 }
 
+std::unique_ptr<MappedFile> OS::mapFile(const fs::path& path) {
+    HANDLE handle = ::CreateFileW(path.native().c_str(), GENERIC_READ,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    auto guard = ScopeGuard([handle] { ::CloseHandle(handle); });
+    if (::GetFileType(handle) != FILE_TYPE_DISK)
+        return nullptr;
+
+    LARGE_INTEGER li;
+    if (!::GetFileSizeEx(handle, &li) || (ULONGLONG)li.QuadPart >= SIZE_MAX)
+        return nullptr;
+
+    // Only map when the file size is not an exact multiple of the page size;
+    // otherwise there would be no zero fill at the end of the final page to
+    // serve as the null terminator that callers require.
+    SYSTEM_INFO si;
+    ::GetSystemInfo(&si);
+
+    auto fileSize = (size_t)li.QuadPart;
+    if (fileSize == 0 || fileSize % si.dwPageSize == 0)
+        return nullptr;
+
+    HANDLE mapping = ::CreateFileMappingW(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping)
+        return nullptr;
+
+    void* mem = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!mem) {
+        ::CloseHandle(mapping);
+        return nullptr;
+    }
+
+    auto result = std::unique_ptr<MappedFile>(new MappedFile());
+    result->view = std::string_view(static_cast<const char*>(mem), fileSize + 1);
+    result->mappingHandle = mapping;
+    return result;
+}
+
+MappedFile::~MappedFile() {
+    if (!view.empty())
+        ::UnmapViewOfFile(const_cast<char*>(view.data()));
+    if (mappingHandle)
+        ::CloseHandle(mappingHandle);
+}
+
+bool OS::pinThreadToCpu(unsigned cpuIndex) {
+    // An affinity mask addresses a single processor group of up to 64 CPUs;
+    // machines with more logical CPUs expose them via additional groups.
+    GROUP_AFFINITY affinity = {};
+    affinity.Group = WORD(cpuIndex / 64);
+    affinity.Mask = KAFFINITY(1) << (cpuIndex % 64);
+    return ::SetThreadGroupAffinity(::GetCurrentThread(), &affinity, nullptr) != 0;
+}
+
 #else
 
 void OS::setupConsole() {
@@ -284,6 +344,58 @@ std::error_code OS::readFile(const fs::path& path, SmallVector<char>& buffer) {
     return ec;
 }
 
+std::unique_ptr<MappedFile> OS::mapFile(const fs::path& path) {
+    int fd;
+    while (true) {
+        fd = ::open(path.native().c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd >= 0)
+            break;
+
+        if (errno != EINTR)
+            return nullptr;
+    }
+
+    auto guard = ScopeGuard([fd] { ::close(fd); });
+
+    struct stat status;
+    if (::fstat(fd, &status) != 0 || !S_ISREG(status.st_mode))
+        return nullptr;
+
+    // Only map when the file size is not an exact multiple of the page size;
+    // otherwise there would be no zero fill at the end of the final page to
+    // serve as the null terminator that callers require.
+    auto fileSize = (size_t)status.st_size;
+    auto pageSize = (size_t)::sysconf(_SC_PAGESIZE);
+    if (fileSize == 0 || fileSize % pageSize == 0)
+        return nullptr;
+
+    void* mem = ::mmap(nullptr, fileSize + 1, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mem == MAP_FAILED)
+        return nullptr;
+
+    auto result = std::unique_ptr<MappedFile>(new MappedFile());
+    result->view = std::string_view(static_cast<const char*>(mem), fileSize + 1);
+    return result;
+}
+
+MappedFile::~MappedFile() {
+    if (!view.empty())
+        ::munmap(const_cast<char*>(view.data()), view.size());
+}
+
+bool OS::pinThreadToCpu(unsigned cpuIndex) {
+#    if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpuIndex % CPU_SETSIZE, &set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#    else
+    // macOS and the BSDs don't offer a portable hard-affinity API.
+    (void)cpuIndex;
+    return false;
+#    endif
+}
+
 #endif
 
 void OS::writeFile(const fs::path& path, std::string_view contents) {
@@ -6,6 +6,13 @@
 //------------------------------------------------------------------------------
 #include "slang/util/SmallVector.h"
 
+#ifdef SLANG_SMALLVECTOR_TELEMETRY
+#    include <cstdio>
+#    include <map>
+#    include <mutex>
+#    include <vector>
+#endif
+
 namespace slang::detail {
 
 void throwOutOfRange() {
@@ -16,4 +23,63 @@ void throwLengthError() {
     SLANG_THROW(std::length_error("vector is at maximum size"));
 }
 
+#ifdef SLANG_SMALLVECTOR_TELEMETRY
+
+namespace {
+
+struct SiteStats {
+    size_t inlineCap = 0;
+    uint64_t count = 0;
+    uint64_t spills = 0;
+    uint64_t maxLen = 0;
+    uint64_t totalLen = 0;
+};
+
+struct TelemetryRegistry {
+    std::mutex mutex;
+    std::map<std::pair<std::string_view, uint32_t>, SiteStats> sites;
+
+    ~TelemetryRegistry() {
+        // Sort sites by spill count so the worst offenders come first.
+        std::vector<std::pair<std::pair<std::string_view, uint32_t>, SiteStats>> sorted(
+            sites.begin(), sites.end());
+        std::ranges::sort(sorted, [](auto& a, auto& b) { return a.second.spills > b.second.spills; });
+
+        fprintf(stderr, "SmallVector telemetry (%zu sites):\n", sorted.size());
+        for (auto& [key, stats] : sorted) {
+            fprintf(stderr,
+                    "  %.*s:%u inline=%zu count=%llu spills=%llu maxLen=%llu avgLen=%.1f\n",
+                    int(key.first.length()), key.first.data(), key.second, stats.inlineCap,
+                    (unsigned long long)stats.count, (unsigned long long)stats.spills,
+                    (unsigned long long)stats.maxLen,
+                    stats.count ? double(stats.totalLen) / double(stats.count) : 0.0);
+        }
+    }
+};
+
+TelemetryRegistry& getTelemetryRegistry() {
+    static TelemetryRegistry registry;
+    return registry;
+}
+
+} // namespace
+
+void recordSmallVectorStats(const char* file, uint32_t line, size_t inlineCap, size_t finalLen,
+                            size_t finalCap, bool spilled) {
+    (void)finalCap;
+
+    auto& registry = getTelemetryRegistry();
+    std::scoped_lock lock(registry.mutex);
+
+    auto& stats = registry.sites[{file, line}];
+    stats.inlineCap = inlineCap;
+    stats.count++;
+    if (spilled)
+        stats.spills++;
+    stats.maxLen = std::max(stats.maxLen, uint64_t(finalLen));
+    stats.totalLen += finalLen;
+}
+
+#endif
+
 } // namespace slang::detail
@@ -15,8 +15,17 @@
 #include <vector>
 
 #include "slang/text/CharInfo.h"
+#include "slang/util/BumpAllocator.h"
 #include "slang/util/Hash.h"
 
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/resource.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
 using namespace std::chrono;
 
 namespace slang {
@@ -55,8 +64,68 @@ struct Entry {
     std::thread::id threadId;
     std::string name;
     std::string detail;
+
+    // While an entry is on the stack these hold the counter readings taken
+    // at the start of the section; when it completes they are replaced with
+    // the deltas accumulated over the section. allocBytes is process-wide,
+    // so sections running concurrently on other threads are included in it.
+    uint64_t instructions = 0;
+    uint64_t cacheMisses = 0;
+    uint64_t allocBytes = 0;
+    uint64_t peakRssKB = 0;
 };
 
+#if defined(__linux__)
+// Per-thread hardware counters read via perf_event file descriptors. Opening
+// them can fail (no permissions, virtualized environment, unsupported PMU);
+// in that case readings are reported as zero.
+struct PerfCounters {
+    int instructionsFd = -1;
+    int cacheMissesFd = -1;
+
+    PerfCounters() {
+        instructionsFd = open(PERF_COUNT_HW_INSTRUCTIONS);
+        cacheMissesFd = open(PERF_COUNT_HW_CACHE_MISSES);
+    }
+
+    ~PerfCounters() {
+        if (instructionsFd >= 0)
+            ::close(instructionsFd);
+        if (cacheMissesFd >= 0)
+            ::close(cacheMissesFd);
+    }
+
+    static int open(uint64_t config) {
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+
+    static uint64_t read(int fd) {
+        uint64_t value = 0;
+        if (fd < 0 || ::read(fd, &value, sizeof(value)) != ssize_t(sizeof(value)))
+            return 0;
+        return value;
+    }
+};
+
+static PerfCounters& getPerfCounters() {
+    thread_local PerfCounters counters;
+    return counters;
+}
+
+static uint64_t getPeakRssKB() {
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return uint64_t(usage.ru_maxrss);
+}
+#endif
+
 struct TimeTrace::Profiler {
     static thread_local std::vector<Entry> stack;
     std::vector<Entry> entries;
@@ -69,8 +138,14 @@ struct TimeTrace::Profiler {
     }
 
     void begin(std::string name, function_ref<std::string()> detail) {
-        stack.push_back(
-            Entry{steady_clock::now(), {}, std::this_thread::get_id(), std::move(name), detail()});
+        Entry entry{steady_clock::now(), {}, std::this_thread::get_id(), std::move(name), detail()};
+        entry.allocBytes = BumpAllocator::totalBytesAllocated();
+#if defined(__linux__)
+        auto& counters = getPerfCounters();
+        entry.instructions = PerfCounters::read(counters.instructionsFd);
+        entry.cacheMisses = PerfCounters::read(counters.cacheMissesFd);
+#endif
+        stack.push_back(std::move(entry));
     }
 
     void end() {
@@ -79,6 +154,20 @@ struct TimeTrace::Profiler {
 
         auto&& entry = stack.back();
         entry.duration = steady_clock::now() - entry.start;
+        entry.allocBytes = BumpAllocator::totalBytesAllocated() - entry.allocBytes;
+#if defined(__linux__)
+        // Guard against a counter read failing mid-flight and producing a
+        // bogus underflowed delta.
+        auto delta = [](uint64_t endVal, uint64_t startVal) {
+            return endVal >= startVal ? endVal - startVal : 0;
+        };
+
+        auto& counters = getPerfCounters();
+        entry.instructions = delta(PerfCounters::read(counters.instructionsFd),
+                                   entry.instructions);
+        entry.cacheMisses = delta(PerfCounters::read(counters.cacheMissesFd), entry.cacheMisses);
+        entry.peakRssKB = getPeakRssKB();
+#endif
 
         // Only include sections longer than 500us.
         if (duration_cast<microseconds>(entry.duration).count() > 500) {
@@ -113,9 +202,12 @@ struct TimeTrace::Profiler {
             auto startUs = duration_cast<microseconds>(entry.start - startTime).count();
             auto durationUs = duration_cast<microseconds>(entry.duration).count();
             os << fmt::format("{{ \"pid\":1, \"tid\":{}, \"ph\":\"X\", \"ts\":{}, "
-                              "\"dur\":{}, \"name\":\"{}\", \"args\":{{ \"detail\":\"{}\" }} }},\n",
+                              "\"dur\":{}, \"name\":\"{}\", \"args\":{{ \"detail\":\"{}\", "
+                              "\"instructions\":{}, \"cache_misses\":{}, \"alloc_bytes\":{}, "
+                              "\"peak_rss_kb\":{} }} }},\n",
                               getTID(entry.threadId), startUs, durationUs, escapeString(entry.name),
-                              escapeString(entry.detail));
+                              escapeString(entry.detail), entry.instructions, entry.cacheMisses,
+                              entry.allocBytes, entry.peakRssKB);
         }
 
         // Emit metadata event with process name.
@@ -0,0 +1,5456 @@
+// Generated by generate_designs.py -- do not edit by hand.
+package perf_pkg;
+    typedef struct packed {
+        logic zero;
+        logic negative;
+        logic overflow;
+    } flags_t;
+
+    typedef enum logic [1:0] { IDLE, RUN, DRAIN, DONE } state_t;
+endpackage
+
+module leaf0 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(0);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf1 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(1);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf2 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(2);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf3 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(3);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf4 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(4);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf5 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(5);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf6 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(6);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf7 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(7);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf8 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(8);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf9 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(9);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf10 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(10);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf11 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(11);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf12 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(12);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf13 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(13);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf14 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(14);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf15 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(15);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf16 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(16);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf17 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(17);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf18 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(18);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf19 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(19);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf20 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(20);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf21 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(21);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf22 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(22);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf23 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(23);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf24 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(24);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf25 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(25);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf26 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(26);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf27 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(27);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf28 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(28);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf29 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(29);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf30 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(30);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf31 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(31);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf32 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(32);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf33 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(33);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf34 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(34);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf35 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(35);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf36 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(36);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf37 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(37);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf38 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(38);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf39 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(39);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf40 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(40);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf41 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(41);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf42 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(42);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf43 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(43);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf44 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(44);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf45 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(45);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf46 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(46);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf47 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(47);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf48 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(48);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf49 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(49);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf50 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(50);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf51 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(51);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf52 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(52);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf53 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(53);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf54 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(54);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf55 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(55);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf56 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(56);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf57 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(57);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf58 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(58);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf59 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(59);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf60 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(60);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf61 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(61);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf62 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(62);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf63 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(63);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf64 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(64);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf65 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(65);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf66 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(66);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf67 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(67);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf68 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(68);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf69 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(69);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf70 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(70);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf71 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(71);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf72 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(72);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf73 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(73);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf74 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(74);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf75 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(75);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf76 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(76);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf77 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(77);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf78 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(78);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf79 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(79);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf80 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(80);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf81 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(81);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf82 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(82);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf83 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(83);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf84 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(84);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf85 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(85);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf86 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(86);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf87 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(87);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf88 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(88);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf89 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(89);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf90 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(90);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf91 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(91);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf92 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(92);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf93 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(93);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf94 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(94);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf95 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(95);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf96 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(96);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf97 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(97);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf98 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(98);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf99 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(99);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf100 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(100);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf101 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(101);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf102 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(102);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf103 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(103);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf104 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(104);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf105 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(105);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf106 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(106);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf107 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(107);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf108 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(108);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf109 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(109);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf110 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(110);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf111 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(111);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf112 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(112);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf113 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(113);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf114 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(114);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf115 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(115);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf116 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(116);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf117 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(117);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf118 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(118);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf119 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(119);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module perf_top #(parameter int GRID = 14) (
+    input  logic        clk,
+    input  logic        rst,
+    input  logic [7:0]  op,
+    output logic [31:0] checksum
+);
+    localparam int COUNT = 120;
+
+    logic [31:0] acc [GRID];
+    logic [31:0] res [COUNT][GRID];
+    perf_pkg::flags_t fl [COUNT][GRID];
+    perf_pkg::state_t state;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            state <= perf_pkg::IDLE;
+        else begin
+            unique case (state)
+                perf_pkg::IDLE:  state <= perf_pkg::RUN;
+                perf_pkg::RUN:   state <= op == '1 ? perf_pkg::DRAIN : perf_pkg::RUN;
+                perf_pkg::DRAIN: state <= perf_pkg::DONE;
+                perf_pkg::DONE:  state <= perf_pkg::DONE;
+            endcase
+        end
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row0
+        leaf0 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(0)),
+                   .b(32'(op)), .result(res[0][g]), .flags(fl[0][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row1
+        leaf1 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(1)),
+                   .b(32'(op)), .result(res[1][g]), .flags(fl[1][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row2
+        leaf2 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(2)),
+                   .b(32'(op)), .result(res[2][g]), .flags(fl[2][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row3
+        leaf3 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(3)),
+                   .b(32'(op)), .result(res[3][g]), .flags(fl[3][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row4
+        leaf4 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(4)),
+                   .b(32'(op)), .result(res[4][g]), .flags(fl[4][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row5
+        leaf5 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(5)),
+                   .b(32'(op)), .result(res[5][g]), .flags(fl[5][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row6
+        leaf6 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(6)),
+                   .b(32'(op)), .result(res[6][g]), .flags(fl[6][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row7
+        leaf7 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(7)),
+                   .b(32'(op)), .result(res[7][g]), .flags(fl[7][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row8
+        leaf8 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(8)),
+                   .b(32'(op)), .result(res[8][g]), .flags(fl[8][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row9
+        leaf9 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(9)),
+                   .b(32'(op)), .result(res[9][g]), .flags(fl[9][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row10
+        leaf10 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(10)),
+                   .b(32'(op)), .result(res[10][g]), .flags(fl[10][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row11
+        leaf11 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(11)),
+                   .b(32'(op)), .result(res[11][g]), .flags(fl[11][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row12
+        leaf12 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(12)),
+                   .b(32'(op)), .result(res[12][g]), .flags(fl[12][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row13
+        leaf13 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(13)),
+                   .b(32'(op)), .result(res[13][g]), .flags(fl[13][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row14
+        leaf14 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(14)),
+                   .b(32'(op)), .result(res[14][g]), .flags(fl[14][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row15
+        leaf15 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(15)),
+                   .b(32'(op)), .result(res[15][g]), .flags(fl[15][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row16
+        leaf16 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(16)),
+                   .b(32'(op)), .result(res[16][g]), .flags(fl[16][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row17
+        leaf17 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(17)),
+                   .b(32'(op)), .result(res[17][g]), .flags(fl[17][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row18
+        leaf18 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(18)),
+                   .b(32'(op)), .result(res[18][g]), .flags(fl[18][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row19
+        leaf19 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(19)),
+                   .b(32'(op)), .result(res[19][g]), .flags(fl[19][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row20
+        leaf20 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(20)),
+                   .b(32'(op)), .result(res[20][g]), .flags(fl[20][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row21
+        leaf21 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(21)),
+                   .b(32'(op)), .result(res[21][g]), .flags(fl[21][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row22
+        leaf22 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(22)),
+                   .b(32'(op)), .result(res[22][g]), .flags(fl[22][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row23
+        leaf23 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(23)),
+                   .b(32'(op)), .result(res[23][g]), .flags(fl[23][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row24
+        leaf24 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(24)),
+                   .b(32'(op)), .result(res[24][g]), .flags(fl[24][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row25
+        leaf25 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(25)),
+                   .b(32'(op)), .result(res[25][g]), .flags(fl[25][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row26
+        leaf26 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(26)),
+                   .b(32'(op)), .result(res[26][g]), .flags(fl[26][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row27
+        leaf27 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(27)),
+                   .b(32'(op)), .result(res[27][g]), .flags(fl[27][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row28
+        leaf28 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(28)),
+                   .b(32'(op)), .result(res[28][g]), .flags(fl[28][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row29
+        leaf29 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(29)),
+                   .b(32'(op)), .result(res[29][g]), .flags(fl[29][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row30
+        leaf30 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(30)),
+                   .b(32'(op)), .result(res[30][g]), .flags(fl[30][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row31
+        leaf31 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(31)),
+                   .b(32'(op)), .result(res[31][g]), .flags(fl[31][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row32
+        leaf32 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(32)),
+                   .b(32'(op)), .result(res[32][g]), .flags(fl[32][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row33
+        leaf33 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(33)),
+                   .b(32'(op)), .result(res[33][g]), .flags(fl[33][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row34
+        leaf34 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(34)),
+                   .b(32'(op)), .result(res[34][g]), .flags(fl[34][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row35
+        leaf35 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(35)),
+                   .b(32'(op)), .result(res[35][g]), .flags(fl[35][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row36
+        leaf36 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(36)),
+                   .b(32'(op)), .result(res[36][g]), .flags(fl[36][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row37
+        leaf37 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(37)),
+                   .b(32'(op)), .result(res[37][g]), .flags(fl[37][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row38
+        leaf38 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(38)),
+                   .b(32'(op)), .result(res[38][g]), .flags(fl[38][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row39
+        leaf39 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(39)),
+                   .b(32'(op)), .result(res[39][g]), .flags(fl[39][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row40
+        leaf40 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(40)),
+                   .b(32'(op)), .result(res[40][g]), .flags(fl[40][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row41
+        leaf41 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(41)),
+                   .b(32'(op)), .result(res[41][g]), .flags(fl[41][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row42
+        leaf42 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(42)),
+                   .b(32'(op)), .result(res[42][g]), .flags(fl[42][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row43
+        leaf43 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(43)),
+                   .b(32'(op)), .result(res[43][g]), .flags(fl[43][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row44
+        leaf44 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(44)),
+                   .b(32'(op)), .result(res[44][g]), .flags(fl[44][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row45
+        leaf45 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(45)),
+                   .b(32'(op)), .result(res[45][g]), .flags(fl[45][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row46
+        leaf46 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(46)),
+                   .b(32'(op)), .result(res[46][g]), .flags(fl[46][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row47
+        leaf47 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(47)),
+                   .b(32'(op)), .result(res[47][g]), .flags(fl[47][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row48
+        leaf48 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(48)),
+                   .b(32'(op)), .result(res[48][g]), .flags(fl[48][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row49
+        leaf49 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(49)),
+                   .b(32'(op)), .result(res[49][g]), .flags(fl[49][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row50
+        leaf50 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(50)),
+                   .b(32'(op)), .result(res[50][g]), .flags(fl[50][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row51
+        leaf51 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(51)),
+                   .b(32'(op)), .result(res[51][g]), .flags(fl[51][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row52
+        leaf52 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(52)),
+                   .b(32'(op)), .result(res[52][g]), .flags(fl[52][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row53
+        leaf53 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(53)),
+                   .b(32'(op)), .result(res[53][g]), .flags(fl[53][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row54
+        leaf54 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(54)),
+                   .b(32'(op)), .result(res[54][g]), .flags(fl[54][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row55
+        leaf55 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(55)),
+                   .b(32'(op)), .result(res[55][g]), .flags(fl[55][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row56
+        leaf56 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(56)),
+                   .b(32'(op)), .result(res[56][g]), .flags(fl[56][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row57
+        leaf57 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(57)),
+                   .b(32'(op)), .result(res[57][g]), .flags(fl[57][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row58
+        leaf58 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(58)),
+                   .b(32'(op)), .result(res[58][g]), .flags(fl[58][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row59
+        leaf59 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(59)),
+                   .b(32'(op)), .result(res[59][g]), .flags(fl[59][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row60
+        leaf60 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(60)),
+                   .b(32'(op)), .result(res[60][g]), .flags(fl[60][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row61
+        leaf61 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(61)),
+                   .b(32'(op)), .result(res[61][g]), .flags(fl[61][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row62
+        leaf62 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(62)),
+                   .b(32'(op)), .result(res[62][g]), .flags(fl[62][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row63
+        leaf63 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(63)),
+                   .b(32'(op)), .result(res[63][g]), .flags(fl[63][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row64
+        leaf64 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(64)),
+                   .b(32'(op)), .result(res[64][g]), .flags(fl[64][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row65
+        leaf65 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(65)),
+                   .b(32'(op)), .result(res[65][g]), .flags(fl[65][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row66
+        leaf66 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(66)),
+                   .b(32'(op)), .result(res[66][g]), .flags(fl[66][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row67
+        leaf67 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(67)),
+                   .b(32'(op)), .result(res[67][g]), .flags(fl[67][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row68
+        leaf68 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(68)),
+                   .b(32'(op)), .result(res[68][g]), .flags(fl[68][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row69
+        leaf69 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(69)),
+                   .b(32'(op)), .result(res[69][g]), .flags(fl[69][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row70
+        leaf70 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(70)),
+                   .b(32'(op)), .result(res[70][g]), .flags(fl[70][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row71
+        leaf71 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(71)),
+                   .b(32'(op)), .result(res[71][g]), .flags(fl[71][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row72
+        leaf72 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(72)),
+                   .b(32'(op)), .result(res[72][g]), .flags(fl[72][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row73
+        leaf73 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(73)),
+                   .b(32'(op)), .result(res[73][g]), .flags(fl[73][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row74
+        leaf74 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(74)),
+                   .b(32'(op)), .result(res[74][g]), .flags(fl[74][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row75
+        leaf75 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(75)),
+                   .b(32'(op)), .result(res[75][g]), .flags(fl[75][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row76
+        leaf76 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(76)),
+                   .b(32'(op)), .result(res[76][g]), .flags(fl[76][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row77
+        leaf77 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(77)),
+                   .b(32'(op)), .result(res[77][g]), .flags(fl[77][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row78
+        leaf78 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(78)),
+                   .b(32'(op)), .result(res[78][g]), .flags(fl[78][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row79
+        leaf79 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(79)),
+                   .b(32'(op)), .result(res[79][g]), .flags(fl[79][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row80
+        leaf80 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(80)),
+                   .b(32'(op)), .result(res[80][g]), .flags(fl[80][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row81
+        leaf81 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(81)),
+                   .b(32'(op)), .result(res[81][g]), .flags(fl[81][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row82
+        leaf82 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(82)),
+                   .b(32'(op)), .result(res[82][g]), .flags(fl[82][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row83
+        leaf83 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(83)),
+                   .b(32'(op)), .result(res[83][g]), .flags(fl[83][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row84
+        leaf84 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(84)),
+                   .b(32'(op)), .result(res[84][g]), .flags(fl[84][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row85
+        leaf85 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(85)),
+                   .b(32'(op)), .result(res[85][g]), .flags(fl[85][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row86
+        leaf86 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(86)),
+                   .b(32'(op)), .result(res[86][g]), .flags(fl[86][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row87
+        leaf87 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(87)),
+                   .b(32'(op)), .result(res[87][g]), .flags(fl[87][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row88
+        leaf88 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(88)),
+                   .b(32'(op)), .result(res[88][g]), .flags(fl[88][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row89
+        leaf89 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(89)),
+                   .b(32'(op)), .result(res[89][g]), .flags(fl[89][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row90
+        leaf90 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(90)),
+                   .b(32'(op)), .result(res[90][g]), .flags(fl[90][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row91
+        leaf91 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(91)),
+                   .b(32'(op)), .result(res[91][g]), .flags(fl[91][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row92
+        leaf92 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(92)),
+                   .b(32'(op)), .result(res[92][g]), .flags(fl[92][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row93
+        leaf93 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(93)),
+                   .b(32'(op)), .result(res[93][g]), .flags(fl[93][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row94
+        leaf94 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(94)),
+                   .b(32'(op)), .result(res[94][g]), .flags(fl[94][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row95
+        leaf95 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(95)),
+                   .b(32'(op)), .result(res[95][g]), .flags(fl[95][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row96
+        leaf96 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(96)),
+                   .b(32'(op)), .result(res[96][g]), .flags(fl[96][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row97
+        leaf97 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(97)),
+                   .b(32'(op)), .result(res[97][g]), .flags(fl[97][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row98
+        leaf98 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(98)),
+                   .b(32'(op)), .result(res[98][g]), .flags(fl[98][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row99
+        leaf99 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(99)),
+                   .b(32'(op)), .result(res[99][g]), .flags(fl[99][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row100
+        leaf100 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(100)),
+                   .b(32'(op)), .result(res[100][g]), .flags(fl[100][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row101
+        leaf101 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(101)),
+                   .b(32'(op)), .result(res[101][g]), .flags(fl[101][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row102
+        leaf102 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(102)),
+                   .b(32'(op)), .result(res[102][g]), .flags(fl[102][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row103
+        leaf103 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(103)),
+                   .b(32'(op)), .result(res[103][g]), .flags(fl[103][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row104
+        leaf104 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(104)),
+                   .b(32'(op)), .result(res[104][g]), .flags(fl[104][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row105
+        leaf105 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(105)),
+                   .b(32'(op)), .result(res[105][g]), .flags(fl[105][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row106
+        leaf106 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(106)),
+                   .b(32'(op)), .result(res[106][g]), .flags(fl[106][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row107
+        leaf107 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(107)),
+                   .b(32'(op)), .result(res[107][g]), .flags(fl[107][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row108
+        leaf108 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(108)),
+                   .b(32'(op)), .result(res[108][g]), .flags(fl[108][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row109
+        leaf109 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(109)),
+                   .b(32'(op)), .result(res[109][g]), .flags(fl[109][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row110
+        leaf110 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(110)),
+                   .b(32'(op)), .result(res[110][g]), .flags(fl[110][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row111
+        leaf111 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(111)),
+                   .b(32'(op)), .result(res[111][g]), .flags(fl[111][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row112
+        leaf112 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(112)),
+                   .b(32'(op)), .result(res[112][g]), .flags(fl[112][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row113
+        leaf113 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(113)),
+                   .b(32'(op)), .result(res[113][g]), .flags(fl[113][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row114
+        leaf114 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(114)),
+                   .b(32'(op)), .result(res[114][g]), .flags(fl[114][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row115
+        leaf115 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(115)),
+                   .b(32'(op)), .result(res[115][g]), .flags(fl[115][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row116
+        leaf116 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(116)),
+                   .b(32'(op)), .result(res[116][g]), .flags(fl[116][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row117
+        leaf117 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(117)),
+                   .b(32'(op)), .result(res[117][g]), .flags(fl[117][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row118
+        leaf118 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(118)),
+                   .b(32'(op)), .result(res[118][g]), .flags(fl[118][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row119
+        leaf119 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(119)),
+                   .b(32'(op)), .result(res[119][g]), .flags(fl[119][g]));
+    end
+
+    function automatic logic [31:0] col_xor(int g);
+        col_xor = '0;
+        foreach (res[i])
+            col_xor ^= res[i][g];
+    endfunction
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            foreach (acc[g]) acc[g] <= '0;
+        else
+            foreach (acc[g]) acc[g] <= acc[g] ^ col_xor(g);
+    end
+
+    always_comb begin
+        checksum = '0;
+        foreach (acc[i])
+            checksum ^= acc[i];
+    end
+endmodule
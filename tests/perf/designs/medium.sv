@@ -0,0 +1,1856 @@
+// Generated by generate_designs.py -- do not edit by hand.
+package perf_pkg;
+    typedef struct packed {
+        logic zero;
+        logic negative;
+        logic overflow;
+    } flags_t;
+
+    typedef enum logic [1:0] { IDLE, RUN, DRAIN, DONE } state_t;
+endpackage
+
+module leaf0 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(0);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf1 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(1);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf2 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(2);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf3 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(3);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf4 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(4);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf5 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(5);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf6 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(6);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf7 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(7);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf8 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(8);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf9 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(9);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf10 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(10);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf11 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(11);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf12 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(12);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf13 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(13);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf14 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(14);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf15 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(15);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf16 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(16);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf17 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(17);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf18 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(18);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf19 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(19);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf20 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(20);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf21 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(21);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf22 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(22);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf23 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(23);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf24 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(24);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf25 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(25);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf26 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(26);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf27 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(27);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf28 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(28);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf29 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(29);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf30 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(30);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf31 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(31);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf32 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(32);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf33 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(33);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf34 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(34);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf35 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(35);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf36 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(36);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf37 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(37);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf38 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(38);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf39 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(39);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module perf_top #(parameter int GRID = 8) (
+    input  logic        clk,
+    input  logic        rst,
+    input  logic [7:0]  op,
+    output logic [31:0] checksum
+);
+    localparam int COUNT = 40;
+
+    logic [31:0] acc [GRID];
+    logic [31:0] res [COUNT][GRID];
+    perf_pkg::flags_t fl [COUNT][GRID];
+    perf_pkg::state_t state;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            state <= perf_pkg::IDLE;
+        else begin
+            unique case (state)
+                perf_pkg::IDLE:  state <= perf_pkg::RUN;
+                perf_pkg::RUN:   state <= op == '1 ? perf_pkg::DRAIN : perf_pkg::RUN;
+                perf_pkg::DRAIN: state <= perf_pkg::DONE;
+                perf_pkg::DONE:  state <= perf_pkg::DONE;
+            endcase
+        end
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row0
+        leaf0 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(0)),
+                   .b(32'(op)), .result(res[0][g]), .flags(fl[0][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row1
+        leaf1 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(1)),
+                   .b(32'(op)), .result(res[1][g]), .flags(fl[1][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row2
+        leaf2 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(2)),
+                   .b(32'(op)), .result(res[2][g]), .flags(fl[2][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row3
+        leaf3 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(3)),
+                   .b(32'(op)), .result(res[3][g]), .flags(fl[3][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row4
+        leaf4 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(4)),
+                   .b(32'(op)), .result(res[4][g]), .flags(fl[4][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row5
+        leaf5 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(5)),
+                   .b(32'(op)), .result(res[5][g]), .flags(fl[5][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row6
+        leaf6 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(6)),
+                   .b(32'(op)), .result(res[6][g]), .flags(fl[6][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row7
+        leaf7 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(7)),
+                   .b(32'(op)), .result(res[7][g]), .flags(fl[7][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row8
+        leaf8 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(8)),
+                   .b(32'(op)), .result(res[8][g]), .flags(fl[8][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row9
+        leaf9 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(9)),
+                   .b(32'(op)), .result(res[9][g]), .flags(fl[9][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row10
+        leaf10 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(10)),
+                   .b(32'(op)), .result(res[10][g]), .flags(fl[10][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row11
+        leaf11 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(11)),
+                   .b(32'(op)), .result(res[11][g]), .flags(fl[11][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row12
+        leaf12 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(12)),
+                   .b(32'(op)), .result(res[12][g]), .flags(fl[12][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row13
+        leaf13 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(13)),
+                   .b(32'(op)), .result(res[13][g]), .flags(fl[13][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row14
+        leaf14 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(14)),
+                   .b(32'(op)), .result(res[14][g]), .flags(fl[14][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row15
+        leaf15 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(15)),
+                   .b(32'(op)), .result(res[15][g]), .flags(fl[15][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row16
+        leaf16 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(16)),
+                   .b(32'(op)), .result(res[16][g]), .flags(fl[16][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row17
+        leaf17 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(17)),
+                   .b(32'(op)), .result(res[17][g]), .flags(fl[17][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row18
+        leaf18 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(18)),
+                   .b(32'(op)), .result(res[18][g]), .flags(fl[18][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row19
+        leaf19 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(19)),
+                   .b(32'(op)), .result(res[19][g]), .flags(fl[19][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row20
+        leaf20 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(20)),
+                   .b(32'(op)), .result(res[20][g]), .flags(fl[20][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row21
+        leaf21 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(21)),
+                   .b(32'(op)), .result(res[21][g]), .flags(fl[21][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row22
+        leaf22 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(22)),
+                   .b(32'(op)), .result(res[22][g]), .flags(fl[22][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row23
+        leaf23 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(23)),
+                   .b(32'(op)), .result(res[23][g]), .flags(fl[23][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row24
+        leaf24 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(24)),
+                   .b(32'(op)), .result(res[24][g]), .flags(fl[24][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row25
+        leaf25 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(25)),
+                   .b(32'(op)), .result(res[25][g]), .flags(fl[25][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row26
+        leaf26 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(26)),
+                   .b(32'(op)), .result(res[26][g]), .flags(fl[26][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row27
+        leaf27 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(27)),
+                   .b(32'(op)), .result(res[27][g]), .flags(fl[27][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row28
+        leaf28 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(28)),
+                   .b(32'(op)), .result(res[28][g]), .flags(fl[28][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row29
+        leaf29 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(29)),
+                   .b(32'(op)), .result(res[29][g]), .flags(fl[29][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row30
+        leaf30 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(30)),
+                   .b(32'(op)), .result(res[30][g]), .flags(fl[30][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row31
+        leaf31 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(31)),
+                   .b(32'(op)), .result(res[31][g]), .flags(fl[31][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row32
+        leaf32 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(32)),
+                   .b(32'(op)), .result(res[32][g]), .flags(fl[32][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row33
+        leaf33 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(33)),
+                   .b(32'(op)), .result(res[33][g]), .flags(fl[33][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row34
+        leaf34 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(34)),
+                   .b(32'(op)), .result(res[34][g]), .flags(fl[34][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row35
+        leaf35 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(35)),
+                   .b(32'(op)), .result(res[35][g]), .flags(fl[35][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row36
+        leaf36 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(36)),
+                   .b(32'(op)), .result(res[36][g]), .flags(fl[36][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row37
+        leaf37 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(37)),
+                   .b(32'(op)), .result(res[37][g]), .flags(fl[37][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row38
+        leaf38 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(38)),
+                   .b(32'(op)), .result(res[38][g]), .flags(fl[38][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row39
+        leaf39 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(39)),
+                   .b(32'(op)), .result(res[39][g]), .flags(fl[39][g]));
+    end
+
+    function automatic logic [31:0] col_xor(int g);
+        col_xor = '0;
+        foreach (res[i])
+            col_xor ^= res[i][g];
+    endfunction
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            foreach (acc[g]) acc[g] <= '0;
+        else
+            foreach (acc[g]) acc[g] <= acc[g] ^ col_xor(g);
+    end
+
+    always_comb begin
+        checksum = '0;
+        foreach (acc[i])
+            checksum ^= acc[i];
+    end
+endmodule
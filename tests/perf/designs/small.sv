@@ -0,0 +1,506 @@
+// Generated by generate_designs.py -- do not edit by hand.
+package perf_pkg;
+    typedef struct packed {
+        logic zero;
+        logic negative;
+        logic overflow;
+    } flags_t;
+
+    typedef enum logic [1:0] { IDLE, RUN, DRAIN, DONE } state_t;
+endpackage
+
+module leaf0 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(0);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf1 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(1);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf2 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(2);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf3 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(3);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf4 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(4);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf5 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(5);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf6 #(parameter int W = 24) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(6);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf7 #(parameter int W = 32) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(7);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf8 #(parameter int W = 8) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(8);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module leaf9 #(parameter int W = 16) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+                4'd0: stage1 <= a + b;
+                4'd1: stage1 <= a - b;
+                4'd2: stage1 <= a & b;
+                4'd3: stage1 <= a | b;
+                4'd4: stage1 <= a ^ b;
+                4'd5: stage1 <= a >> b;
+                4'd6: stage1 <= a << b;
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {W{op[0]}};
+        result <= stage2 + W'(9);
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+
+module perf_top #(parameter int GRID = 4) (
+    input  logic        clk,
+    input  logic        rst,
+    input  logic [7:0]  op,
+    output logic [31:0] checksum
+);
+    localparam int COUNT = 10;
+
+    logic [31:0] acc [GRID];
+    logic [31:0] res [COUNT][GRID];
+    perf_pkg::flags_t fl [COUNT][GRID];
+    perf_pkg::state_t state;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            state <= perf_pkg::IDLE;
+        else begin
+            unique case (state)
+                perf_pkg::IDLE:  state <= perf_pkg::RUN;
+                perf_pkg::RUN:   state <= op == '1 ? perf_pkg::DRAIN : perf_pkg::RUN;
+                perf_pkg::DRAIN: state <= perf_pkg::DONE;
+                perf_pkg::DONE:  state <= perf_pkg::DONE;
+            endcase
+        end
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row0
+        leaf0 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(0)),
+                   .b(32'(op)), .result(res[0][g]), .flags(fl[0][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row1
+        leaf1 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(1)),
+                   .b(32'(op)), .result(res[1][g]), .flags(fl[1][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row2
+        leaf2 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(2)),
+                   .b(32'(op)), .result(res[2][g]), .flags(fl[2][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row3
+        leaf3 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(3)),
+                   .b(32'(op)), .result(res[3][g]), .flags(fl[3][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row4
+        leaf4 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(4)),
+                   .b(32'(op)), .result(res[4][g]), .flags(fl[4][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row5
+        leaf5 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(5)),
+                   .b(32'(op)), .result(res[5][g]), .flags(fl[5][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row6
+        leaf6 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(6)),
+                   .b(32'(op)), .result(res[6][g]), .flags(fl[6][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row7
+        leaf7 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(7)),
+                   .b(32'(op)), .result(res[7][g]), .flags(fl[7][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row8
+        leaf8 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(8)),
+                   .b(32'(op)), .result(res[8][g]), .flags(fl[8][g]));
+    end
+
+    for (genvar g = 0; g < GRID; g++) begin : row9
+        leaf9 u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'(9)),
+                   .b(32'(op)), .result(res[9][g]), .flags(fl[9][g]));
+    end
+
+    function automatic logic [31:0] col_xor(int g);
+        col_xor = '0;
+        foreach (res[i])
+            col_xor ^= res[i][g];
+    endfunction
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            foreach (acc[g]) acc[g] <= '0;
+        else
+            foreach (acc[g]) acc[g] <= acc[g] ^ col_xor(g);
+    end
+
+    always_comb begin
+        checksum = '0;
+        foreach (acc[i])
+            checksum ^= acc[i];
+    end
+endmodule
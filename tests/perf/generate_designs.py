@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: Michael Popoloski
+# SPDX-License-Identifier: MIT
+#
+# Generates the graded synthetic designs consumed by the performance
+# regression harness (perf_regress.py). Output is fully deterministic so
+# the checked-in designs can be regenerated verbatim after editing the
+# templates below:
+#
+#   python3 generate_designs.py designs/
+#
+# Each grade scales the same mix of constructs -- case-heavy combinational
+# logic, pipelined always_ff blocks, struct/package types, and generate
+# loops -- so that the parse and elaboration phases both get a realistic
+# workload rather than one degenerate construct repeated.
+
+import sys
+from pathlib import Path
+
+# grade -> (leaf module count, instance grid dimension)
+GRADES = {
+    "small": (10, 4),
+    "medium": (40, 8),
+    "large": (120, 14),
+}
+
+
+def leaf_module(i):
+    width = 8 + (i % 4) * 8
+    ops = "\n".join(f"                4'd{op}: stage1 <= a {sym} b;"
+                    for op, sym in enumerate(["+", "-", "&", "|", "^", ">>", "<<"]))
+    return f"""\
+module leaf{i} #(parameter int W = {width}) (
+    input  logic             clk,
+    input  logic             rst,
+    input  logic [3:0]       op,
+    input  logic [W-1:0]     a,
+    input  logic [W-1:0]     b,
+    output logic [W-1:0]     result,
+    output perf_pkg::flags_t flags
+);
+    logic [W-1:0] stage1, stage2;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            stage1 <= '0;
+        else begin
+            unique case (op)
+{ops}
+                default: stage1 <= a;
+            endcase
+        end
+    end
+
+    always_ff @(posedge clk) begin
+        stage2 <= stage1 ^ {{W{{op[0]}}}};
+        result <= stage2 + W'({i});
+    end
+
+    always_comb begin
+        flags.zero     = result == '0;
+        flags.negative = result[W-1];
+        flags.overflow = a[W-1] == b[W-1] && result[W-1] != a[W-1];
+    end
+endmodule
+"""
+
+
+def header():
+    return """\
+// Generated by generate_designs.py -- do not edit by hand.
+package perf_pkg;
+    typedef struct packed {
+        logic zero;
+        logic negative;
+        logic overflow;
+    } flags_t;
+
+    typedef enum logic [1:0] { IDLE, RUN, DRAIN, DONE } state_t;
+endpackage
+"""
+
+
+def top_module(count, grid):
+    insts = []
+    for i in range(count):
+        insts.append(f"""\
+    for (genvar g = 0; g < GRID; g++) begin : row{i}
+        leaf{i} u (.clk, .rst, .op(op[3:0]), .a(acc[g] + 32'({i})),
+                   .b(32'(op)), .result(res[{i}][g]), .flags(fl[{i}][g]));
+    end
+""")
+    body = "\n".join(insts)
+    return f"""\
+module perf_top #(parameter int GRID = {grid}) (
+    input  logic        clk,
+    input  logic        rst,
+    input  logic [7:0]  op,
+    output logic [31:0] checksum
+);
+    localparam int COUNT = {count};
+
+    logic [31:0] acc [GRID];
+    logic [31:0] res [COUNT][GRID];
+    perf_pkg::flags_t fl [COUNT][GRID];
+    perf_pkg::state_t state;
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            state <= perf_pkg::IDLE;
+        else begin
+            unique case (state)
+                perf_pkg::IDLE:  state <= perf_pkg::RUN;
+                perf_pkg::RUN:   state <= op == '1 ? perf_pkg::DRAIN : perf_pkg::RUN;
+                perf_pkg::DRAIN: state <= perf_pkg::DONE;
+                perf_pkg::DONE:  state <= perf_pkg::DONE;
+            endcase
+        end
+    end
+
+{body}
+    function automatic logic [31:0] col_xor(int g);
+        col_xor = '0;
+        foreach (res[i])
+            col_xor ^= res[i][g];
+    endfunction
+
+    always_ff @(posedge clk) begin
+        if (rst)
+            foreach (acc[g]) acc[g] <= '0;
+        else
+            foreach (acc[g]) acc[g] <= acc[g] ^ col_xor(g);
+    end
+
+    always_comb begin
+        checksum = '0;
+        foreach (acc[i])
+            checksum ^= acc[i];
+    end
+endmodule
+"""
+
+
+def main():
+    outDir = Path(sys.argv[1] if len(sys.argv) > 1 else "designs")
+    outDir.mkdir(parents=True, exist_ok=True)
+    for grade, (count, grid) in GRADES.items():
+        parts = [header()]
+        parts.extend(leaf_module(i) for i in range(count))
+        parts.append(top_module(count, grid))
+        (outDir / f"{grade}.sv").write_text("\n".join(parts))
+        print(f"wrote {grade}.sv ({count} leaf modules, grid {grid})")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: Michael Popoloski
+# SPDX-License-Identifier: MIT
+"""End-to-end performance regression gate.
+
+Runs the slang driver over one of the generated designs in designs/,
+collects per-phase timings from the --time-trace output, and compares
+them against recorded baselines. The measurement is the minimum over
+several iterations, which discards scheduler noise; a phase only fails
+the gate when it exceeds baseline * tolerance plus a small absolute
+slack, so tiny designs can't trip on millisecond jitter.
+
+Baselines are machine-specific. The checked-in baselines.json records
+the reference CI runner; on other machines, record a local baseline
+first and point at it:
+
+    perf_regress.py --driver <slang> --design medium --update -b local.json
+    perf_regress.py --driver <slang> --design medium -b local.json
+
+On regression the output names the design and phase, e.g.:
+
+    PERF REGRESSION: medium/elaboration: 412.5ms (baseline 250.0ms, limit 362.5ms)
+"""
+
+import argparse
+import json
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+# Top-level phase scopes emitted by the driver's time trace. "total" is
+# measured here as wall time of the whole run and covers everything the
+# trace doesn't attribute, including diagnostic reporting.
+PHASES = ("parseAllSources", "elaboration", "total")
+
+
+def run_once(driver, design):
+    """Runs the driver once; returns {phase: milliseconds}."""
+    with tempfile.NamedTemporaryFile(suffix=".json", delete=False) as tf:
+        tracePath = Path(tf.name)
+    try:
+        start = time.perf_counter()
+        proc = subprocess.run(
+            [driver, str(design), "-q", "--time-trace", str(tracePath)],
+            stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        wallMs = (time.perf_counter() - start) * 1000.0
+
+        if proc.returncode != 0:
+            sys.stderr.write(proc.stdout.decode(errors="replace"))
+            sys.exit(f"driver failed with exit code {proc.returncode}")
+
+        trace = json.loads(tracePath.read_text())
+        times = {phase: 0.0 for phase in PHASES}
+        times["total"] = wallMs
+        for event in trace.get("traceEvents", []):
+            name = event.get("name")
+            if name in times and name != "total":
+                times[name] += event.get("dur", 0) / 1000.0
+        return times
+    finally:
+        tracePath.unlink(missing_ok=True)
+
+
+def measure(driver, design, iterations):
+    best = None
+    for _ in range(iterations):
+        times = run_once(driver, design)
+        if best is None:
+            best = times
+        else:
+            best = {phase: min(best[phase], times[phase]) for phase in PHASES}
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--driver", required=True, help="path to the slang driver binary")
+    parser.add_argument("--design", required=True, help="design grade (e.g. small, medium, large)")
+    parser.add_argument("--design-dir", default=str(Path(__file__).parent / "designs"))
+    parser.add_argument("-b", "--baseline", default=str(Path(__file__).parent / "baselines.json"))
+    parser.add_argument("-n", "--iterations", type=int, default=5)
+    parser.add_argument("--tolerance", type=float, default=1.45,
+                        help="allowed slowdown ratio over baseline (default %(default)s)")
+    parser.add_argument("--slack-ms", type=float, default=50.0,
+                        help="absolute slack added to each limit (default %(default)s)")
+    parser.add_argument("--update", action="store_true",
+                        help="record the measurement as the new baseline instead of gating")
+    args = parser.parse_args()
+
+    design = Path(args.design_dir) / f"{args.design}.sv"
+    if not design.is_file():
+        sys.exit(f"no such design: {design}")
+
+    measured = measure(args.driver, str(design), args.iterations)
+    for phase in PHASES:
+        print(f"{args.design}/{phase}: {measured[phase]:.1f}ms")
+
+    baselinePath = Path(args.baseline)
+    baselines = json.loads(baselinePath.read_text()) if baselinePath.is_file() else {}
+
+    if args.update:
+        baselines.setdefault(args.design, {}).update(measured)
+        baselinePath.write_text(json.dumps(baselines, indent=2, sort_keys=True) + "\n")
+        print(f"updated baseline {baselinePath}")
+        return
+
+    recorded = baselines.get(args.design)
+    if recorded is None:
+        sys.exit(f"no baseline for design '{args.design}' in {baselinePath}; "
+                 f"run with --update to record one")
+
+    failed = False
+    for phase in PHASES:
+        base = recorded.get(phase, 0.0)
+        if base <= 0.0:
+            continue
+        limit = base * args.tolerance + args.slack_ms
+        if measured[phase] > limit:
+            print(f"PERF REGRESSION: {args.design}/{phase}: {measured[phase]:.1f}ms "
+                  f"(baseline {base:.1f}ms, limit {limit:.1f}ms)")
+            failed = True
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
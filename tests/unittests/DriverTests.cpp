@@ -3,10 +3,12 @@
 
 #include "Test.h"
 #include <fmt/core.h>
+#include <fstream>
 #include <regex>
 
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/ast/symbols/InstanceSymbols.h"
+#include "slang/ast/symbols/ParameterSymbols.h"
 #include "slang/driver/Driver.h"
 
 using namespace slang::driver;
@@ -76,6 +78,18 @@ TEST_CASE("Driver invalid diagHierarchy") {
     CHECK(stderrContains("invalid value for diag-hierarchy option"));
 }
 
+TEST_CASE("Driver invalid diagFormat") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    const char* argv[] = {"testfoo", "--diag-format=foo"};
+    CHECK(driver.parseCommandLine(2, argv));
+    CHECK(!driver.processOptions());
+    CHECK(stderrContains("invalid value for diag-format option"));
+}
+
 TEST_CASE("Driver invalid timescale") {
     auto guard = OS::captureOutput();
 
@@ -88,6 +102,18 @@ TEST_CASE("Driver invalid timescale") {
     CHECK(stderrContains("invalid value for time scale option"));
 }
 
+TEST_CASE("Driver invalid design size hint") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    const char* argv[] = {"testfoo", "--hint-design-size=medium"};
+    CHECK(driver.parseCommandLine(2, argv));
+    CHECK(!driver.processOptions());
+    CHECK(stderrContains("invalid value for hint-design-size option"));
+}
+
 TEST_CASE("Driver invalid include dirs") {
     auto guard = OS::captureOutput();
 
@@ -314,6 +340,90 @@ TEST_CASE("Driver full compilation") {
     CHECK(stdoutContains("Build succeeded"));
 }
 
+TEST_CASE("Driver memory report") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\" --mem-report", findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+
+    auto compilation = driver.createCompilation();
+    CHECK(driver.reportCompilation(*compilation, false));
+    CHECK(stdoutContains("Memory usage:"));
+    CHECK(stdoutContains("syntax nodes"));
+    CHECK(stdoutContains("symbols"));
+}
+
+TEST_CASE("Driver memory limit compacts parsed trees") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    // A zero limit forces every tree through compaction and trips the
+    // warning for the memory that remains; the compile must still succeed
+    // with the compacted trees.
+    auto args = fmt::format("testfoo \"{0}test.sv\" --memory-limit=0", findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+    CHECK(stderrContains("exceeding the --memory-limit"));
+
+    auto compilation = driver.createCompilation();
+    CHECK(driver.reportCompilation(*compilation, false));
+    CHECK(stdoutContains("Build succeeded"));
+}
+
+TEST_CASE("Driver write binary result file") {
+    auto guard = OS::captureOutput();
+    auto resultPath = (std::filesystem::temp_directory_path() / "slang_test.svcr").string();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\"", findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+
+    auto compilation = driver.createCompilation();
+    CHECK(driver.reportCompilation(*compilation, false));
+    CHECK(driver.writeResultFile(*compilation, resultPath));
+
+    std::ifstream in(resultPath, std::ios::binary);
+    char magic[4] = {};
+    in.read(magic, 4);
+    CHECK(std::string_view(magic, 4) == "SVCR");
+}
+
+TEST_CASE("Driver write telemetry report") {
+    auto guard = OS::captureOutput();
+    auto telemetryPath = (std::filesystem::temp_directory_path() / "slang_telemetry.json").string();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\"", findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+
+    auto compilation = driver.createCompilation();
+    CHECK(driver.reportCompilation(*compilation, false));
+    CHECK(driver.writeTelemetry(*compilation, telemetryPath));
+
+    std::ifstream in(telemetryPath);
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    CHECK(text.find("\"parseSeconds\":") != std::string::npos);
+    CHECK(text.find("\"totalLive\":") != std::string::npos);
+    CHECK(text.find("\"lookupMisses\":") != std::string::npos);
+    CHECK(text.find("\"errors\": 0") != std::string::npos);
+}
+
 TEST_CASE("Driver full compilation with defines and param overrides") {
     auto guard = OS::captureOutput();
 
@@ -332,6 +442,135 @@ TEST_CASE("Driver full compilation with defines and param overrides") {
     CHECK(stdoutContains("Build succeeded"));
 }
 
+TEST_CASE("Driver parameter sweep") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format(
+        "testfoo \"{0}test4.sv\" --top=frob --allow-use-before-declare -DFOOBAR", findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+
+    std::vector<std::vector<std::string>> points = {{"bar=1"}, {"bar=7"}, {"bar=42"}};
+    std::vector<int32_t> seen;
+    driver.runParameterSweep(points, [&](size_t, Compilation& compilation) {
+        auto& top = *compilation.getRoot().topInstances[0];
+        auto& param = top.body.memberAt<ParameterSymbol>(0);
+        seen.push_back(*param.getValue().integer().as<int32_t>());
+    });
+
+    CHECK(seen == std::vector<int32_t>{1, 7, 42});
+}
+
+TEST_CASE("Driver per-top compilation") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\" \"{0}test5.sv\" --top=m --top=k "
+                            "--compile-per-top --threads=2",
+                            findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+
+    CHECK(driver.reportPerTopCompilations(false));
+    CHECK(stdoutContains("    m\n"));
+    CHECK(stdoutContains("    k\n"));
+    CHECK(stdoutContains("Build succeeded"));
+}
+
+TEST_CASE("Driver per-top compilation with elaboration profile") {
+    auto profilePath =
+        (std::filesystem::temp_directory_path() / "slang_test_elab_profile.txt").string();
+
+    // Seed a profile so the second top is scheduled first; the run then
+    // rewrites the file with freshly measured times.
+    {
+        std::ofstream seed(profilePath);
+        seed << "m 5\nk 250\n";
+    }
+
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\" \"{0}test5.sv\" --top=m --top=k "
+                            "--compile-per-top --threads=2 --elab-profile \"{1}\"",
+                            findTestDir(), profilePath);
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+
+    CHECK(driver.reportPerTopCompilations(false));
+    CHECK(stdoutContains("    m\n"));
+    CHECK(stdoutContains("    k\n"));
+    CHECK(stdoutContains("Build succeeded"));
+
+    std::ifstream in(profilePath);
+    std::string name;
+    uint64_t millis;
+    int count = 0;
+    while (in >> name >> millis) {
+        CHECK((name == "m" || name == "k"));
+        count++;
+    }
+    CHECK(count == 2);
+}
+
+TEST_CASE("Driver invalid shard options") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    const char* argv[] = {"testfoo", "--shard-count=2", "--shard-index=2"};
+    CHECK(driver.parseCommandLine(3, argv));
+    CHECK(!driver.processOptions());
+    CHECK(stderrContains("--shard-index must be less than --shard-count"));
+}
+
+TEST_CASE("Driver sharded compilation") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    // The sorted top list is [k, m], so shard 1 of 2 gets just m.
+    auto args = fmt::format("testfoo \"{0}test.sv\" \"{0}test5.sv\" --top=m --top=k "
+                            "--shard-count=2 --shard-index=1",
+                            findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+
+    auto compilation = driver.createCompilation();
+    CHECK(driver.reportCompilation(*compilation, false));
+    CHECK(stdoutContains("    m\n"));
+    CHECK(!stdoutContains("    k\n"));
+    CHECK(stdoutContains("Build succeeded"));
+}
+
+TEST_CASE("Driver sharded compilation with empty shard") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\" \"{0}test5.sv\" "
+                            "--shard-count=8 --shard-index=7",
+                            findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(!driver.parseAllSources());
+    CHECK(stderrContains("has no top modules to elaborate"));
+}
+
 TEST_CASE("Driver setting a bunch of compilation options") {
     for (auto timing : {"min", "typ", "max"}) {
         auto guard = OS::captureOutput();
@@ -550,6 +789,26 @@ TEST_CASE("Driver library files with explicit name") {
     }
 }
 
+TEST_CASE("Driver lazy library parsing") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    // test5.sv is never referenced so it should be scanned but not parsed;
+    // libmod is instantiated directly and pkg is pulled in transitively.
+    auto args = fmt::format("testfoo \"{0}test3.sv\" --lazy-libraries "
+                            "-v \"{0}library/libmod.qv\" -v \"{0}library/pkg.sv\" "
+                            "-v \"{0}test5.sv\"",
+                            findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+    CHECK(driver.reportParseDiags());
+
+    CHECK(driver.syntaxTrees.size() == 3);
+}
+
 TEST_CASE("Driver load library maps") {
     auto guard = OS::captureOutput();
 
@@ -695,3 +954,48 @@ TEST_CASE("Driver customize default lib name") {
     CHECK(units[0]->getSourceLibrary()->name == "blah");
     CHECK(units[1]->getSourceLibrary()->name == "blah");
 }
+
+TEST_CASE("Driver source package round trip") {
+    auto guard = OS::captureOutput();
+    auto pkgPath = (std::filesystem::temp_directory_path() / "slang_test.svpkg").string();
+
+    {
+        Driver driver;
+        driver.addStandardArgs();
+
+        auto args = fmt::format("testfoo -v \"blah={0}test6.sv\"", findTestDir());
+        CHECK(driver.parseCommandLine(args));
+        CHECK(driver.sourceLoader.writePackage(pkgPath));
+    }
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test5.sv\" --load-precompiled \"{1}\" "
+                            "--defaultLibName blah",
+                            findTestDir(), pkgPath);
+    CHECK(driver.parseCommandLine(args));
+    CHECK(driver.processOptions());
+    CHECK(driver.parseAllSources());
+
+    auto compilation = driver.createCompilation();
+    CHECK(driver.reportCompilation(*compilation, false));
+    CHECK(stdoutContains("Build succeeded"));
+
+    auto& root = compilation->getRoot();
+    REQUIRE(root.topInstances.size() == 1);
+    CHECK(root.topInstances[0]->name == "k");
+    CHECK(root.topInstances[0]->getSourceLibrary()->name == "blah");
+}
+
+TEST_CASE("Driver invalid source package") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo --load-precompiled \"{0}test.sv\"", findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(!driver.processOptions());
+    CHECK(stderrContains("not a valid source package"));
+}
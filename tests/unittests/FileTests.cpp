@@ -23,6 +23,25 @@ TEST_CASE("Read source") {
     CHECK(file->data.length() > 0);
 }
 
+TEST_CASE("Read source (memory mapped)") {
+    SourceManager manager;
+    manager.setEnableMemoryMapping(true);
+    std::string testPath = getTestInclude();
+
+    CHECK(!manager.readSource("X:\\nonsense.txt", /* library */ nullptr));
+
+    auto file = manager.readSource(testPath, /* library */ nullptr);
+    REQUIRE(file);
+    CHECK(file->data.length() > 0);
+    CHECK(file->data.back() == '\0');
+
+    // Contents should match what a copying read produces.
+    SourceManager copyManager;
+    auto copied = copyManager.readSource(testPath, /* library */ nullptr);
+    REQUIRE(copied);
+    CHECK(file->data == copied->data);
+}
+
 TEST_CASE("Read header (absolute)") {
     SourceManager manager;
     std::string testPath = getTestInclude();
@@ -182,3 +201,29 @@ TEST_CASE("In-memory glob matching") {
     CHECK(!svGlobMatches("foo/bar/baz.txt", "foo/...bat.txt"));
     CHECK(svGlobMatches("foo/bar/baz.txt", "...baz.txt"));
 }
+
+TEST_CASE("Batched line number lookup") {
+    SourceManager manager;
+    auto buffer1 = manager.assignText("one\r\ntwo\nthree\rfour");
+    auto buffer2 = manager.assignText("alpha\nbeta\n");
+
+    // Mix buffers and include one out-of-order location; results should
+    // always match individual getLineNumber queries.
+    std::vector<SourceLocation> locations = {SourceLocation(buffer1.id, 0),
+                                             SourceLocation(buffer1.id, 5),
+                                             SourceLocation(buffer1.id, 9),
+                                             SourceLocation(buffer1.id, 15),
+                                             SourceLocation(buffer2.id, 6),
+                                             SourceLocation(buffer2.id, 1)};
+
+    std::vector<size_t> results(locations.size());
+    manager.getLineNumbers(locations, results);
+
+    for (size_t i = 0; i < locations.size(); i++)
+        CHECK(results[i] == manager.getLineNumber(locations[i]));
+
+    CHECK(results[0] == 1);
+    CHECK(results[3] == 4);
+    CHECK(results[4] == 2);
+    CHECK(results[5] == 1);
+}
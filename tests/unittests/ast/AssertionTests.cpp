@@ -4,6 +4,7 @@
 #include "Test.h"
 #include <fmt/format.h>
 
+#include "slang/ast/ASTVisitor.h"
 #include "slang/diagnostics/StatementsDiags.h"
 
 TEST_CASE("Named sequences") {
@@ -2670,3 +2671,107 @@ endmodule
     REQUIRE(diags.size() == 2);
     CHECK(diags[0].code == diag::Redefinition);
 }
+
+TEST_CASE("Assertion expansion statistics") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    logic clk, a, b;
+
+    sequence s1;
+        a ##1 b;
+    endsequence
+
+    sequence s2;
+        s1 ##1 s1;
+    endsequence
+
+    property p;
+        @(posedge clk) s2 |-> s1;
+    endproperty
+
+    assert property (p);
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    const Symbol* s1 = nullptr;
+    const Symbol* p = nullptr;
+    for (auto& [symbol, stats] : compilation.getAssertionExpansionStats()) {
+        if (symbol->name == "s1")
+            s1 = symbol;
+        else if (symbol->name == "p")
+            p = symbol;
+    }
+
+    auto& stats = compilation.getAssertionExpansionStats();
+    REQUIRE(s1);
+    REQUIRE(p);
+    CHECK(stats.at(p).count == 1);
+    CHECK(stats.at(p).maxDepth == 1);
+
+    // s1 expands three times: twice inside s2 and once directly in p.
+    CHECK(stats.at(s1).count >= 2);
+    CHECK(stats.at(s1).maxDepth >= 2);
+}
+
+TEST_CASE("Argument-less assertion instances share one expansion") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    logic clk, a, b;
+
+    sequence s;
+        a ##1 b;
+    endsequence
+
+    assert property (@(posedge clk) s);
+    assert property (@(posedge clk) a |-> s);
+    assert property (@(negedge clk) s);
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    // The sequence has no ports and none of the uses are nested inside
+    // another expansion, so all three use sites share a single expanded body.
+    const Symbol* s = nullptr;
+    for (auto& [symbol, stats] : compilation.getAssertionExpansionStats()) {
+        if (symbol->name == "s")
+            s = symbol;
+    }
+
+    REQUIRE(s);
+    CHECK(compilation.getAssertionExpansionStats().at(s).count == 1);
+}
+
+TEST_CASE("Assertion clocking timing controls are cached") {
+    auto tree = SyntaxTree::fromText(R"(
+module m(input logic clk, a, b);
+    property p;
+        @(posedge clk) a |-> b;
+    endproperty
+
+    a1: assert property (p);
+    a2: assert property (p);
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    // Both assertions expand the same property, so the clocking event should
+    // have been bound once and shared.
+    std::vector<const TimingControl*> clocks;
+    compilation.getRoot().visit(makeVisitor([&](auto& v, const ClockingAssertionExpr& expr) {
+        clocks.push_back(&expr.clocking);
+        v.visitDefault(expr);
+    }));
+
+    REQUIRE(clocks.size() == 2);
+    CHECK(clocks[0] == clocks[1]);
+}
@@ -1243,3 +1243,45 @@ endmodule : cmp
         NO_COMPILATION_ERRORS;
     }
 }
+
+TEST_CASE("Defparams behind config cell overrides still resolve") {
+    auto tree = SyntaxTree::fromText(R"(
+config cfg;
+    design top;
+    cell a use b;
+endconfig
+
+module leaf;
+    parameter int p = 1;
+endmodule
+
+module a;
+endmodule
+
+module b;
+    leaf l();
+    defparam l.p = 42;
+endmodule
+
+module mid;
+    a x();
+endmodule
+
+module top;
+    mid m();
+endmodule
+)");
+
+    CompilationOptions options;
+    options.topModules.emplace("cfg");
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    // The relevance scan sees 'mid' instantiating 'a', which contains
+    // nothing of interest, but the config swaps in 'b' whose defparam the
+    // scan never saw; pruning must be disabled when a config is present.
+    auto& p = compilation.getRoot().lookupName<ParameterSymbol>("top.m.x.l.p");
+    CHECK(p.getValue().integer() == 42);
+}
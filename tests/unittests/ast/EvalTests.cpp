@@ -7,6 +7,7 @@
 using Catch::Approx;
 
 #include "slang/ast/ScriptSession.h"
+#include "slang/util/ThreadPool.h"
 
 TEST_CASE("Simple eval") {
     ScriptSession session;
@@ -43,6 +44,26 @@ endfunction
     NO_SESSION_ERRORS;
 }
 
+TEST_CASE("Eval single-return function inlining") {
+    ScriptSession session;
+    session.eval(R"(
+function automatic int mymax(int a, int b);
+    return a > b ? a : b;
+endfunction
+
+function automatic int fib(int n);
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+endfunction
+)");
+
+    auto value = session.eval("mymax(mymax(3, 7), 5)");
+    CHECK(value.integer() == 7);
+
+    value = session.eval("fib(10)");
+    CHECK(value.integer() == 55);
+    NO_SESSION_ERRORS;
+}
+
 TEST_CASE("Nested functions") {
     ScriptSession session;
     session.eval(R"(
@@ -1114,6 +1135,46 @@ endfunction
     CHECK(session.eval("func13(4'd0)").integer() == 3);
 }
 
+TEST_CASE("Eval case statement match tables") {
+    // Statements with all-constant arms build a match table on first eval;
+    // repeated evaluations must keep first-match priority semantics.
+    ScriptSession session;
+    session.eval(R"(
+function int func1(logic [3:0] foo);
+    casez (foo)
+        4'b0001: return 1;
+        4'b1??1: return 2;
+        4'b1001: return 3;
+        4'b1xx1: return 4;
+    endcase
+    return 5;
+endfunction
+)");
+    for (int i = 0; i < 3; i++) {
+        CHECK(session.eval("func1(4'b0001)").integer() == 1);
+        CHECK(session.eval("func1(4'b1001)").integer() == 2);
+        CHECK(session.eval("func1(4'b1111)").integer() == 2);
+        CHECK(session.eval("func1(4'b0011)").integer() == 5);
+        CHECK(session.eval("func1(4'b1zz1)").integer() == 2);
+    }
+
+    session.eval(R"(
+function int func2(logic [3:0] foo);
+    case (foo)
+        4'b01x0: return 1;
+        4'b1010: return 2;
+        4'b1010: return 3;
+    endcase
+    return 4;
+endfunction
+)");
+    for (int i = 0; i < 3; i++) {
+        CHECK(session.eval("func2(4'b01x0)").integer() == 1);
+        CHECK(session.eval("func2(4'b1010)").integer() == 2);
+        CHECK(session.eval("func2(4'b0100)").integer() == 4);
+    }
+}
+
 TEST_CASE("Eval sformatf") {
     ScriptSession session;
     session.eval("logic [125:0] foo = '0;");
@@ -2540,3 +2601,67 @@ TEST_CASE("Array map eval") {
 
     NO_SESSION_ERRORS;
 }
+
+TEST_CASE("Batch expression eval") {
+    ScriptSession session;
+    session.eval("localparam int P = 7;");
+    session.eval("int x = 5;");
+    session.eval(R"(
+function automatic int square(int a);
+    int result;
+    case (a)
+        1: result = 1;
+        2: result = 4;
+        3: result = 9;
+        default: result = a * a;
+    endcase
+    return result;
+endfunction
+)");
+
+    std::vector<std::string_view> texts = {"x + 1"sv, "P * 2"sv, "square(3)"sv, "square(P)"sv,
+                                           "x * P"sv};
+
+    // Serial and pooled evaluation must agree.
+    auto serial = session.evalBatch(texts);
+    REQUIRE(serial.size() == 5);
+    CHECK(serial[0].integer() == 6);
+    CHECK(serial[1].integer() == 14);
+    CHECK(serial[2].integer() == 9);
+    CHECK(serial[3].integer() == 49);
+    CHECK(serial[4].integer() == 35);
+
+    ThreadPool pool(2);
+    auto pooled = session.evalBatch(texts, &pool);
+    REQUIRE(pooled.size() == 5);
+    for (size_t i = 0; i < 5; i++)
+        CHECK(pooled[i] == serial[i]);
+
+    // Batch evaluation doesn't disturb session state.
+    CHECK(session.eval("x").integer() == 5);
+
+    NO_SESSION_ERRORS;
+}
+
+TEST_CASE("Long left-associated operator chains") {
+    ScriptSession session;
+
+    // Build a chain far deeper than could be bound or evaluated with
+    // one stack frame per operand.
+    std::string text = "0";
+    for (int i = 1; i <= 5000; i++) {
+        text += " + ";
+        text += std::to_string(i);
+    }
+    CHECK(session.eval(text).integer() == 12502500);
+
+    // Mixed precedence still folds correctly since higher precedence
+    // operands hang off the right side of the chain.
+    CHECK(session.eval("1 + 2 * 3 - 4").integer() == 3);
+
+    // Short-circuiting applies at every link of a logical chain.
+    CHECK(session.eval("1 && 1 && 0 && 1").integer() == 0);
+    CHECK(session.eval("0 || 0 || 1 || 0").integer() == 1);
+
+    NO_SESSION_ERRORS;
+}
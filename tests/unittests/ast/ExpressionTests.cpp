@@ -53,6 +53,27 @@ TEST_CASE("Evaluate assignment expression") {
     NO_COMPILATION_ERRORS;
 }
 
+TEST_CASE("Operator chain interior nodes keep syntax pointers") {
+    auto syntax = SyntaxTree::fromText("1 + 2 + 3 + 4 + 5 + 6 + 7 + 8");
+
+    Compilation compilation;
+    auto& scope = compilation.createScriptScope();
+
+    ASTContext astCtx(scope, LookupLocation::max);
+    auto& bound = Expression::bind(syntax->root().as<ExpressionSyntax>(), astCtx);
+    REQUIRE(syntax->diagnostics().empty());
+
+    // Every node down the left spine should have its syntax assigned,
+    // including the interior nodes built by the iterative chain rebuild.
+    const Expression* expr = &bound;
+    while (expr->kind == ExpressionKind::BinaryOp) {
+        CHECK(expr->syntax != nullptr);
+        expr = &expr->as<BinaryExpression>().left();
+    }
+    CHECK(expr->syntax != nullptr);
+    NO_COMPILATION_ERRORS;
+}
+
 TEST_CASE("Check type propagation") {
     // Assignment operator should increase RHS size to 20
     auto syntax = SyntaxTree::fromText("i = 5'b0101 + 4'b1100");
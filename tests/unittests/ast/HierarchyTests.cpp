@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "Test.h"
+#include <fmt/format.h>
 
 #include "slang/ast/symbols/BlockSymbols.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
@@ -9,6 +10,7 @@
 #include "slang/ast/symbols/MemberSymbols.h"
 #include "slang/ast/symbols/ParameterSymbols.h"
 #include "slang/text/SourceManager.h"
+#include "slang/util/ThreadPool.h"
 
 TEST_CASE("Finding top level") {
     auto file1 = SyntaxTree::fromText(
@@ -27,6 +29,97 @@ TEST_CASE("Finding top level") {
     NO_COMPILATION_ERRORS;
 }
 
+TEST_CASE("Scope flat member array") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    int a;
+    real b;
+    logic [3:0] c;
+    function int f; return a; endfunction
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& body = compilation.getRoot().topInstances[0]->body;
+    auto arr = body.membersArray();
+
+    // The flat array should match a walk of the member list exactly.
+    size_t i = 0;
+    for (auto& member : body.members()) {
+        REQUIRE(i < arr.size());
+        CHECK(arr[i++] == &member);
+    }
+    CHECK(i == arr.size());
+
+    // Repeated requests return the same cached array.
+    CHECK(body.membersArray().data() == arr.data());
+}
+
+TEST_CASE("Freezing a compilation") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int P = 4);
+    logic [P-1:0] data = '0;
+    if (P > 2) begin : g
+        int i;
+    end
+endmodule
+
+module top;
+    m #(.P(8)) m1();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    CHECK(!compilation.isFrozen());
+    compilation.freeze();
+    CHECK(compilation.isFrozen());
+    NO_COMPILATION_ERRORS;
+
+    // Freezing again is a no-op, and the design remains traversable.
+    compilation.freeze();
+    auto& body = compilation.getRoot().topInstances[0]->body;
+    CHECK(body.find("m1") != nullptr);
+}
+
+TEST_CASE("Frozen hierarchical lookup cache") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf;
+    logic [7:0] data;
+endmodule
+
+module mid;
+    leaf l();
+endmodule
+
+module top;
+    mid env();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    compilation.freeze();
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+    auto first = root.lookupName("top.env.l.data");
+    REQUIRE(first);
+    CHECK(first->name == "data");
+
+    // Repeated lookups of the same dotted path are served from the cache
+    // and resolve to the identical symbol.
+    for (int i = 0; i < 3; i++)
+        CHECK(root.lookupName("top.env.l.data") == first);
+
+    CHECK(root.lookupName("top.env.l") ==
+          &compilation.getRoot().lookupName<InstanceSymbol>("top.env.l"));
+}
+
 TEST_CASE("Finding top level - 2") {
     auto tree1 = SyntaxTree::fromText(R"(
 module top;
@@ -490,6 +583,55 @@ endmodule
     NO_COMPILATION_ERRORS;
 }
 
+TEST_CASE("Elaboration progress counters") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf;
+endmodule
+
+module top;
+    leaf l1();
+    leaf l2();
+    leaf l3();
+endmodule
+)");
+
+    Compilation compilation;
+    auto& progress = compilation.getProgress();
+    CHECK(progress.phase == Compilation::ElaborationProgress::NotStarted);
+    CHECK(progress.phaseName() == "not started");
+
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    CHECK(progress.phase == Compilation::ElaborationProgress::Complete);
+    CHECK(progress.phaseName() == "complete");
+
+    // top plus three leaves, shared or not.
+    CHECK(progress.instancesProcessed == 4);
+    CHECK(progress.liveBytes > 0);
+}
+
+TEST_CASE("Very deep hierarchy elaborates fully") {
+    // Deep enough to exercise the visitor's suspend-and-resume handling of
+    // deep subtrees while staying under maxInstanceDepth.
+    std::string source;
+    for (int i = 0; i < 100; i++)
+        source += fmt::format("module m{}; m{} next(); int unused{}; endmodule\n", i, i + 1, i);
+    source += "module m100; endmodule\n";
+
+    auto tree = SyntaxTree::fromText(source);
+
+    CompilationOptions coptions;
+    coptions.flags &= ~CompilationFlags::SuppressUnused;
+
+    Compilation compilation(coptions);
+    compilation.addSyntaxTree(tree);
+
+    // Every level should have been visited, including the deepest ones.
+    auto& diags = compilation.getAllDiagnostics();
+    CHECK(diags.size() == 100);
+}
+
 TEST_CASE("Recursive modules -- invalid") {
     auto tree = SyntaxTree::fromText(R"(
 module bar;
@@ -1908,3 +2050,387 @@ endmodule
     compilation.addSyntaxTree(tree);
     NO_COMPILATION_ERRORS;
 }
+
+TEST_CASE("Duplicate parameterizations still report diags per parameterization") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int W = 8);
+    logic [W-1:0] v;
+    initial v = 3'd7;
+endmodule
+
+module top;
+    m #(4) m1();
+    m #(4) m2();
+    m #(4) m3();
+    m #(3) m4();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    // The W=4 instances share one elaboration; the warning must still be
+    // coalesced as appearing in three of the four instances.
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::WidthExpand);
+    CHECK(diags[0].coalesceCount == 3);
+}
+
+TEST_CASE("Duplicate diagnostics fold across distinct parameterizations") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int P = 0);
+    logic [3:0] v;
+    if (P != 3) begin
+        initial v = 3'd7;
+    end
+endmodule
+
+module top;
+    m #(0) m1();
+    m #(1) m2();
+    m #(2) m3();
+    m #(3) m4();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    // Four distinct elaborations; the identical warning from the first three
+    // is folded down to instance bodies as it's issued and must still be
+    // reported once with the right instance count.
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::WidthExpand);
+    CHECK(diags[0].coalesceCount == 3);
+}
+
+TEST_CASE("Upward names prevent instance elaboration sharing") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf;
+    logic [3:0] v;
+    initial v = mid.w;
+endmodule
+
+module mid #(parameter int W);
+    logic [W-1:0] w;
+    leaf l();
+endmodule
+
+module top;
+    mid #(4) a();
+    mid #(8) b();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    // Both leaf bodies have identical (empty) parameterizations but resolve
+    // mid.w differently, so the second one must still be elaborated to find
+    // the truncation in b.l.
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::WidthTruncate);
+
+    // The report of what blocked sharing should call out the upward name.
+    auto blockers = compilation.getElabSharingBlockers();
+    REQUIRE(blockers.size() == 1);
+    CHECK(blockers[0].first->name == "leaf");
+    CHECK(blockers[0].second == "upward hierarchical name");
+}
+
+TEST_CASE("Hierarchical references into a body prevent elaboration sharing") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    logic v;
+    assign v = 1;
+endmodule
+
+module top;
+    m m1();
+    m m2();
+    assign top.m2.v = 0;
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    // m2's body matches m1's already-elaborated one, but the hierarchical
+    // assign reaches into it; its internal continuous assign must still be
+    // bound so that the driver conflict is detected.
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::MultipleContAssigns);
+}
+
+TEST_CASE("Instance body structural hashing") {
+    auto makeTree = [](std::string_view addend) {
+        return SyntaxTree::fromText(fmt::format(R"(
+module leaf #(parameter int W = 4)(input logic [W-1:0] in, output logic [W-1:0] out);
+    always_comb out = in + {};
+endmodule
+
+module other;
+    int i;
+endmodule
+
+module top;
+    logic [7:0] a, b;
+    leaf #(8) l(.in(a), .out(b));
+    other o();
+endmodule
+)",
+                                                addend));
+    };
+
+    Compilation c1;
+    c1.addSyntaxTree(makeTree("1"));
+    CHECK(c1.getAllDiagnostics().empty());
+
+    Compilation c2;
+    c2.addSyntaxTree(makeTree("1"));
+
+    Compilation c3;
+    c3.addSyntaxTree(makeTree("2"));
+
+    auto hashOf = [](Compilation& c, std::string_view name) {
+        return c.getRoot().lookupName<InstanceSymbol>(name).body.getStructuralHash();
+    };
+
+    // Identical designs hash identically, all the way up the tree.
+    CHECK(hashOf(c1, "top") == hashOf(c2, "top"));
+    CHECK(hashOf(c1, "top.l") == hashOf(c2, "top.l"));
+
+    // Changing leaf changes its hash and the hash of every ancestor,
+    // but unrelated siblings are unaffected.
+    CHECK(hashOf(c1, "top") != hashOf(c3, "top"));
+    CHECK(hashOf(c1, "top.l") != hashOf(c3, "top.l"));
+    CHECK(hashOf(c1, "top.o") == hashOf(c3, "top.o"));
+}
+
+TEST_CASE("Design hash for build cache keys") {
+    auto makeTree = [](std::string_view addend) {
+        return SyntaxTree::fromText(fmt::format(R"(
+module leaf(input int in, output int out);
+    always_comb out = in + {};
+endmodule
+
+module top1;
+    int a, b;
+    leaf l(.in(a), .out(b));
+endmodule
+
+module top2;
+    int i;
+endmodule
+)",
+                                                addend));
+    };
+
+    Compilation c1;
+    c1.addSyntaxTree(makeTree("1"));
+    auto h1 = c1.getDesignHash();
+
+    // The parallel path produces the same key as the serial one.
+    Compilation c2;
+    c2.addSyntaxTree(makeTree("1"));
+    ThreadPool pool;
+    CHECK(c2.getDesignHash(&pool) == h1);
+
+    // Changing the design changes the key.
+    Compilation c3;
+    c3.addSyntaxTree(makeTree("2"));
+    CHECK(c3.getDesignHash() != h1);
+}
+
+TEST_CASE("Constant-dead statement discovery") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter bit ENABLE = 0)(input logic clk, input int in, output int out);
+    always_comb begin
+        if (ENABLE) begin
+            out = in * 2;
+        end
+        else begin
+            out = in;
+            if (in > 0)
+                out++;
+        end
+    end
+endmodule
+
+module top(input logic clk, input int in, output int o1, o2);
+    m #(0) m0(.clk, .in, .out(o1));
+    m #(1) m1(.clk, .in, .out(o2));
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    // In m0 the if-true branch is dead; in m1 the else branch is. The
+    // non-constant inner condition is never reported.
+    auto& root = compilation.getRoot();
+    auto dead0 = compilation.findConstantDeadStatements(root.lookupName<InstanceSymbol>("top.m0"));
+    auto dead1 = compilation.findConstantDeadStatements(root.lookupName<InstanceSymbol>("top.m1"));
+    REQUIRE(dead0.size() == 1);
+    REQUIRE(dead1.size() == 1);
+    CHECK(dead0[0] != dead1[0]);
+    CHECK(dead0[0]->kind == StatementKind::Block);
+    CHECK(dead1[0]->kind == StatementKind::Block);
+}
+
+TEST_CASE("Elaboration cost estimates") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf(input logic clk, output int count);
+    int a, b, c;
+    always_ff @(posedge clk)
+        count <= a + b + c;
+endmodule
+
+module top(input logic clk);
+    int c0, c1;
+    leaf l0(.clk, .count(c0));
+    leaf l1(.clk, .count(c1));
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    const DefinitionSymbol* leaf = nullptr;
+    const DefinitionSymbol* top = nullptr;
+    for (auto& [def, stats] : compilation.getElaborationCostStats()) {
+        if (def->name == "leaf")
+            leaf = def;
+        else if (def->name == "top")
+            top = def;
+    }
+
+    auto& stats = compilation.getElaborationCostStats();
+    REQUIRE(leaf);
+    REQUIRE(top);
+    CHECK(stats.at(top).instanceCount == 1);
+    CHECK(stats.at(top).symbolsVisited > 0);
+
+    // Both leaf instances are counted even though their identical bodies
+    // share one elaboration, which only visits symbols once.
+    CHECK(stats.at(leaf).instanceCount == 2);
+    CHECK(stats.at(leaf).symbolsVisited > 0);
+}
+
+TEST_CASE("Parameter environment interning") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int W = 8, parameter type T = logic);
+    T [W-1:0] data;
+endmodule
+
+module top;
+    m #(4) m0();
+    m #(4) m1();
+    m #(8) m2();
+    m #(.W(4), .T(bit)) m3();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+    auto bodyOf = [&](std::string_view path) -> const InstanceBodySymbol& {
+        return root.lookupName<InstanceSymbol>(path).body;
+    };
+
+    // Identical parameterizations share one environment object; distinct
+    // ones get their own, with distinct hashes in the common case.
+    auto& e0 = bodyOf("top.m0").getParameterEnv();
+    auto& e1 = bodyOf("top.m1").getParameterEnv();
+    auto& e2 = bodyOf("top.m2").getParameterEnv();
+    auto& e3 = bodyOf("top.m3").getParameterEnv();
+    CHECK(&e0 == &e1);
+    CHECK(&e0 != &e2);
+    CHECK(&e0 != &e3);
+    CHECK(e0.hash != e2.hash);
+
+    REQUIRE(e0.paramValues.size() == 1);
+    CHECK(e0.paramValues[0]->integer() == 4);
+    CHECK(e2.paramValues[0]->integer() == 8);
+    REQUIRE(e0.typeParams.size() == 1);
+    CHECK(e0.typeParams[0]->toString() == "logic");
+
+    CHECK(bodyOf("top.m0").hasSameType(bodyOf("top.m1")));
+    CHECK(!bodyOf("top.m0").hasSameType(bodyOf("top.m3")));
+}
+
+TEST_CASE("Hierarchy skeleton elaboration mode") {
+    auto text = R"(
+module leaf #(parameter int W = 1);
+    logic [W-1:0] data;
+    initial data = not_a_real_name;
+endmodule
+
+module top;
+    leaf #(4) l0();
+    leaf #(8) l1();
+endmodule
+)";
+
+    // Skeleton mode still materializes the instance tree and parameter
+    // values but never binds the initial block, so the bad name inside
+    // it goes undiagnosed.
+    CompilationOptions coptions;
+    coptions.elaborationMode = ElaborationMode::HierarchySkeleton;
+
+    Compilation compilation(coptions);
+    compilation.addSyntaxTree(SyntaxTree::fromText(text));
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+    auto& l1 = root.lookupName<InstanceSymbol>("top.l1");
+    CHECK(l1.body.getParameterEnv().paramValues[0]->integer() == 8);
+
+    // The same design under full elaboration reports the error.
+    Compilation full;
+    full.addSyntaxTree(SyntaxTree::fromText(text));
+    CHECK(!full.getAllDiagnostics().empty());
+
+    // Definitions-only mode doesn't even look at the hierarchy.
+    CompilationOptions doptions;
+    doptions.elaborationMode = ElaborationMode::DefinitionsOnly;
+
+    Compilation defsOnly(doptions);
+    defsOnly.addSyntaxTree(SyntaxTree::fromText(text));
+    NO_COMPILATION_ERRORS;
+    CHECK(defsOnly.getDefinitions().size() == 2);
+}
+
+TEST_CASE("Freezing overrides shallow elaboration modes") {
+    auto text = R"(
+module leaf;
+    initial data = not_a_real_name;
+endmodule
+
+module top;
+    leaf l0();
+endmodule
+)";
+
+    CompilationOptions coptions;
+    coptions.elaborationMode = ElaborationMode::HierarchySkeleton;
+
+    Compilation compilation(coptions);
+    compilation.addSyntaxTree(SyntaxTree::fromText(text));
+
+    // Skeleton mode leaves the initial block unbound...
+    NO_COMPILATION_ERRORS;
+
+    // ...but the frozen contract requires full elaboration, so freezing
+    // forces the rest of the walk (and surfaces its diagnostics).
+    compilation.freeze();
+    CHECK(!compilation.getAllDiagnostics().empty());
+}
@@ -5,6 +5,7 @@
 
 #include "slang/ast/Compilation.h"
 #include "slang/ast/EvalContext.h"
+#include "slang/ast/SymbolSearchIndex.h"
 #include "slang/ast/expressions/AssignmentExpressions.h"
 #include "slang/ast/expressions/MiscExpressions.h"
 #include "slang/ast/symbols/BlockSymbols.h"
@@ -2133,6 +2134,64 @@ endpackage
     compilation.getAllDiagnostics();
 }
 
+TEST_CASE("Package mutual import loop") {
+    auto tree = SyntaxTree::fromText(R"(
+package p;
+    import q::*;
+    int x = 1;
+endpackage
+
+package q;
+    import p::*;
+    int y = x + 1;
+endpackage
+
+module m;
+    import q::*;
+    int z = y;
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    // Check no crash or infinite loop from the cycle.
+    compilation.getAllDiagnostics();
+}
+
+TEST_CASE("Packages elaborate eagerly in dependency order") {
+    auto tree = SyntaxTree::fromText(R"(
+package p1;
+    import p2::*;
+    int a = bad_name_a;
+    int b = bad_name_b;
+endpackage
+
+package p2;
+    int c = bad_name_c;
+    int d = bad_name_d;
+endpackage
+)");
+
+    // With an error limit of one, only the first package visited gets fully
+    // checked. p1 is declared first but imports p2, so the dependency-ordered
+    // eager pre-pass must check p2 before it.
+    CompilationOptions options;
+    options.errorLimit = 1;
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 2);
+    CHECK(diags[0].code == diag::UndeclaredIdentifier);
+    CHECK(diags[1].code == diag::UndeclaredIdentifier);
+
+    auto text = report(diags);
+    CHECK(text.find("bad_name_c") != std::string::npos);
+    CHECK(text.find("bad_name_a") == std::string::npos);
+}
+
 TEST_CASE("Bind instantiation can't see into $unit, can't import") {
     auto tree = SyntaxTree::fromText(R"(
 `default_nettype none
@@ -2174,3 +2233,116 @@ endmodule
     CHECK(diags[4].code == diag::UndeclaredIdentifier);
     CHECK(diags[5].code == diag::ImplicitNamedPortNotFound);
 }
+
+TEST_CASE("Unqualified lookup miss caching after freeze") {
+    auto tree = SyntaxTree::fromText(R"(
+package p;
+    int x;
+endpackage
+
+module top;
+    import p::*;
+    int y = x;
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    compilation.freeze();
+
+    auto& body = compilation.getRoot().lookupName<InstanceSymbol>("top").body;
+
+    // The first miss proves the name absent and seeds the cache; the second
+    // answers from the cache. Hits are unaffected.
+    CHECK(body.lookupName("nonexistent") == nullptr);
+    CHECK(body.lookupName("nonexistent") == nullptr);
+    CHECK(body.lookupName("x") != nullptr);
+    CHECK(body.lookupName("y") != nullptr);
+}
+
+TEST_CASE("Bulk hierarchical path resolution") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf;
+    int acc;
+endmodule
+
+module top;
+    leaf l[3:0]();
+    for (genvar i = 0; i < 2; i++) begin : g
+        int x;
+    end
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    std::vector<std::string_view> paths = {"top",          "top.l",       "top.l[2]",
+                                           "top.l[2].acc", "top.g[1].x",  "top.l[5]",
+                                           "top.missing",  "top.l[2].acc"};
+    auto symbols = compilation.resolveHierarchicalPaths(paths);
+    REQUIRE(symbols.size() == 8);
+
+    CHECK(symbols[0]->name == "top");
+    CHECK(symbols[1]->kind == SymbolKind::InstanceArray);
+    CHECK(symbols[2]->kind == SymbolKind::Instance);
+    CHECK(symbols[3]->kind == SymbolKind::Variable);
+    CHECK(symbols[4]->name == "x");
+
+    // Out of range and unknown names resolve to null.
+    CHECK(symbols[5] == nullptr);
+    CHECK(symbols[6] == nullptr);
+
+    // Repeats come from the prefix cache.
+    CHECK(symbols[7] == symbols[3]);
+}
+
+TEST_CASE("Symbol search index") {
+    auto tree = SyntaxTree::fromText(R"(
+module fifo_ctrl;
+    logic wr_ptr_gray;
+    logic rd_ptr_gray;
+    int depth;
+endmodule
+
+module top;
+    int grayCounter;
+    fifo_ctrl ctrl();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    SymbolSearchIndex index(compilation);
+    CHECK(index.size() >= 6);
+
+    // Substring matching is case-insensitive and ranked: the exact name
+    // match comes back first, then prefix matches, then interior ones.
+    auto results = index.lookup("gray");
+    REQUIRE(results.size() == 3);
+    CHECK(results[0].symbol->name == "grayCounter");
+    CHECK(results[1].symbol->name == "rd_ptr_gray");
+    CHECK(results[2].symbol->name == "wr_ptr_gray");
+
+    results = index.lookup("fifo_ctrl");
+    REQUIRE(!results.empty());
+    CHECK(results[0].symbol->name == "fifo_ctrl");
+
+    // Short queries work too, just without trigram acceleration.
+    results = index.lookup("wr");
+    REQUIRE(!results.empty());
+    CHECK(results[0].symbol->name == "wr_ptr_gray");
+
+    CHECK(index.lookup("nonexistent").empty());
+    CHECK(index.lookup("").empty());
+
+    // maxResults truncates from the bottom of the ranking.
+    results = index.lookup("gray", 1);
+    REQUIRE(results.size() == 1);
+    CHECK(results[0].symbol->name == "grayCounter");
+}
@@ -15,6 +15,7 @@
 #include "slang/ast/symbols/MemberSymbols.h"
 #include "slang/ast/symbols/ParameterSymbols.h"
 #include "slang/ast/symbols/PortSymbols.h"
+#include "slang/ast/symbols/SpecifySymbols.h"
 #include "slang/ast/symbols/SubroutineSymbols.h"
 #include "slang/ast/symbols/VariableSymbols.h"
 #include "slang/ast/types/NetType.h"
@@ -1081,6 +1082,37 @@ endmodule
     CHECK(path == "top.genblk1[0].a");
 }
 
+TEST_CASE("Hierarchical paths reuse cached parent prefixes") {
+    auto tree = SyntaxTree::fromText(R"(
+module top;
+    m m1();
+    m m2();
+endmodule
+
+module m;
+    int x;
+    int y;
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    // Querying several symbols under the same parents exercises the interned
+    // prefix cache; each result must still be the symbol's own full path.
+    auto pathOf = [&](std::string_view name) {
+        std::string path;
+        compilation.getRoot().lookupName(name)->getHierarchicalPath(path);
+        return path;
+    };
+
+    CHECK(pathOf("top.m1.x") == "top.m1.x");
+    CHECK(pathOf("top.m1.y") == "top.m1.y");
+    CHECK(pathOf("top.m2.x") == "top.m2.x");
+    CHECK(pathOf("top.m1.x") == "top.m1.x");
+}
+
 TEST_CASE("$static_assert elab task") {
     auto tree = SyntaxTree::fromText(R"(
 module top;
@@ -1623,6 +1655,45 @@ endmodule
     NO_COMPILATION_ERRORS;
 }
 
+TEST_CASE("Specify block bulk timing arcs") {
+    auto tree = SyntaxTree::fromText(R"(
+module m(input a, b, output out);
+    specify
+        specparam rise = 1, fall = 2;
+        if (a) (b => out) = (rise, fall);
+        (a *> out) = 3;
+        ifnone (b => out) = (1, 0);
+    endspecify
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& block = *compilation.getRoot()
+                       .topInstances[0]
+                       ->body.membersOfType<SpecifyBlockSymbol>()
+                       .begin();
+
+    auto arcs = block.getTimingArcs();
+    REQUIRE(arcs.size() == 3);
+
+    CHECK(arcs[0].condition != nullptr);
+    REQUIRE(arcs[0].inputs.size() == 1);
+    REQUIRE(arcs[0].outputs.size() == 1);
+    CHECK(arcs[0].delays.size() == 2);
+
+    CHECK(arcs[1].condition == nullptr);
+    CHECK(arcs[1].path->connectionKind == TimingPathSymbol::ConnectionKind::Full);
+    CHECK(arcs[1].delays.size() == 1);
+
+    CHECK(arcs[2].path->isStateDependent);
+
+    // Repeated calls return the same packed storage.
+    CHECK(block.getTimingArcs().data() == arcs.data());
+}
+
 TEST_CASE("Specify path errors") {
     auto tree = SyntaxTree::fromText(R"(
 interface I;
@@ -363,6 +363,52 @@ endmodule
     CHECK(cv.integer() == 15);
 }
 
+TEST_CASE("Param-dependent folds in differently parameterized bodies") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int WIDTH = 8);
+    localparam int ADDR = $clog2(WIDTH) - 1;
+endmodule
+
+module top;
+    m #(.WIDTH(8)) m1();
+    m #(.WIDTH(8)) m2();
+    m #(.WIDTH(256)) m3();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+    CHECK(root.lookupName<ParameterSymbol>("top.m1.ADDR").getValue().integer() == 2);
+    CHECK(root.lookupName<ParameterSymbol>("top.m2.ADDR").getValue().integer() == 2);
+    CHECK(root.lookupName<ParameterSymbol>("top.m3.ADDR").getValue().integer() == 7);
+}
+
+TEST_CASE("Scope-dependent system calls are not fold cached") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    localparam string PATH = $sformatf("%m");
+endmodule
+
+module top;
+    m m1();
+    m m2();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    // The same initializer syntax evaluates in both bodies but %m depends on
+    // the evaluating scope, so each body must get its own result.
+    auto& root = compilation.getRoot();
+    CHECK(root.lookupName<ParameterSymbol>("top.m1.PATH").getValue().str() == "top.m1");
+    CHECK(root.lookupName<ParameterSymbol>("top.m2.PATH").getValue().str() == "top.m2");
+}
+
 TEST_CASE("Parameter port wrong / implicit type regression GH #797") {
     auto tree = SyntaxTree::fromText(R"(
 module dut #(
@@ -829,6 +875,42 @@ endmodule
     CHECK(param("top.m1.q.n1.bar.n2.bar.n2.foo") == 6);
 }
 
+TEST_CASE("defparam alongside defparam-free subtrees") {
+    // The subtree under c1 contains no defparams or binds anywhere in its
+    // closure, so the resolution passes skip elaborating it; targets inside
+    // skipped subtrees must still receive their overrides.
+    auto tree = SyntaxTree::fromText(R"(
+module top;
+    leaf l1();
+    chain c1();
+    defparam l1.p = 42;
+endmodule
+
+module leaf;
+    parameter p = 1;
+endmodule
+
+module chain;
+    leaf2 l2();
+endmodule
+
+module leaf2;
+    parameter q = 5;
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto param = [&](auto name) {
+        return compilation.getRoot().lookupName<ParameterSymbol>(name).getValue().integer();
+    };
+
+    CHECK(param("top.l1.p") == 42);
+    CHECK(param("top.c1.l2.q") == 5);
+}
+
 TEST_CASE("defparam error cases") {
     auto tree = SyntaxTree::fromText(R"(
 module top;
@@ -1266,3 +1348,38 @@ endmodule
         CHECK(p.getValue().integer() == i + 1);
     }
 }
+
+TEST_CASE("Constant function call memoization") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    function automatic int f(int n);
+        int result = 0;
+        for (int i = 0; i < n; i++)
+            result += i;
+        return result;
+    endfunction
+
+    localparam int A = f(10);
+    localparam int B = f(10);
+    localparam int C = f(11);
+
+    for (genvar i = 0; i < 4; i++) begin : loop
+        localparam int D = f(10);
+    end
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+    CHECK(root.lookupName<ParameterSymbol>("m.A").getValue().integer() == 45);
+    CHECK(root.lookupName<ParameterSymbol>("m.B").getValue().integer() == 45);
+    CHECK(root.lookupName<ParameterSymbol>("m.C").getValue().integer() == 55);
+
+    for (int i = 0; i < 4; i++) {
+        auto& d = root.lookupName<ParameterSymbol>(fmt::format("m.loop[{}].D", i));
+        CHECK(d.getValue().integer() == 45);
+    }
+}
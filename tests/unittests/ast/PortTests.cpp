@@ -1675,6 +1675,139 @@ endmodule
     NO_COMPILATION_ERRORS;
 }
 
+TEST_CASE("Interface array connection sliced across a wide instance array") {
+    auto tree = SyntaxTree::fromText(R"(
+interface I;
+    logic q;
+    modport m(input q);
+endinterface
+
+module leaf(I.m i);
+    wire w = i.q;
+endmodule
+
+module top;
+    I i[32] ();
+    leaf l[32] (.i(i));
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+}
+
+TEST_CASE("Interface connection memo is scoped to the parent body") {
+    auto tree = SyntaxTree::fromText(R"(
+interface I;
+    logic q;
+    modport m(input q);
+endinterface
+
+module leaf(I.m i);
+    wire w = i.q;
+endmodule
+
+module mid(I.m i);
+    leaf l[1:0](.i(i));
+endmodule
+
+module top;
+    I i1();
+    I i2();
+    mid m1(.i(i1));
+    mid m2(.i(i2));
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+    auto connOf = [&](std::string_view arrayPath, size_t index) {
+        auto& arr = root.lookupName<InstanceArraySymbol>(arrayPath);
+        auto& inst = arr.elements[index]->as<InstanceSymbol>();
+        auto port = inst.body.findPort("i");
+        REQUIRE(port);
+        return inst.getPortConnection(port->as<InterfacePortSymbol>())->getIfaceConn().first;
+    };
+
+    // The same instance array syntax elaborates in both bodies of 'mid',
+    // where the connection resolves to a different interface; sibling
+    // elements share a resolution but the two bodies must not.
+    auto m1Conn = connOf("top.m1.l", 0);
+    CHECK(m1Conn == connOf("top.m1.l", 1));
+    CHECK(m1Conn != connOf("top.m2.l", 0));
+}
+
+TEST_CASE("Instance array elements share unsliced input connections") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf(input logic [7:0] in, output logic [7:0] out);
+endmodule
+
+module top;
+    logic [7:0] data;
+    logic [31:0] wide;
+    leaf l[3:0](.in(data), .out(wide));
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& arr = compilation.getRoot().lookupName<InstanceArraySymbol>("top.l");
+    auto getConn = [](const Symbol& element, std::string_view portName) {
+        auto& inst = element.as<InstanceSymbol>();
+        auto port = inst.body.findPort(portName);
+        REQUIRE(port);
+        return inst.getPortConnection(port->as<PortSymbol>())->getExpression();
+    };
+
+    // The broadcast input binds once and is shared by every element, while
+    // the sliced output is necessarily bound per element.
+    CHECK(getConn(*arr.elements[0], "in") == getConn(*arr.elements[1], "in"));
+    CHECK(getConn(*arr.elements[0], "out") != getConn(*arr.elements[1], "out"));
+}
+
+TEST_CASE("Shared input connections are scoped to the parent body") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf(input logic [7:0] in);
+endmodule
+
+module mid;
+    logic [7:0] data;
+    leaf l[1:0](.in(data));
+endmodule
+
+module top;
+    mid m1();
+    mid m2();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+    auto connOf = [&](std::string_view arrayPath, size_t index) {
+        auto& arr = root.lookupName<InstanceArraySymbol>(arrayPath);
+        auto& inst = arr.elements[index]->as<InstanceSymbol>();
+        auto port = inst.body.findPort("in");
+        REQUIRE(port);
+        return inst.getPortConnection(port->as<PortSymbol>())->getExpression();
+    };
+
+    // 'data' is a distinct variable in each elaborated body of 'mid', so
+    // the bound expression is shared between siblings but never across the
+    // two bodies, even though they instantiate identical syntax.
+    auto m1Conn = connOf("top.m1.l", 0);
+    CHECK(m1Conn == connOf("top.m1.l", 1));
+    CHECK(m1Conn != connOf("top.m2.l", 0));
+}
+
 TEST_CASE("Interface array port with modport selector passthrough") {
     auto tree = SyntaxTree::fromText(R"(
 interface I;
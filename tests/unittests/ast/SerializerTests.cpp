@@ -3,9 +3,12 @@
 
 #include "Test.h"
 
+#include <sstream>
+
 #include "slang/ast/ASTSerializer.h"
 #include "slang/ast/ASTVisitor.h"
 #include "slang/text/Json.h"
+#include "slang/util/ThreadPool.h"
 
 TEST_CASE("JSON dump") {
     auto tree = SyntaxTree::fromText(R"(
@@ -564,3 +567,75 @@ endmodule
   ]
 })");
 }
+
+TEST_CASE("JSON dump -- streaming output") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int N = 4) (input logic [N-1:0] a, output logic [N-1:0] b);
+    assign b = ~a;
+endmodule
+
+module top;
+    logic [3:0] x, y;
+    m m1(.a(x), .b(y));
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    JsonWriter buffered;
+    buffered.setPrettyPrint(true);
+    ASTSerializer serializer1(compilation, buffered);
+    serializer1.serialize(compilation.getRoot());
+
+    // Streaming with a tiny chunk size should produce byte-identical output.
+    std::ostringstream os;
+    JsonWriter streamed;
+    streamed.setPrettyPrint(true);
+    streamed.streamTo(os, 1);
+    ASTSerializer serializer2(compilation, streamed);
+    serializer2.serialize(compilation.getRoot());
+    streamed.finishStream();
+
+    CHECK(os.str() == std::string(buffered.view()));
+}
+
+TEST_CASE("JSON dump -- parallel serialization") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int N = 4) (input logic [N-1:0] a, output logic [N-1:0] b);
+    assign b = ~a;
+endmodule
+
+module top1;
+    logic [3:0] x, y;
+    m m1(.a(x), .b(y));
+endmodule
+
+module top2;
+    logic [7:0] x, y;
+    m #(8) m1(.a(x), .b(y));
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    // Serializing the root's members across a thread pool should produce
+    // byte-identical output to the single-threaded version, pretty or not.
+    for (bool pretty : {false, true}) {
+        JsonWriter sequential;
+        sequential.setPrettyPrint(pretty);
+        ASTSerializer serializer1(compilation, sequential);
+        serializer1.serialize(compilation.getRoot());
+
+        ThreadPool pool;
+        JsonWriter parallel;
+        parallel.setPrettyPrint(pretty);
+        ASTSerializer serializer2(compilation, parallel);
+        serializer2.serializeParallel(compilation.getRoot(), pool);
+
+        CHECK(std::string(parallel.view()) == std::string(sequential.view()));
+    }
+}
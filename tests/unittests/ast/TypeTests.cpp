@@ -2214,3 +2214,77 @@ logic [-2147483648:-2147483649] a;
     CHECK(diags[1].code == diag::SignedIntegerOverflow);
     CHECK(diags[2].code == diag::SignedIntegerOverflow);
 }
+
+TEST_CASE("Packed array type interning") {
+    auto tree = SyntaxTree::fromText(R"(
+module Top;
+    logic [63:0] a;
+    logic [63:0] b;
+    logic [63:0][3:0] c;
+    logic [63:0][3:0] d;
+    logic [62:0] e;
+endmodule
+)");
+
+    Compilation compilation;
+    const auto& instance = evalModule(tree, compilation).body;
+    auto typeOf = [&](std::string_view name) {
+        return &instance.find<VariableSymbol>(name).getType();
+    };
+
+    // Structurally identical packed arrays share a single interned instance.
+    CHECK(typeOf("a") == typeOf("b"));
+    CHECK(typeOf("c") == typeOf("d"));
+    CHECK(typeOf("a") != typeOf("c"));
+    CHECK(typeOf("a") != typeOf("e"));
+    CHECK(typeOf("a") == &compilation.getType(64, IntegralFlags::FourState));
+
+    NO_COMPILATION_ERRORS;
+}
+
+TEST_CASE("Type bit layout") {
+    auto tree = SyntaxTree::fromText(R"(
+module Top;
+    struct packed { logic [7:0] a; logic [3:0] b; logic c; } ps;
+    struct { logic [7:0] a; int b; } us;
+    int i;
+endmodule
+)");
+
+    Compilation compilation;
+    const auto& instance = evalModule(tree, compilation).body;
+    auto typeOf = [&](std::string_view name) {
+        return &instance.find<VariableSymbol>(name).getType();
+    };
+
+    auto psLayout = typeOf("ps")->getBitLayout();
+    REQUIRE(psLayout);
+    CHECK(psLayout->totalWidth == 13);
+    REQUIRE(psLayout->fields.size() == 3);
+
+    // Packed offsets count from the LSB, so the first declared field
+    // occupies the topmost bits.
+    CHECK(psLayout->fields[0].field->name == "a");
+    CHECK(psLayout->fields[0].offset == 5);
+    CHECK(psLayout->fields[0].width == 8);
+    CHECK(psLayout->fields[1].offset == 1);
+    CHECK(psLayout->fields[1].width == 4);
+    CHECK(psLayout->fields[2].offset == 0);
+    CHECK(psLayout->fields[2].width == 1);
+
+    auto usLayout = typeOf("us")->getBitLayout();
+    REQUIRE(usLayout);
+    CHECK(usLayout->totalWidth == 40);
+    REQUIRE(usLayout->fields.size() == 2);
+    CHECK(usLayout->fields[0].offset == 0);
+    CHECK(usLayout->fields[0].width == 8);
+    CHECK(usLayout->fields[1].offset == 8);
+    CHECK(usLayout->fields[1].width == 32);
+
+    // The layout is computed once per canonical type.
+    CHECK(psLayout == typeOf("ps")->getBitLayout());
+
+    CHECK(typeOf("i")->getBitLayout() == nullptr);
+
+    NO_COMPILATION_ERRORS;
+}
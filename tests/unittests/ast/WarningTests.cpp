@@ -110,6 +110,34 @@ endmodule
     CHECK(diags[18].code == diag::UnusedImplicitNet);
 }
 
+TEST_CASE("Unused warnings with shared instance elaborations") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    int unused;
+endmodule
+
+module top;
+    m m1();
+    m m2();
+    m m3();
+endmodule
+)");
+
+    CompilationOptions coptions;
+    coptions.flags &= ~CompilationFlags::SuppressUnused;
+
+    Compilation compilation(coptions);
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::UnusedVariable);
+
+    // The warning is present in every instance, so no coalescing info
+    // should be attached even though only one body was actually swept.
+    CHECK(!diags[0].coalesceCount.has_value());
+}
+
 TEST_CASE("Unused nets and vars false positives regress") {
     auto tree = SyntaxTree::fromText(R"(
 interface I(input clk);
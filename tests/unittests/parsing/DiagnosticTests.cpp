@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: MIT
 
 #include "Test.h"
+#include <sstream>
 
 #include "slang/diagnostics/DiagnosticClient.h"
+#include "slang/diagnostics/JsonDiagnosticClient.h"
 #include "slang/diagnostics/TextDiagnosticClient.h"
 #include "slang/text/SourceManager.h"
 
@@ -467,6 +469,38 @@ TEST_CASE("DiagnosticEngine stuff") {
     CHECK(client->count == 10); // includes 2 warnings and 1 fatal
 }
 
+TEST_CASE("DiagnosticEngine format string compilation") {
+    class TestClient : public DiagnosticClient {
+    public:
+        std::string lastMessage;
+        void report(const ReportedDiagnostic& diag) final { lastMessage = diag.formattedMessage; }
+    };
+
+    DiagnosticEngine engine(getSourceManager());
+    auto client = std::make_shared<TestClient>();
+    engine.addClient(client);
+
+    Diagnostic diag(diag::UndeclaredIdentifier, SourceLocation());
+    diag << std::string("foo");
+
+    // Issue twice so the second answer comes from the compiled format.
+    engine.issue(diag);
+    CHECK(client->lastMessage == "use of undeclared identifier 'foo'");
+    engine.issue(diag);
+    CHECK(client->lastMessage == "use of undeclared identifier 'foo'");
+
+    // Overriding the message invalidates the compiled form; escaped braces
+    // and unused arguments behave the same as the fmt fallback.
+    engine.setMessage(diag::UndeclaredIdentifier, "{{weird}} '{}' message");
+    engine.issue(diag);
+    CHECK(client->lastMessage == "{weird} 'foo' message");
+
+    // Messages with explicit specs take the fmt fallback path.
+    engine.setMessage(diag::UndeclaredIdentifier, "padded '{:>5}'");
+    engine.issue(diag);
+    CHECK(client->lastMessage == "padded '  foo'");
+}
+
 TEST_CASE("DiagnosticEngine::setWarningOptions") {
     auto options = std::vector{
         "everything"s, "none"s,     "error"s, "error=case-gen-dup"s, "no-error=empty-member"s,
@@ -529,6 +563,39 @@ source:11:5: warning: extra ';' has no effect [-Wempty-member]
 )");
 }
 
+TEST_CASE("JSON diagnostic client streams one record per diagnostic") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    ; // warn
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+
+    DiagnosticEngine engine(tree->sourceManager());
+
+    std::ostringstream sstr;
+    auto client = std::make_shared<JsonDiagnosticClient>(sstr);
+    engine.addClient(client);
+    for (auto& diag : compilation.getAllDiagnostics())
+        engine.issue(diag);
+
+    CHECK("\n" + sstr.str() == R"(
+{"severity":"warning","message":"extra ';' has no effect","file":"source","line":3,"col":5,"option":"empty-member"}
+)");
+
+    // The source line field is opt-in.
+    sstr.str("");
+    client->showSourceLine(true);
+    for (auto& diag : compilation.getAllDiagnostics())
+        engine.issue(diag);
+
+    CHECK("\n" + sstr.str() == R"(
+{"severity":"warning","message":"extra ';' has no effect","file":"source","line":3,"col":5,"option":"empty-member","source":"    ; // warn"}
+)");
+}
+
 TEST_CASE("Diagnostics with Unicode and tabs in source snippet") {
     auto tree = SyntaxTree::fromText(R"(
 module m;
@@ -3,6 +3,8 @@
 
 #include "Test.h"
 
+#include "slang/parsing/IncrementalLexer.h"
+#include "slang/parsing/Lexer.h"
 #include "slang/parsing/Preprocessor.h"
 #include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxPrinter.h"
@@ -377,6 +379,66 @@ TEST_CASE("String literal") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("String literal (verbatim value storage)") {
+    // A string with no escapes refers directly to the source text for its
+    // value instead of a separate copy; one with escapes can't.
+    auto& text = "\"plain text\"";
+    Token token = lexToken(text);
+    CHECK(token.valueText() == "plain text");
+    CHECK(token.valueText().data() == token.rawText().data() + 1);
+
+    auto& escaped = "\"plain\\ntext\"";
+    token = lexToken(escaped);
+    CHECK(token.valueText() == "plain\ntext");
+    CHECK(token.valueText().data() != token.rawText().data() + 1);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("String literal (broken UTF8 with control char)") {
+    // The lead byte promises a three byte sequence but the embedded control
+    // character cuts it short, so more bytes get appended to the value than
+    // are consumed from the source; the value must be a separate copy whose
+    // length doesn't overrun the literal.
+    auto& text = "\"a\xe0\x01z\"";
+    Token token = lexToken(text);
+
+    CHECK(token.kind == TokenKind::StringLiteral);
+    CHECK(token.toString() == text);
+    CHECK(token.valueText().data() != token.rawText().data() + 1);
+    REQUIRE(!diagnostics.empty());
+    CHECK(diagnostics.back().code == diag::InvalidUTF8Seq);
+}
+
+TEST_CASE("Long runs (bulk scanning)") {
+    // Exercise the vectorized scanning kernels with runs that cross the
+    // 16 and 32 byte chunk boundaries at every offset.
+    for (size_t len = 1; len < 70; len++) {
+        std::string ident(len, 'a');
+        Token token = lexToken(ident);
+        CHECK(token.kind == TokenKind::Identifier);
+        CHECK(token.toString() == ident);
+
+        std::string str = "\"" + std::string(len, 'x') + "\"";
+        token = lexToken(str);
+        CHECK(token.kind == TokenKind::StringLiteral);
+        CHECK(token.valueText() == std::string(len, 'x'));
+
+        std::string comment = "//" + std::string(len, '-') + "\nfoo";
+        token = lexToken(comment);
+        CHECK(token.kind == TokenKind::Identifier);
+        REQUIRE(token.trivia().size() == 2);
+        CHECK(token.trivia()[0].kind == TriviaKind::LineComment);
+        CHECK(token.trivia()[1].kind == TriviaKind::EndOfLine);
+
+        std::string ws = std::string(len, ' ') + "bar";
+        token = lexToken(ws);
+        CHECK(token.kind == TokenKind::Identifier);
+        REQUIRE(token.trivia().size() == 1);
+        CHECK(token.trivia()[0].kind == TriviaKind::Whitespace);
+    }
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("String literal (newline)") {
     auto& text = "\"literal\r\nwith new line\"";
     Token token = lexToken(text);
@@ -783,6 +845,59 @@ TEST_CASE("Escaped keyword identifiers") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("Compact whitespace trivia") {
+    auto& text = "\t // comment\n    foo";
+
+    LexerOptions options;
+    options.compactWhitespaceTrivia = true;
+
+    diagnostics.clear();
+    auto buffer = getSourceManager().assignText(text);
+    Lexer lexer(buffer, alloc, diagnostics, options);
+    Token token = lexer.lex();
+
+    CHECK(token.kind == TokenKind::Identifier);
+    REQUIRE(token.trivia().size() == 4);
+    CHECK(token.trivia()[0].kind == TriviaKind::Whitespace);
+    CHECK(token.trivia()[0].getRawText() == " ");
+    CHECK(token.trivia()[1].kind == TriviaKind::LineComment);
+    CHECK(token.trivia()[1].getRawText() == "// comment");
+    CHECK(token.trivia()[2].kind == TriviaKind::EndOfLine);
+    CHECK(token.trivia()[2].getRawText() == "\n");
+    CHECK(token.trivia()[3].kind == TriviaKind::Whitespace);
+    CHECK(token.trivia()[3].getRawText() == " ");
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("Compact trivia singletons") {
+    auto& text = "a\r\n  b\n    c";
+
+    LexerOptions options;
+    options.compactWhitespaceTrivia = true;
+
+    diagnostics.clear();
+    auto buffer = getSourceManager().assignText(text);
+    Lexer lexer(buffer, alloc, diagnostics, options);
+
+    Token a = lexer.lex();
+    Token b = lexer.lex();
+    Token c = lexer.lex();
+    CHECK(a.valueText() == "a");
+    CHECK(b.valueText() == "b");
+    CHECK(c.valueText() == "c");
+
+    // Both tokens are preceded by a newline plus indentation, so they should
+    // share the same statically allocated trivia array.
+    REQUIRE(b.trivia().size() == 2);
+    CHECK(b.trivia()[0].kind == TriviaKind::EndOfLine);
+    CHECK(b.trivia()[0].getRawText() == "\n");
+    CHECK(b.trivia()[1].kind == TriviaKind::Whitespace);
+    CHECK(b.trivia()[1].getRawText() == " ");
+    REQUIRE(c.trivia().size() == 2);
+    CHECK(b.trivia().data() == c.trivia().data());
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("Too many errors") {
     std::vector<char> buf(10, '\x01');
 
@@ -1263,3 +1378,64 @@ TEST_CASE("Hex escape corner case") {
     CHECK(diagnostics[0].code == diag::InvalidHexEscapeCode);
     CHECK(diagnostics[1].code == diag::ExpectedClosingQuote);
 }
+
+TEST_CASE("Incremental lexer resync") {
+    std::string text = "module m;\n  logic [31:0] foo;\n  assign foo = 32'd1; // note\nendmodule\n";
+    text.push_back('\0');
+
+    IncrementalLexer inc;
+    inc.prime(text);
+    size_t total = inc.boundaries().size();
+    REQUIRE(total > 0);
+
+    // Rename 'foo' to 'foobar' at its declaration.
+    size_t offset = text.find("foo");
+    std::string edited = text;
+    edited.replace(offset, 3, "foobar");
+
+    size_t relexed = inc.update(edited, {offset, 3, 6});
+    CHECK(relexed < total);
+
+    // The incrementally updated boundaries must match a from-scratch lex.
+    IncrementalLexer fresh;
+    fresh.prime(edited);
+    CHECK(std::ranges::equal(inc.boundaries(), fresh.boundaries()));
+
+    // A deletion near the end of the buffer never finds a resync point and
+    // just re-lexes the tail.
+    size_t commentPos = edited.find("// note");
+    std::string edited2 = edited;
+    edited2.erase(commentPos, 7);
+
+    inc.update(edited2, {commentPos, 7, 0});
+    fresh.prime(edited2);
+    CHECK(std::ranges::equal(inc.boundaries(), fresh.boundaries()));
+}
+
+TEST_CASE("Raw bulk lexing") {
+    std::string_view text = "module m; int foo = 3 + 4; endmodule";
+
+    SmallVector<RawToken> tokens;
+    Lexer::lexRaw(text, tokens);
+    REQUIRE(tokens.size() == 11);
+
+    CHECK(tokens[0].kind == uint32_t(TokenKind::ModuleKeyword));
+    CHECK(tokens[4].kind == uint32_t(TokenKind::Identifier));
+    CHECK(tokens[6].kind == uint32_t(TokenKind::IntegerLiteral));
+
+    // Offsets and lengths point at the token text in the source.
+    for (auto& token : tokens)
+        CHECK(token.offset + token.length <= text.size());
+    CHECK(text.substr(tokens[4].offset, tokens[4].length) == "foo");
+
+    // Directives and macro usages come through as raw tokens with no
+    // preprocessing applied.
+    tokens.clear();
+    Lexer::lexRaw("`define FOO 1\n`FOO", tokens);
+    REQUIRE(tokens.size() >= 4);
+    CHECK(tokens[0].kind == uint32_t(TokenKind::Directive));
+
+    tokens.clear();
+    Lexer::lexRaw("", tokens);
+    CHECK(tokens.empty());
+}
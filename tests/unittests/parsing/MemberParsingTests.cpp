@@ -5,6 +5,8 @@
 
 #include "slang/parsing/Parser.h"
 #include "slang/parsing/Preprocessor.h"
+#include "slang/syntax/ParseSession.h"
+#include "slang/text/SourceManager.h"
 
 TEST_CASE("Simple module") {
     auto& text = "module foo(); endmodule";
@@ -1489,3 +1491,150 @@ endmodule
     REQUIRE(diagnostics.size() == 1);
     CHECK(diagnostics[0].code == diag::UnexpectedEndDelim);
 }
+
+TEST_CASE("Parser error recovery limit bails to member boundary") {
+    auto& text = R"(
+module m1;
+    + + > > ! ~ % % ^ ^ & &
+endmodule
+
+module m2;
+    logic l;
+endmodule
+)";
+    diagnostics.clear();
+
+    Bag options;
+    ParserOptions po;
+    po.errorRecoveryLimit = 4;
+    options.set(po);
+
+    Preprocessor preprocessor(getSourceManager(), alloc, diagnostics, options);
+    preprocessor.pushSource(text);
+
+    Parser parser(preprocessor, options);
+    auto& unit = parser.parseCompilationUnit();
+
+    // The garbage in m1 blows the recovery budget; the parser scans ahead
+    // to the endmodule and still parses m2 normally, with all of the
+    // skipped tokens preserved as trivia.
+    REQUIRE(unit.members.size() == 2);
+    CHECK(unit.members[1]->kind == SyntaxKind::ModuleDeclaration);
+    CHECK(!diagnostics.empty());
+    CHECK(unit.toString() == text);
+}
+
+TEST_CASE("Incremental reparse reuses prefix members") {
+    auto& oldText = R"(
+module m1;
+    logic l;
+endmodule
+
+module m2;
+    int i;
+endmodule
+
+module m3;
+endmodule
+)";
+    auto& newText = R"(
+module m1;
+    logic l;
+endmodule
+
+module m2;
+    int i, j;
+endmodule
+
+module m3;
+endmodule
+)";
+
+    SourceManager sm;
+    auto oldTree = SyntaxTree::fromBuffer(sm.assignText(oldText), sm);
+    REQUIRE(oldTree);
+    CHECK(oldTree->diagnostics().empty());
+
+    std::string_view ov = oldText;
+    std::string_view nv = newText;
+    size_t editOffset = 0;
+    while (ov[editOffset] == nv[editOffset])
+        editOffset++;
+
+    auto& oldUnit = oldTree->root().as<CompilationUnitSyntax>();
+    REQUIRE(oldUnit.members.size() == 3);
+    auto oldM1 = oldUnit.members[0];
+    auto oldM3 = oldUnit.members[2];
+
+    auto newTree = SyntaxTree::reparse(oldTree, sm.assignText(newText), editOffset);
+    REQUIRE(newTree);
+    CHECK(newTree->diagnostics().empty());
+    CHECK(newTree->root().toString() == newText);
+
+    // m1 ends before the edit and is shared by reference with the old tree;
+    // m2 and m3 are at or after it and were reparsed with fresh locations.
+    auto& newUnit = newTree->root().as<CompilationUnitSyntax>();
+    REQUIRE(newUnit.members.size() == 3);
+    CHECK(newUnit.members[0] == oldM1);
+    CHECK(newUnit.members[2] != oldM3);
+}
+
+TEST_CASE("Incremental reparse falls back to a full parse") {
+    auto& oldText = R"(
+`define W 4
+module m1;
+    logic [`W-1:0] l;
+endmodule
+
+module m2;
+endmodule
+)";
+    auto& newText = R"(
+`define W 4
+module m1;
+    logic [`W-1:0] l;
+endmodule
+
+module m2;
+    int i;
+endmodule
+)";
+
+    SourceManager sm;
+    auto oldTree = SyntaxTree::fromBuffer(sm.assignText(oldText), sm);
+    REQUIRE(oldTree);
+
+    std::string_view ov = oldText;
+    std::string_view nv = newText;
+    size_t editOffset = 0;
+    while (ov[editOffset] == nv[editOffset])
+        editOffset++;
+
+    // The macro definition ahead of the edit disqualifies mid-file restart;
+    // the result is a correct full parse with nothing shared.
+    auto oldM1 = oldTree->root().as<CompilationUnitSyntax>().members[0];
+    auto newTree = SyntaxTree::reparse(oldTree, sm.assignText(newText), editOffset);
+    REQUIRE(newTree);
+    CHECK(newTree->diagnostics().empty());
+    CHECK(newTree->root().toString() == newText);
+    CHECK(newTree->root().as<CompilationUnitSyntax>().members[0] != oldM1);
+}
+
+TEST_CASE("Parse session reuses pooled allocator memory") {
+    ParseSession session;
+
+    auto text = "module m;\n    int i = 4;\nendmodule"sv;
+    auto tree = session.parse(text);
+    REQUIRE(tree);
+    CHECK(tree->diagnostics().empty());
+    CHECK(tree->root().kind == SyntaxKind::ModuleDeclaration);
+    CHECK(tree->root().toString() == text);
+
+    // Recycling hands the tree's arena back for the next parse.
+    session.recycle(std::move(tree));
+
+    auto tree2 = session.parse("int j = 1 + 2;"sv);
+    REQUIRE(tree2);
+    CHECK(tree2->diagnostics().empty());
+    CHECK(tree2->root().kind == SyntaxKind::DataDeclaration);
+}
@@ -3,6 +3,7 @@
 
 #include "Test.h"
 
+#include "slang/parsing/ExpandedSourceMap.h"
 #include "slang/parsing/Preprocessor.h"
 #include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxPrinter.h"
@@ -97,6 +98,43 @@ TEST_CASE("Double include, with pragma once") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("Double include, with include guard") {
+    auto& text = R"(
+`include "guarded.svh"
+`include "guarded.svh"
+)";
+    auto& expected = R"(
+// A header wrapped in a classic include guard.
+"guarded string"
+)";
+
+    std::string result = preprocess(text);
+    result.erase(std::remove(result.begin(), result.end(), '\r'), result.end());
+
+    CHECK(result == expected);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
+TEST_CASE("Include guard not skipped when guard macro undefined") {
+    auto& text = R"(
+`include "guarded.svh"
+`undef GUARDED_SVH
+`include "guarded.svh"
+)";
+    auto& expected = R"(
+// A header wrapped in a classic include guard.
+"guarded string"
+// A header wrapped in a classic include guard.
+"guarded string"
+)";
+
+    std::string result = preprocess(text);
+    result.erase(std::remove(result.begin(), result.end(), '\r'), result.end());
+
+    CHECK(result == expected);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("Include directive errors") {
     auto& text = R"(
 `include
@@ -372,6 +410,25 @@ TEST_CASE("Macro stringify whitespace") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("Macro stringify with compact whitespace trivia") {
+    auto& text = "`define FOO(x,y) `\" x ( y)\t  x   x`\"\n`FOO(bar,)";
+
+    LexerOptions lexerOptions;
+    lexerOptions.compactWhitespaceTrivia = true;
+    Bag options;
+    options.set(lexerOptions);
+
+    diagnostics.clear();
+    Preprocessor preprocessor(getSourceManager(), alloc, diagnostics, options);
+    preprocessor.pushSource(text);
+    Token token = preprocessor.next();
+
+    // Whitespace runs are canonicalized to single spaces in this mode.
+    REQUIRE(token.kind == TokenKind::StringLiteral);
+    CHECK(token.valueText() == " bar ( ) bar bar");
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("Macro stringify useless concatenation") {
     auto& text = "`define FOO(x) `\"``x`\" \n`FOO(a)";
     Token token = lexToken(text);
@@ -1382,6 +1439,46 @@ TEST_CASE("Preprocessor API") {
     CHECK(pp.getDefinedMacros().size() == 19);
 }
 
+TEST_CASE("Macro snapshot and restore") {
+    Preprocessor pp(getSourceManager(), alloc, diagnostics);
+    pp.predefine("FOO 1");
+    pp.predefine("BAR(x) (x) + 1");
+
+    auto snapshot = pp.snapshotMacros();
+
+    // Restoring into a fresh preprocessor brings over the whole environment
+    // without re-lexing the definitions.
+    Preprocessor pp2(getSourceManager(), alloc, diagnostics);
+    CHECK(!pp2.isDefined("FOO"));
+
+    pp2.restoreMacros(snapshot);
+    CHECK(pp2.isDefined("FOO"));
+    CHECK(pp2.isDefined("BAR"));
+    CHECK(pp2.isDefined("__LINE__"));
+
+    pp2.pushSource("`BAR(`FOO)");
+    std::string result;
+    while (true) {
+        Token token = pp2.next();
+        result += token.toString();
+        if (token.kind == TokenKind::EndOfFile)
+            break;
+    }
+    CHECK(result == "(1) + 1");
+
+    // Changes made after restoring don't leak back into the snapshot.
+    pp2.undefine("FOO");
+    pp2.restoreMacros(snapshot);
+    CHECK(pp2.isDefined("FOO"));
+
+    // An empty snapshot takes us back to just the built-in macros.
+    pp2.restoreMacros(MacroSnapshot());
+    CHECK(!pp2.isDefined("FOO"));
+    CHECK(pp2.isDefined("__LINE__"));
+
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("Command-line defines priority over `define") {
     PreprocessorOptions ppOptions;
     ppOptions.predefines.emplace_back("A=2");
@@ -2682,3 +2779,88 @@ endmodule
     REQUIRE(diagnostics.size() == 1);
     CHECK(diagnostics[0].code == diag::ProtectedEnvelope);
 }
+
+TEST_CASE("Macro expansion cache") {
+    PreprocessorOptions ppOptions;
+    ppOptions.enableMacroCache = true;
+
+    Bag options;
+    options.set(ppOptions);
+
+    auto& text = R"(
+`define BAR(x) (x << 2)
+`define FOO(a, b) a + b * `BAR(a)
+int p = `FOO(1, 2);
+int q = `FOO(1, 2);
+int r = `FOO(3, 4);
+int l1 = `__LINE__;
+int l2 = `__LINE__;
+`define BAR(x) (x >> 1)
+int u = `FOO(1, 2);
+)";
+
+    // Repeated identical usages replay from the cache; intrinsics stay
+    // per-use and redefining a nested macro invalidates dependent entries.
+    std::string result = preprocess(text, options);
+    CHECK(result == R"(
+int p = 1 + 2 * (1 << 2);
+int q = 1 + 2 * (1 << 2);
+int r = 3 + 4 * (3 << 2);
+int l1 = 7;
+int l2 = 8;
+int u = 1 + 2 * (1 >> 1);
+)");
+
+    REQUIRE(diagnostics.size() == 1);
+    CHECK(diagnostics[0].code == diag::RedefiningMacro);
+}
+
+TEST_CASE("Expanded source map") {
+    auto& text = "`define FOO 1 + 2\n"
+                 "`include \"include.svh\"\n"
+                 "int i = `FOO;\n"
+                 "`ifdef NOPE\n"
+                 "int bad;\n"
+                 "`endif\n"
+                 "int j; // comment\n";
+
+    diagnostics.clear();
+    auto& sm = getSourceManager();
+    Preprocessor preprocessor(sm, alloc, diagnostics);
+    preprocessor.pushSource(text);
+
+    auto segments = buildExpandedSourceMap(preprocessor);
+    CHECK_DIAGNOSTICS_EMPTY;
+    REQUIRE(!segments.empty());
+
+    // Concatenating the segments reproduces the expanded view: directives
+    // and disabled regions are gone, macro expansions and included text are
+    // present.
+    std::string expanded;
+    bool sawMacro = false;
+    bool sawOtherBuffer = false;
+    for (auto& seg : segments) {
+        CHECK(seg.expandedOffset == expanded.size());
+        expanded += seg.text;
+
+        sawMacro |= seg.fromMacro;
+        sawOtherBuffer |= seg.buffer.valid() && seg.buffer != segments[0].buffer;
+
+        // Every segment with known provenance views its original buffer
+        // text in place.
+        if (seg.buffer.valid()) {
+            auto original = sm.getSourceText(seg.buffer);
+            REQUIRE(seg.offset + seg.text.size() <= original.size());
+            CHECK(original.substr(seg.offset, seg.text.size()) == seg.text);
+        }
+    }
+
+    CHECK(sawMacro);
+    CHECK(sawOtherBuffer);
+    CHECK(expanded.find("1 + 2") != std::string::npos);
+    CHECK(expanded.find("test string") != std::string::npos);
+    CHECK(expanded.find("// comment") != std::string::npos);
+    CHECK(expanded.find("`define") == std::string::npos);
+    CHECK(expanded.find("`include") == std::string::npos);
+    CHECK(expanded.find("bad") == std::string::npos);
+}
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "Test.h"
+
+#include "slang/syntax/SyntaxTreeDependencies.h"
+
+static bool contains(const std::vector<std::shared_ptr<SyntaxTree>>& list,
+                     const std::shared_ptr<SyntaxTree>& tree) {
+    return std::ranges::find(list, tree) != list.end();
+}
+
+TEST_CASE("Dependency graph instantiation chains") {
+    auto leaf = SyntaxTree::fromText("module leaf; endmodule");
+    auto mid = SyntaxTree::fromText("module mid; leaf l(); endmodule");
+    auto top = SyntaxTree::fromText("module top; mid m(); endmodule");
+    auto other = SyntaxTree::fromText("module other; endmodule");
+
+    SyntaxTreeDependencyGraph graph;
+    graph.add(leaf);
+    graph.add(mid);
+    graph.add(top);
+    graph.add(other);
+    CHECK(graph.getTrees().size() == 4);
+
+    auto deps = graph.getDependents(*leaf);
+    REQUIRE(deps.size() == 2);
+    CHECK(contains(deps, mid));
+    CHECK(contains(deps, top));
+
+    CHECK(graph.getDependents(*top).empty());
+    CHECK(graph.getDependents(*other).empty());
+
+    auto newLeaf = SyntaxTree::fromText("module leaf; logic l; endmodule");
+    auto affected = graph.replace(*leaf, newLeaf);
+    REQUIRE(affected.size() == 3);
+    CHECK(affected[0] == newLeaf);
+    CHECK(contains(affected, mid));
+    CHECK(contains(affected, top));
+    CHECK(graph.getTrees().size() == 4);
+
+    // A rename dirties both the old and the new declared names.
+    auto renamed = SyntaxTree::fromText("module renamed; endmodule");
+    affected = graph.replace(*newLeaf, renamed);
+    REQUIRE(affected.size() == 3);
+    CHECK(affected[0] == renamed);
+    CHECK(contains(affected, mid));
+    CHECK(contains(affected, top));
+}
+
+TEST_CASE("Dependency graph packages and interface ports") {
+    auto pkg = SyntaxTree::fromText("package p; typedef int t; endpackage");
+    auto importer = SyntaxTree::fromText("module m1; import p::*; endmodule");
+    auto scoped = SyntaxTree::fromText("module m2; p::t x; endmodule");
+    auto iface = SyntaxTree::fromText("interface bus; modport master(); endinterface");
+    auto port = SyntaxTree::fromText("module m3(bus.master b); endmodule");
+
+    SyntaxTreeDependencyGraph graph;
+    graph.add(pkg);
+    graph.add(importer);
+    graph.add(scoped);
+    graph.add(iface);
+    graph.add(port);
+
+    auto deps = graph.getDependents(*pkg);
+    REQUIRE(deps.size() == 2);
+    CHECK(contains(deps, importer));
+    CHECK(contains(deps, scoped));
+
+    deps = graph.getDependents(*iface);
+    REQUIRE(deps.size() == 1);
+    CHECK(contains(deps, port));
+}
+
+TEST_CASE("Dependency graph is conservative for bind directives") {
+    auto mod = SyntaxTree::fromText("module m; endmodule");
+    auto other = SyntaxTree::fromText("module unrelated; endmodule");
+    auto binder = SyntaxTree::fromText("module b; endmodule\nmodule t; bind m b b1(); endmodule");
+
+    SyntaxTreeDependencyGraph graph;
+    graph.add(mod);
+    graph.add(other);
+    graph.add(binder);
+
+    // The bind directive could target anything, so every tree is affected
+    // whenever the binding tree changes, and the binding tree is affected
+    // whenever anything else changes.
+    auto deps = graph.getDependents(*binder);
+    CHECK(deps.size() == 2);
+
+    deps = graph.getDependents(*other);
+    REQUIRE(deps.size() == 1);
+    CHECK(contains(deps, binder));
+}
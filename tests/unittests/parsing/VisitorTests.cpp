@@ -4,9 +4,11 @@
 #include "Test.h"
 #include <fmt/core.h>
 
+#include "slang/ast/ASTQuery.h"
 #include "slang/ast/ASTVisitor.h"
 #include "slang/parsing/ParserMetadata.h"
 #include "slang/syntax/SyntaxPrinter.h"
+#include "slang/syntax/SyntaxTokenStore.h"
 #include "slang/syntax/SyntaxVisitor.h"
 
 class SemanticModel {
@@ -202,6 +204,144 @@ endmodule
 )");
 }
 
+TEST_CASE("Compacting a rewritten tree") {
+    auto tree = SyntaxTree::fromText(R"(
+module M;
+    typedef enum int { FOO = 1, BAR = 2, BAZ = 3 } test_t;
+
+    function void foo(int i, output r);
+    endfunction
+endmodule
+)");
+
+    // Rewrite and then compact; the compacted tree should print identically
+    // while no longer referencing the original tree's memory.
+    tree = TestRewriter(tree).transform(tree);
+    auto compacted = tree->compact();
+
+    CHECK(SyntaxPrinter::printFile(*compacted) == SyntaxPrinter::printFile(*tree));
+    CHECK(compacted->getDefinedMacros().size() == tree->getDefinedMacros().size());
+
+    tree.reset();
+    CHECK(SyntaxPrinter::printFile(*compacted) == R"(
+module M;
+    typedef enum int { FOO = 1, BAR = 2, BAZ = 3 } test_t;
+    localparam int test_t__count = 3;
+
+    function void foo(argA,int i, output r,argZ);
+    endfunction
+endmodule
+)");
+}
+
+TEST_CASE("Rewriting shares unchanged subtrees") {
+    auto tree = SyntaxTree::fromText(R"(
+module m1;
+    typedef enum int { FOO = 1, BAR = 2 } test_t;
+endmodule
+
+module m2;
+    int i;
+endmodule
+)");
+
+    auto& oldUnit = tree->root().as<CompilationUnitSyntax>();
+    auto result = TestRewriter(tree).transform(tree);
+    REQUIRE(result != tree);
+
+    // Only the edited module is recreated; the untouched one is shared
+    // by pointer with the original tree.
+    auto& newUnit = result->root().as<CompilationUnitSyntax>();
+    REQUIRE(newUnit.members.size() == 2);
+    CHECK(newUnit.members[0] != oldUnit.members[0]);
+    CHECK(newUnit.members[1] == oldUnit.members[1]);
+
+    CHECK(SyntaxPrinter::printFile(*result) == R"(
+module m1;
+    typedef enum int { FOO = 1, BAR = 2 } test_t;
+    localparam int test_t__count = 2;
+endmodule
+
+module m2;
+    int i;
+endmodule
+)");
+}
+
+TEST_CASE("Chained rewrites can edit shared subtrees") {
+    auto tree = SyntaxTree::fromText(R"(
+module m1;
+    typedef enum int { FOO = 1, BAR = 2 } test_t;
+endmodule
+
+module m2;
+    int i;
+endmodule
+)");
+
+    auto first = TestRewriter(tree).transform(tree);
+    REQUIRE(first != tree);
+
+    // The first rewrite shared m2 by pointer, so its parent pointers still
+    // lead into the original tree; a second rewrite targeting something
+    // inside it must still apply.
+    class IntRemover : public SyntaxRewriter<IntRemover> {
+    public:
+        void handle(const DataDeclarationSyntax& decl) { remove(decl); }
+    };
+
+    auto second = IntRemover().transform(first);
+    REQUIRE(second != first);
+
+    CHECK(SyntaxPrinter::printFile(*second) == R"(
+module m1;
+    typedef enum int { FOO = 1, BAR = 2 } test_t;
+    localparam int test_t__count = 2;
+endmodule
+
+module m2;
+endmodule
+)");
+}
+
+TEST_CASE("Token store round trips a tree") {
+    auto text = R"(
+`define W 4
+module M;
+    // a comment
+    logic [3:0] l;
+endmodule
+)";
+    auto tree = SyntaxTree::fromText(text);
+
+    auto& store = tree->getTokenStore();
+    CHECK(&store == &tree->getTokenStore());
+    CHECK(store.size() > 0);
+    CHECK(store.triviaOffsets.size() == store.size() + 1);
+    CHECK(store.kinds.size() == store.locations.size());
+    CHECK(store.kinds.size() == store.texts.size());
+
+    // Printing the flat store reproduces the original text,
+    // directive and comment included.
+    CHECK(SyntaxPrinter().print(store).str() == text);
+
+    // On a tree with macro expansions the store contains both the usage
+    // tokens and the expanded tokens, matching a printer with all
+    // content included.
+    auto tree2 = SyntaxTree::fromText(R"(
+`define W 4
+module M;
+    logic [`W-1:0] l;
+endmodule
+)");
+    auto& store2 = tree2->getTokenStore();
+    CHECK(SyntaxPrinter().print(store2).str() == SyntaxPrinter()
+                                                     .setIncludeDirectives(true)
+                                                     .setIncludeSkipped(true)
+                                                     .print(*tree2)
+                                                     .str());
+}
+
 TEST_CASE("Rewriting around macros") {
     auto tree = SyntaxTree::fromText(R"(
 `define ENUM_MACRO(asdf) \
@@ -527,6 +667,108 @@ endmodule
     CHECK(count == 3);
 }
 
+TEST_CASE("Kind-filtered AST visiting") {
+    auto tree = SyntaxTree::fromText(R"(
+module leaf;
+    int x;
+    real y;
+endmodule
+
+module mid;
+    leaf l1();
+    leaf l2();
+    logic [3:0] v;
+endmodule
+
+module top;
+    mid m();
+    if (1) begin : g
+        int gv;
+    end
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+    HierarchyKindIndex index(root);
+
+    // A filtered walk should find the same variables as a full traversal.
+    int fullCount = 0;
+    root.visit(makeVisitor([&](auto& v, const VariableSymbol& var) {
+        fullCount++;
+        v.visitDefault(var);
+    }));
+
+    int filteredCount = 0;
+    index.visitMatching<SymbolKind::Variable>(root, [&](const VariableSymbol&) {
+        filteredCount++;
+    });
+    CHECK(filteredCount == 6);
+    CHECK(filteredCount == fullCount);
+
+    // A kind that doesn't appear anywhere prunes the whole walk.
+    int netCount = 0;
+    index.visitMatching<SymbolKind::Net>(root, [&](const NetSymbol&) { netCount++; });
+    CHECK(netCount == 0);
+
+    // Multiple kinds can be matched in one pass, with callbacks that only
+    // care about some of them.
+    int mixed = 0;
+    index.visitMatching<SymbolKind::Variable, SymbolKind::GenerateBlock>(
+        root, [&](const GenerateBlockSymbol&) { mixed++; });
+    CHECK(mixed == 1);
+}
+
+TEST_CASE("Batched AST queries") {
+    auto tree = SyntaxTree::fromText(R"(
+module top;
+    int count_a;
+    int count_b;
+    real other;
+    logic [7:0] data_bus;
+
+    if (1) begin : g
+        int count_g;
+    end
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+
+    // Several patterns share one walk of the design.
+    ASTQueryEngine engine;
+
+    std::vector<std::string> counts;
+    QueryPattern countPattern;
+    countPattern.kinds.push_back(SymbolKind::Variable);
+    countPattern.namePattern = "count_*";
+    engine.addQuery(countPattern,
+                    [&](const Symbol& sym) { counts.push_back(std::string(sym.name)); });
+
+    int reals = 0;
+    QueryPattern realPattern;
+    realPattern.typePredicate = [](const Type& type) { return type.isFloating(); };
+    engine.addQuery(realPattern, [&](const Symbol&) { reals++; });
+
+    engine.run(root);
+    CHECK(counts == std::vector<std::string>{"count_a", "count_b", "count_g"});
+    CHECK(reals == 1);
+
+    // The findAll helper collects matches of a single pattern.
+    QueryPattern busPattern;
+    busPattern.namePattern = "?ata_bus";
+    auto found = ASTQueryEngine::findAll(root, busPattern);
+    REQUIRE(found.size() == 1);
+    CHECK(found[0]->name == "data_bus");
+}
+
 struct Visitor : public ASTVisitor<Visitor, true, true> {
     int count = 0;
     template<typename T>
@@ -721,6 +963,8 @@ class C; endclass
 
     auto& meta = tree->getMetadata();
     CHECK(meta.nodeMap.size() == 3);
+    CHECK(meta.definitionCount == 3);
+    CHECK(meta.packageCount == 0);
 
     for (auto& [key, node] : meta.nodeMap) {
         if (key->as<ModuleDeclarationSyntax>().header->name.valueText() == "FooBar") {
@@ -749,3 +993,79 @@ TEST_CASE("Visit all file") {
 
     CHECK(count == 1456);
 }
+
+TEST_CASE("Verbatim source fast path for printing") {
+    auto& text = R"(
+`define WIDTH 4
+module m;
+    logic [`WIDTH-1:0] l;
+    typedef enum int { FOO = 1, BAR = 2 } test_t;
+endmodule
+)";
+
+    // A freshly parsed tree advertises that it renders back to its buffer
+    // text verbatim, and whole-file printing round-trips exactly.
+    auto tree = SyntaxTree::fromText(text);
+    CHECK(tree->isVerbatimSource());
+    CHECK(SyntaxPrinter::printFile(*tree) == text);
+
+    // Rewritten trees lose the property and print their modified form.
+    auto result = TestRewriter(tree).transform(tree);
+    CHECK(!result->isVerbatimSource());
+    CHECK(SyntaxPrinter::printFile(*result) != text);
+}
+
+namespace {
+
+struct PerClassChildVisitor {
+    template<typename T>
+    ConstTokenOrSyntax visit(const T& node, size_t index) {
+        return node.getChild(index);
+    }
+};
+
+void checkChildAccess(const SyntaxNode& node) {
+    PerClassChildVisitor visitor;
+    size_t index = 0;
+    for (auto child : node.children()) {
+        // The table-driven access on the base class must agree with the
+        // generated per-class accessor for every child of every node.
+        auto expected = node.visit(visitor, index);
+        CHECK(child == expected);
+
+        if (child.isNode() && child.node())
+            checkChildAccess(*child.node());
+        index++;
+    }
+    CHECK(index == node.getChildCount());
+}
+
+} // namespace
+
+TEST_CASE("Child table access matches per-class accessors") {
+    auto text = R"(
+module m #(parameter int P = 4) (input logic clk, output logic [P-1:0] out);
+    logic [P-1:0] counter;
+    always_ff @(posedge clk) begin
+        if (counter == '1)
+            counter <= '0;
+        else
+            counter <= counter + 1;
+    end
+
+    assign out = counter;
+
+    generate
+        for (genvar i = 0; i < P; i++) begin : g
+            wire w = counter[i];
+        end
+    endgenerate
+endmodule
+)";
+    auto tree = SyntaxTree::fromText(text);
+    REQUIRE(tree->diagnostics().empty());
+    checkChildAccess(tree->root());
+
+    // The flat child range must also print back to the original text.
+    CHECK(SyntaxPrinter().print(tree->root()).str() == text);
+}
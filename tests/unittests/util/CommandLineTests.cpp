@@ -208,6 +208,16 @@ TEST_CASE("Test CommandLine -- splitting") {
     CHECK(stuff == std::vector{" -a"s, "asdf"s, "bar baz bif \\"s, "f foo \" biz \\"s, "1"s});
 }
 
+TEST_CASE("Test CommandLine -- unterminated quote") {
+    std::vector<std::string> stuff;
+
+    CommandLine cmdLine;
+    cmdLine.add("-a,--longa", stuff, "SDF", "val");
+
+    CHECK(cmdLine.parse("prog -a 'foo bar -a \"baz bif"sv));
+    CHECK(stuff == std::vector{"foo bar -a \"baz bif"s});
+}
+
 TEST_CASE("Test CommandLine -- comments") {
     std::vector<std::string> stuff;
 
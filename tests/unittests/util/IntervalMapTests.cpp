@@ -227,3 +227,44 @@ TEST_CASE("IntervalMap -- pseudorandom union testing") {
 
     CHECK(std::ranges::distance(map.begin(), map.end()) == 34);
 }
+
+TEST_CASE("IntervalMap -- frozen snapshot queries") {
+    IntervalMap<int32_t, int32_t> map;
+    BumpAllocator ba;
+    IntervalMap<int32_t, int32_t>::allocator_type alloc(ba);
+
+    // Include nested and overlapping intervals so the scan pruning is
+    // actually exercised.
+    std::mt19937 mt;
+    for (int32_t i = 0; i < 500; i++) {
+        int32_t left = getUniformIntDist(mt, 1, 1000);
+        int32_t right = left + getUniformIntDist(mt, 0, 100);
+        map.insert(left, right, i, alloc);
+    }
+
+    FrozenIntervalMap<int32_t, int32_t> frozen(map);
+    CHECK(!frozen.empty());
+    CHECK(frozen.size() == 500);
+
+    // Every overlap query must return exactly the same set of entries as
+    // the B+ tree form, in the same order.
+    for (int32_t q = 0; q < 200; q++) {
+        int32_t left = getUniformIntDist(mt, 1, 1100);
+        int32_t right = left + getUniformIntDist(mt, 0, 50);
+
+        auto it = map.find(left, right);
+        auto fit = frozen.find(left, right);
+        while (it != map.end()) {
+            REQUIRE(fit.valid());
+            CHECK(it.bounds() == fit.bounds());
+            CHECK(*it == *fit);
+            ++it;
+            ++fit;
+        }
+        CHECK(!fit.valid());
+    }
+
+    FrozenIntervalMap<int32_t, int32_t> empty;
+    CHECK(empty.empty());
+    CHECK(!empty.find(1, 10).valid());
+}
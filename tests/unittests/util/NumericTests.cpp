@@ -295,6 +295,20 @@ TEST_CASE("Comparison") {
 
     CHECK_THAT(SVInt(logic_t::x) > SVInt(logic_t::z), exactlyEquals(logic_t::x));
 
+    // Four-state equality: a 0/1 mismatch in known bits is definite even when
+    // unknowns are present elsewhere, across single and multiple words.
+    CHECK_THAT("8'b1100xz01"_si == "8'b1100xz01"_si, exactlyEquals(logic_t::x));
+    CHECK_THAT("8'b1100xz01"_si == "8'b0100xz01"_si, exactlyEquals(logic_t(false)));
+    CHECK_THAT("100'hx_12345678_9abcdef0"_si == "100'hx_12345678_9abcdef0"_si,
+               exactlyEquals(logic_t::x));
+    CHECK_THAT("100'hx_12345678_9abcdef0"_si == "100'hx_12345678_9abcdef1"_si,
+               exactlyEquals(logic_t(false)));
+    CHECK_THAT("100'hx3_12345678_9abcdef0"_si == "100'hx4_12345678_9abcdef0"_si,
+               exactlyEquals(logic_t(false)));
+    CHECK_THAT("100'hx_12345678_9abcdef0"_si == "100'h8_12345678_9abcdef0"_si,
+               exactlyEquals(logic_t::x));
+    CHECK_THAT("100'b1z"_si == "90'b0"_si, exactlyEquals(logic_t(false)));
+
     CHECK(SVInt::conditional(SVInt(1), SVInt(10, 2, false), SVInt(8, 3, false)) == SVInt(2));
     CHECK(SVInt::conditional(SVInt(0), SVInt(7, 2, false), SVInt(12, 3, false)) == SVInt(3));
     CHECK_THAT(SVInt::conditional(SVInt(logic_t::x), "4'bx1z0"_si, "4'bz1x0"_si),
@@ -5,6 +5,8 @@
 #include <catch2/matchers/catch_matchers_string.hpp>
 #include <sstream>
 
+#include "slang/text/SegmentedBuffer.h"
+#include "slang/util/BumpAllocator.h"
 #include "slang/util/Random.h"
 #include "slang/util/ThreadPool.h"
 #include "slang/util/TimeTrace.h"
@@ -32,6 +34,73 @@ TEST_CASE("TypeName test") {
     CHECK_THAT(std::string(name), ContainsSubstring("slang::ast::AssertionKind"));
 }
 
+TEST_CASE("BumpAllocator snapshot and rollback") {
+    BumpAllocator alloc;
+    auto baseline = alloc.liveBytes();
+    CHECK(baseline > 0);
+
+    auto snap = alloc.snapshot();
+    auto firstPtr = alloc.allocate(64, 8);
+
+    // Allocate enough to force several new segments, including one
+    // oversized allocation that gets its own segment.
+    for (int i = 0; i < 200; i++)
+        alloc.allocate(128, 8);
+    alloc.allocate(16384, 8);
+
+    CHECK(alloc.liveBytes() > baseline);
+    auto peak = alloc.peakBytes();
+    CHECK(peak >= alloc.liveBytes());
+
+    alloc.rollbackTo(snap);
+    CHECK(alloc.liveBytes() == baseline);
+    CHECK(alloc.peakBytes() == peak);
+
+    // The arena should hand out the same memory again after the rewind.
+    CHECK(alloc.allocate(64, 8) == firstPtr);
+}
+
+TEST_CASE("BumpAllocator segment pool") {
+    BumpAllocator::trimPool();
+    auto baseline = BumpAllocator::getPoolStats();
+    CHECK(baseline.segmentsHeld == 0);
+
+    // Destroying an allocator that grew several standard segments
+    // should leave them in the pool for the next allocator to reuse.
+    {
+        BumpAllocator alloc;
+        for (int i = 0; i < 500; i++)
+            alloc.allocate(128, 8);
+    }
+
+    auto stats = BumpAllocator::getPoolStats();
+    CHECK(stats.segmentsHeld > 0);
+    CHECK(stats.bytesHeld == stats.segmentsHeld * 4096);
+
+    {
+        BumpAllocator alloc;
+        for (int i = 0; i < 500; i++)
+            alloc.allocate(128, 8);
+
+        auto reused = BumpAllocator::getPoolStats();
+        CHECK(reused.hits > baseline.hits);
+    }
+
+    // Trimming returns everything to the system.
+    BumpAllocator::trimPool();
+    CHECK(BumpAllocator::getPoolStats().segmentsHeld == 0);
+
+    // Capacity zero disables pooling; restore the default afterward.
+    BumpAllocator::setPoolCapacity(0);
+    {
+        BumpAllocator alloc;
+        for (int i = 0; i < 500; i++)
+            alloc.allocate(128, 8);
+    }
+    CHECK(BumpAllocator::getPoolStats().segmentsHeld == 0);
+    BumpAllocator::setPoolCapacity(64 * 1024 * 1024);
+}
+
 TEST_CASE("createRandomGenerator construction") {
     // Basic construction test, not much else we can do with it.
     auto rng = createRandomGenerator<std::mt19937>();
@@ -64,3 +133,52 @@ TEST_CASE("TimeTrace tests") {
     std::ostringstream sstr;
     TimeTrace::write(sstr);
 }
+
+TEST_CASE("SegmentedBuffer") {
+    SegmentedBuffer buffer;
+    CHECK(buffer.empty());
+
+    // Append enough data to force several segments.
+    std::string expected;
+    for (int i = 0; i < 4000; i++) {
+        buffer.format("chunk {} ", i);
+        expected += fmt::format("chunk {} ", i);
+    }
+    buffer.push_back('!');
+    expected += '!';
+
+    CHECK(buffer.size() == expected.size());
+    CHECK(buffer.back() == '!');
+    CHECK(buffer.str() == expected);
+
+    // Scanning backward visits characters in reverse order.
+    std::string tail;
+    size_t visited = buffer.scanBack([&](char c) {
+        if (tail.size() == 8)
+            return false;
+        tail += c;
+        return true;
+    });
+    CHECK(visited == 8);
+    CHECK(tail == "! 9993 k");
+
+    // Shrinking across a segment boundary.
+    buffer.resize(10);
+    expected.resize(10);
+    CHECK(buffer.str() == expected);
+
+    // Extracting a prefix writes it out and removes it.
+    buffer.append("more text after the resize");
+    expected += "more text after the resize";
+
+    std::ostringstream sstr;
+    buffer.extractTo(sstr, 15);
+    CHECK(sstr.str() == expected.substr(0, 15));
+    CHECK(buffer.str() == expected.substr(15));
+
+    buffer.writeTo(sstr);
+    CHECK(sstr.str() == expected);
+
+    buffer.clear();
+    CHECK(buffer.empty());
+}
@@ -5,6 +5,8 @@
 // SPDX-FileCopyrightText: Michael Popoloski
 // SPDX-License-Identifier: MIT
 //------------------------------------------------------------------------------
+#include <algorithm>
+#include <filesystem>
 #include <fmt/color.h>
 #include <fstream>
 #include <iostream>
@@ -14,9 +16,13 @@
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/diagnostics/TextDiagnosticClient.h"
 #include "slang/driver/Driver.h"
+#include "slang/syntax/AllSyntax.h"
 #include "slang/syntax/SyntaxTree.h"
+#include "slang/syntax/SyntaxTreeDependencies.h"
 #include "slang/text/Json.h"
 #include "slang/util/String.h"
+#include "slang/util/ThreadPool.h"
+#include "slang/util/ActivityProfiler.h"
 #include "slang/util/TimeTrace.h"
 #include "slang/util/VersionInfo.h"
 
@@ -29,12 +35,29 @@ void printJson(Compilation& compilation, const std::string& fileName,
     JsonWriter writer;
     writer.setPrettyPrint(true);
 
+    // Stream the output in chunks as the design is visited rather than
+    // buffering the whole serialized text, which for big elaborated designs
+    // can be many times larger than the AST itself.
+    std::ofstream outputFile;
+    if (fileName == "-") {
+        writer.streamTo(std::cout);
+    }
+    else {
+        outputFile.open(fileName);
+        outputFile.exceptions(std::ios::failbit | std::ios::badbit);
+        writer.streamTo(outputFile);
+    }
+
     ASTSerializer serializer(compilation, writer);
     serializer.setIncludeSourceInfo(includeSourceInfo);
     if (scopes.empty()) {
+        // The design has been fully elaborated by this point (diagnostics
+        // were gathered before we got here) so the root's members can be
+        // serialized in parallel.
+        ThreadPool threadPool;
         serializer.startObject();
         serializer.writeProperty("design");
-        serializer.serialize(compilation.getRoot());
+        serializer.serializeParallel(compilation.getRoot(), threadPool);
         serializer.writeProperty("definitions");
         serializer.startArray();
         for (auto def : compilation.getDefinitions())
@@ -51,7 +74,185 @@ void printJson(Compilation& compilation, const std::string& fileName,
     }
 
     writer.writeNewLine();
-    OS::writeFile(fileName, writer.view());
+    writer.finishStream();
+}
+
+// Writes a searchable index of all top-level declarations in the parsed
+// trees, one tab-separated "name kind file offset" line per declaration,
+// sorted by name. Entries in an existing index that point at files not part
+// of this run are preserved, so the index can be refreshed incrementally by
+// reindexing only the files that changed.
+bool writeModuleIndex(Driver& driver, const std::string& fileName) {
+    using namespace slang::syntax;
+
+    auto& sm = driver.sourceManager;
+    flat_hash_set<std::string_view> coveredFiles;
+    std::vector<std::string> lines;
+
+    auto addEntry = [&](std::string_view kind, parsing::Token name) {
+        if (name.isMissing() || name.valueText().empty())
+            return;
+
+        auto loc = sm.getFullyOriginalLoc(name.location());
+        lines.push_back(fmt::format("{}\t{}\t{}\t{}", name.valueText(), kind,
+                                    sm.getRawFileName(loc.buffer()), loc.offset()));
+    };
+
+    for (auto& tree : driver.syntaxTrees) {
+        for (auto buffer : tree->getConsumedBuffers())
+            coveredFiles.insert(sm.getRawFileName(buffer));
+
+        auto& root = tree->root();
+        if (root.kind != SyntaxKind::CompilationUnit)
+            continue;
+
+        for (auto member : root.as<CompilationUnitSyntax>().members) {
+            switch (member->kind) {
+                case SyntaxKind::ModuleDeclaration:
+                    addEntry("module", member->as<ModuleDeclarationSyntax>().header->name);
+                    break;
+                case SyntaxKind::InterfaceDeclaration:
+                    addEntry("interface", member->as<ModuleDeclarationSyntax>().header->name);
+                    break;
+                case SyntaxKind::ProgramDeclaration:
+                    addEntry("program", member->as<ModuleDeclarationSyntax>().header->name);
+                    break;
+                case SyntaxKind::PackageDeclaration:
+                    addEntry("package", member->as<ModuleDeclarationSyntax>().header->name);
+                    break;
+                case SyntaxKind::ClassDeclaration:
+                    addEntry("class", member->as<ClassDeclarationSyntax>().name);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    // Carry over entries for files outside this run from the previous index.
+    if (std::ifstream in(fileName); in) {
+        std::string line;
+        while (std::getline(in, line)) {
+            auto first = line.find('\t');
+            auto second = line.find('\t', first + 1);
+            auto third = line.find('\t', second + 1);
+            if (third == std::string::npos)
+                continue;
+
+            auto file = std::string_view(line).substr(second + 1, third - second - 1);
+            if (!coveredFiles.contains(file))
+                lines.push_back(std::move(line));
+        }
+    }
+
+    std::ranges::sort(lines);
+    lines.erase(std::unique(lines.begin(), lines.end()), lines.end());
+
+    std::ofstream out(fileName);
+    for (auto& line : lines)
+        out << line << '\n';
+
+    if (!out) {
+        OS::printE(fmt::format("error: unable to write index to '{}'\n", fileName));
+        return false;
+    }
+    return true;
+}
+
+// Runs the driver as a long-lived server: after the initial compilation,
+// commands are read from stdin one per line and parsed syntax trees are kept
+// warm in memory between requests, so a recheck after an edit only has to
+// reparse the edited file instead of the whole design. Responses end with a
+// "@done <status>" marker line on stdout; diagnostics go to stderr as usual.
+int runServer(Driver& driver, bool quiet) {
+    using namespace slang::syntax;
+
+    bool ok = driver.parseAllSources();
+
+    SyntaxTreeDependencyGraph graph;
+    for (auto& tree : driver.syntaxTrees)
+        graph.add(tree);
+
+    auto pathOf = [&](const std::shared_ptr<SyntaxTree>& tree) {
+        auto buffer = tree->root().getFirstToken().location().buffer();
+        return driver.sourceManager.getFullPath(buffer);
+    };
+
+    auto compileAndReport = [&] {
+        driver.diagEngine.clearCounts();
+        driver.diagClient->clear();
+        auto compilation = driver.createCompilation();
+        return driver.reportCompilation(*compilation, /* quiet */ true);
+    };
+
+    ok &= compileAndReport();
+    OS::print(fmt::format("@done {}\n", ok ? 0 : 1));
+
+    std::string line;
+    while (std::getline(std::cin, line)) {
+        while (!line.empty() && (line.back() == '\r' || line.back() == ' '))
+            line.pop_back();
+
+        if (line.empty())
+            continue;
+
+        if (line == "quit" || line == "exit")
+            break;
+
+        if (line == "recompile") {
+            ok = compileAndReport();
+            OS::print(fmt::format("@done {}\n", ok ? 0 : 1));
+            continue;
+        }
+
+        if (line.starts_with("recheck ")) {
+            std::error_code ec;
+            auto path = std::filesystem::weakly_canonical(line.substr(8), ec);
+
+            std::shared_ptr<SyntaxTree> oldTree;
+            for (auto& tree : driver.syntaxTrees) {
+                if (!ec && std::filesystem::equivalent(pathOf(tree), path, ec)) {
+                    oldTree = tree;
+                    break;
+                }
+                ec.clear();
+            }
+
+            if (!oldTree) {
+                OS::printE(fmt::format("error: no loaded file matches '{}'\n", line.substr(8)));
+                OS::print("@done 1\n");
+                continue;
+            }
+
+            auto result = SyntaxTree::fromFile(path.string(), driver.sourceManager,
+                                               driver.createOptionBag());
+            if (!result) {
+                OS::printE(fmt::format("error: unable to reparse '{}': {}\n", path.string(),
+                                       result.error().second));
+                OS::print("@done 1\n");
+                continue;
+            }
+
+            auto newTree = *result;
+            auto affected = graph.replace(*oldTree, newTree);
+            std::ranges::replace(driver.syntaxTrees, oldTree, newTree);
+
+            // The design is re-elaborated but every unaffected tree is reused
+            // as-is; reparsing (including any large library files) is where
+            // interactive invocations spend most of their time.
+            if (!quiet)
+                OS::print(fmt::format("@affected {}\n", affected.size()));
+
+            ok = compileAndReport();
+            OS::print(fmt::format("@done {}\n", ok ? 0 : 1));
+            continue;
+        }
+
+        OS::printE(fmt::format("error: unknown command '{}'\n", line));
+        OS::print("@done 1\n");
+    }
+
+    return ok ? 0 : 5;
 }
 
 template<typename TArgs>
@@ -80,6 +281,15 @@ int driverMain(int argc, TArgs argv) {
             "--parse-only", onlyParse,
             "Stop after parsing input files, don't perform elaboration or type checking");
 
+        std::optional<std::string> indexFile;
+        driver.cmdLine.add("--index-only", indexFile,
+                           "Stop after parsing and write an index of all top-level "
+                           "module/interface/program/package/class declarations "
+                           "(name, kind, file, offset) to the given file; entries for "
+                           "files not part of this run are carried over from an "
+                           "existing index so it can be updated incrementally",
+                           "<file>", CommandLineFlags::FilePath);
+
         std::optional<bool> includeComments;
         std::optional<bool> includeDirectives;
         std::optional<bool> obfuscateIds;
@@ -106,12 +316,31 @@ int driverMain(int argc, TArgs argv) {
         driver.cmdLine.add("--ast-json-source-info", includeSourceInfo,
                            "When dumping AST to JSON, include source line and file information");
 
+        std::optional<std::string> precompile;
+        driver.cmdLine.add("--precompile", precompile,
+                           "Write all input files into a single binary source package that "
+                           "later runs can load via --load-precompiled, then exit",
+                           "<file>", CommandLineFlags::FilePath);
+
+        std::optional<bool> serve;
+        driver.cmdLine.add("--serve", serve,
+                           "After compiling once, stay resident and read commands from stdin "
+                           "('recheck <file>', 'recompile', 'quit'), keeping parsed state warm "
+                           "in memory so subsequent checks only reparse edited files");
+
         std::optional<std::string> timeTrace;
         driver.cmdLine.add("--time-trace", timeTrace,
                            "Do performance profiling of the slang compiler and output "
                            "the results to the given file in Chrome Event Tracing JSON format",
                            "<path>");
 
+        std::optional<std::string> profileActivity;
+        driver.cmdLine.add("--profile-activity", profileActivity,
+                           "Sample what the compiler is working on (which module, which "
+                           "expression) at a fixed interval and output folded stack counts "
+                           "to the given file, suitable for flamegraph tools",
+                           "<path>");
+
         if (!driver.parseCommandLine(argc, argv))
             return 1;
 
@@ -132,17 +361,40 @@ int driverMain(int argc, TArgs argv) {
             return 2;
 
         if (onlyParse.has_value() + onlyPreprocess.has_value() + onlyMacros.has_value() +
-                driver.options.lintMode() >
+                indexFile.has_value() + driver.options.lintMode() >
             1) {
             OS::printE(fg(driver.diagClient->errorColor), "error: ");
             OS::printE("can only specify one of --preprocess, --macros-only, "
-                       "--parse-only, --lint-only");
+                       "--parse-only, --index-only, --lint-only");
             return 3;
         }
 
+        if (precompile) {
+            if (driver.sourceLoader.writePackage(*precompile))
+                return 0;
+
+            for (auto& err : driver.sourceLoader.getErrors())
+                OS::printE(fmt::format("error: {}\n", err));
+            return 5;
+        }
+
+        if (serve == true) {
+            if (onlyParse.has_value() || onlyPreprocess.has_value() || onlyMacros.has_value() ||
+                driver.options.singleUnit == true) {
+                OS::printE(fg(driver.diagClient->errorColor), "error: ");
+                OS::printE("--serve cannot be combined with --preprocess, --macros-only, "
+                           "--parse-only, or --single-unit");
+                return 3;
+            }
+            return runServer(driver, quiet == true);
+        }
+
         if (timeTrace)
             TimeTrace::initialize();
 
+        if (profileActivity)
+            ActivityProfiler::start();
+
         bool ok = true;
         SLANG_TRY {
             if (onlyPreprocess == true) {
@@ -156,16 +408,29 @@ int driverMain(int argc, TArgs argv) {
                 ok = driver.parseAllSources();
                 ok &= driver.reportParseDiags();
             }
+            else if (indexFile) {
+                ok = driver.parseAllSources();
+                ok &= driver.reportParseDiags();
+                ok &= writeModuleIndex(driver, *indexFile);
+            }
             else {
                 {
                     TimeTraceScope timeScope("parseAllSources"sv, ""sv);
                     ok = driver.parseAllSources();
                 }
 
-                {
+                if (driver.options.compilePerTop == true) {
+                    TimeTraceScope timeScope("elaboration"sv, ""sv);
+                    ok &= driver.reportPerTopCompilations(quiet == true);
+                }
+                else {
                     TimeTraceScope timeScope("elaboration"sv, ""sv);
                     auto compilation = driver.createCompilation();
                     ok &= driver.reportCompilation(*compilation, quiet == true);
+                    if (driver.options.resultFile)
+                        ok &= driver.writeResultFile(*compilation, *driver.options.resultFile);
+                    if (driver.options.telemetryFile)
+                        ok &= driver.writeTelemetry(*compilation, *driver.options.telemetryFile);
                     if (astJsonFile)
                         printJson(*compilation, *astJsonFile, astJsonScopes,
                                   includeSourceInfo == true);
@@ -188,6 +453,15 @@ int driverMain(int argc, TArgs argv) {
             }
         }
 
+        if (profileActivity) {
+            std::ofstream file(*profileActivity);
+            ActivityProfiler::write(file);
+            if (!file.flush()) {
+                SLANG_THROW(std::runtime_error(
+                    fmt::format("Unable to write activity profile to '{}'", *profileActivity)));
+            }
+        }
+
         return ok ? 0 : 5;
     }
     SLANG_CATCH(const std::exception& e) {
@@ -6,27 +6,173 @@
 // SPDX-License-Identifier: MIT
 //------------------------------------------------------------------------------
 #include <algorithm>
+#include <map>
 #include <regex>
+#include <set>
+#include <variant>
+#include <vector>
 
 #include "slang/ast/ASTVisitor.h"
 #include "slang/ast/Compilation.h"
 #include "slang/ast/symbols/InstanceSymbols.h"
 #include "slang/driver/Driver.h"
+#include "slang/util/ThreadPool.h"
 #include "slang/util/VersionInfo.h"
 
 using namespace slang;
 using namespace slang::driver;
 using namespace slang::ast;
 
+namespace {
+
+struct FilterOptions {
+    const SourceManager* sourceManager = nullptr;
+    const std::regex* instRegex = nullptr;
+    const std::string* instPrefix = nullptr;
+    const std::string* customFormat = nullptr;
+    bool showParams = false;
+    bool summaryOnly = false;
+};
+
+/// Aggregated information about the instances in one subtree; built
+/// concurrently per subtree and then merged.
+struct HierSummary {
+    std::map<std::string_view, size_t> instanceCounts;
+    std::map<std::string_view, std::set<std::string>> paramSets;
+
+    void merge(HierSummary&& other) {
+        for (auto& [name, count] : other.instanceCounts)
+            instanceCounts[name] += count;
+        for (auto& [name, sets] : other.paramSets)
+            paramSets[name].merge(sets);
+    }
+};
+
+/// The output produced for one subtree: the formatted text in hierarchy
+/// order plus the subtree's summary.
+struct Chunk {
+    std::string text;
+    HierSummary summary;
+};
+
+std::string formatParams(const InstanceSymbol& type) {
+    std::string result;
+    int size = type.body.getParameters().size();
+    if (!size)
+        return result;
+
+    result += "Parameters: ";
+    for (auto p : type.body.getParameters()) {
+        std::string v;
+        size--;
+        if (p->symbol.kind == SymbolKind::Parameter)
+            v = p->symbol.as<ParameterSymbol>().getValue().toString();
+        else if (p->symbol.kind == SymbolKind::TypeParameter)
+            v = p->symbol.as<TypeParameterSymbol>().targetType.getType().toString();
+        else
+            v = "?";
+        result += fmt::format("{}={}{}", p->symbol.name, v, size ? ", " : "");
+    }
+    return result;
+}
+
+/// Handles filtering, output, and summary accounting for a single module
+/// instance. Returns false if the prefix filter rules out the entire
+/// subtree; otherwise advances @a index past the matched portion of the
+/// prefix.
+bool processInstance(const InstanceSymbol& type, const FilterOptions& opts, int& index,
+                     std::string& out, HierSummary& summary) {
+    int pathLength = opts.instPrefix ? int(opts.instPrefix->length()) : 0;
+    int len = int(type.name.length());
+
+    // if no instPrefix, pathLength is 0, and this check will never take place, so
+    // *opts.instPrefix is safe. if index >= pathLength we satisfied the full
+    // instPrefix. from now on we are limited only by max-depth
+    if (index < pathLength) {
+        if (type.name != opts.instPrefix->substr(index, std::min(pathLength - index, len))) {
+            // current instance name did not match
+            return false;
+        }
+        index += len;
+        if (index < pathLength && (*opts.instPrefix)[index] != '.')
+            return false; // separator needed, but didn't find one
+        index++;          // adjust for '.'
+    }
+
+    std::string s_inst;
+    if (!opts.summaryOnly || opts.instRegex)
+        type.getHierarchicalPath(s_inst);
+
+    std::smatch match;
+    if (opts.instRegex && !std::regex_search(s_inst, match, *opts.instRegex)) {
+        // Not shown, but keep scanning the subtree.
+        return true;
+    }
+
+    auto s_module = type.getDefinition().name;
+    std::string paramText;
+    if (opts.showParams || opts.summaryOnly)
+        paramText = formatParams(type);
+
+    summary.instanceCounts[s_module]++;
+
+    if (!opts.summaryOnly) {
+        auto s_file = opts.sourceManager->getFileName(type.getDefinition().location);
+        if (opts.customFormat) {
+            out += fmt::format(fmt::runtime(*opts.customFormat), fmt::arg("module", s_module),
+                               fmt::arg("inst", s_inst), fmt::arg("file", s_file));
+        }
+        else {
+            out += fmt::format("Module=\"{}\" Instance=\"{}\" File=\"{}\" ", s_module, s_inst,
+                               s_file);
+        }
+        if (opts.showParams)
+            out += paramText;
+        out += "\n";
+    }
+
+    summary.paramSets[s_module].insert(std::move(paramText));
+    return true;
+}
+
+/// Collects the direct instance children of an instance, looking through
+/// generate blocks and arrays without descending into the children
+/// themselves.
+std::vector<const InstanceSymbol*> collectChildInstances(const InstanceSymbol& type) {
+    std::vector<const InstanceSymbol*> children;
+    type.body.visit(makeVisitor(
+        [&](auto&, const InstanceSymbol& child) { children.push_back(&child); }));
+    return children;
+}
+
+void visitSubtree(const InstanceSymbol& type, const FilterOptions& opts, int depth, int index,
+                  std::string& out, HierSummary& summary) {
+    if (!type.isModule())
+        return;
+    if (!processInstance(type, opts, index, out, summary))
+        return;
+
+    // When the depth cutoff is reached we skip the walk below it entirely,
+    // not just the printing.
+    depth--;
+    if (!depth)
+        return;
+
+    for (auto child : collectChildInstances(type))
+        visitSubtree(*child, opts, depth, index, out, summary);
+}
+
+} // namespace
+
 int main(int argc, char** argv) {
     std::regex regex;
-    std::smatch match;
     Driver driver;
     driver.addStandardArgs();
 
     std::optional<bool> showHelp;
     std::optional<bool> showVersion;
     std::optional<bool> params;
+    std::optional<bool> summary;
     std::optional<int> maxDepth;
     std::optional<std::string> instPrefix;
     std::optional<std::string> instRegex;
@@ -34,6 +180,9 @@ int main(int argc, char** argv) {
     driver.cmdLine.add("-h,--help", showHelp, "Display available options");
     driver.cmdLine.add("--version", showVersion, "Display version information and exit");
     driver.cmdLine.add("--params", params, "Display instance parameter values");
+    driver.cmdLine.add("--summary", summary,
+                       "Print per-module instance counts and unique parameter "
+                       "set counts instead of the instance tree");
     driver.cmdLine.add("--max-depth", maxDepth, "Maximum instance depth to be printed", "<depth>");
     driver.cmdLine.add("--inst-prefix", instPrefix,
                        "Skip all instance subtrees not under this prefix (inst.sub_inst...)",
@@ -65,72 +214,68 @@ int main(int argc, char** argv) {
     bool ok = driver.parseAllSources();
 
     auto compilation = driver.createCompilation();
-    auto sourceManager = compilation->getSourceManager();
+
+    // Fully elaborate up front so that the traversal below never triggers
+    // lazy resolution and the compilation can be walked from multiple
+    // threads at once.
+    compilation->freeze();
 
     if (instRegex.has_value())
         regex = instRegex.value();
-    auto instances = compilation->getRoot().topInstances;
-    for (auto& i : instances) {
+
+    FilterOptions opts;
+    opts.sourceManager = compilation->getSourceManager();
+    opts.instRegex = instRegex.has_value() ? &regex : nullptr;
+    opts.instPrefix = instPrefix.has_value() ? &instPrefix.value() : nullptr;
+    opts.customFormat = customFormat.has_value() ? &customFormat.value() : nullptr;
+    opts.showParams = params.value_or(false);
+    opts.summaryOnly = summary.value_or(false);
+
+    // Each top instance is processed inline to fix the output order and then
+    // its child subtrees are handed to the thread pool, which builds each
+    // chunk of output (and its summary) concurrently. The chunks are printed
+    // and merged in hierarchy order afterwards.
+    ThreadPool threadPool{driver.options.numThreads.value_or(0u)};
+    std::vector<std::variant<Chunk, std::future<Chunk>>> pieces;
+
+    for (auto inst : compilation->getRoot().topInstances) {
         int depth = maxDepth.value_or(-1); // will never be 0, go full depth
-        int pathLength = instPrefix.value_or("").length();
         int index = 0;
-        i->visit(makeVisitor([&](auto& visitor, const InstanceSymbol& type) {
-            if (type.isModule()) {
-                std::string s_inst;
-                int len = type.name.length();
-                int save_index = index;
-                // if no instPrefix, pathLength is 0, and this check will never take place, so
-                // instPrefix.value() is safe if index >= pathLength we satisfied the full
-                // instPrefix. from now on we are limited only by max-depth
-                if (index < pathLength) {
-                    if (type.name !=
-                        instPrefix.value().substr(index, std::min(pathLength - index, len))) {
-                        // current instance name did not match
-                        return;
-                    }
-                    index += len;
-                    if (index < pathLength && instPrefix.value()[index] != '.')
-                        return; // separator needed, but didn't find one
-                    index++;    // adjust for '.'
-                }
-                type.getHierarchicalPath(s_inst);
-                if (!instRegex.has_value() || std::regex_search(s_inst, match, regex)) {
-                    auto s_module = type.getDefinition().name;
-                    auto s_file = sourceManager->getFileName(type.getDefinition().location);
-                    if (customFormat.has_value())
-                        OS::print(fmt::format(fmt::runtime(customFormat.value()),
-                                              fmt::arg("module", s_module),
-                                              fmt::arg("inst", s_inst), fmt::arg("file", s_file)));
-                    else
-                        OS::print(fmt::format("Module=\"{}\" Instance=\"{}\" File=\"{}\" ",
-                                              s_module, s_inst, s_file));
-                    int size = type.body.getParameters().size();
-                    if (size && params.value_or(false)) {
-                        OS::print(fmt::format("Parameters: "));
-                        for (auto p : type.body.getParameters()) {
-                            std::string v;
-                            size--;
-                            if (p->symbol.kind == SymbolKind::Parameter)
-                                v = p->symbol.as<ParameterSymbol>().getValue().toString();
-                            else if (p->symbol.kind == SymbolKind::TypeParameter)
-                                v = p->symbol.as<TypeParameterSymbol>()
-                                        .targetType.getType()
-                                        .toString();
-                            else
-                                v = "?";
-                            OS::print(fmt::format("{}={}{}", p->symbol.name, v, size ? ", " : ""));
-                        }
-                    }
-                    OS::print("\n");
-                }
-                depth--;
-                if (depth)
-                    visitor.visitDefault(type);
-                depth++;
-                index = save_index;
-            }
-        }));
+
+        Chunk head;
+        bool descend = inst->isModule() &&
+                       processInstance(*inst, opts, index, head.text, head.summary);
+        pieces.emplace_back(std::move(head));
+
+        depth--;
+        if (!descend || !depth)
+            continue;
+
+        for (auto child : collectChildInstances(*inst)) {
+            pieces.emplace_back(threadPool.submit([child, &opts, depth, index] {
+                Chunk chunk;
+                visitSubtree(*child, opts, depth, index, chunk.text, chunk.summary);
+                return chunk;
+            }));
+        }
     }
+
+    HierSummary total;
+    for (auto& piece : pieces) {
+        Chunk chunk = std::holds_alternative<Chunk>(piece)
+                          ? std::get<Chunk>(std::move(piece))
+                          : std::get<std::future<Chunk>>(piece).get();
+        OS::print(chunk.text);
+        total.merge(std::move(chunk.summary));
+    }
+
+    if (opts.summaryOnly) {
+        for (auto& [name, count] : total.instanceCounts) {
+            OS::print(fmt::format("Module=\"{}\" Count={} UniqueParamSets={}\n", name, count,
+                                  total.paramSets[name].size()));
+        }
+    }
+
     ok &= driver.reportCompilation(*compilation, /* quiet */ false);
 
     return ok ? 0 : 3;
@@ -27,6 +27,8 @@
 #include "slang/numeric/SVInt.h"
 #include "slang/syntax/SyntaxTree.h"
 #include "slang/syntax/SyntaxVisitor.h"
+#include "slang/util/Hash.h"
+#include "slang/util/ThreadPool.h"
 #include "slang/util/Util.h"
 
 using namespace slang;
@@ -388,8 +390,10 @@ public:
         auto nodePtr = std::make_unique<NetlistPortDeclaration>(symbol);
         auto& node = nodePtr->as<NetlistPortDeclaration>();
         symbol.getHierarchicalPath(node.hierarchicalPath);
-        SLANG_ASSERT(lookupPort(nodePtr->hierarchicalPath) == nullptr &&
-                     "Port declaration already exists");
+        // The key views the node's own path string, which stays stable since
+        // nodes are individually heap allocated.
+        auto [it, inserted] = portLookup.emplace(node.hierarchicalPath, &node);
+        SLANG_ASSERT(inserted && "Port declaration already exists");
         nodes.push_back(std::move(nodePtr));
         DEBUG_PRINT("New node: port declaration {}\n", node.hierarchicalPath);
         return node;
@@ -406,6 +410,7 @@ public:
             auto nodePtr = std::make_unique<NetlistVariableDeclaration>(symbol);
             nodePtr->hierarchicalPath = hierPath;
             auto& node = nodePtr->as<NetlistVariableDeclaration>();
+            variableLookup.emplace(node.hierarchicalPath, &node);
             nodes.push_back(std::move(nodePtr));
             DEBUG_PRINT("Add var decl {}\n", node.hierarchicalPath);
             return node;
@@ -444,23 +449,15 @@ public:
 
     /// Find a port declaration node in the netlist by hierarchical path.
     NetlistPortDeclaration* lookupPort(std::string_view hierarchicalPath) {
-        auto compareNode = [&hierarchicalPath](const std::unique_ptr<NetlistNode>& node) {
-            return node->kind == NodeKind::PortDeclaration &&
-                   node->as<NetlistPortDeclaration>().hierarchicalPath == hierarchicalPath;
-        };
-        auto it = std::ranges::find_if(*this, compareNode);
-        return it != end() ? &it->get()->as<NetlistPortDeclaration>() : nullptr;
+        auto it = portLookup.find(hierarchicalPath);
+        return it != portLookup.end() ? it->second : nullptr;
     }
 
     /// Find a variable declaration node in the netlist by hierarchical path.
     /// Note that this does not lookup alias nodes.
     NetlistVariableDeclaration* lookupVariable(std::string_view hierarchicalPath) {
-        auto compareNode = [&hierarchicalPath](const std::unique_ptr<NetlistNode>& node) {
-            return node->kind == NodeKind::VariableDeclaration &&
-                   node->as<NetlistVariableDeclaration>().hierarchicalPath == hierarchicalPath;
-        };
-        auto it = std::ranges::find_if(*this, compareNode);
-        return it != end() ? &it->get()->as<NetlistVariableDeclaration>() : nullptr;
+        auto it = variableLookup.find(hierarchicalPath);
+        return it != variableLookup.end() ? it->second : nullptr;
     }
 
     /// Find a variable reference node in the netlist by its syntax.
@@ -485,9 +482,12 @@ public:
     // A list of modifications to apply to the netlist.
     using SplittingList = std::vector<VarSplit>;
 
-    /// Identify the new ALIAS nodes and their edges to add to the netlist.
-    void identifySplits(SplittingList& mods) {
-        for (auto& node : nodes) {
+    /// Identify the new ALIAS nodes and their edges to add to the netlist
+    /// for nodes in the index range [begin, end). This only reads the graph,
+    /// so disjoint ranges can be processed concurrently.
+    void identifySplits(size_t begin, size_t end, SplittingList& mods) {
+        for (size_t i = begin; i < end; i++) {
+            auto& node = nodes[i];
 
             // Find variable declaration nodes in the graph that have multiple
             // outgoing edges.
@@ -577,11 +577,45 @@ public:
     ///   var ref a -x-> var alias x -x-> var ref b
     ///   var ref a ---> var alias x ---> var ref
     ///
-    void split() {
+    /// If a thread pool is provided, identification of the splits is
+    /// partitioned across it; the per-block results are merged back in node
+    /// order so the applied modifications are identical to a serial run.
+    void split(ThreadPool* threadPool = nullptr) {
         SplittingList mods;
-        identifySplits(mods);
+        if (threadPool && threadPool->getThreadCount() > 1 && !nodes.empty()) {
+            size_t numBlocks = threadPool->getThreadCount();
+            size_t blockSize = (nodes.size() + numBlocks - 1) / numBlocks;
+            std::vector<SplittingList> blockMods(numBlocks);
+
+            for (size_t i = 0; i < numBlocks; i++) {
+                size_t begin = i * blockSize;
+                size_t end = std::min(begin + blockSize, nodes.size());
+                if (begin >= end)
+                    break;
+
+                threadPool->pushTask([this, begin, end, &blockMods, i] {
+                    identifySplits(begin, end, blockMods[i]);
+                });
+            }
+            threadPool->waitForAll();
+
+            for (auto& block : blockMods)
+                mods.insert(mods.end(), block.begin(), block.end());
+        }
+        else {
+            identifySplits(0, nodes.size(), mods);
+        }
+
         applySplits(mods);
     }
+
+private:
+    // Declaration nodes indexed by hierarchical path, maintained as nodes are
+    // added so that lookups during construction don't scan the whole graph.
+    // The keys view each node's own path string, which is stable because
+    // nodes are individually heap allocated.
+    flat_hash_map<std::string_view, NetlistPortDeclaration*> portLookup;
+    flat_hash_map<std::string_view, NetlistVariableDeclaration*> variableLookup;
 };
 
 } // namespace netlist
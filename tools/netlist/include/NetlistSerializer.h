@@ -0,0 +1,249 @@
+//------------------------------------------------------------------------------
+//! @file NetlistSerializer.h
+//! @brief Compact binary export and import of the netlist graph
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "Netlist.h"
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "slang/util/OS.h"
+
+namespace netlist {
+
+/// The binary netlist graph format, version 1.
+///
+/// The file is a sequence of 8-byte-aligned sections addressed by offsets in
+/// the header, so consumers can mmap the file and index straight into the
+/// node records, CSR adjacency arrays and string table without any parsing:
+///
+///   Header | node records | rowStart[numNodes + 1] (uint64)
+///          | target[numEdges] (uint32) | edgeFlags[numEdges] (uint8)
+///          | string table (NUL-terminated strings)
+///
+/// Node ids are dense indexes into the record array, assigned in graph
+/// iteration order; rowStart[i] .. rowStart[i+1] delimits the slice of the
+/// target and edgeFlags arrays holding node i's outgoing edges. All values
+/// are stored in the native byte order of the exporting machine.
+struct BinaryNetlistHeader {
+    static constexpr char Magic[9] = "SLNGNETL";
+    static constexpr uint32_t Version = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t numNodes;
+    uint64_t numEdges;
+    uint64_t rowOffset;
+    uint64_t targetOffset;
+    uint64_t edgeFlagsOffset;
+    uint64_t stringTableOffset;
+    uint64_t stringTableSize;
+};
+
+/// A fixed-size node record in the binary format, laid out directly after
+/// the header.
+struct BinaryNetlistNode {
+    uint64_t originalId; ///< NetlistNode::ID from the exporting run.
+    uint32_t kind;       ///< The NodeKind of the node.
+    uint32_t edgeKind;   ///< The ast::EdgeKind driving the node.
+    uint64_t nameOffset; ///< String table offset of the name or hierarchical path.
+};
+
+/// Edge flag bits stored in the edgeFlags array.
+enum BinaryNetlistEdgeFlags : uint8_t { EdgeFlagDisabled = 1 };
+
+/// Serializes the netlist graph into the binary format described above.
+inline std::vector<char> serializeNetlist(const Netlist& netlist) {
+    // Assign dense ids in iteration order and intern the name strings.
+    std::map<const NetlistNode*, uint32_t> denseIds;
+    std::string stringTable;
+    std::map<std::string, uint64_t> stringOffsets;
+
+    auto intern = [&](const std::string& str) {
+        auto [it, inserted] = stringOffsets.emplace(str, stringTable.size());
+        if (inserted) {
+            stringTable.append(str);
+            stringTable.push_back('\0');
+        }
+        return it->second;
+    };
+
+    auto nameOf = [](const NetlistNode& node) -> std::string {
+        switch (node.kind) {
+            case NodeKind::PortDeclaration:
+                return node.as<NetlistPortDeclaration>().hierarchicalPath;
+            case NodeKind::VariableDeclaration:
+                return node.as<NetlistVariableDeclaration>().hierarchicalPath;
+            case NodeKind::VariableAlias:
+                return node.as<NetlistVariableAlias>().hierarchicalPath;
+            case NodeKind::VariableReference:
+                return node.as<NetlistVariableReference>().toString();
+            default:
+                return std::string(node.getName());
+        }
+    };
+
+    std::vector<BinaryNetlistNode> records;
+    records.reserve(netlist.numNodes());
+    for (auto& node : netlist) {
+        denseIds.emplace(node.get(), uint32_t(records.size()));
+        records.push_back({uint64_t(node->ID), uint32_t(node->kind), uint32_t(node->edgeKind),
+                           intern(nameOf(*node))});
+    }
+
+    // Build the CSR adjacency arrays.
+    std::vector<uint64_t> rowStart;
+    std::vector<uint32_t> targets;
+    std::vector<uint8_t> edgeFlags;
+    rowStart.reserve(records.size() + 1);
+    for (auto& node : netlist) {
+        rowStart.push_back(targets.size());
+        for (auto& edge : node->getEdges()) {
+            targets.push_back(denseIds.at(&edge->getTargetNode()));
+            edgeFlags.push_back(edge->disabled ? EdgeFlagDisabled : 0);
+        }
+    }
+    rowStart.push_back(targets.size());
+
+    auto align8 = [](size_t size) { return (size + 7) & ~size_t(7); };
+
+    BinaryNetlistHeader header{};
+    std::memcpy(header.magic, BinaryNetlistHeader::Magic, sizeof(header.magic));
+    header.version = BinaryNetlistHeader::Version;
+    header.numNodes = records.size();
+    header.numEdges = targets.size();
+
+    size_t offset = sizeof(header) + records.size() * sizeof(BinaryNetlistNode);
+    header.rowOffset = offset = align8(offset);
+    offset += rowStart.size() * sizeof(uint64_t);
+    header.targetOffset = offset = align8(offset);
+    offset += targets.size() * sizeof(uint32_t);
+    header.edgeFlagsOffset = offset = align8(offset);
+    offset += edgeFlags.size();
+    header.stringTableOffset = offset = align8(offset);
+    header.stringTableSize = stringTable.size();
+
+    std::vector<char> buffer(offset + stringTable.size());
+    auto put = [&](size_t at, const void* data, size_t size) {
+        if (size)
+            std::memcpy(buffer.data() + at, data, size);
+    };
+    put(0, &header, sizeof(header));
+    put(sizeof(header), records.data(), records.size() * sizeof(BinaryNetlistNode));
+    put(header.rowOffset, rowStart.data(), rowStart.size() * sizeof(uint64_t));
+    put(header.targetOffset, targets.data(), targets.size() * sizeof(uint32_t));
+    put(header.edgeFlagsOffset, edgeFlags.data(), edgeFlags.size());
+    put(header.stringTableOffset, stringTable.data(), stringTable.size());
+    return buffer;
+}
+
+/// Serializes the netlist graph and writes it to the given file.
+inline void exportBinaryNetlist(const Netlist& netlist, const std::string& fileName) {
+    auto buffer = serializeNetlist(netlist);
+    slang::OS::writeFile(fileName, std::string_view(buffer.data(), buffer.size()));
+}
+
+/// @brief A read-only view over a serialized netlist graph.
+///
+/// The view points into the caller's buffer (typically an mmap'd file or the
+/// result of loadBinaryNetlist) and performs no parsing or copying beyond
+/// validating the header, so opening a multi-gigabyte graph is effectively
+/// free. Analyses that only need the graph shape and node names can run from
+/// this view directly; anything that needs AST symbols still requires
+/// rebuilding the netlist from a compilation, since symbols cannot be
+/// reconstituted from the saved graph.
+class BinaryNetlistView {
+public:
+    /// Constructs a view over the given serialized buffer. The buffer must
+    /// outlive the view. Throws std::runtime_error if the buffer does not
+    /// hold a valid netlist graph of a supported version.
+    explicit BinaryNetlistView(std::span<const char> data) : data(data) {
+        if (data.size() < sizeof(BinaryNetlistHeader))
+            SLANG_THROW(std::runtime_error("netlist graph file is truncated"));
+
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (std::memcmp(header.magic, BinaryNetlistHeader::Magic, sizeof(header.magic)) != 0)
+            SLANG_THROW(std::runtime_error("not a binary netlist graph file"));
+        if (header.version != BinaryNetlistHeader::Version)
+            SLANG_THROW(std::runtime_error("unsupported netlist graph version"));
+        if (header.stringTableOffset + header.stringTableSize > data.size())
+            SLANG_THROW(std::runtime_error("netlist graph file is truncated"));
+    }
+
+    /// Gets the number of nodes in the graph.
+    size_t numNodes() const { return header.numNodes; }
+
+    /// Gets the number of edges in the graph.
+    size_t numEdges() const { return header.numEdges; }
+
+    /// Gets the node record for the given dense node id.
+    BinaryNetlistNode node(uint32_t id) const {
+        BinaryNetlistNode record;
+        std::memcpy(&record, data.data() + sizeof(BinaryNetlistHeader) +
+                                 size_t(id) * sizeof(BinaryNetlistNode),
+                    sizeof(record));
+        return record;
+    }
+
+    /// Gets the NodeKind of the given node.
+    NodeKind nodeKind(uint32_t id) const { return NodeKind(node(id).kind); }
+
+    /// Gets the name (for variable references) or hierarchical path (for
+    /// declarations and aliases) of the given node.
+    std::string_view nodeName(uint32_t id) const {
+        return std::string_view(data.data() + header.stringTableOffset + node(id).nameOffset);
+    }
+
+    /// Gets the dense ids of the given node's successors, including those
+    /// reached through disabled edges.
+    std::span<const uint32_t> successors(uint32_t id) const {
+        auto row = rowStart();
+        return targets().subspan(row[id], row[id + 1] - row[id]);
+    }
+
+    /// Returns true if the i'th outgoing edge of the given node is disabled.
+    bool edgeDisabled(uint32_t id, size_t index) const {
+        auto edgeIndex = rowStart()[id] + index;
+        return (uint8_t(data[header.edgeFlagsOffset + edgeIndex]) & EdgeFlagDisabled) != 0;
+    }
+
+private:
+    std::span<const uint64_t> rowStart() const {
+        return {reinterpret_cast<const uint64_t*>(data.data() + header.rowOffset),
+                size_t(header.numNodes + 1)};
+    }
+
+    std::span<const uint32_t> targets() const {
+        return {reinterpret_cast<const uint32_t*>(data.data() + header.targetOffset),
+                size_t(header.numEdges)};
+    }
+
+    std::span<const char> data;
+    BinaryNetlistHeader header;
+};
+
+/// Reads a serialized netlist graph from the given file into @a storage and
+/// returns a view over it. The storage must outlive the returned view.
+inline BinaryNetlistView loadBinaryNetlist(const std::string& fileName,
+                                           std::vector<char>& storage) {
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in)
+        SLANG_THROW(std::runtime_error(fmt::format("unable to open '{}'", fileName)));
+
+    in.seekg(0, std::ios::end);
+    storage.resize(size_t(in.tellg()));
+    in.seekg(0);
+    in.read(storage.data(), std::streamsize(storage.size()));
+    return BinaryNetlistView(storage);
+}
+
+} // namespace netlist
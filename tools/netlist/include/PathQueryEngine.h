@@ -0,0 +1,235 @@
+//------------------------------------------------------------------------------
+//! @file PathQueryEngine.h
+//! @brief Answer repeated path queries using precomputed reachability.
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "Netlist.h"
+#include "NetlistPath.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <vector>
+
+#include "slang/util/Util.h"
+
+namespace netlist {
+
+/// Answer point-to-point path queries over a netlist.
+///
+/// Unlike PathFinder, which walks the graph for every query, this engine
+/// computes the strongly-connected components of the netlist and a
+/// reachability bitset over the condensation once at construction time.
+/// Existence queries are then a single bitset test, and path enumeration is
+/// a search guided by the reachability index that only ever follows edges
+/// that can still lead to the destination. Intended for workloads that issue
+/// many queries against the same (unmodified) netlist; the index is not
+/// updated if the graph changes after construction.
+class PathQueryEngine {
+public:
+    explicit PathQueryEngine(Netlist& netlist) {
+        // Assign dense indexes to the nodes.
+        for (auto& node : netlist) {
+            nodeIndex[node.get()] = nodesByIndex.size();
+            nodesByIndex.push_back(node.get());
+        }
+
+        computeSccs();
+        computeReachability();
+    }
+
+    /// Return true if a path exists from the start node to the end node.
+    bool pathExists(const NetlistNode& startNode, const NetlistNode& endNode) const {
+        return reaches(sccOf[indexOf(startNode)], sccOf[indexOf(endNode)]);
+    }
+
+    /// Find a path between two nodes in the netlist.
+    /// Return a NetlistPath object that is empty if the path does not exist.
+    NetlistPath find(NetlistNode& startNode, NetlistNode& endNode) const {
+        if (!pathExists(startNode, endNode)) {
+            return NetlistPath();
+        }
+        // Single-node path.
+        if (startNode == endNode) {
+            return NetlistPath({&endNode});
+        }
+
+        // Search from the start node, but only follow edges whose target can
+        // still reach the destination; everything else is pruned by the
+        // reachability index. The parent relationships recorded along the way
+        // describe the path once the end node is encountered.
+        const size_t endScc = sccOf[indexOf(endNode)];
+        std::map<NetlistNode*, NetlistNode*> parent;
+        std::vector<bool> visited(nodesByIndex.size(), false);
+        std::vector<NetlistNode*> workList{&startNode};
+        visited[indexOf(startNode)] = true;
+
+        bool found = false;
+        while (!workList.empty() && !found) {
+            auto* node = workList.back();
+            workList.pop_back();
+            for (auto& edge : node->getEdges()) {
+                if (edge->disabled) {
+                    continue;
+                }
+                auto* target = &edge->getTargetNode();
+                size_t targetIndex = indexOf(*target);
+                if (visited[targetIndex] || !reaches(sccOf[targetIndex], endScc)) {
+                    continue;
+                }
+                visited[targetIndex] = true;
+                parent[target] = node;
+                if (target == &endNode) {
+                    found = true;
+                    break;
+                }
+                workList.push_back(target);
+            }
+        }
+        SLANG_ASSERT(found && "reachability index promised a path");
+
+        // Build the path by walking the parent relationships back from the
+        // end node, retaining only the variable references, to match the
+        // paths produced by PathFinder.
+        NetlistPath path;
+        auto* nextNode = &endNode;
+        do {
+            nextNode = parent[nextNode];
+            if (nextNode->kind == NodeKind::VariableReference) {
+                path.add(*nextNode);
+            }
+        } while (nextNode != &startNode);
+        path.reverse();
+        return path;
+    }
+
+private:
+    size_t indexOf(const NetlistNode& node) const {
+        auto it = nodeIndex.find(&node);
+        SLANG_ASSERT(it != nodeIndex.end() && "node is not part of the indexed netlist");
+        return it->second;
+    }
+
+    /// Iterative Tarjan's algorithm. SCCs are numbered in completion order,
+    /// so every SCC reachable from a given SCC has a smaller number than it;
+    /// computeReachability relies on that ordering.
+    void computeSccs() {
+        const size_t numNodes = nodesByIndex.size();
+        const size_t unvisited = std::numeric_limits<size_t>::max();
+        sccOf.assign(numNodes, unvisited);
+
+        std::vector<size_t> index(numNodes, unvisited);
+        std::vector<size_t> lowlink(numNodes);
+        std::vector<bool> onStack(numNodes, false);
+        std::vector<size_t> sccStack;
+        size_t nextIndex = 0;
+
+        struct Frame {
+            size_t node;
+            size_t edge;
+        };
+        std::vector<Frame> frames;
+
+        for (size_t root = 0; root < numNodes; root++) {
+            if (index[root] != unvisited) {
+                continue;
+            }
+
+            index[root] = lowlink[root] = nextIndex++;
+            sccStack.push_back(root);
+            onStack[root] = true;
+            frames.push_back({root, 0});
+
+            while (!frames.empty()) {
+                auto& frame = frames.back();
+                auto& edges = nodesByIndex[frame.node]->getEdges();
+                if (frame.edge < edges.size()) {
+                    auto& edge = *edges[frame.edge++];
+                    if (edge.disabled) {
+                        continue;
+                    }
+                    size_t target = indexOf(edge.getTargetNode());
+                    if (index[target] == unvisited) {
+                        index[target] = lowlink[target] = nextIndex++;
+                        sccStack.push_back(target);
+                        onStack[target] = true;
+                        frames.push_back({target, 0});
+                    }
+                    else if (onStack[target]) {
+                        lowlink[frame.node] = std::min(lowlink[frame.node], index[target]);
+                    }
+                    continue;
+                }
+
+                size_t node = frame.node;
+                frames.pop_back();
+                if (!frames.empty()) {
+                    lowlink[frames.back().node] = std::min(lowlink[frames.back().node],
+                                                           lowlink[node]);
+                }
+                if (lowlink[node] == index[node]) {
+                    while (true) {
+                        size_t member = sccStack.back();
+                        sccStack.pop_back();
+                        onStack[member] = false;
+                        sccOf[member] = numSccs;
+                        if (member == node) {
+                            break;
+                        }
+                    }
+                    numSccs++;
+                }
+            }
+        }
+    }
+
+    /// Compute the full reachability matrix over the condensation as one
+    /// bitset row per SCC. Rows are folded in ascending SCC number; since
+    /// successors always have smaller numbers their rows are complete by the
+    /// time they are OR'd in, giving transitive closure in a single pass.
+    void computeReachability() {
+        reachWords = (numSccs + 63) / 64;
+        reach.assign(numSccs * reachWords, 0);
+
+        std::vector<std::vector<size_t>> successors(numSccs);
+        for (size_t i = 0; i < nodesByIndex.size(); i++) {
+            for (auto& edge : nodesByIndex[i]->getEdges()) {
+                if (edge->disabled) {
+                    continue;
+                }
+                size_t targetScc = sccOf[indexOf(edge->getTargetNode())];
+                if (targetScc != sccOf[i]) {
+                    successors[sccOf[i]].push_back(targetScc);
+                }
+            }
+        }
+
+        for (size_t scc = 0; scc < numSccs; scc++) {
+            auto* row = &reach[scc * reachWords];
+            row[scc / 64] |= uint64_t(1) << (scc % 64);
+            for (size_t successor : successors[scc]) {
+                auto* successorRow = &reach[successor * reachWords];
+                for (size_t word = 0; word < reachWords; word++) {
+                    row[word] |= successorRow[word];
+                }
+            }
+        }
+    }
+
+    bool reaches(size_t fromScc, size_t toScc) const {
+        return (reach[fromScc * reachWords + toScc / 64] >> (toScc % 64)) & 1;
+    }
+
+    std::map<const NetlistNode*, size_t> nodeIndex;
+    std::vector<NetlistNode*> nodesByIndex;
+    std::vector<size_t> sccOf;
+    size_t numSccs{0};
+    std::vector<uint64_t> reach;
+    size_t reachWords{0};
+};
+
+} // namespace netlist
@@ -9,6 +9,7 @@
 #include "Netlist.h"
 
 #include "CombLoops.h"
+#include "NetlistSerializer.h"
 #include "PathFinder.h"
 #include "fmt/color.h"
 #include "fmt/format.h"
@@ -28,6 +29,7 @@
 #include "slang/text/FormatBuffer.h"
 #include "slang/text/Json.h"
 #include "slang/util/String.h"
+#include "slang/util/ThreadPool.h"
 #include "slang/util/TimeTrace.h"
 #include "slang/util/Util.h"
 #include "slang/util/VersionInfo.h"
@@ -235,6 +237,11 @@ int main(int argc, char** argv) {
                        "Dump the netlist in DOT format to the specified file, or '-' for stdout",
                        "<file>", CommandLineFlags::FilePath);
 
+    std::optional<std::string> netlistBinFile;
+    driver.cmdLine.add("--netlist-bin", netlistBinFile,
+                       "Dump the netlist graph in a compact binary format to the specified file",
+                       "<file>", CommandLineFlags::FilePath);
+
     std::optional<std::string> fromPointName;
     driver.cmdLine.add("--from", fromPointName, "Specify a start point from which to trace a path",
                        "<name>");
@@ -291,7 +298,9 @@ int main(int argc, char** argv) {
         Netlist netlist;
         NetlistVisitor visitor(*compilation, netlist);
         compilation->getRoot().visit(visitor);
-        netlist.split();
+
+        ThreadPool threadPool(driver.options.numThreads.value_or(0u));
+        netlist.split(&threadPool);
         DEBUG_PRINT("Netlist has {} nodes and {} edges\n", netlist.numNodes(), netlist.numEdges());
 
         // Output a DOT file of the netlist.
@@ -300,6 +309,12 @@ int main(int argc, char** argv) {
             return 0;
         }
 
+        // Output the netlist graph in the compact binary format.
+        if (netlistBinFile) {
+            exportBinaryNetlist(netlist, *netlistBinFile);
+            return 0;
+        }
+
         if (combLoops == true) {
             ElementaryCyclesSearch ecs(netlist);
             std::vector<CycleListType>* cycles = ecs.getElementaryCycles();
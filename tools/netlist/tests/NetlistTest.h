@@ -3,6 +3,7 @@
 
 #include "Netlist.h"
 #include "PathFinder.h"
+#include "PathQueryEngine.h"
 #include "Test.h"
 #include "visitors/NetlistVisitor.h"
 #include <string>
@@ -13,7 +14,11 @@ inline Netlist createNetlist(Compilation& compilation) {
     Netlist netlist;
     NetlistVisitor visitor(compilation, netlist);
     compilation.getRoot().visit(visitor);
-    netlist.split();
+
+    // Use a small pool so that the parallel splitting path gets exercised;
+    // results are required to match a serial run exactly.
+    ThreadPool threadPool(2);
+    netlist.split(&threadPool);
     return netlist;
 }
 
@@ -671,3 +671,62 @@ endmodule
     auto netlist = createNetlist(compilation);
     CHECK(netlist.lookupVariable("t34.i"));
 }
+
+//===---------------------------------------------------------------------===//
+// Tests for the path query engine
+//===---------------------------------------------------------------------===//
+
+TEST_CASE("Path query engine answers existence queries") {
+    auto tree = SyntaxTree::fromText(R"(
+module passthrough (input logic i_value, output logic o_value);
+  assign o_value = i_value;
+endmodule
+)");
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+    auto netlist = createNetlist(compilation);
+    auto* inPort = netlist.lookupPort("passthrough.i_value");
+    auto* outPort = netlist.lookupPort("passthrough.o_value");
+    PathQueryEngine queryEngine(netlist);
+    // Valid i_value -> o_value
+    CHECK(queryEngine.pathExists(*inPort, *outPort));
+    CHECK(!queryEngine.find(*inPort, *outPort).empty());
+    // Invalid o_value -> i_value
+    CHECK(!queryEngine.pathExists(*outPort, *inPort));
+    CHECK(queryEngine.find(*outPort, *inPort).empty());
+}
+
+TEST_CASE("Path query engine matches PathFinder on a chain of variables") {
+    auto tree = SyntaxTree::fromText(R"(
+module chain_vars (input logic i_value, output logic o_value);
+
+  logic a, b, c, d, e;
+
+  assign a = i_value;
+
+  always_comb begin
+    b = a;
+    c = b;
+    d = c;
+  end
+
+  assign e = d;
+  assign o_value = e;
+
+endmodule
+)");
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+    auto netlist = createNetlist(compilation);
+    PathQueryEngine queryEngine(netlist);
+    auto path = queryEngine.find(*netlist.lookupPort("chain_vars.i_value"),
+                                 *netlist.lookupPort("chain_vars.o_value"));
+    CHECK(path.size() == 12);
+    CHECK(*path.findVariable("chain_vars.a") == 1);
+    CHECK(*path.findVariable("chain_vars.b") == 3);
+    CHECK(*path.findVariable("chain_vars.c") == 5);
+    CHECK(*path.findVariable("chain_vars.d") == 7);
+    CHECK(*path.findVariable("chain_vars.e") == 9);
+}
@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+//! @file SerializerTests.cpp
+//! @brief Binary netlist graph serialization unit tests
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+
+#include "NetlistSerializer.h"
+#include "NetlistTest.h"
+
+TEST_CASE("Binary netlist graph round trip") {
+    auto tree = SyntaxTree::fromText(R"(
+module passthrough(input logic a, input logic b, output logic c, output logic d);
+  assign c = a;
+  assign d = b;
+endmodule
+)");
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+    auto netlist = createNetlist(compilation);
+
+    auto buffer = serializeNetlist(netlist);
+    BinaryNetlistView view(buffer);
+
+    CHECK(view.numNodes() == netlist.numNodes());
+    CHECK(view.numEdges() == netlist.numEdges());
+
+    // Every node's kind, name and successors must survive the round trip.
+    std::map<uint64_t, uint32_t> denseByOriginal;
+    for (uint32_t id = 0; id < view.numNodes(); id++)
+        denseByOriginal.emplace(view.node(id).originalId, id);
+
+    uint32_t denseId = 0;
+    for (auto& node : netlist) {
+        CHECK(view.nodeKind(denseId) == node->kind);
+        CHECK(view.node(denseId).originalId == node->ID);
+
+        if (node->kind == NodeKind::PortDeclaration) {
+            CHECK(view.nodeName(denseId) ==
+                  node->as<NetlistPortDeclaration>().hierarchicalPath);
+        }
+
+        auto successors = view.successors(denseId);
+        REQUIRE(successors.size() == node->getEdges().size());
+        for (size_t i = 0; i < successors.size(); i++) {
+            auto& edge = *node->getEdges()[i];
+            CHECK(successors[i] == denseByOriginal.at(edge.getTargetNode().ID));
+            CHECK(view.edgeDisabled(denseId, i) == edge.disabled);
+        }
+        denseId++;
+    }
+
+    // A corrupted header is rejected rather than misread.
+    buffer[0] = 'X';
+    CHECK_THROWS(BinaryNetlistView(buffer));
+}
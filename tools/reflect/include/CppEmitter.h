@@ -43,6 +43,17 @@ public:
             headers.emplace_back(code);
     }
     void addWithIndent(std::string&& code) { hpp << indent(currentIndent) << code; }
+
+    /// Appends the body of another file to this one, merging the include
+    /// lists. Used to stitch fragments emitted in parallel back together.
+    void merge(HppFile&& other) {
+        for (auto& inc : other.includes)
+            addInclude(std::move(inc));
+        for (auto header : other.headers)
+            addIncludeHeader(header);
+        hpp << other.hpp.str();
+    }
+
     void increaseIndent() { currentIndent++; }
     void decreaseIndent() {
         SLANG_ASSERT(currentIndent != 0);
@@ -9,8 +9,10 @@
 #include "SvLocalParam.h"
 #include "SvStruct.h"
 #include "fmt/color.h"
+#include <future>
 
 #include "slang/util/OS.h"
+#include "slang/util/ThreadPool.h"
 
 using namespace slang;
 using namespace ast;
@@ -37,31 +39,35 @@ void SvTypeReflector::reflect() {
     };
     std::unordered_map<std::string_view, namespaceMembers> namespaces;
 
-    compilation->getRoot().visit(makeVisitor([&](auto&, const TypeAliasType& type) {
-        if (checkPublic(type, slang::parsing::TokenKind::Semicolon)) {
-            if (type.isStruct())
+    // A single walk of the root collects the whole public type closure.
+    compilation->getRoot().visit(makeVisitor(
+        [&](auto&, const TypeAliasType& type) {
+            if (checkPublic(type, slang::parsing::TokenKind::Semicolon)) {
+                if (type.isStruct())
+                    namespaces[getNamespace(type)].members.emplace_back(
+                        std::make_unique<SvStruct>(type));
+                else if (type.isEnum())
+                    namespaces[getNamespace(type)].members.emplace_back(
+                        std::make_unique<SvEnum>(type));
+                if (verbose)
+                    OS::print(fmt::fg(fmt::color::yellow_green),
+                              fmt::format("Detected {} as public\n", type.name));
+            }
+
+            if (type.isAlias() && type.targetType.getType().name != "")
+                namespaces[getNamespace(type)].aliases[type.name] = type.targetType.getType().name;
+        },
+        [&](auto&, const ParameterSymbol& type) {
+            if (type.isLocalParam() && checkPublic(type, parsing::TokenKind::Equals)) {
                 namespaces[getNamespace(type)].members.emplace_back(
-                    std::make_unique<SvStruct>(type));
-            else if (type.isEnum())
-                namespaces[getNamespace(type)].members.emplace_back(std::make_unique<SvEnum>(type));
-            if (verbose)
-                OS::print(fmt::fg(fmt::color::yellow_green),
-                          fmt::format("Detected {} as public\n", type.name));
-        }
+                    std::make_unique<SvLocalParam>(type));
+                if (verbose)
+                    OS::print(fmt::fg(fmt::color::yellow_green),
+                              fmt::format("Detected {} as public\n", type.name));
+            }
+        }));
 
-        if (type.isAlias() && type.targetType.getType().name != "")
-            namespaces[getNamespace(type)].aliases[type.name] = type.targetType.getType().name;
-    }));
-
-    compilation->getRoot().visit(makeVisitor([&](auto&, const ParameterSymbol& type) {
-        if (type.isLocalParam() && checkPublic(type, parsing::TokenKind::Equals)) {
-            namespaces[getNamespace(type)].members.emplace_back(
-                std::make_unique<SvLocalParam>(type));
-            if (verbose)
-                OS::print(fmt::fg(fmt::color::yellow_green),
-                          fmt::format("Detected {} as public\n", type.name));
-        }
-    }));
+    ThreadPool threadPool;
 
     for (const auto& _namespace : namespaces) {
         if (_namespace.second.members.empty())
@@ -73,18 +79,40 @@ void SvTypeReflector::reflect() {
         hpp.increaseIndent();
 
         //** NAMESPACE MEMBERS DECLARATION **//
-        for (const auto& generic : _namespace.second.members) {
-            if (generic->isStruct())
-                reinterpret_cast<SvStruct*>(generic.get())
-                    ->toCpp(hpp, _namespace.first, _namespace.second.aliases, noSystemC);
-            else if (generic->isEnum())
-                reinterpret_cast<SvEnum*>(generic.get())
-                    ->toCpp(hpp, _namespace.first, _namespace.second.aliases, noSystemC);
-            else if (generic->isLocalParam())
-                reinterpret_cast<SvLocalParam*>(generic.get())
-                    ->toCpp(hpp, _namespace.first, _namespace.second.aliases, noSystemC);
+        // Each member emits into its own scratch file so types can be
+        // generated in parallel; the fragments are stitched back together
+        // in declaration order afterwards.
+        const auto& members = _namespace.second.members;
+        std::vector<HppFile> fragments;
+        fragments.reserve(members.size());
+        for (size_t i = 0; i < members.size(); i++) {
+            fragments.emplace_back(_namespace.first, noSystemC);
+            fragments.back().increaseIndent();
         }
 
+        std::vector<std::future<void>> futures;
+        futures.reserve(members.size());
+        for (size_t i = 0; i < members.size(); i++) {
+            futures.push_back(threadPool.submit([&, i] {
+                const auto& generic = members[i];
+                auto& fragment = fragments[i];
+                if (generic->isStruct())
+                    reinterpret_cast<SvStruct*>(generic.get())
+                        ->toCpp(fragment, _namespace.first, _namespace.second.aliases, noSystemC);
+                else if (generic->isEnum())
+                    reinterpret_cast<SvEnum*>(generic.get())
+                        ->toCpp(fragment, _namespace.first, _namespace.second.aliases, noSystemC);
+                else if (generic->isLocalParam())
+                    reinterpret_cast<SvLocalParam*>(generic.get())
+                        ->toCpp(fragment, _namespace.first, _namespace.second.aliases, noSystemC);
+            }));
+        }
+
+        for (auto& future : futures)
+            future.get();
+        for (auto& fragment : fragments)
+            hpp.merge(std::move(fragment));
+
         hpp.decreaseIndent();
         hpp.addWithIndent("}\n");
     }
@@ -1,13 +1,17 @@
 //------------------------------------------------------------------------------
 // rewriter.cpp
-// Simple tool that parses an input file and writes it back out; used
-// for verifying the round-trip nature of the parse tree.
+// Tool that parses input files and writes them back out; used for
+// verifying the round-trip nature of the parse tree and as the driver
+// for codemod flows built on SyntaxRewriter.
 //
 // SPDX-FileCopyrightText: Michael Popoloski
 // SPDX-License-Identifier: MIT
 //------------------------------------------------------------------------------
 
+#include <atomic>
 #include <cstdio>
+#include <filesystem>
+#include <fstream>
 #if defined(_WIN32)
 #    include <fcntl.h>
 #    include <io.h>
@@ -17,23 +21,123 @@
 
 #include "slang/syntax/SyntaxPrinter.h"
 #include "slang/syntax/SyntaxTree.h"
+#include "slang/text/SourceManager.h"
+#include "slang/util/CommandLine.h"
 #include "slang/util/OS.h"
+#include "slang/util/ThreadPool.h"
 
 using namespace slang;
 using namespace slang::syntax;
 
+namespace fs = std::filesystem;
+
+static std::string rewriteText(const SyntaxTree& tree) {
+    // Codemods plug in here: run any SyntaxRewriter subclasses over the
+    // tree before printing. With no rewrites registered this is a pure
+    // round trip of the source text.
+    return SyntaxPrinter::printFile(tree);
+}
+
+// Commits output atomically: the new text is written to a sibling temp
+// file and renamed into place, so a crash or full disk mid-write never
+// leaves a truncated source file behind.
+static bool writeInPlace(const fs::path& path, const std::string& text) {
+    fs::path temp = path;
+    temp += ".rewrite.tmp";
+
+    std::ofstream out(temp, std::ios::binary);
+    out.write(text.data(), std::streamsize(text.size()));
+    out.close();
+
+    std::error_code ec;
+    if (!out) {
+        fs::remove(temp, ec);
+        OS::printE(fmt::format("error: unable to write '{}'\n", temp.string()));
+        return false;
+    }
+
+    fs::rename(temp, path, ec);
+    if (ec) {
+        OS::printE(fmt::format("error: unable to rename '{}' into place: {}\n", temp.string(),
+                               ec.message()));
+        fs::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
+
+static bool rewriteFile(const std::string& path, bool inPlace) {
+    // Each file gets its own source manager so that a long batch doesn't
+    // accumulate every input's text in memory at once.
+    SourceManager sourceManager;
+    auto tree = SyntaxTree::fromFile(path, sourceManager);
+    if (!tree) {
+        OS::printE(fmt::format("error: '{}': {}\n", path, tree.error().first.message()));
+        return false;
+    }
+
+    auto text = rewriteText(*tree.value());
+    if (inPlace)
+        return writeInPlace(path, text);
+
+    printf("%s", text.c_str());
+    return true;
+}
+
 int main(int argc, char** argv) {
     OS::setupConsole();
 
     SLANG_TRY {
-        if (argc != 2) {
-            fmt::print(stderr, "usage: rewriter file\n");
+        CommandLine cmdLine;
+
+        std::optional<bool> showHelp;
+        cmdLine.add("-h,--help", showHelp, "Display available options");
+
+        std::optional<bool> inPlace;
+        cmdLine.add("-i,--in-place", inPlace,
+                    "Write each output back over its input file (atomically, via "
+                    "rename-into-place) instead of printing to stdout");
+
+        std::optional<std::string> fileList;
+        cmdLine.add("-f,--file-list", fileList,
+                    "File containing a list of input paths, one per line; lines "
+                    "starting with '#' are ignored",
+                    "<path>");
+
+        std::optional<uint32_t> numThreads;
+        cmdLine.add("-j,--threads", numThreads,
+                    "The number of threads to use to parallelize rewriting", "<count>");
+
+        std::vector<std::string> files;
+        cmdLine.setPositional(files, "files");
+
+        if (!cmdLine.parse(argc, argv)) {
+            for (auto& err : cmdLine.getErrors())
+                OS::printE(fmt::format("{}\n", err));
             return 1;
         }
 
-        auto tree = SyntaxTree::fromFile(argv[1]);
-        if (!tree) {
-            fmt::print(stderr, "error: '{}': {}\n", argv[1], tree.error().first.message());
+        if (showHelp == true) {
+            OS::print(fmt::format("{}", cmdLine.getHelpText("slang SystemVerilog rewriter")));
+            return 0;
+        }
+
+        if (fileList) {
+            std::ifstream in(*fileList);
+            if (!in) {
+                OS::printE(fmt::format("error: unable to read file list '{}'\n", *fileList));
+                return 1;
+            }
+
+            std::string line;
+            while (std::getline(in, line)) {
+                if (!line.empty() && line[0] != '#')
+                    files.push_back(line);
+            }
+        }
+
+        if (files.empty()) {
+            OS::printE("error: no input files\n");
             return 1;
         }
 
@@ -42,7 +146,36 @@ int main(int argc, char** argv) {
         _setmode(_fileno(stdout), _O_BINARY);
 #endif
 
-        printf("%s", SyntaxPrinter::printFile(*tree.value()).c_str());
+        // Interleaved stdout from concurrent rewrites would be garbage, so
+        // batches require committing results back to their own files.
+        if (files.size() > 1 && inPlace != true) {
+            OS::printE("error: multiple input files require --in-place\n");
+            return 1;
+        }
+
+        if (files.size() == 1)
+            return rewriteFile(files[0], inPlace == true) ? 0 : 1;
+
+        // One task per file rather than one block per thread, so a file
+        // that's slow to load only stalls its own task.
+        std::atomic<size_t> failures = 0;
+        ThreadPool threadPool(numThreads.value_or(0u));
+        threadPool.pushLoop(
+            size_t(0), files.size(),
+            [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; i++) {
+                    if (!rewriteFile(files[i], true))
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                }
+            },
+            files.size());
+        threadPool.waitForAll();
+
+        if (failures > 0) {
+            OS::printE(fmt::format("{} of {} files failed to rewrite\n", failures.load(),
+                                   files.size()));
+            return 1;
+        }
         return 0;
     }
     SLANG_CATCH(const std::exception& e) {
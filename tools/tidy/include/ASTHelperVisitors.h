@@ -31,6 +31,15 @@ protected:
         config(Registry::getConfig()) {}
 
     [[nodiscard]] bool skip(std::string_view path) const {
+        // Once the running check exhausts its time budget, skip all remaining
+        // symbols so it finishes promptly with whatever it found so far.
+        if (CheckTimer::budgetExceeded())
+            return true;
+
+        const auto& cleanFiles = Registry::getCleanFiles();
+        if (!cleanFiles.empty() && cleanFiles.count(std::string(path)))
+            return true;
+
         auto file = std::filesystem::path(path).filename().string();
         auto parentPath = weakly_canonical(std::filesystem::path(path).parent_path());
         const auto& skipFiles = config.getSkipFiles();
@@ -9,11 +9,14 @@
 
 #include "TidyConfig.h"
 #include "TidyKind.h"
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
 #include "slang/text/SourceManager.h"
@@ -68,6 +71,15 @@ public:
 
     static const TidyConfig& getConfig() { return config(); }
 
+    /// Sets the files that every check may skip this run because a result
+    /// cache proved them unchanged and free of diagnostics. Consulted by
+    /// TidyVisitor::skip alongside the configured skip lists.
+    static void setCleanFiles(std::unordered_set<std::string> files) {
+        cleanFiles() = std::move(files);
+    }
+
+    static const std::unordered_set<std::string>& getCleanFiles() { return cleanFiles(); }
+
     static void setSourceManager(const slang::SourceManager* sm) { *sourceManager() = sm; }
     static slang::not_null<const slang::SourceManager*> getSourceManager() {
         if (auto sm = *sourceManager(); sm == nullptr)
@@ -91,6 +103,59 @@ private:
         static const slang::SourceManager* sm;
         return &sm;
     }
+
+    static std::unordered_set<std::string>& cleanFiles() {
+        static std::unordered_set<std::string> files;
+        return files;
+    }
+};
+
+/// @brief Wall-clock budget tracking for the check running on the current
+/// thread.
+///
+/// Each check runs start to finish on a single thread pool worker, so the
+/// state can be thread local: the runner calls @a start just before invoking
+/// the check and TidyVisitor::skip consults @a budgetExceeded on every symbol,
+/// bailing out of the remaining instances once the deadline passes. The
+/// expired flag is sticky so the runner can tell afterwards that the check
+/// only produced partial results.
+class CheckTimer {
+public:
+    /// Starts timing the check about to run on this thread. If @a budget is
+    /// empty there is no deadline and @a budgetExceeded always returns false.
+    static void start(std::optional<std::chrono::steady_clock::duration> budget) {
+        auto& s = state();
+        s.deadline.reset();
+        s.expired = false;
+        if (budget)
+            s.deadline = std::chrono::steady_clock::now() + *budget;
+    }
+
+    /// @return true if the check running on this thread has used up its
+    /// time budget and should skip any remaining work.
+    static bool budgetExceeded() {
+        auto& s = state();
+        if (!s.deadline)
+            return false;
+        if (!s.expired && std::chrono::steady_clock::now() > *s.deadline)
+            s.expired = true;
+        return s.expired;
+    }
+
+    /// @return true if the budget was exceeded at any point since the last
+    /// call to @a start on this thread.
+    static bool wasBudgetExceeded() { return state().expired; }
+
+private:
+    struct State {
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+        bool expired = false;
+    };
+
+    static State& state() {
+        static thread_local State s;
+        return s;
+    }
 };
 
 class TidyCheck {
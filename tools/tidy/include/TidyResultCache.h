@@ -0,0 +1,45 @@
+//------------------------------------------------------------------------------
+//! @file TidyResultCache.h
+//! @brief Per-file result cache for incremental slang-tidy runs
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+/// Persists which source files were both free of diagnostics from every
+/// enabled check and unchanged since the previous slang-tidy run, so that
+/// incremental runs can skip re-checking them. Entries are keyed by file
+/// name and a hash of the file's content; the whole cache is discarded if
+/// the fingerprint (enabled checks and configuration) differs from the one
+/// it was written with.
+class TidyResultCache {
+public:
+    /// Loads the cache from the given path. Returns false if the file does
+    /// not exist, cannot be parsed, or was written with a different
+    /// fingerprint; the cache is left empty in that case.
+    bool load(const std::filesystem::path& path, uint64_t fingerprint);
+
+    /// Returns true if the given file had the given content hash and was
+    /// clean for all checks when the cache was written.
+    bool isClean(std::string_view fileName, uint64_t contentHash) const;
+
+    /// Writes a new cache recording the given clean files. Returns false if
+    /// the file could not be written.
+    static bool write(const std::filesystem::path& path, uint64_t fingerprint,
+                      std::span<const std::pair<std::string, uint64_t>> cleanFiles);
+
+    /// Computes the stable content hash used for cache entries.
+    static uint64_t hashContent(std::string_view text);
+
+private:
+    std::unordered_map<std::string, uint64_t> entries;
+};
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "TidyResultCache.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <fmt/format.h>
+#include <fstream>
+
+static constexpr std::string_view header = "# slang-tidy cache v1";
+
+uint64_t TidyResultCache::hashContent(std::string_view text) {
+    // FNV-1a; the hash must be stable across processes since it's persisted,
+    // so don't use std::hash here.
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : text) {
+        hash ^= uint8_t(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+bool TidyResultCache::load(const std::filesystem::path& path, uint64_t fingerprint) {
+    entries.clear();
+
+    std::ifstream in(path);
+    if (!in)
+        return false;
+
+    std::string line;
+    if (!std::getline(in, line) || line != header)
+        return false;
+
+    if (!std::getline(in, line))
+        return false;
+
+    uint64_t storedFingerprint;
+    if (sscanf(line.c_str(), "fingerprint %" SCNx64, &storedFingerprint) != 1 ||
+        storedFingerprint != fingerprint) {
+        return false;
+    }
+
+    while (std::getline(in, line)) {
+        // Each entry is the content hash followed by the file name, which
+        // may itself contain spaces.
+        uint64_t hash;
+        int consumed = 0;
+        if (sscanf(line.c_str(), "%" SCNx64 " %n", &hash, &consumed) != 1 ||
+            size_t(consumed) >= line.size()) {
+            entries.clear();
+            return false;
+        }
+
+        entries.emplace(line.substr(size_t(consumed)), hash);
+    }
+
+    return true;
+}
+
+bool TidyResultCache::isClean(std::string_view fileName, uint64_t contentHash) const {
+    auto it = entries.find(std::string(fileName));
+    return it != entries.end() && it->second == contentHash;
+}
+
+bool TidyResultCache::write(const std::filesystem::path& path, uint64_t fingerprint,
+                            std::span<const std::pair<std::string, uint64_t>> cleanFiles) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out)
+        return false;
+
+    out << header << '\n';
+    out << fmt::format("fingerprint {:x}\n", fingerprint);
+    for (auto& [name, hash] : cleanFiles)
+        out << fmt::format("{:x} {}\n", hash, name);
+
+    out.flush();
+    return out.good();
+}
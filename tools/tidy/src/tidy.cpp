@@ -8,15 +8,54 @@
 
 #include "TidyConfigParser.h"
 #include "TidyFactory.h"
+#include "TidyResultCache.h"
 #include "fmt/color.h"
 #include "fmt/format.h"
 #include <filesystem>
+#include <fstream>
 #include <unordered_set>
 
 #include "slang/diagnostics/TextDiagnosticClient.h"
 #include "slang/driver/Driver.h"
+#include "slang/util/BumpAllocator.h"
+#include "slang/util/ThreadPool.h"
+#include "slang/util/TimeTrace.h"
 #include "slang/util/VersionInfo.h"
 
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <Windows.h>
+#else
+#    include <ctime>
+#endif
+
+/// Returns the CPU time consumed so far by the calling thread, in seconds,
+/// or zero if the platform doesn't expose it.
+static double getThreadCpuSeconds() {
+#if defined(_WIN32)
+    FILETIME creation, exit, kernel, user;
+    if (GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+        auto toSeconds = [](const FILETIME& ft) {
+            return double((uint64_t(ft.dwHighDateTime) << 32) | ft.dwLowDateTime) * 1e-7;
+        };
+        return toSeconds(kernel) + toSeconds(user);
+    }
+    return 0.0;
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        return double(ts.tv_sec) + double(ts.tv_nsec) * 1e-9;
+    return 0.0;
+#else
+    return 0.0;
+#endif
+}
+
 /// Performs a search for the .slang-tidy file on the current directory. If the file is not found,
 /// tries on the parent directory until the root.
 std::optional<std::filesystem::path> project_slang_tidy_config();
@@ -62,6 +101,31 @@ int main(int argc, char** argv) {
     std::optional<std::string> infoCode;
     driver.cmdLine.add("--code", infoCode, "print information about the error or warning.");
 
+    std::optional<std::string> cacheFileArg;
+    driver.cmdLine.add("--cache-file", cacheFileArg,
+                       "Enables incremental mode: files that were unchanged and free of "
+                       "diagnostics from every enabled check in the previous run are skipped. "
+                       "The cache is persisted at the given path.",
+                       "<file>");
+
+    std::optional<double> checkTimeBudget;
+    driver.cmdLine.add("--check-time-budget", checkTimeBudget,
+                       "Maximum wall-clock time, in seconds, that any single check may spend. "
+                       "A check that exceeds its budget skips its remaining instances and "
+                       "reports the partial results it gathered, marked as PARTIAL.",
+                       "<seconds>");
+
+    std::optional<bool> checkStats;
+    driver.cmdLine.add("--check-stats", checkStats,
+                       "Print per-check wall time, CPU time, and allocation statistics "
+                       "after the run");
+
+    std::optional<std::string> timeTrace;
+    driver.cmdLine.add("--time-trace", timeTrace,
+                       "Do performance profiling of the compilation and each tidy check and "
+                       "output the results to the given file in Chrome Event Tracing JSON format",
+                       "<path>");
+
     if (!driver.parseCommandLine(argc, argv))
         return 1;
 
@@ -140,6 +204,7 @@ int main(int argc, char** argv) {
 
     // Create the config class and populate it with the config file if provided
     TidyConfig tidyConfig;
+    std::optional<std::filesystem::path> usedConfigPath;
     if (tidyConfigFile) {
         if (!exists(std::filesystem::path(tidyConfigFile.value()))) {
             if (!superQuiet)
@@ -149,11 +214,12 @@ int main(int argc, char** argv) {
             return 1;
         }
         else {
-            tidyConfig =
-                TidyConfigParser(std::filesystem::path(tidyConfigFile.value())).getConfig();
+            usedConfigPath = std::filesystem::path(tidyConfigFile.value());
+            tidyConfig = TidyConfigParser(*usedConfigPath).getConfig();
         }
     }
     else if (auto path = project_slang_tidy_config()) {
+        usedConfigPath = path;
         tidyConfig = TidyConfigParser(path.value()).getConfig();
     }
 
@@ -166,6 +232,9 @@ int main(int argc, char** argv) {
     if (!driver.processOptions())
         return 1;
 
+    if (timeTrace)
+        TimeTrace::initialize();
+
     std::unique_ptr<ast::Compilation> compilation;
     bool compilationOk;
     SLANG_TRY {
@@ -190,21 +259,129 @@ int main(int argc, char** argv) {
     // Set the sourceManager to the Registry so checks can access it
     Registry::setSourceManager(compilation->getSourceManager());
 
+    // Incremental mode: load the result cache and mark every file that is
+    // unchanged and was clean for all enabled checks in the previous run, so
+    // the checks skip the symbols inside it. This assumes a file's results
+    // only depend on its own content; a diagnostic that appears in one file
+    // because of an edit in another (e.g. through parameterization) can be
+    // missed until the file itself changes, which is the tradeoff that makes
+    // pre-commit runs fast.
+    std::vector<std::pair<std::string, uint64_t>> fileHashes;
+    uint64_t cacheFingerprint = 0;
+    if (cacheFileArg) {
+        // The cache is only valid for the set of checks and the config it
+        // was written with.
+        auto enabledChecks = Registry::getEnabledChecks();
+        std::sort(enabledChecks.begin(), enabledChecks.end());
+        std::string fingerprintText;
+        for (const auto& checkName : enabledChecks) {
+            fingerprintText += checkName;
+            fingerprintText += ',';
+        }
+        if (usedConfigPath) {
+            SmallVector<char> configText;
+            if (!OS::readFile(*usedConfigPath, configText))
+                fingerprintText.append(configText.data(), configText.size());
+        }
+        cacheFingerprint = TidyResultCache::hashContent(fingerprintText);
+
+        auto sm = compilation->getSourceManager();
+        for (auto buffer : sm->getAllBuffers()) {
+            if (sm->isMacroLoc(SourceLocation(buffer, 0)))
+                continue;
+
+            auto fileName = sm->getFileName(SourceLocation(buffer, 0));
+            fileHashes.emplace_back(std::string(fileName),
+                                    TidyResultCache::hashContent(sm->getSourceText(buffer)));
+        }
+
+        TidyResultCache cache;
+        if (cache.load(*cacheFileArg, cacheFingerprint)) {
+            std::unordered_set<std::string> cleanFiles;
+            for (const auto& [fileName, hash] : fileHashes) {
+                if (cache.isClean(fileName, hash))
+                    cleanFiles.insert(fileName);
+            }
+            Registry::setCleanFiles(std::move(cleanFiles));
+        }
+    }
+
     int retCode = 0;
 
-    // Check all enabled checks
+    // Run all enabled checks concurrently. Each check is an independent
+    // visitor that accumulates its own diagnostics; the only shared state is
+    // the AST itself, which is fully elaborated by this point and only read.
+    struct CheckRun {
+        bool passed;
+        bool partial;
+        double wallTime;
+        double cpuTime;
+        uint64_t allocBytes;
+    };
+
+    struct CheckResult {
+        std::unique_ptr<TidyCheck> check;
+        std::future<CheckRun> run;
+    };
+
+    std::optional<std::chrono::steady_clock::duration> budget;
+    if (checkTimeBudget) {
+        budget = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(*checkTimeBudget));
+    }
+
+    auto& root = compilation->getRoot();
+    std::vector<CheckResult> results;
+    ThreadPool threadPool(driver.options.numThreads.value_or(0u));
+
     for (const auto& checkName : Registry::getEnabledChecks()) {
+        auto check = Registry::create(checkName);
+        driver.diagEngine.setMessage(check->diagCode(), check->diagMessage());
+        driver.diagEngine.setSeverity(check->diagCode(), check->diagSeverity());
+
+        auto future = threadPool.submit([checkPtr = check.get(), &root, budget]() -> CheckRun {
+            TimeTraceScope timeScope("tidyCheck", checkPtr->name());
+            CheckTimer::start(budget);
+
+            // Note that the allocation counter is process-wide, so when
+            // checks run concurrently this attributes bytes to whichever
+            // checks were in flight; it still points at the hungry check.
+            auto allocStart = BumpAllocator::totalBytesAllocated();
+            auto cpuStart = getThreadCpuSeconds();
+            auto wallStart = std::chrono::steady_clock::now();
+
+            bool passed = checkPtr->check(root);
+
+            CheckRun run;
+            run.passed = passed;
+            run.partial = CheckTimer::wasBudgetExceeded();
+            run.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                         wallStart)
+                               .count();
+            run.cpuTime = getThreadCpuSeconds() - cpuStart;
+            run.allocBytes = BumpAllocator::totalBytesAllocated() - allocStart;
+            return run;
+        });
+        results.push_back({std::move(check), std::move(future)});
+    }
+
+    // Report the results in the order the checks were launched so that the
+    // output is deterministic regardless of how the runs interleave.
+    bool anyPartial = false;
+    std::vector<std::pair<std::string, CheckRun>> checkRuns;
+    for (auto& result : results) {
         driver.diagClient->clear();
 
-        const auto check = Registry::create(checkName);
+        const auto& check = result.check;
+
+        auto run = result.run.get();
+        auto checkOk = run.passed;
+        anyPartial |= run.partial;
+        checkRuns.emplace_back(check->name(), run);
 
         if (!quiet)
             OS::print(fmt::format("[{}]", check->name()));
 
-        driver.diagEngine.setMessage(check->diagCode(), check->diagMessage());
-        driver.diagEngine.setSeverity(check->diagCode(), check->diagSeverity());
-
-        auto checkOk = check->check(compilation->getRoot());
         if (!checkOk) {
             retCode = 1;
 
@@ -225,18 +402,74 @@ int main(int argc, char** argv) {
             }
 
             if (!superQuiet) {
+                if (run.partial) {
+                    OS::print(fmt::format("note: [{}] exceeded its time budget; remaining "
+                                          "instances were skipped and the results above are "
+                                          "partial\n",
+                                          check->name()));
+                }
                 for (const auto& diag : check->getDiagnostics()) {
                     driver.diagEngine.issue(diag);
                 }
                 OS::print(fmt::format("{}\n", driver.diagClient->getString()));
             }
         }
+        else if (run.partial) {
+            // The check ran out of budget before finding anything; it can't
+            // claim a clean pass since it didn't look at everything.
+            if (!quiet)
+                OS::print(fmt::emphasis::bold | fmt::fg(fmt::color::yellow), " PARTIAL\n");
+        }
         else {
             if (!quiet)
                 OS::print(fmt::emphasis::bold | fmt::fg(fmt::color::green), " PASS\n");
         }
     }
 
+    if (checkStats == true && !superQuiet) {
+        std::sort(checkRuns.begin(), checkRuns.end(),
+                  [](auto& a, auto& b) { return a.second.wallTime > b.second.wallTime; });
+
+        OS::print("\nCheck statistics:\n");
+        OS::print(fmt::format("    {:<40}{:>12}{:>12}{:>14}\n", "Check", "Wall (ms)", "CPU (ms)",
+                              "Alloc (KB)"));
+        for (const auto& [name, run] : checkRuns) {
+            OS::print(fmt::format("    {:<40}{:>12.2f}{:>12.2f}{:>14}{}\n", name,
+                                  run.wallTime * 1000.0, run.cpuTime * 1000.0,
+                                  run.allocBytes / 1024, run.partial ? "  (partial)" : ""));
+        }
+    }
+
+    // Refresh the cache for the next run. A file is clean if no enabled
+    // check reported a diagnostic in it this run; files skipped via the
+    // cache produced no diagnostics and so stay clean. If any check was cut
+    // short by its time budget we can't know which files it never looked at,
+    // so leave the cache alone rather than record them as clean.
+    if (cacheFileArg && !anyPartial) {
+        auto sm = compilation->getSourceManager();
+        std::unordered_set<std::string> dirtyFiles;
+        for (const auto& result : results) {
+            for (const auto& diag : result.check->getDiagnostics())
+                dirtyFiles.insert(std::string(sm->getFileName(diag.location)));
+        }
+
+        std::vector<std::pair<std::string, uint64_t>> cleanFiles;
+        for (const auto& entry : fileHashes) {
+            if (!dirtyFiles.count(entry.first))
+                cleanFiles.push_back(entry);
+        }
+
+        if (!TidyResultCache::write(*cacheFileArg, cacheFingerprint, cleanFiles))
+            OS::printE(fmt::format("slang-tidy: unable to write cache file {}\n", *cacheFileArg));
+    }
+
+    if (timeTrace) {
+        std::ofstream file(*timeTrace);
+        TimeTrace::write(file);
+        if (!file.flush())
+            OS::printE(fmt::format("slang-tidy: unable to write time trace to '{}'\n", *timeTrace));
+    }
+
     return retCode;
 }
 
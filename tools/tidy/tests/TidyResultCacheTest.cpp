@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "Test.h"
+#include "TidyResultCache.h"
+
+TEST_CASE("TidyResultCache: round trip") {
+    auto path = std::filesystem::temp_directory_path() / "slang_tidy_cache_test";
+
+    std::vector<std::pair<std::string, uint64_t>> cleanFiles = {
+        {"top.sv", TidyResultCache::hashContent("module top; endmodule")},
+        {"dir with spaces/leaf.sv", TidyResultCache::hashContent("module leaf; endmodule")}};
+
+    CHECK(TidyResultCache::write(path, 0x1234, cleanFiles));
+
+    TidyResultCache cache;
+    CHECK(cache.load(path, 0x1234));
+    CHECK(cache.isClean("top.sv", cleanFiles[0].second));
+    CHECK(cache.isClean("dir with spaces/leaf.sv", cleanFiles[1].second));
+
+    // Changed content or an unknown file is not clean.
+    CHECK_FALSE(cache.isClean("top.sv", TidyResultCache::hashContent("module top2; endmodule")));
+    CHECK_FALSE(cache.isClean("other.sv", cleanFiles[0].second));
+}
+
+TEST_CASE("TidyResultCache: fingerprint mismatch discards cache") {
+    auto path = std::filesystem::temp_directory_path() / "slang_tidy_cache_test";
+
+    std::vector<std::pair<std::string, uint64_t>> cleanFiles = {
+        {"top.sv", TidyResultCache::hashContent("module top; endmodule")}};
+    CHECK(TidyResultCache::write(path, 0x1234, cleanFiles));
+
+    TidyResultCache cache;
+    CHECK_FALSE(cache.load(path, 0x5678));
+    CHECK_FALSE(cache.isClean("top.sv", cleanFiles[0].second));
+}
+
+TEST_CASE("TidyResultCache: missing file") {
+    TidyResultCache cache;
+    CHECK_FALSE(cache.load(std::filesystem::temp_directory_path() / "slang_tidy_cache_missing",
+                           0x1234));
+}